@@ -430,6 +430,72 @@ extern DECLSPEC SDL_AudioSpec *SDLCALL SDL_LoadWAV_RW(SDL_RWops * src,
  */
 extern DECLSPEC void SDLCALL SDL_FreeWAV(Uint8 * audio_buf);
 
+/**
+ *  \name WAVE streams
+ *
+ *  These read a WAVE a piece at a time, for playing files too long to
+ *  load with SDL_LoadWAV_RW(), for example by feeding SDL_QueueAudio().
+ *  Positions and lengths are in sample frames, one sample per channel.
+ */
+/* @{ */
+typedef struct SDL_WAVStream SDL_WAVStream;
+
+/**
+ *  This function reads the headers of a WAVE from the data source and
+ *  fills \c spec the way SDL_LoadWAV_RW() does, but leaves the audio data
+ *  to be decoded by SDL_ReadWAVStream() as it's needed. The source is
+ *  freed with the stream if \c freesrc is non-zero.
+ *
+ *  \return A new stream, or NULL if the headers couldn't be read, in which
+ *          case the source is freed if \c freesrc is non-zero.
+ */
+extern DECLSPEC SDL_WAVStream *SDLCALL SDL_OpenWAVStream_RW(SDL_RWops * src,
+                                                            int freesrc,
+                                                            SDL_AudioSpec * spec);
+
+/**
+ *  Opens a WAV file as a stream.
+ */
+#define SDL_OpenWAVStream(file, spec) \
+    SDL_OpenWAVStream_RW(SDL_RWFromFile(file, "rb"),1, spec)
+
+/**
+ *  This function decodes as many whole sample frames as fit in \c len
+ *  bytes into \c buf, in the format given by SDL_OpenWAVStream_RW().
+ *
+ *  \return The number of bytes decoded, 0 at the end of the data, or -1 on
+ *          error.
+ */
+extern DECLSPEC int SDLCALL SDL_ReadWAVStream(SDL_WAVStream * stream,
+                                              void *buf, int len);
+
+/**
+ *  This function makes the next SDL_ReadWAVStream() start at \c frame.
+ *  The data source has to be seekable.
+ *
+ *  \return 0 on success, or -1 on error.
+ */
+extern DECLSPEC int SDLCALL SDL_SeekWAVStream(SDL_WAVStream * stream,
+                                              Uint32 frame);
+
+/**
+ *  This function returns the sample frame the next SDL_ReadWAVStream()
+ *  starts at.
+ */
+extern DECLSPEC Uint32 SDLCALL SDL_TellWAVStream(SDL_WAVStream * stream);
+
+/**
+ *  This function returns the number of sample frames in the stream.
+ */
+extern DECLSPEC Uint32 SDLCALL SDL_GetWAVStreamLength(SDL_WAVStream * stream);
+
+/**
+ *  This function frees a stream, and its data source if it was opened with
+ *  \c freesrc set, otherwise leaving the source at the end of the WAVE.
+ */
+extern DECLSPEC void SDLCALL SDL_CloseWAVStream(SDL_WAVStream * stream);
+/* @} *//* WAVE streams */
+
 /**
  *  This function takes a source format and rate and a destination format
  *  and rate, and initializes the \c cvt structure with information needed
@@ -459,6 +525,136 @@ extern DECLSPEC int SDLCALL SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
  */
 extern DECLSPEC int SDLCALL SDL_ConvertAudio(SDL_AudioCVT * cvt);
 
+/* SDL_AudioStream is a new audio conversion interface.
+   The benefits vs SDL_AudioCVT:
+    - it can handle resampling data in chunks without generating
+      artifacts, when it doesn't have the complete buffer available.
+    - it can handle incoming data in any variable size.
+    - You push data as you have it, and pull it when you need it
+ */
+/* this is opaque to the outside world. */
+struct _SDL_AudioStream;
+typedef struct _SDL_AudioStream SDL_AudioStream;
+
+/**
+ *  Create a new audio stream
+ *
+ *  \param src_format The format of the source audio
+ *  \param src_channels The number of channels of the source audio
+ *  \param src_rate The sampling rate of the source audio
+ *  \param dst_format The format of the desired audio output
+ *  \param dst_channels The number of channels of the desired audio output
+ *  \param dst_rate The sampling rate of the desired audio output
+ *  \return The new stream, or NULL on error.
+ *
+ *  \sa SDL_AudioStreamPut
+ *  \sa SDL_AudioStreamGet
+ *  \sa SDL_AudioStreamAvailable
+ *  \sa SDL_AudioStreamFlush
+ *  \sa SDL_AudioStreamClear
+ *  \sa SDL_FreeAudioStream
+ */
+extern DECLSPEC SDL_AudioStream * SDLCALL SDL_NewAudioStream(const SDL_AudioFormat src_format,
+                                           const Uint8 src_channels,
+                                           const int src_rate,
+                                           const SDL_AudioFormat dst_format,
+                                           const Uint8 dst_channels,
+                                           const int dst_rate);
+
+/**
+ *  Add data to be converted/resampled to the stream
+ *
+ *  \param stream The stream the audio data is being added to
+ *  \param buf A pointer to the audio data to add
+ *  \param len The number of bytes to write to the stream
+ *  \return 0 on success, or -1 on error.
+ *
+ *  The data doesn't have to be a whole number of sample frames; a partial
+ *  frame is held until the rest of it arrives.
+ *
+ *  \sa SDL_NewAudioStream
+ *  \sa SDL_AudioStreamGet
+ *  \sa SDL_AudioStreamAvailable
+ *  \sa SDL_AudioStreamFlush
+ *  \sa SDL_AudioStreamClear
+ *  \sa SDL_FreeAudioStream
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamPut(SDL_AudioStream *stream, const void *buf, int len);
+
+/**
+ *  Get converted/resampled data from the stream
+ *
+ *  \param stream The stream the audio is being requested from
+ *  \param buf A buffer to fill with audio data
+ *  \param len The maximum number of bytes to fill, a multiple of the
+ *              output sample frame size
+ *  \return The number of bytes read from the stream, or -1 on error
+ *
+ *  \sa SDL_NewAudioStream
+ *  \sa SDL_AudioStreamPut
+ *  \sa SDL_AudioStreamAvailable
+ *  \sa SDL_AudioStreamFlush
+ *  \sa SDL_AudioStreamClear
+ *  \sa SDL_FreeAudioStream
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamGet(SDL_AudioStream *stream, void *buf, int len);
+
+/**
+ *  Get the number of converted/resampled bytes available. The stream may be
+ *  buffering data behind the scenes until it has enough to resample
+ *  correctly, so this number might be lower than what you expect, or even
+ *  be zero. Add more data or flush the stream if you need the data now.
+ *
+ *  \sa SDL_NewAudioStream
+ *  \sa SDL_AudioStreamPut
+ *  \sa SDL_AudioStreamGet
+ *  \sa SDL_AudioStreamFlush
+ *  \sa SDL_AudioStreamClear
+ *  \sa SDL_FreeAudioStream
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamAvailable(SDL_AudioStream *stream);
+
+/**
+ *  Tell the stream that you're done sending data, and anything being
+ *  buffered should be converted/resampled and made available immediately.
+ *
+ *  It is legal to add more data to a stream after flushing, but there will
+ *  be audio gaps in the output. Generally this is intended to signal the
+ *  end of input, so the complete output becomes available.
+ *
+ *  \sa SDL_NewAudioStream
+ *  \sa SDL_AudioStreamPut
+ *  \sa SDL_AudioStreamGet
+ *  \sa SDL_AudioStreamAvailable
+ *  \sa SDL_AudioStreamClear
+ *  \sa SDL_FreeAudioStream
+ */
+extern DECLSPEC int SDLCALL SDL_AudioStreamFlush(SDL_AudioStream *stream);
+
+/**
+ *  Clear any pending data in the stream without converting it
+ *
+ *  \sa SDL_NewAudioStream
+ *  \sa SDL_AudioStreamPut
+ *  \sa SDL_AudioStreamGet
+ *  \sa SDL_AudioStreamAvailable
+ *  \sa SDL_AudioStreamFlush
+ *  \sa SDL_FreeAudioStream
+ */
+extern DECLSPEC void SDLCALL SDL_AudioStreamClear(SDL_AudioStream *stream);
+
+/**
+ *  Free an audio stream
+ *
+ *  \sa SDL_NewAudioStream
+ *  \sa SDL_AudioStreamPut
+ *  \sa SDL_AudioStreamGet
+ *  \sa SDL_AudioStreamAvailable
+ *  \sa SDL_AudioStreamFlush
+ *  \sa SDL_AudioStreamClear
+ */
+extern DECLSPEC void SDLCALL SDL_FreeAudioStream(SDL_AudioStream *stream);
+
 #define SDL_MIX_MAXVOLUME 128
 /**
  *  This takes two audio buffers of the playing audio format and mixes
@@ -480,6 +676,29 @@ extern DECLSPEC void SDLCALL SDL_MixAudioFormat(Uint8 * dst,
                                                 SDL_AudioFormat format,
                                                 Uint32 len, int volume);
 
+/**
+ *  This mixes several source buffers into \c dst in one pass, as if
+ *  SDL_MixAudioFormat() was called for each of them with the matching entry
+ *  of \c volume.
+ *
+ *  For AUDIO_S16SYS and AUDIO_F32SYS the sources are summed at a higher
+ *  precision and the result is only clipped once, so it can differ from
+ *  mixing one source at a time when a partial sum would have clipped.
+ *
+ *  \param dst     The buffer to mix into, also one of the inputs
+ *  \param src     An array of \c num_src buffers of \c len bytes each
+ *  \param format  The audio format of all the buffers
+ *  \param len     The length of each buffer in bytes
+ *  \param volume  An array of \c num_src volumes, from 0 to ::SDL_MIX_MAXVOLUME
+ *  \param num_src The number of source buffers
+ */
+extern DECLSPEC void SDLCALL SDL_MixAudioFormatMulti(Uint8 * dst,
+                                                     const Uint8 ** src,
+                                                     SDL_AudioFormat format,
+                                                     Uint32 len,
+                                                     const int *volume,
+                                                     int num_src);
+
 /**
  *  Queue more audio on non-callback devices.
  *
@@ -534,10 +753,10 @@ extern DECLSPEC int SDLCALL SDL_QueueAudio(SDL_AudioDeviceID dev, const void *da
  *  callback, and then SDL will expect you to retrieve data at regular
  *  intervals (pull method) with this function.
  *
- *  There are no limits on the amount of data you can queue, short of
- *  exhaustion of address space. Data from the device will keep queuing as
- *  necessary without further intervention from you. This means you will
- *  eventually run out of memory if you aren't routinely dequeueing data.
+ *  Data from the device will keep queuing without further intervention
+ *  from you, into a queue that holds at least a second of audio. If you
+ *  aren't routinely dequeueing data, whatever doesn't fit is dropped;
+ *  SDL_GetQueuedAudioStats() reports how much.
  *
  *  Capture devices will not queue data when paused; if you are expecting
  *  to not need captured audio for some length of time, use
@@ -639,6 +858,45 @@ extern DECLSPEC Uint32 SDLCALL SDL_GetQueuedAudioSize(SDL_AudioDeviceID dev);
  */
 extern DECLSPEC void SDLCALL SDL_ClearQueuedAudio(SDL_AudioDeviceID dev);
 
+/**
+ *  Statistics about the audio queue of a non-callback device.
+ *
+ *  \sa SDL_GetQueuedAudioStats
+ */
+typedef struct SDL_AudioQueueStats
+{
+    Uint32 queued_bytes;        /**< Bytes currently waiting in the queue */
+    Uint32 max_queued_bytes;    /**< The most bytes that were ever waiting at once */
+    Uint32 capacity;            /**< Bytes the queue can hold before it has to grow */
+    Uint32 underruns;           /**< Times a playback device needed more audio than was queued */
+    Uint32 dropped_bytes;       /**< Bytes lost because they didn't fit in the queue */
+} SDL_AudioQueueStats;
+
+/**
+ *  Get statistics about the audio queue of a device that uses
+ *  SDL_QueueAudio() or SDL_DequeueAudio().
+ *
+ *  Playback devices count an underrun every time the device needed more
+ *  queued audio than was available and had to play silence instead. This
+ *  includes the queue being completely empty, so count the underruns while
+ *  you expect to be keeping the device busy. The counters keep running
+ *  until the device is closed; SDL_ClearQueuedAudio() doesn't reset them.
+ *
+ *  Playback queues grow to fit whatever you queue. Capture queues have a
+ *  fixed capacity of at least a second of audio, so the audio thread never
+ *  has to allocate; captured audio that doesn't fit because you haven't
+ *  dequeued in time is dropped and counted in dropped_bytes.
+ *
+ *  \param dev The device ID of which to query the audio queue.
+ *  \param stats Filled in with the current statistics.
+ *  \return zero on success, -1 on error.
+ *
+ *  \sa SDL_QueueAudio
+ *  \sa SDL_DequeueAudio
+ *  \sa SDL_GetQueuedAudioSize
+ */
+extern DECLSPEC int SDLCALL SDL_GetQueuedAudioStats(SDL_AudioDeviceID dev, SDL_AudioQueueStats *stats);
+
 
 /**
  *  \name Audio lock functions
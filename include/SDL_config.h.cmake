@@ -167,6 +167,9 @@
 #cmakedefine HAVE_CLOCK_GETTIME 1
 #cmakedefine HAVE_GETPAGESIZE 1
 #cmakedefine HAVE_MPROTECT 1
+#cmakedefine HAVE_MMAP 1
+#cmakedefine HAVE_PREAD 1
+#cmakedefine HAVE_PREAD64 1
 #cmakedefine HAVE_ICONV 1
 #cmakedefine HAVE_PTHREAD_SETNAME_NP 1
 #cmakedefine HAVE_PTHREAD_SET_NAME_NP 1
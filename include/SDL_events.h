@@ -628,6 +628,23 @@ extern DECLSPEC void SDLCALL SDL_FlushEvents(Uint32 minType, Uint32 maxType);
  */
 extern DECLSPEC int SDLCALL SDL_PollEvent(SDL_Event * event);
 
+/**
+ *  \brief Polls for several currently pending events at once.
+ *
+ *  This pumps the event loop once and then removes up to \c numevents
+ *  events from the queue while holding the queue lock a single time,
+ *  which is cheaper than calling SDL_PollEvent() once per event.
+ *
+ *  \return The number of events stored in \c events, or -1 on error.
+ *
+ *  \param events An array of at least \c numevents events to fill.
+ *  \param numevents The maximum number of events to retrieve.
+ *
+ *  \sa SDL_PollEvent()
+ *  \sa SDL_HINT_EVENT_COALESCE_MOTION
+ */
+extern DECLSPEC int SDLCALL SDL_PollEvents(SDL_Event * events, int numevents);
+
 /**
  *  \brief Waits indefinitely for the next available event.
  *
@@ -123,8 +123,9 @@ extern "C" {
  *
  *  This variable can be set to the following values:
  *    "0" or "nearest" - Nearest pixel sampling
- *    "1" or "linear"  - Linear filtering (supported by OpenGL and Direct3D)
- *    "2" or "best"    - Currently this is the same as "linear"
+ *    "1" or "linear"  - Linear filtering (supported by OpenGL, Direct3D and the software renderer)
+ *    "2" or "best"    - Currently this is the same as "linear", except that the
+ *                       software renderer averages pixels when shrinking
  *
  *  By default nearest pixel sampling is used
  */
@@ -141,6 +142,75 @@ extern "C" {
  */
 #define SDL_HINT_RENDER_VSYNC               "SDL_RENDER_VSYNC"
 
+/**
+ *  \brief  A variable controlling how many threads the software renderer draws with.
+ *
+ *  When this is more than 1, software renderers record their drawing until
+ *  SDL_RenderPresent() or SDL_RenderReadPixels(), then draw it all at once
+ *  with this many threads, each one working on a different band of rows.
+ *  The threads are shared with SDL_HINT_SURFACE_THREADS.
+ *  The output is the same as drawing on the calling thread.
+ *
+ *  This variable can be set to the following values:
+ *    "0" or "1" - Draw immediately on the calling thread
+ *    "N"        - Draw with N threads
+ *
+ *  The variable is checked when the renderer is created. By default the
+ *  software renderer draws immediately on the calling thread.
+ */
+#define SDL_HINT_RENDER_SOFTWARE_THREADS    "SDL_RENDER_SOFTWARE_THREADS"
+
+/**
+ *  \brief  A variable controlling whether the 2D render API batches drawing commands.
+ *
+ *  When batching is enabled, drawing calls are collected and handed to the
+ *  render driver together, merging runs of calls that use the same texture,
+ *  color and blend mode. They are drawn at SDL_RenderPresent(),
+ *  SDL_RenderReadPixels() or SDL_RenderFlush(), or when the render state they
+ *  depend on changes. Applications that mix their own OpenGL or Direct3D
+ *  calls with the render API, or that read a software renderer's surface
+ *  directly, should call SDL_RenderFlush() first.
+ *
+ *  This variable can be set to the following values:
+ *    "0"       - Draw each call immediately
+ *    "1"       - Batch drawing calls when the render driver supports it
+ *
+ *  The variable is checked when the renderer is created. By default batching
+ *  is used unless SDL_HINT_RENDER_DRIVER selects a specific driver, or the
+ *  renderer was created with SDL_CreateSoftwareRenderer().
+ */
+#define SDL_HINT_RENDER_BATCHING            "SDL_RENDER_BATCHING"
+
+/**
+ *  \brief  A variable controlling the colorspace used when YUV textures are converted to RGB in software.
+ *
+ *  This variable can be set to the following values:
+ *    "JPEG"    - Full range BT.601
+ *    "BT601"   - BT.601, with luma in the 16-235 video range
+ *    "BT709"   - BT.709, with luma in the 16-235 video range
+ *
+ *  The variable is checked when a YUV texture is created. By default "JPEG" is used.
+ */
+#define SDL_HINT_YUV_CONVERSION_MODE        "SDL_YUV_CONVERSION_MODE"
+
+/**
+ *  \brief  A variable controlling how many threads large surface operations are split across.
+ *
+ *  When this is more than 1, SDL_FillRect() and SDL_FillRects() on large
+ *  areas, and SDL_ConvertSurface() and SDL_ConvertPixels() on large images,
+ *  are split into bands of rows, which are worked on by a pool of this
+ *  many threads, counting the calling thread. The output is the same as
+ *  working on the calling thread.
+ *
+ *  This variable can be set to the following values:
+ *    "0" or "1" - Work on the calling thread
+ *    "N"        - Work with N threads
+ *
+ *  The variable is checked on each call. By default everything happens on
+ *  the calling thread.
+ */
+#define SDL_HINT_SURFACE_THREADS            "SDL_SURFACE_THREADS"
+
 /**
  *  \brief  A variable controlling whether the screensaver is enabled. 
  *
@@ -707,6 +777,83 @@ extern "C" {
  */
 #define SDL_HINT_RPI_VIDEO_LAYER           "SDL_RPI_VIDEO_LAYER"
 
+/**
+ * \brief Tell SDL to use a lock-free ring for pushing events onto the event queue.
+ *
+ * With this enabled, threads calling SDL_PushEvent() don't contend on the
+ * event queue lock with the thread retrieving events, unless the ring fills up.
+ * This hint is checked when the events subsystem is initialized.
+ *
+ * The ring only pays off when several threads push events at once and there
+ * are enough CPU cores to run them alongside the thread retrieving events.
+ * Every event is copied onto the ring and then onto the event list, so with
+ * a single producer, or with more threads than cores, the locked list is as
+ * fast or faster.  test/testeventqueue measures both on a given machine.
+ *
+ * The variable can be set to the following values:
+ *   "0"       - All event queue operations take the event queue lock. (default)
+ *   "1"       - Events are pushed onto a lock-free ring first.
+ */
+#define SDL_HINT_EVENT_QUEUE_LOCKFREE      "SDL_EVENT_QUEUE_LOCKFREE"
+
+/**
+ * \brief Tell SDL to merge consecutive motion events as they are queued.
+ *
+ * Consecutive SDL_MOUSEMOTION events from the same mouse and window with the
+ * same button state, and consecutive SDL_FINGERMOTION events from the same
+ * finger, are combined into one event with the latest position and the
+ * summed relative motion.  This keeps high-rate mice and touch panels from
+ * flooding the event queue.
+ *
+ * The variable can be set to the following values:
+ *   "0"       - Every motion event is queued separately. (default)
+ *   "1"       - Consecutive motion events are merged.
+ */
+#define SDL_HINT_EVENT_COALESCE_MOTION     "SDL_EVENT_COALESCE_MOTION"
+
+/**
+ * \brief Tell SDL whether to use vectorized sample format converters.
+ *
+ * SSE2, AVX2 and NEON converters are available between the native endian
+ * S16, S32, U8 and F32 formats, and are used when the CPU supports them.
+ * This hint is checked when an SDL_AudioCVT or SDL_AudioStream is built.
+ *
+ * The variable can be set to the following values:
+ *   "0"       - Always use the portable C converters.
+ *   "1"       - Use the best vectorized converters available. (default)
+ *   "sse2", "avx2" or "neon" - Use only those converters, if the CPU
+ *               supports them, for testing and benchmarking.
+ */
+#define SDL_HINT_AUDIO_SIMD_CONVERTERS     "SDL_AUDIO_SIMD_CONVERTERS"
+
+/**
+ * \brief Tell SDL whether to memory-map files opened for reading.
+ *
+ * When enabled, SDL_RWFromFile() maps files opened with mode "r" or "rb"
+ * into memory where the platform supports it, and reads are copied straight
+ * from the mapping. The data can then also be used in place with
+ * SDL_RWGetView(). If the file can't be mapped, it is read normally.
+ *
+ * A mapped file must not be truncated while it is open, or reading it may
+ * crash the program.
+ *
+ * The variable can be set to the following values:
+ *   "0"       - Read files through stdio. (default)
+ *   "1"       - Map files opened for reading into memory.
+ */
+#define SDL_HINT_RWOPS_MMAP                "SDL_RWOPS_MMAP"
+
+/**
+ * \brief The number of threads SDL_RWreadAsync() reads on.
+ *
+ * Reads that wait on the disk or network leave the CPU free, so this can
+ * usefully be more than the number of CPUs. The hint is checked when the
+ * first asynchronous read is started.
+ *
+ * The default value is "4".
+ */
+#define SDL_HINT_ASYNCIO_THREADS           "SDL_ASYNCIO_THREADS"
+
 /**
  *  \brief  An enumeration of hint priorities
  */
@@ -67,6 +67,28 @@ typedef struct SDL_Rect
     int w, h;
 } SDL_Rect;
 
+/**
+ *  \brief  A point with floating point coordinates, for sub-pixel positioning
+ *          with the 2D render API.
+ */
+typedef struct SDL_FPoint
+{
+    float x;
+    float y;
+} SDL_FPoint;
+
+/**
+ *  \brief A rectangle with floating point coordinates, with the origin at the
+ *         upper left.
+ */
+typedef struct SDL_FRect
+{
+    float x;
+    float y;
+    float w;
+    float h;
+} SDL_FRect;
+
 /**
  *  \brief Returns true if point resides inside a rectangle.
  */
@@ -45,6 +45,8 @@ extern "C" {
 #define SDL_RWOPS_JNIFILE   3U  /* Android asset */
 #define SDL_RWOPS_MEMORY    4U  /* Memory stream */
 #define SDL_RWOPS_MEMORY_RO 5U  /* Read-Only memory stream */
+#define SDL_RWOPS_MAPFILE   6U  /* Read-Only memory-mapped file */
+#define SDL_RWOPS_BUFFERED  7U  /* Buffer on top of another stream */
 
 /**
  * This is the read/write operation structure -- very basic.
@@ -165,12 +167,131 @@ extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromMem(void *mem, int size);
 extern DECLSPEC SDL_RWops *SDLCALL SDL_RWFromConstMem(const void *mem,
                                                       int size);
 
+/**
+ *  \brief Create a stream that buffers reads from and writes to another one.
+ *
+ *  Reads fetch \c buffer_size bytes from \c context at a time, and writes
+ *  are collected until the buffer is full, so reading or writing a few bytes
+ *  at a time, as SDL_ReadLE32() and friends do, is cheap whatever the stream.
+ *  Reads and writes bigger than the buffer go straight to \c context.
+ *
+ *  \c context shouldn't be used directly while the buffered stream is
+ *  open, except after SDL_FlushBufferedRW().
+ *
+ *  \param context     The stream to buffer.
+ *  \param buffer_size The size of the buffer in bytes, or 0 for the default.
+ *  \param autoclose   Whether closing the buffered stream closes \c context.
+ *
+ *  \return The buffered stream, or NULL on error.
+ */
+extern DECLSPEC SDL_RWops *SDLCALL SDL_CreateBufferedRW(SDL_RWops * context,
+                                                        size_t buffer_size,
+                                                        SDL_bool autoclose);
+
+/**
+ *  \brief Write out anything a buffered stream is holding, and move the
+ *         stream it's on top of to the buffered stream's position.
+ *
+ *  \return 0 on success, or -1 if the data couldn't be written or the
+ *          stream couldn't be seeked.
+ */
+extern DECLSPEC int SDLCALL SDL_FlushBufferedRW(SDL_RWops * context);
+
 /* @} *//* RWFrom functions */
 
 
 extern DECLSPEC SDL_RWops *SDLCALL SDL_AllocRW(void);
 extern DECLSPEC void SDLCALL SDL_FreeRW(SDL_RWops * area);
 
+/**
+ *  \brief Get the data at the current position of a stream that is in memory.
+ *
+ *  This works for streams created with SDL_RWFromMem(), SDL_RWFromConstMem()
+ *  and files that SDL_RWFromFile() mapped into memory (see
+ *  ::SDL_HINT_RWOPS_MMAP), and lets the data be used without copying it.
+ *  The data must not be modified, and is only valid until the stream is
+ *  closed. The stream position doesn't change; seek past the data used.
+ *
+ *  \param context The stream to look at.
+ *  \param size    Filled in with the number of bytes from the current
+ *                 position to the end of the stream.
+ *
+ *  \return A pointer to the data at the current position, or NULL if the
+ *          stream isn't in memory.
+ */
+extern DECLSPEC const void *SDLCALL SDL_RWGetView(SDL_RWops * context,
+                                                  size_t * size);
+
+/**
+ *  \name Asynchronous reads
+ *
+ *  Reads that are done on a small pool of threads, so that lots of data
+ *  can be loaded at once without the application managing threads.
+ */
+/* @{ */
+
+/**
+ *  The state of an asynchronous read.
+ */
+typedef enum
+{
+    SDL_ASYNC_PENDING,      /**< Waiting to start, or in progress */
+    SDL_ASYNC_COMPLETE,     /**< Done; fewer bytes than asked for means end of stream */
+    SDL_ASYNC_FAILED,       /**< The stream couldn't be read */
+    SDL_ASYNC_CANCELED      /**< Canceled before it started */
+} SDL_AsyncStatus;
+
+struct SDL_AsyncRead;
+typedef struct SDL_AsyncRead SDL_AsyncRead;
+
+/**
+ *  \brief Start reading \c size bytes at \c offset in a stream into \c ptr.
+ *
+ *  The read is done on one of a pool of threads (see
+ *  ::SDL_HINT_ASYNCIO_THREADS), in the order reads were started. Reads
+ *  from memory streams and files can overlap; reads from other streams
+ *  take turns seeking and reading.
+ *
+ *  The stream and buffer have to stay valid until the read is waited for.
+ *  The stream shouldn't be read or seeked while reads from it are
+ *  pending, and its position afterwards is undefined.
+ *
+ *  \return A handle to pass to SDL_WaitAsyncRead(), or NULL on error.
+ */
+extern DECLSPEC SDL_AsyncRead *SDLCALL SDL_RWreadAsync(SDL_RWops * context,
+                                                       Sint64 offset,
+                                                       void *ptr,
+                                                       size_t size);
+
+/**
+ *  \brief Check on an asynchronous read without waiting for it.
+ *
+ *  \param request The read to check on.
+ *  \param nread   Filled in with the number of bytes read so far, if not NULL.
+ */
+extern DECLSPEC SDL_AsyncStatus SDLCALL SDL_GetAsyncReadStatus(SDL_AsyncRead * request,
+                                                               size_t * nread);
+
+/**
+ *  \brief Wait for an asynchronous read to finish, and free its handle.
+ *
+ *  Every read started has to be waited for, even one that was canceled.
+ *
+ *  \param request The read to wait for.
+ *  \param nread   Filled in with the number of bytes read, if not NULL.
+ */
+extern DECLSPEC SDL_AsyncStatus SDLCALL SDL_WaitAsyncRead(SDL_AsyncRead * request,
+                                                          size_t * nread);
+
+/**
+ *  \brief Cancel an asynchronous read that hasn't started yet.
+ *
+ *  \return 0 if the read was canceled, or -1 if it has already started.
+ */
+extern DECLSPEC int SDLCALL SDL_CancelAsyncRead(SDL_AsyncRead * request);
+
+/* @} *//* Asynchronous reads */
+
 #define RW_SEEK_SET 0       /**< Seek from the beginning of data */
 #define RW_SEEK_CUR 1       /**< Seek relative to current read point */
 #define RW_SEEK_END 2       /**< Seek relative to the end of data */
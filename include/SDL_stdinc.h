@@ -337,6 +337,60 @@ extern DECLSPEC void *SDLCALL SDL_calloc(size_t nmemb, size_t size);
 extern DECLSPEC void *SDLCALL SDL_realloc(void *mem, size_t size);
 extern DECLSPEC void SDLCALL SDL_free(void *mem);
 
+typedef void *(SDLCALL *SDL_malloc_func)(size_t size);
+typedef void *(SDLCALL *SDL_calloc_func)(size_t nmemb, size_t size);
+typedef void *(SDLCALL *SDL_realloc_func)(void *mem, size_t size);
+typedef void (SDLCALL *SDL_free_func)(void *mem);
+
+/**
+ *  \brief Get the current set of SDL memory functions
+ */
+extern DECLSPEC void SDLCALL SDL_GetMemoryFunctions(SDL_malloc_func *malloc_func,
+                                                    SDL_calloc_func *calloc_func,
+                                                    SDL_realloc_func *realloc_func,
+                                                    SDL_free_func *free_func);
+
+/**
+ *  \brief Replace SDL's memory allocation functions with a custom set
+ *
+ *  Everything SDL allocates from then on, including event queue entries,
+ *  surfaces and audio buffers, goes through these functions.
+ *
+ *  \note This isn't thread-safe, so call it before SDL_Init() or from the
+ *        only thread using SDL. Anything SDL allocated before the call will
+ *        be freed with your free function.
+ *
+ *  \return 0 on success, or -1 if any of the functions are NULL.
+ */
+extern DECLSPEC int SDLCALL SDL_SetMemoryFunctions(SDL_malloc_func malloc_func,
+                                                   SDL_calloc_func calloc_func,
+                                                   SDL_realloc_func realloc_func,
+                                                   SDL_free_func free_func);
+
+/**
+ *  \brief Get the number of blocks allocated with SDL_malloc(), SDL_calloc()
+ *         and SDL_realloc() that haven't been freed yet
+ *
+ *  Counting costs some time on every allocation, so it's only done when SDL
+ *  is built with SDL_MALLOC_STATS defined.
+ *
+ *  \return The number of blocks, or -1 if SDL isn't counting them.
+ */
+extern DECLSPEC int SDLCALL SDL_GetNumAllocations(void);
+
+/**
+ *  \brief Get the number of bytes in the blocks counted by
+ *         SDL_GetNumAllocations()
+ *
+ *  This is the usable size of each block, which may be a little more than
+ *  was asked for.
+ *
+ *  \return The number of bytes, or -1 if SDL isn't counting blocks or can't
+ *          tell how big they are, which is the case on some platforms and
+ *          with custom memory functions.
+ */
+extern DECLSPEC Sint64 SDLCALL SDL_GetNumAllocatedBytes(void);
+
 extern DECLSPEC char *SDLCALL SDL_getenv(const char *name);
 extern DECLSPEC int SDLCALL SDL_setenv(const char *name, const char *value, int overwrite);
 
@@ -97,6 +97,16 @@ typedef struct SDL_Surface
 typedef int (*SDL_blit) (struct SDL_Surface * src, SDL_Rect * srcrect,
                          struct SDL_Surface * dst, SDL_Rect * dstrect);
 
+/**
+ * \brief The filter used when a surface is stretched by SDL_BlitScaled().
+ */
+typedef enum
+{
+    SDL_ScaleModeNearest,   /**< nearest pixel sampling */
+    SDL_ScaleModeLinear,    /**< bilinear filtering */
+    SDL_ScaleModeBest       /**< bilinear filtering when enlarging, area averaging when shrinking */
+} SDL_ScaleMode;
+
 /**
  *  Allocate and free an RGB surface.
  *
@@ -331,6 +341,36 @@ extern DECLSPEC int SDLCALL SDL_SetSurfaceBlendMode(SDL_Surface * surface,
 extern DECLSPEC int SDLCALL SDL_GetSurfaceBlendMode(SDL_Surface * surface,
                                                     SDL_BlendMode *blendMode);
 
+/**
+ *  \brief Set the filter used when the surface is stretched by SDL_BlitScaled().
+ *
+ *  \param surface   The surface to update.
+ *  \param scaleMode ::SDL_ScaleMode to use for stretching.
+ *
+ *  \return 0 on success, or -1 if the parameters are not valid.
+ *
+ *  \note Filtering is done for surfaces with 8 bits per color channel in
+ *        24 or 32 bits per pixel, that don't have a color key. Other
+ *        surfaces are always stretched with ::SDL_ScaleModeNearest.
+ *
+ *  \sa SDL_GetSurfaceScaleMode()
+ */
+extern DECLSPEC int SDLCALL SDL_SetSurfaceScaleMode(SDL_Surface * surface,
+                                                    SDL_ScaleMode scaleMode);
+
+/**
+ *  \brief Get the filter used when the surface is stretched by SDL_BlitScaled().
+ *
+ *  \param surface   The surface to query.
+ *  \param scaleMode A pointer filled in with the current scale mode.
+ *
+ *  \return 0 on success, or -1 if the surface is not valid.
+ *
+ *  \sa SDL_SetSurfaceScaleMode()
+ */
+extern DECLSPEC int SDLCALL SDL_GetSurfaceScaleMode(SDL_Surface * surface,
+                                                    SDL_ScaleMode *scaleMode);
+
 /**
  *  Sets the clipping rectangle for the destination surface in a blit.
  *
@@ -476,7 +516,8 @@ extern DECLSPEC int SDLCALL SDL_LowerBlit
  *  \brief Perform a fast, low quality, stretch blit between two surfaces of the
  *         same pixel format.
  *
- *  \note This function uses a static buffer, and is not thread-safe.
+ *  This always uses nearest pixel sampling, SDL_BlitScaled() stretches
+ *  with the scale mode set by SDL_SetSurfaceScaleMode().
  */
 extern DECLSPEC int SDLCALL SDL_SoftStretch(SDL_Surface * src,
                                             const SDL_Rect * srcrect,
@@ -501,6 +542,19 @@ extern DECLSPEC int SDLCALL SDL_LowerBlitScaled
     (SDL_Surface * src, SDL_Rect * srcrect,
     SDL_Surface * dst, SDL_Rect * dstrect);
 
+/**
+ *  \brief Get how often blit setup was found in the blit mapping cache.
+ *
+ *  When a surface is blitted to a different destination, or a palette
+ *  involved changes, SDL looks up the blitter for the pair of formats and
+ *  any palette translation table. These are cached and shared between all
+ *  surfaces, so retargeting a blit only needs to work them out once.
+ *
+ *  \param hits   Filled in with the number of lookups that were cached.
+ *  \param misses Filled in with the number of lookups that had to be worked out.
+ */
+extern DECLSPEC void SDLCALL SDL_GetBlitCacheStats(Uint64 * hits, Uint64 * misses);
+
 
 /* Ends C function definitions when using C++ */
 #ifdef __cplusplus
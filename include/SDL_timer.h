@@ -70,6 +70,23 @@ extern DECLSPEC Uint64 SDLCALL SDL_GetPerformanceFrequency(void);
  */
 extern DECLSPEC void SDLCALL SDL_Delay(Uint32 ms);
 
+/**
+ * \brief Get the number of nanoseconds since the SDL library initialization.
+ *
+ * This counts from the same moment as SDL_GetTicks(), as precisely as the
+ * platform's clock allows, and doesn't wrap.
+ */
+extern DECLSPEC Uint64 SDLCALL SDL_GetTicksNS(void);
+
+/**
+ * \brief Wait a specified number of nanoseconds before returning.
+ *
+ * This sleeps for most of the delay and busy-waits for the last few hundred
+ * microseconds, so it is much more precise than SDL_Delay() at the cost of
+ * some CPU time.
+ */
+extern DECLSPEC void SDLCALL SDL_DelayNS(Uint64 ns);
+
 /**
  *  Function prototype for the timer callback function.
  *
@@ -80,6 +97,14 @@ extern DECLSPEC void SDLCALL SDL_Delay(Uint32 ms);
  */
 typedef Uint32 (SDLCALL * SDL_TimerCallback) (Uint32 interval, void *param);
 
+/**
+ *  Function prototype for the high resolution timer callback function.
+ *
+ *  This works like SDL_TimerCallback, except that intervals are in
+ *  nanoseconds.
+ */
+typedef Uint64 (SDLCALL * SDL_NSTimerCallback) (Uint64 interval, void *param);
+
 /**
  * Definition of the timer ID type.
  */
@@ -94,6 +119,20 @@ extern DECLSPEC SDL_TimerID SDLCALL SDL_AddTimer(Uint32 interval,
                                                  SDL_TimerCallback callback,
                                                  void *param);
 
+/**
+ * \brief Add a new high resolution timer to the pool of timers already running.
+ *
+ * The interval is in nanoseconds. Periodic high resolution timers are
+ * rescheduled relative to their previous deadline, so they don't drift.
+ *
+ * \return A timer ID, or 0 when an error occurs.
+ *
+ * \sa SDL_RemoveTimer()
+ */
+extern DECLSPEC SDL_TimerID SDLCALL SDL_AddTimerNS(Uint64 interval,
+                                                   SDL_NSTimerCallback callback,
+                                                   void *param);
+
 /**
  * \brief Remove a timer knowing its ID.
  *
@@ -33,6 +33,7 @@
 #include "events/SDL_events_c.h"
 #include "haptic/SDL_haptic_c.h"
 #include "joystick/SDL_joystick_c.h"
+#include "video/SDL_rowjob_c.h"
 
 /* Initialization/Cleanup routines */
 #if !SDL_TIMERS_DISABLED
@@ -41,6 +42,8 @@ extern void SDL_TimerQuit(void);
 extern void SDL_TicksInit(void);
 extern void SDL_TicksQuit(void);
 #endif
+extern void SDL_QuitBlitCache(void);
+extern void SDL_QuitAsyncIO(void);
 #if SDL_VIDEO_DRIVER_WINDOWS
 extern int SDL_HelperWindowCreate(void);
 extern int SDL_HelperWindowDestroy(void);
@@ -355,6 +358,9 @@ SDL_Quit(void)
     SDL_HelperWindowDestroy();
 #endif
     SDL_QuitSubSystem(SDL_INIT_EVERYTHING);
+    SDL_QuitRowJobs();
+    SDL_QuitBlitCache();
+    SDL_QuitAsyncIO();
 
 #if !SDL_TIMERS_DISABLED
     SDL_TicksQuit();
@@ -33,6 +33,28 @@
 
 #include "SDL_config.h"
 
+/* Vector code for instruction sets beyond the ones the library is compiled
+   for is built with SDL_TARGETING() and only called after the matching
+   runtime check, like SDL_HasAVX2(). Files using it include <immintrin.h>
+   when these are defined. */
+#if defined(__i386__) || defined(__x86_64__)
+#if (defined(__clang__) && ((__clang_major__ > 3) || ((__clang_major__ == 3) && (__clang_minor__ >= 8)))) || \
+    (!defined(__clang__) && defined(__GNUC__) && ((__GNUC__ > 4) || ((__GNUC__ == 4) && (__GNUC_MINOR__ >= 9))))
+#define SDL_TARGETING(x) __attribute__((target(x)))
+#define HAVE_SSSE3_INTRINSICS 1
+#define HAVE_AVX_INTRINSICS 1
+#define HAVE_AVX2_INTRINSICS 1
+#endif
+#elif defined(_MSC_VER) && (_MSC_VER >= 1700) && (defined(_M_IX86) || defined(_M_X64))
+/* Visual C++ compiles any intrinsic, whatever /arch is set to */
+#define HAVE_SSSE3_INTRINSICS 1
+#define HAVE_AVX_INTRINSICS 1
+#define HAVE_AVX2_INTRINSICS 1
+#endif
+#ifndef SDL_TARGETING
+#define SDL_TARGETING(x)
+#endif
+
 #endif
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -448,119 +448,187 @@ SDL_RemoveAudioDevice(const int iscapture, void *handle)
 
 /* buffer queueing support... */
 
-/* this expects that you managed thread safety elsewhere. */
+static SDL_INLINE Uint32
+audio_queue_used(SDL_AudioQueue *queue)
+{
+    return (Uint32) SDL_AtomicGet(&queue->tail) - (Uint32) SDL_AtomicGet(&queue->head);
+}
+
+static SDL_AudioQueueRing *
+alloc_audio_queue_ring(Uint32 size)
+{
+    SDL_AudioQueueRing *ring = (SDL_AudioQueueRing *) SDL_malloc(sizeof (*ring) + size);
+    if (ring == NULL) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    ring->data = (Uint8 *) (ring + 1);
+    ring->size = size;
+    ring->next = NULL;
+    return ring;
+}
+
+/* Producer side. Frees the rings the consumer has switched away from. */
 static void
-free_audio_queue(SDL_AudioBufferQueue *packet)
+free_retired_audio_queue_rings(SDL_AudioQueue *queue)
 {
-    while (packet) {
-        SDL_AudioBufferQueue *next = packet->next;
-        SDL_free(packet);
-        packet = next;
+    SDL_AudioQueueRing *ring = (SDL_AudioQueueRing *) SDL_AtomicSetPtr(&queue->retired, NULL);
+    while (ring) {
+        SDL_AudioQueueRing *next = ring->next;
+        SDL_free(ring);
+        ring = next;
     }
 }
 
-/* NOTE: This assumes you'll hold the mixer lock before calling! */
+/* Producer side, playback only. Makes a ring with room for (len) more bytes,
+   copies everything that's queued into it and publishes it for the audio
+   thread, which switches over the next time it reads. Positions keep
+   counting across rings, so neither side has to stop for this. */
 static int
-queue_audio_to_device(SDL_AudioDevice *device, const Uint8 *data, Uint32 len)
+grow_audio_queue(SDL_AudioQueue *queue, Uint32 len)
 {
-    SDL_AudioBufferQueue *orighead;
-    SDL_AudioBufferQueue *origtail;
-    Uint32 origlen;
-    Uint32 datalen;
-
-    orighead = device->buffer_queue_head;
-    origtail = device->buffer_queue_tail;
-    origlen = origtail ? origtail->datalen : 0;
-
-    while (len > 0) {
-        SDL_AudioBufferQueue *packet = device->buffer_queue_tail;
-        SDL_assert(!packet || (packet->datalen <= SDL_AUDIOBUFFERQUEUE_PACKETLEN));
-        if (!packet || (packet->datalen >= SDL_AUDIOBUFFERQUEUE_PACKETLEN)) {
-            /* tail packet missing or completely full; we need a new packet. */
-            packet = device->buffer_queue_pool;
-            if (packet != NULL) {
-                /* we have one available in the pool. */
-                device->buffer_queue_pool = packet->next;
-            } else {
-                /* Have to allocate a new one! */
-                packet = (SDL_AudioBufferQueue *) SDL_malloc(sizeof (SDL_AudioBufferQueue));
-                if (packet == NULL) {
-                    /* uhoh, reset so we've queued nothing new, free what we can. */
-                    if (!origtail) {
-                        packet = device->buffer_queue_head;  /* whole queue. */
-                    } else {
-                        packet = origtail->next;  /* what we added to existing queue. */
-                        origtail->next = NULL;
-                        origtail->datalen = origlen;
-                    }
-                    device->buffer_queue_head = orighead;
-                    device->buffer_queue_tail = origtail;
-                    device->buffer_queue_pool = NULL;
-
-                    free_audio_queue(packet);  /* give back what we can. */
+    SDL_AudioQueueRing *old = queue->write_ring;
+    SDL_AudioQueueRing *ring;
+    Uint32 pos = (Uint32) SDL_AtomicGet(&queue->head);
+    Uint32 used = (Uint32) SDL_AtomicGet(&queue->tail) - pos;
+    Uint32 size = old->size;
 
-                    return SDL_OutOfMemory();
-                }
-            }
-            packet->datalen = 0;
-            packet->startpos = 0;
-            packet->next = NULL;
+    if (len > (0x80000000 - used)) {
+        return SDL_OutOfMemory();  /* the positions can't tell more apart. */
+    }
+    while (size < used + len) {
+        size *= 2;
+    }
 
-            SDL_assert((device->buffer_queue_head != NULL) == (device->queued_bytes != 0));
-            if (device->buffer_queue_tail == NULL) {
-                device->buffer_queue_head = packet;
-            } else {
-                device->buffer_queue_tail->next = packet;
-            }
-            device->buffer_queue_tail = packet;
-        }
+    ring = alloc_audio_queue_ring(size);
+    if (ring == NULL) {
+        return -1;
+    }
 
-        datalen = SDL_min(len, SDL_AUDIOBUFFERQUEUE_PACKETLEN - packet->datalen);
-        SDL_memcpy(packet->data + packet->datalen, data, datalen);
-        data += datalen;
-        len -= datalen;
-        packet->datalen += datalen;
-        device->queued_bytes += datalen;
+    /* the consumer can't get behind (pos), and only we write, so this
+       stays valid while the audio thread keeps reading the old ring. */
+    while (used > 0) {
+        const Uint32 src = pos & (old->size - 1);
+        const Uint32 dst = pos & (ring->size - 1);
+        const Uint32 cpy = SDL_min(used, SDL_min(old->size - src, ring->size - dst));
+        SDL_memcpy(ring->data + dst, old->data + src, cpy);
+        pos += cpy;
+        used -= cpy;
     }
+    queue->write_ring = ring;
 
+    /* a ring the audio thread never picked up can go right away. */
+    SDL_free(SDL_AtomicSetPtr(&queue->pending, ring));
     return 0;
 }
 
-/* NOTE: This assumes you'll hold the mixer lock before calling! */
+/* Producer side. This assumes there's room for (len) bytes. */
+static void
+write_audio_queue(SDL_AudioQueue *queue, const Uint8 *data, Uint32 len)
+{
+    SDL_AudioQueueRing *ring = queue->write_ring;
+    const Uint32 tail = (Uint32) SDL_AtomicGet(&queue->tail);
+    const Uint32 pos = tail & (ring->size - 1);
+    const Uint32 cpy = SDL_min(len, ring->size - pos);
+    Uint32 used;
+
+    SDL_memcpy(ring->data + pos, data, cpy);
+    SDL_memcpy(ring->data, data + cpy, len - cpy);
+
+    /* the data has to be in place before the consumer can see it. */
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicSet(&queue->tail, (int) (tail + len));
+
+    used = audio_queue_used(queue);
+    if (used > (Uint32) SDL_AtomicGet(&queue->max_queued_bytes)) {
+        SDL_AtomicSet(&queue->max_queued_bytes, (int) used);
+    }
+}
+
+/* Consumer side. Returns the next contiguous run of queued data, up to
+   (len) bytes, without consuming it. */
 static Uint32
-dequeue_audio_from_device(SDL_AudioDevice *device, Uint8 *stream, Uint32 len)
+peek_audio_queue(SDL_AudioQueue *queue, Uint8 **data, Uint32 len)
 {
-    SDL_AudioBufferQueue *packet;
-    Uint8 *ptr = stream;
+    const Uint32 head = (Uint32) SDL_AtomicGet(&queue->head);
+    const Uint32 avail = (Uint32) SDL_AtomicGet(&queue->tail) - head;
+    SDL_AudioQueueRing *ring;
+    Uint32 pos;
 
-    while ((len > 0) && ((packet = device->buffer_queue_head) != NULL)) {
-        const Uint32 avail = packet->datalen - packet->startpos;
-        const Uint32 cpy = SDL_min(len, avail);
-        SDL_assert(device->queued_bytes >= avail);
+    /* don't read the data before the producer's position. */
+    SDL_MemoryBarrierAcquire();
 
-        SDL_memcpy(ptr, packet->data + packet->startpos, cpy);
-        packet->startpos += cpy;
-        ptr += cpy;
-        device->queued_bytes -= cpy;
-        len -= cpy;
+    /* anything past the old ring's data was only written to the new one,
+       which was published before the tail we just read moved past it. */
+    if (SDL_AtomicGetPtr(&queue->pending) != NULL) {
+        SDL_AudioQueueRing *retired;
 
-        if (packet->startpos == packet->datalen) {  /* packet is done, put it in the pool. */
-            device->buffer_queue_head = packet->next;
-            SDL_assert((packet->next != NULL) || (packet == device->buffer_queue_tail));
-            packet->next = device->buffer_queue_pool;
-            device->buffer_queue_pool = packet;
-        }
+        ring = queue->read_ring;
+        queue->read_ring = (SDL_AudioQueueRing *) SDL_AtomicSetPtr(&queue->pending, NULL);
+        do {
+            retired = (SDL_AudioQueueRing *) SDL_AtomicGetPtr(&queue->retired);
+            ring->next = retired;
+        } while (!SDL_AtomicCASPtr(&queue->retired, retired, ring));
     }
 
-    SDL_assert((device->buffer_queue_head != NULL) == (device->queued_bytes != 0));
+    ring = queue->read_ring;
+    pos = head & (ring->size - 1);
+    *data = ring->data + pos;
+    return SDL_min(SDL_min(len, avail), ring->size - pos);
+}
+
+static void
+consume_audio_queue(SDL_AudioQueue *queue, Uint32 len)
+{
+    /* finish reading before the producer can reuse the space. */
+    SDL_MemoryBarrierRelease();
+    SDL_AtomicAdd(&queue->head, (int) len);
+}
 
-    if (device->buffer_queue_head == NULL) {
-        device->buffer_queue_tail = NULL;  /* in case we drained the queue entirely. */
+/* Consumer side. */
+static Uint32
+read_audio_queue(SDL_AudioQueue *queue, Uint8 *stream, Uint32 len)
+{
+    Uint8 *ptr = stream;
+    Uint8 *data;
+    Uint32 cpy;
+
+    while ((len > 0) && ((cpy = peek_audio_queue(queue, &data, len)) > 0)) {
+        SDL_memcpy(ptr, data, cpy);
+        consume_audio_queue(queue, cpy);
+        ptr += cpy;
+        len -= cpy;
     }
 
     return (Uint32) (ptr - stream);
 }
 
+/* Producer side, for the application. Only takes the queue lock, which
+   keeps other application threads out; the audio thread never needs it. */
+static int
+queue_audio_to_device(SDL_AudioDevice *device, const Uint8 *data, Uint32 len)
+{
+    SDL_AudioQueue *queue = &device->queue;
+    int rc = 0;
+
+    SDL_LockMutex(queue->lock);
+    if (SDL_AtomicGetPtr(&queue->retired) != NULL) {
+        free_retired_audio_queue_rings(queue);
+    }
+    if ((queue->write_ring->size - audio_queue_used(queue)) < len) {
+        rc = grow_audio_queue(queue, len);
+    }
+
+    if (rc == 0) {
+        write_audio_queue(queue, data, len);
+    } else {
+        SDL_AtomicAdd(&queue->dropped_bytes, (int) len);
+    }
+    SDL_UnlockMutex(queue->lock);
+
+    return rc;
+}
+
 static void SDLCALL
 SDL_BufferQueueDrainCallback(void *userdata, Uint8 *stream, int len)
 {
@@ -572,13 +640,37 @@ SDL_BufferQueueDrainCallback(void *userdata, Uint8 *stream, int len)
     SDL_assert(!device->iscapture);  /* this shouldn't ever happen, right?! */
     SDL_assert(len >= 0);  /* this shouldn't ever happen, right?! */
 
-    written = dequeue_audio_from_device(device, stream, (Uint32) len);
+    written = read_audio_queue(&device->queue, stream, (Uint32) len);
     stream += written;
     len -= (int) written;
 
     if (len > 0) {  /* fill any remaining space in the stream with silence. */
-        SDL_assert(device->buffer_queue_head == NULL);
-        SDL_memset(stream, device->spec.silence, len);
+        SDL_AtomicIncRef(&device->queue.underruns);
+        SDL_memset(stream, device->callbackspec.silence, len);
+    }
+}
+
+/* NOTE: This assumes you'll hold the mixer lock before calling! */
+static void
+dequeue_audio_to_stream(SDL_AudioDevice *device, Uint32 len)
+{
+    /* Like SDL_BufferQueueDrainCallback(), but hands the queued data
+       straight to the conversion stream instead of copying it out first. */
+    SDL_AudioQueue *queue = &device->queue;
+    Uint8 *data;
+    Uint32 cpy;
+
+    while ((len > 0) && ((cpy = peek_audio_queue(queue, &data, len)) > 0)) {
+        /* if this fails...oh well. We'll play silence here. */
+        SDL_AudioStreamPut(device->stream, data, (int) cpy);
+        consume_audio_queue(queue, cpy);
+        len -= cpy;
+    }
+
+    if (len > 0) {  /* fill any remaining space with silence. */
+        SDL_AtomicIncRef(&queue->underruns);
+        SDL_memset(device->work_buffer, device->callbackspec.silence, len);
+        SDL_AudioStreamPut(device->stream, device->work_buffer, (int) len);
     }
 }
 
@@ -587,15 +679,21 @@ SDL_BufferQueueFillCallback(void *userdata, Uint8 *stream, int len)
 {
     /* this function always holds the mixer lock before being called. */
     SDL_AudioDevice *device = (SDL_AudioDevice *) userdata;
+    SDL_AudioQueue *queue;
 
     SDL_assert(device != NULL);  /* this shouldn't ever happen, right?! */
     SDL_assert(device->iscapture);  /* this shouldn't ever happen, right?! */
     SDL_assert(len >= 0);  /* this shouldn't ever happen, right?! */
 
-    /* note that if this needs to allocate more space and run out of memory,
-       we have no choice but to quietly drop the data and hope it works out
-       later, but you probably have bigger problems in this case anyhow. */
-    queue_audio_to_device(device, stream, (Uint32) len);
+    queue = &device->queue;
+    if ((queue->write_ring->size - audio_queue_used(queue)) < (Uint32) len) {
+        /* The capture ring never grows, so the audio thread doesn't have to
+           allocate or wait for the app. If the app hasn't dequeued enough,
+           we have no choice but to drop this block and count it. */
+        SDL_AtomicAdd(&queue->dropped_bytes, len);
+        return;
+    }
+    write_audio_queue(queue, stream, (Uint32) len);
 }
 
 int
@@ -613,9 +711,7 @@ SDL_QueueAudio(SDL_AudioDeviceID devid, const void *data, Uint32 len)
     }
 
     if (len > 0) {
-        current_audio.impl.LockDevice(device);
         rc = queue_audio_to_device(device, data, len);
-        current_audio.impl.UnlockDevice(device);
     }
 
     return rc;
@@ -634,9 +730,9 @@ SDL_DequeueAudio(SDL_AudioDeviceID devid, void *data, Uint32 len)
         return 0;  /* just report zero bytes dequeued. */
     }
 
-    current_audio.impl.LockDevice(device);
-    rc = dequeue_audio_from_device(device, data, len);
-    current_audio.impl.UnlockDevice(device);
+    SDL_LockMutex(device->queue.lock);
+    rc = read_audio_queue(&device->queue, data, len);
+    SDL_UnlockMutex(device->queue.lock);
     return rc;
 }
 
@@ -653,59 +749,58 @@ SDL_GetQueuedAudioSize(SDL_AudioDeviceID devid)
     /* Nothing to do unless we're set up for queueing. */
     if (device->spec.callback == SDL_BufferQueueDrainCallback) {
         current_audio.impl.LockDevice(device);
-        retval = device->queued_bytes + current_audio.impl.GetPendingBytes(device);
+        retval = audio_queue_used(&device->queue) + current_audio.impl.GetPendingBytes(device);
         current_audio.impl.UnlockDevice(device);
     } else if (device->spec.callback == SDL_BufferQueueFillCallback) {
-        current_audio.impl.LockDevice(device);
-        retval = device->queued_bytes;
-        current_audio.impl.UnlockDevice(device);
+        retval = audio_queue_used(&device->queue);
     }
 
     return retval;
 }
 
-void
-SDL_ClearQueuedAudio(SDL_AudioDeviceID devid)
+int
+SDL_GetQueuedAudioStats(SDL_AudioDeviceID devid, SDL_AudioQueueStats *stats)
 {
     SDL_AudioDevice *device = get_audio_device(devid);
-    SDL_AudioBufferQueue *packet;
+    SDL_AudioQueue *queue;
 
     if (!device) {
-        return;  /* nothing to do. */
+        return -1;  /* get_audio_device() will have set the error state */
+    } else if (!stats) {
+        return SDL_InvalidParamError("stats");
+    } else if ((device->spec.callback != SDL_BufferQueueDrainCallback) &&
+               (device->spec.callback != SDL_BufferQueueFillCallback)) {
+        return SDL_SetError("Audio device has a callback, queueing not allowed");
     }
 
-    /* Blank out the device and release the mutex. Free it afterwards. */
-    current_audio.impl.LockDevice(device);
-
-    /* merge the available pool and the current queue into one list. */
-    packet = device->buffer_queue_head;
-    if (packet) {
-        device->buffer_queue_tail->next = device->buffer_queue_pool;
-    } else {
-        packet = device->buffer_queue_pool;
-    }
+    queue = &device->queue;
+    SDL_zerop(stats);
+    SDL_LockMutex(queue->lock);
+    stats->queued_bytes = audio_queue_used(queue);
+    stats->capacity = queue->write_ring->size;
+    SDL_UnlockMutex(queue->lock);
+    stats->max_queued_bytes = (Uint32) SDL_AtomicGet(&queue->max_queued_bytes);
+    stats->underruns = (Uint32) SDL_AtomicGet(&queue->underruns);
+    stats->dropped_bytes = (Uint32) SDL_AtomicGet(&queue->dropped_bytes);
+    return 0;
+}
 
-    /* Remove the queued packets from the device. */
-    device->buffer_queue_tail = NULL;
-    device->buffer_queue_head = NULL;
-    device->queued_bytes = 0;
-    device->buffer_queue_pool = packet;
+void
+SDL_ClearQueuedAudio(SDL_AudioDeviceID devid)
+{
+    SDL_AudioDevice *device = get_audio_device(devid);
 
-    /* Keep up to two packets in the pool to reduce future malloc pressure. */
-    if (packet) {
-        if (!packet->next) {
-            packet = NULL;  /* one packet (the only one) for the pool. */
-        } else {
-            SDL_AudioBufferQueue *next = packet->next->next;
-            packet->next->next = NULL;  /* two packets for the pool. */
-            packet = next;  /* rest will be freed. */
-        }
+    if (!device || !device->queue.lock) {
+        return;  /* nothing to do. */
     }
 
+    /* Keep both sides out while we drop everything. The ring keeps its
+       storage, so queueing again won't have to allocate. */
+    current_audio.impl.LockDevice(device);
+    SDL_LockMutex(device->queue.lock);
+    SDL_AtomicSet(&device->queue.head, SDL_AtomicGet(&device->queue.tail));
+    SDL_UnlockMutex(device->queue.lock);
     current_audio.impl.UnlockDevice(device);
-
-    /* free any extra packets we didn't keep in the pool. */
-    free_audio_queue(packet);
 }
 
 
@@ -714,12 +809,11 @@ static int SDLCALL
 SDL_RunAudio(void *devicep)
 {
     SDL_AudioDevice *device = (SDL_AudioDevice *) devicep;
-    const int silence = (int) device->spec.silence;
+    void *udata = device->callbackspec.userdata;
+    SDL_AudioCallback callback = device->callbackspec.callback;
+    const int data_len = device->callbackspec.size;
     const Uint32 delay = ((device->spec.samples * 1000) / device->spec.freq);
-    const int stream_len = (device->convert.needed) ? device->convert.len : device->spec.size;
-    Uint8 *stream;
-    void *udata = device->spec.userdata;
-    void (SDLCALL *callback) (void *, Uint8 *, int) = device->spec.callback;
+    Uint8 *data;
 
     SDL_assert(!device->iscapture);
 
@@ -732,51 +826,67 @@ SDL_RunAudio(void *devicep)
 
     /* Loop, filling the audio buffers */
     while (!SDL_AtomicGet(&device->shutdown)) {
+        SDL_bool streamed = SDL_FALSE;
+
         /* Fill the current buffer with sound */
-        if (device->convert.needed) {
-            stream = device->convert.buf;
-        } else if (SDL_AtomicGet(&device->enabled)) {
-            stream = current_audio.impl.GetDeviceBuf(device);
+        if (!device->stream && SDL_AtomicGet(&device->enabled)) {
+            data = current_audio.impl.GetDeviceBuf(device);
         } else {
             /* if the device isn't enabled, we still write to the
-               fake_stream, so the app's callback will fire with
+               work_buffer, so the app's callback will fire with
                a regular frequency, in case they depend on that
                for timing or progress. They can use hotplug
-               now to know if the device failed. */
-            stream = NULL;
+               now to know if the device failed.
+               Streaming playback uses work_buffer, too. */
+            data = NULL;
         }
 
-        if (stream == NULL) {
-            stream = device->fake_stream;
+        if (data == NULL) {
+            data = device->work_buffer;
         }
 
         /* !!! FIXME: this should be LockDevice. */
         if ( SDL_AtomicGet(&device->enabled) ) {
             SDL_LockMutex(device->mixer_lock);
             if (SDL_AtomicGet(&device->paused)) {
-                SDL_memset(stream, silence, stream_len);
+                SDL_memset(data, device->callbackspec.silence, data_len);
+            } else if (device->stream && (callback == SDL_BufferQueueDrainCallback)) {
+                dequeue_audio_to_stream(device, (Uint32) data_len);
+                streamed = SDL_TRUE;
             } else {
-                (*callback) (udata, stream, stream_len);
+                (*callback) (udata, data, data_len);
             }
             SDL_UnlockMutex(device->mixer_lock);
         }
 
-        /* Convert the audio if necessary */
-        if (device->convert.needed && SDL_AtomicGet(&device->enabled)) {
-            SDL_ConvertAudio(&device->convert);
-            stream = current_audio.impl.GetDeviceBuf(device);
-            if (stream == NULL) {
-                stream = device->fake_stream;
-            } else {
-                SDL_memcpy(stream, device->convert.buf,
-                           device->convert.len_cvt);
+        if (device->stream) {
+            /* Stream available audio to device, converting/resampling. */
+            /* if this fails...oh well. We'll play silence here. */
+            if (!streamed) {
+                SDL_AudioStreamPut(device->stream, data, data_len);
             }
-        }
 
-        /* Ready current buffer for play and change current buffer */
-        if (stream == device->fake_stream) {
+            while (SDL_AudioStreamAvailable(device->stream) >= ((int) device->spec.size)) {
+                int got;
+                data = SDL_AtomicGet(&device->enabled) ? current_audio.impl.GetDeviceBuf(device) : NULL;
+                got = SDL_AudioStreamGet(device->stream, data ? data : device->work_buffer, device->spec.size);
+                SDL_assert((got < 0) || (got == device->spec.size));
+
+                if (data == NULL) {  /* device is having issues... */
+                    SDL_Delay(delay);  /* wait for as long as this buffer would have played. Maybe device recovers later? */
+                } else {
+                    if (got != device->spec.size) {
+                        SDL_memset(data, device->spec.silence, device->spec.size);
+                    }
+                    current_audio.impl.PlayDevice(device);
+                    current_audio.impl.WaitDevice(device);
+                }
+            }
+        } else if (data == device->work_buffer) {
+            /* nothing to do; pause like we queued a buffer to play. */
             SDL_Delay(delay);
-        } else {
+        } else {  /* writing directly to the device. */
+            /* queue this buffer and wait for it to finish playing. */
             current_audio.impl.PlayDevice(device);
             current_audio.impl.WaitDevice(device);
         }
@@ -797,10 +907,10 @@ SDL_CaptureAudio(void *devicep)
     SDL_AudioDevice *device = (SDL_AudioDevice *) devicep;
     const int silence = (int) device->spec.silence;
     const Uint32 delay = ((device->spec.samples * 1000) / device->spec.freq);
-    const int stream_len = (device->convert.needed) ? device->convert.len : device->spec.size;
-    Uint8 *stream;
-    void *udata = device->spec.userdata;
-    void (SDLCALL *callback) (void *, Uint8 *, int) = device->spec.callback;
+    const int data_len = device->spec.size;
+    Uint8 *data;
+    void *udata = device->callbackspec.userdata;
+    SDL_AudioCallback callback = device->callbackspec.callback;
 
     SDL_assert(device->iscapture);
 
@@ -818,18 +928,21 @@ SDL_CaptureAudio(void *devicep)
 
         if (!SDL_AtomicGet(&device->enabled) || SDL_AtomicGet(&device->paused)) {
             SDL_Delay(delay);  /* just so we don't cook the CPU. */
+            if (device->stream) {
+                SDL_AudioStreamClear(device->stream);
+            }
             current_audio.impl.FlushCapture(device);  /* dump anything pending. */
             continue;
         }
 
         /* Fill the current buffer with sound */
-        still_need = stream_len;
-        if (device->convert.needed) {
-            ptr = stream = device->convert.buf;
-        } else {
-            /* just use the "fake" stream to hold data read from the device. */
-            ptr = stream = device->fake_stream;
-        }
+        still_need = data_len;
+
+        /* Use the work_buffer to hold data read from the device. */
+        data = device->work_buffer;
+        SDL_assert(data != NULL);
+
+        ptr = data;
 
         /* We still read from the device when "paused" to keep the state sane,
            and block when there isn't data so this thread isn't eating CPU.
@@ -852,18 +965,36 @@ SDL_CaptureAudio(void *devicep)
             SDL_memset(ptr, silence, still_need);
         }
 
-        if (device->convert.needed) {
-            SDL_ConvertAudio(&device->convert);
-        }
+        if (device->stream) {
+            /* if this fails...oh well. */
+            SDL_AudioStreamPut(device->stream, data, data_len);
 
-        /* !!! FIXME: this should be LockDevice. */
-        SDL_LockMutex(device->mixer_lock);
-        if (SDL_AtomicGet(&device->paused)) {
-            current_audio.impl.FlushCapture(device);  /* one snuck in! */
-        } else {
-            (*callback)(udata, stream, stream_len);
+            while (SDL_AudioStreamAvailable(device->stream) >= ((int) device->callbackspec.size)) {
+                const int got = SDL_AudioStreamGet(device->stream, device->work_buffer, device->callbackspec.size);
+                SDL_assert((got < 0) || (got == device->callbackspec.size));
+                if (got != device->callbackspec.size) {
+                    SDL_memset(device->work_buffer, device->callbackspec.silence, device->callbackspec.size);
+                }
+
+                /* !!! FIXME: this should be LockDevice. */
+                SDL_LockMutex(device->mixer_lock);
+                if (SDL_AtomicGet(&device->paused)) {
+                    current_audio.impl.FlushCapture(device);  /* one snuck in! */
+                } else {
+                    (*callback)(udata, device->work_buffer, device->callbackspec.size);
+                }
+                SDL_UnlockMutex(device->mixer_lock);
+            }
+        } else {  /* feeding user callback directly without streaming. */
+            /* !!! FIXME: this should be LockDevice. */
+            SDL_LockMutex(device->mixer_lock);
+            if (SDL_AtomicGet(&device->paused)) {
+                current_audio.impl.FlushCapture(device);  /* one snuck in! */
+            } else {
+                (*callback)(udata, data, device->callbackspec.size);
+            }
+            SDL_UnlockMutex(device->mixer_lock);
         }
-        SDL_UnlockMutex(device->mixer_lock);
     }
 
     current_audio.impl.FlushCapture(device);
@@ -1098,16 +1229,18 @@ close_audio_device(SDL_AudioDevice * device)
     if (device->mixer_lock != NULL) {
         SDL_DestroyMutex(device->mixer_lock);
     }
-    SDL_free(device->fake_stream);
-    if (device->convert.needed) {
-        SDL_free(device->convert.buf);
-    }
+    SDL_free(device->work_buffer);
+    SDL_FreeAudioStream(device->stream);
     if (device->hidden != NULL) {
         current_audio.impl.CloseDevice(device);
     }
 
-    free_audio_queue(device->buffer_queue_head);
-    free_audio_queue(device->buffer_queue_pool);
+    if (device->queue.lock != NULL) {
+        SDL_DestroyMutex(device->queue.lock);
+    }
+    free_retired_audio_queue_rings(&device->queue);
+    SDL_free(SDL_AtomicGetPtr(&device->queue.pending));
+    SDL_free(device->queue.read_ring);
 
     SDL_free(device);
 }
@@ -1184,7 +1317,7 @@ open_audio_device(const char *devname, int iscapture,
     SDL_AudioDeviceID id = 0;
     SDL_AudioSpec _obtained;
     SDL_AudioDevice *device;
-    SDL_bool build_cvt;
+    SDL_bool build_stream;
     void *handle = NULL;
     int i = 0;
 
@@ -1319,26 +1452,26 @@ open_audio_device(const char *devname, int iscapture,
     SDL_assert(device->hidden != NULL);
 
     /* See if we need to do any conversion */
-    build_cvt = SDL_FALSE;
+    build_stream = SDL_FALSE;
     if (obtained->freq != device->spec.freq) {
         if (allowed_changes & SDL_AUDIO_ALLOW_FREQUENCY_CHANGE) {
             obtained->freq = device->spec.freq;
         } else {
-            build_cvt = SDL_TRUE;
+            build_stream = SDL_TRUE;
         }
     }
     if (obtained->format != device->spec.format) {
         if (allowed_changes & SDL_AUDIO_ALLOW_FORMAT_CHANGE) {
             obtained->format = device->spec.format;
         } else {
-            build_cvt = SDL_TRUE;
+            build_stream = SDL_TRUE;
         }
     }
     if (obtained->channels != device->spec.channels) {
         if (allowed_changes & SDL_AUDIO_ALLOW_CHANNELS_CHANGE) {
             obtained->channels = device->spec.channels;
         } else {
-            build_cvt = SDL_TRUE;
+            build_stream = SDL_TRUE;
         }
     }
 
@@ -1351,50 +1484,74 @@ open_audio_device(const char *devname, int iscapture,
         SDL_CalculateAudioSpec(obtained);
     }
 
-    if (build_cvt) {
-        /* Build an audio conversion block */
-        if (SDL_BuildAudioCVT(&device->convert,
-                              obtained->format, obtained->channels,
-                              obtained->freq,
-                              device->spec.format, device->spec.channels,
-                              device->spec.freq) < 0) {
+    if (build_stream) {
+        if (iscapture) {
+            device->stream = SDL_NewAudioStream(device->spec.format,
+                                  device->spec.channels, device->spec.freq,
+                                  obtained->format, obtained->channels, obtained->freq);
+        } else {
+            device->stream = SDL_NewAudioStream(obtained->format, obtained->channels,
+                                  obtained->freq, device->spec.format,
+                                  device->spec.channels, device->spec.freq);
+        }
+
+        if (!device->stream) {
             close_audio_device(device);
             return 0;
         }
-        if (device->convert.needed) {
-            device->convert.len = (int) (((double) device->spec.size) /
-                                         device->convert.len_ratio);
-
-            device->convert.buf =
-                (Uint8 *) SDL_malloc(device->convert.len *
-                                            device->convert.len_mult);
-            if (device->convert.buf == NULL) {
-                close_audio_device(device);
-                SDL_OutOfMemory();
-                return 0;
-            }
-        }
     }
 
     if (device->spec.callback == NULL) {  /* use buffer queueing? */
-        /* pool a few packets to start. Enough for two callbacks. */
-        const int packetlen = SDL_AUDIOBUFFERQUEUE_PACKETLEN;
-        const int wantbytes = ((device->convert.needed) ? device->convert.len : device->spec.size) * 2;
-        const int wantpackets = (wantbytes / packetlen) + ((wantbytes % packetlen) ? packetlen : 0);
-        for (i = 0; i < wantpackets; i++) {
-            SDL_AudioBufferQueue *packet = (SDL_AudioBufferQueue *) SDL_malloc(sizeof (SDL_AudioBufferQueue));
-            if (packet) { /* don't care if this fails, we'll deal later. */
-                packet->datalen = 0;
-                packet->startpos = 0;
-                packet->next = device->buffer_queue_pool;
-                device->buffer_queue_pool = packet;
-            }
+        /* Playback starts with enough room for two callbacks and grows as
+           needed. Capture gets all the room it will ever have up front, a
+           second or two callbacks' worth, so the audio thread never has to
+           allocate. */
+        Uint32 len = obtained->size * 2;
+        Uint32 size = SDL_AUDIOQUEUE_MINSIZE;
+
+        if (iscapture) {
+            const Uint32 second = (SDL_AUDIO_BITSIZE(obtained->format) / 8) *
+                                  obtained->channels * obtained->freq;
+            len = SDL_max(len, second);
+        }
+        while (size < len) {
+            size *= 2;
+        }
+
+        device->queue.lock = SDL_CreateMutex();
+        if (!device->queue.lock) {
+            close_audio_device(device);
+            return 0;
         }
+        device->queue.read_ring = alloc_audio_queue_ring(size);
+        if (!device->queue.read_ring) {
+            close_audio_device(device);
+            return 0;
+        }
+        device->queue.write_ring = device->queue.read_ring;
 
         device->spec.callback = iscapture ? SDL_BufferQueueFillCallback : SDL_BufferQueueDrainCallback;
         device->spec.userdata = device;
     }
 
+    device->callbackspec = *obtained;
+    device->callbackspec.callback = device->spec.callback;
+    device->callbackspec.userdata = device->spec.userdata;
+
+    /* Allocate a scratch audio buffer */
+    device->work_buffer_len = build_stream ? device->callbackspec.size : 0;
+    if (device->spec.size > device->work_buffer_len) {
+        device->work_buffer_len = device->spec.size;
+    }
+    SDL_assert(device->work_buffer_len > 0);
+
+    device->work_buffer = (Uint8 *) SDL_malloc(device->work_buffer_len);
+    if (device->work_buffer == NULL) {
+        close_audio_device(device);
+        SDL_OutOfMemory();
+        return 0;
+    }
+
     /* add it to our list of open devices. */
     open_devices[id] = device;
 
@@ -1406,20 +1563,6 @@ open_audio_device(const char *devname, int iscapture,
         const size_t stacksize = is_internal_thread ? 64 * 1024 : 0;
         char threadname[64];
 
-        /* Allocate a fake audio buffer; only used by our internal threads. */
-        Uint32 stream_len = (device->convert.needed) ? device->convert.len_cvt : 0;
-        if (device->spec.size > stream_len) {
-            stream_len = device->spec.size;
-        }
-        SDL_assert(stream_len > 0);
-
-        device->fake_stream = (Uint8 *) SDL_malloc(stream_len);
-        if (device->fake_stream == NULL) {
-            close_audio_device(device);
-            SDL_OutOfMemory();
-            return 0;
-        }
-
         SDL_snprintf(threadname, sizeof (threadname), "SDLAudioDev%d", (int) device->id);
         device->thread = SDL_CreateThreadInternal(iscapture ? SDL_CaptureAudio : SDL_RunAudio, threadname, stacksize, device);
 
@@ -1577,6 +1720,8 @@ SDL_AudioQuit(void)
 
     SDL_DestroyMutex(current_audio.detectionLock);
 
+    SDL_FreeResampleFilters();
+
     SDL_zero(current_audio);
     SDL_zero(open_devices);
 }
@@ -1655,13 +1800,7 @@ SDL_MixAudio(Uint8 * dst, const Uint8 * src, Uint32 len, int volume)
     /* Mix the user-level audio format */
     SDL_AudioDevice *device = get_audio_device(1);
     if (device != NULL) {
-        SDL_AudioFormat format;
-        if (device->convert.needed) {
-            format = device->convert.src_format;
-        } else {
-            format = device->spec.format;
-        }
-        SDL_MixAudioFormat(dst, src, format, len, volume);
+        SDL_MixAudioFormat(dst, src, device->callbackspec.format, len, volume);
     }
 }
 
@@ -38,15 +38,30 @@ typedef struct
 } SDL_AudioTypeFilters;
 extern const SDL_AudioTypeFilters sdl_audio_type_filters[];
 
-/* this is used internally to access some autogenerated code. */
-typedef struct
-{
-    SDL_AudioFormat fmt;
-    int channels;
-    int upsample;
-    int multiple;
-    SDL_AudioFilter filter;
-} SDL_AudioRateFilters;
-extern const SDL_AudioRateFilters sdl_audio_rate_filters[];
+/* Bandlimited resampler for interleaved float audio, in SDL_audiocvt.c.
+   It keeps enough input history between calls to convert a stream in
+   arbitrarily sized pieces. */
+typedef struct SDL_AudioResampler SDL_AudioResampler;
+
+/* Create a resampler between any two positive rates, or NULL on error */
+extern SDL_AudioResampler *SDL_CreateAudioResampler(int channels, int src_rate, int dst_rate);
+
+/* Consume all of (inframes) frames of input and write up to (outframes)
+   frames of output, returning the number of frames written, or -1 on error.
+   Input that can't be converted yet stays buffered; call again with no
+   input to fetch the rest. */
+extern int SDL_ResampleAudio(SDL_AudioResampler *resampler, const float *inbuf, int inframes, float *outbuf, int outframes);
+
+/* Mark the end of the input, so the buffered tail can be resampled.
+   Call SDL_ResampleAudio() until it returns 0 to drain it. */
+extern int SDL_FlushAudioResampler(SDL_AudioResampler *resampler);
+
+/* Discard any buffered input and start over */
+extern void SDL_ResetAudioResampler(SDL_AudioResampler *resampler);
+
+extern void SDL_FreeAudioResampler(SDL_AudioResampler *resampler);
+
+/* Free the resampling filters cached by SDL_BuildAudioCVT() */
+extern void SDL_FreeResampleFilters(void);
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -26,6 +26,9 @@
 #include "SDL_audio_c.h"
 
 #include "SDL_assert.h"
+#include "SDL_atomic.h"
+#include "SDL_cpuinfo.h"
+#include "SDL_hints.h"
 
 /* #define DEBUG_CONVERT */
 
@@ -810,6 +813,695 @@ SDL_ConvertSurround_4(SDL_AudioCVT * cvt, SDL_AudioFormat format)
 }
 
 
+/*
+ * Bandlimited resampling.
+ *
+ * The ratio between the two rates is reduced to dst/src = L/M, and each
+ * output frame is a windowed-sinc (Kaiser) filter evaluated at its position
+ * in the input, stepping M/L input frames per output frame. The filter is
+ * precomputed as a table of phases: when L is small enough there is a row
+ * for every position a frame can land on, otherwise positions fall between
+ * two of RESAMPLER_MAX_PHASES rows and the coefficients are interpolated.
+ * Everything is done in float; SDL_BuildAudioCVT() converts to and from
+ * AUDIO_F32SYS around the resampler.
+ */
+
+/* Filter length when upsampling; downsampling stretches it by the ratio. */
+#define RESAMPLER_TAPS          48
+#define RESAMPLER_MAX_TAPS      256
+#define RESAMPLER_MAX_PHASES    256
+#define RESAMPLER_KAISER_BETA   8.0
+/* Passband edge, as a fraction of the lower of the two Nyquist frequencies */
+#define RESAMPLER_CUTOFF        0.91
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define HAVE_NEON_RESAMPLER 1
+#include <arm_neon.h>
+#endif
+
+typedef struct SDL_ResampleFilter
+{
+    int src_rate;               /* M, the reduced source rate */
+    int dst_rate;               /* L, the reduced destination rate */
+    int taps;                   /* always a multiple of 4 */
+    int phases;                 /* equal to dst_rate if every phase is exact */
+    int refcount;
+    float *coeffs;              /* (phases + 1) rows of (taps) coefficients */
+    struct SDL_ResampleFilter *next;
+} SDL_ResampleFilter;
+
+static SDL_SpinLock resample_filter_lock;
+static SDL_ResampleFilter *resample_filters;
+
+typedef void (*SDL_ResampleDotFunc) (const float *coeffs, int taps, int chans,
+                                     const float *src, float *dst);
+
+static int
+SDL_gcd(int a, int b)
+{
+    while (b != 0) {
+        const int t = a % b;
+        a = b;
+        b = t;
+    }
+    return a;
+}
+
+/* Zeroth order modified Bessel function of the first kind */
+static double
+SDL_BesselI0(const double x)
+{
+    const double xx = (x * x) / 4.0;
+    double sum = 1.0;
+    double term = 1.0;
+    int k;
+
+    for (k = 1; k < 64; k++) {
+        term *= xx / ((double) k * (double) k);
+        sum += term;
+        if (term < (sum * 1e-12)) {
+            break;
+        }
+    }
+    return sum;
+}
+
+static SDL_ResampleFilter *
+SDL_CreateResampleFilter(const int src_rate, const int dst_rate)
+{
+    const double ratio = ((double) dst_rate) / ((double) src_rate);
+    const double scale = (ratio < 1.0) ? ratio : 1.0;
+    /* twice the cutoff frequency, in cycles per input frame */
+    const double cutoff = RESAMPLER_CUTOFF * scale;
+    const double i0beta = SDL_BesselI0(RESAMPLER_KAISER_BETA);
+    SDL_ResampleFilter *filter;
+    int taps, half, phases, p, k;
+
+    taps = ((int) SDL_ceil(RESAMPLER_TAPS / scale) + 3) & ~3;
+    if (taps > RESAMPLER_MAX_TAPS) {
+        taps = RESAMPLER_MAX_TAPS;
+    }
+    half = taps / 2;
+    phases = (dst_rate <= RESAMPLER_MAX_PHASES) ? dst_rate : RESAMPLER_MAX_PHASES;
+
+    filter = (SDL_ResampleFilter *) SDL_calloc(1, sizeof (*filter));
+    if (filter == NULL) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    filter->coeffs = (float *) SDL_malloc((phases + 1) * taps * sizeof (float));
+    if (filter->coeffs == NULL) {
+        SDL_free(filter);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    filter->src_rate = src_rate;
+    filter->dst_rate = dst_rate;
+    filter->taps = taps;
+    filter->phases = phases;
+
+    for (p = 0; p <= phases; p++) {
+        float *row = filter->coeffs + (p * taps);
+        const double frac = ((double) p) / ((double) phases);
+        double sum = 0.0;
+
+        for (k = 0; k < taps; k++) {
+            /* distance from the output position to input frame k */
+            const double x = ((double) (k - (half - 1))) - frac;
+            const double w = 1.0 - ((x / half) * (x / half));
+            double v = 0.0;
+
+            if (w > 0.0) {
+                v = cutoff * SDL_BesselI0(RESAMPLER_KAISER_BETA * SDL_sqrt(w)) / i0beta;
+                if (x != 0.0) {
+                    v *= SDL_sin(M_PI * cutoff * x) / (M_PI * cutoff * x);
+                }
+            }
+            row[k] = (float) v;
+            sum += v;
+        }
+
+        /* Normalize each phase to unity gain at DC */
+        for (k = 0; k < taps; k++) {
+            row[k] = (float) (row[k] / sum);
+        }
+    }
+
+    return filter;
+}
+
+static SDL_ResampleFilter *
+SDL_AcquireResampleFilter(const int src_rate, const int dst_rate)
+{
+    const int gcd = SDL_gcd(src_rate, dst_rate);
+    const int m = src_rate / gcd;
+    const int l = dst_rate / gcd;
+    SDL_ResampleFilter *filter;
+    SDL_ResampleFilter *created = NULL;
+
+    for (;;) {
+        SDL_AtomicLock(&resample_filter_lock);
+        for (filter = resample_filters; filter; filter = filter->next) {
+            if ((filter->src_rate == m) && (filter->dst_rate == l)) {
+                break;
+            }
+        }
+        if ((filter == NULL) && (created != NULL)) {
+            created->next = resample_filters;
+            resample_filters = created;
+            filter = created;
+            created = NULL;
+        }
+        if (filter != NULL) {
+            filter->refcount++;
+        }
+        SDL_AtomicUnlock(&resample_filter_lock);
+
+        if (filter != NULL) {
+            break;
+        }
+
+        /* Build it without holding the lock; someone may beat us to it. */
+        created = SDL_CreateResampleFilter(m, l);
+        if (created == NULL) {
+            return NULL;
+        }
+    }
+
+    if (created != NULL) {
+        SDL_free(created->coeffs);
+        SDL_free(created);
+    }
+    return filter;
+}
+
+static void
+SDL_ReleaseResampleFilter(SDL_ResampleFilter *filter)
+{
+    /* Filters stay cached until SDL_FreeResampleFilters() */
+    SDL_AtomicLock(&resample_filter_lock);
+    filter->refcount--;
+    SDL_AtomicUnlock(&resample_filter_lock);
+}
+
+void
+SDL_FreeResampleFilters(void)
+{
+    SDL_ResampleFilter **prev;
+    SDL_ResampleFilter *filter;
+
+    SDL_AtomicLock(&resample_filter_lock);
+    prev = &resample_filters;
+    while ((filter = *prev) != NULL) {
+        if (filter->refcount == 0) {
+            *prev = filter->next;
+            SDL_free(filter->coeffs);
+            SDL_free(filter);
+        } else {
+            prev = &filter->next;
+        }
+    }
+    SDL_AtomicUnlock(&resample_filter_lock);
+}
+
+/* Get the coefficients for an output frame (frac/L) of the way past an
+   input frame, blending two rows into (blended) if needed. */
+static const float *
+SDL_GetResamplePhase(const SDL_ResampleFilter *filter, const int frac,
+                     float *blended)
+{
+    const int taps = filter->taps;
+    const Sint64 x = ((Sint64) frac) * filter->phases;
+    const int row = (int) (x / filter->dst_rate);
+    const int rem = (int) (x % filter->dst_rate);
+    const float *a = filter->coeffs + (row * taps);
+    const float *b = a + taps;
+    float t;
+    int k;
+
+    if (rem == 0) {
+        return a;
+    }
+
+    t = ((float) rem) / ((float) filter->dst_rate);
+    for (k = 0; k < taps; k++) {
+        blended[k] = a[k] + (t * (b[k] - a[k]));
+    }
+    return blended;
+}
+
+static void
+SDL_ResampleDot_Scalar(const float *coeffs, int taps, int chans,
+                       const float *src, float *dst)
+{
+    int c, k;
+
+    for (c = 0; c < chans; c++) {
+        const float *s = src + c;
+        float sum = 0.0f;
+        for (k = 0; k < taps; k++, s += chans) {
+            sum += coeffs[k] * *s;
+        }
+        dst[c] = sum;
+    }
+}
+
+#ifdef __SSE__
+static void
+SDL_ResampleDot_Mono_SSE(const float *coeffs, int taps, int chans,
+                         const float *src, float *dst)
+{
+    __m128 acc = _mm_setzero_ps();
+    int k;
+
+    for (k = 0; k < taps; k += 4) {
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(coeffs + k),
+                                         _mm_loadu_ps(src + k)));
+    }
+    acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+    acc = _mm_add_ss(acc, _mm_shuffle_ps(acc, acc, 0x55));
+    _mm_store_ss(dst, acc);
+}
+
+static void
+SDL_ResampleDot_Stereo_SSE(const float *coeffs, int taps, int chans,
+                           const float *src, float *dst)
+{
+    __m128 acc = _mm_setzero_ps();
+    int k;
+
+    for (k = 0; k < taps; k += 4, src += 8) {
+        const __m128 c = _mm_loadu_ps(coeffs + k);
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(src),
+                                         _mm_unpacklo_ps(c, c)));
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(src + 4),
+                                         _mm_unpackhi_ps(c, c)));
+    }
+    acc = _mm_add_ps(acc, _mm_movehl_ps(acc, acc));
+    _mm_storel_pi((__m64 *) dst, acc);
+}
+
+static void
+SDL_ResampleDot_Quad_SSE(const float *coeffs, int taps, int chans,
+                         const float *src, float *dst)
+{
+    __m128 acc = _mm_setzero_ps();
+    int k;
+
+    for (k = 0; k < taps; k += 4, src += 16) {
+        const __m128 c = _mm_loadu_ps(coeffs + k);
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(src),
+                                         _mm_shuffle_ps(c, c, 0x00)));
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(src + 4),
+                                         _mm_shuffle_ps(c, c, 0x55)));
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(src + 8),
+                                         _mm_shuffle_ps(c, c, 0xAA)));
+        acc = _mm_add_ps(acc, _mm_mul_ps(_mm_loadu_ps(src + 12),
+                                         _mm_shuffle_ps(c, c, 0xFF)));
+    }
+    _mm_storeu_ps(dst, acc);
+}
+#endif /* __SSE__ */
+
+#if HAVE_NEON_RESAMPLER
+static void
+SDL_ResampleDot_Mono_NEON(const float *coeffs, int taps, int chans,
+                          const float *src, float *dst)
+{
+    float32x4_t acc = vdupq_n_f32(0.0f);
+    float32x2_t sum;
+    int k;
+
+    for (k = 0; k < taps; k += 4) {
+        acc = vmlaq_f32(acc, vld1q_f32(coeffs + k), vld1q_f32(src + k));
+    }
+    sum = vadd_f32(vget_low_f32(acc), vget_high_f32(acc));
+    sum = vpadd_f32(sum, sum);
+    dst[0] = vget_lane_f32(sum, 0);
+}
+
+static void
+SDL_ResampleDot_Stereo_NEON(const float *coeffs, int taps, int chans,
+                            const float *src, float *dst)
+{
+    float32x4_t acc = vdupq_n_f32(0.0f);
+    int k;
+
+    for (k = 0; k < taps; k += 4, src += 8) {
+        const float32x4_t c = vld1q_f32(coeffs + k);
+        const float32x4x2_t cc = vzipq_f32(c, c);
+        acc = vmlaq_f32(acc, vld1q_f32(src), cc.val[0]);
+        acc = vmlaq_f32(acc, vld1q_f32(src + 4), cc.val[1]);
+    }
+    vst1_f32(dst, vadd_f32(vget_low_f32(acc), vget_high_f32(acc)));
+}
+
+static void
+SDL_ResampleDot_Quad_NEON(const float *coeffs, int taps, int chans,
+                          const float *src, float *dst)
+{
+    float32x4_t acc = vdupq_n_f32(0.0f);
+    int k;
+
+    for (k = 0; k < taps; k += 4, src += 16) {
+        const float32x4_t c = vld1q_f32(coeffs + k);
+        acc = vmlaq_lane_f32(acc, vld1q_f32(src), vget_low_f32(c), 0);
+        acc = vmlaq_lane_f32(acc, vld1q_f32(src + 4), vget_low_f32(c), 1);
+        acc = vmlaq_lane_f32(acc, vld1q_f32(src + 8), vget_high_f32(c), 0);
+        acc = vmlaq_lane_f32(acc, vld1q_f32(src + 12), vget_high_f32(c), 1);
+    }
+    vst1q_f32(dst, acc);
+}
+#endif /* HAVE_NEON_RESAMPLER */
+
+static SDL_ResampleDotFunc
+SDL_ChooseResampleDot(const int chans)
+{
+#if HAVE_NEON_RESAMPLER
+    switch (chans) {
+    case 1: return SDL_ResampleDot_Mono_NEON;
+    case 2: return SDL_ResampleDot_Stereo_NEON;
+    case 4: return SDL_ResampleDot_Quad_NEON;
+    }
+#endif
+#ifdef __SSE__
+    if (SDL_HasSSE()) {
+        switch (chans) {
+        case 1: return SDL_ResampleDot_Mono_SSE;
+        case 2: return SDL_ResampleDot_Stereo_SSE;
+        case 4: return SDL_ResampleDot_Quad_SSE;
+        }
+    }
+#endif
+    return SDL_ResampleDot_Scalar;
+}
+
+/* Produce output frames while (*ppos) is before (endpos), reading input
+   outside of (inbuf) as silence. Returns the number of frames written. */
+static int
+SDL_ResampleFrames(const SDL_ResampleFilter *filter, const int chans,
+                   const float *inbuf, const int inframes,
+                   int *ppos, int *pfrac, const int endpos,
+                   float *outbuf, const int outframes)
+{
+    const SDL_ResampleDotFunc dot = SDL_ChooseResampleDot(chans);
+    const int taps = filter->taps;
+    const int half = taps / 2;
+    const int step = filter->src_rate / filter->dst_rate;
+    const int stepfrac = filter->src_rate % filter->dst_rate;
+    float blended[RESAMPLER_MAX_TAPS];
+    int pos = *ppos;
+    int frac = *pfrac;
+    int i;
+
+    for (i = 0; (i < outframes) && (pos < endpos); i++, outbuf += chans) {
+        const float *coeffs = SDL_GetResamplePhase(filter, frac, blended);
+        const int first = pos - (half - 1);
+
+        if ((first >= 0) && ((first + taps) <= inframes)) {
+            dot(coeffs, taps, chans, inbuf + (first * chans), outbuf);
+        } else {
+            int c, k;
+            for (c = 0; c < chans; c++) {
+                float sum = 0.0f;
+                for (k = 0; k < taps; k++) {
+                    const int frame = first + k;
+                    if ((frame >= 0) && (frame < inframes)) {
+                        sum += coeffs[k] * inbuf[(frame * chans) + c];
+                    }
+                }
+                outbuf[c] = sum;
+            }
+        }
+
+        pos += step;
+        frac += stepfrac;
+        if (frac >= filter->dst_rate) {
+            frac -= filter->dst_rate;
+            pos++;
+        }
+    }
+
+    *ppos = pos;
+    *pfrac = frac;
+    return i;
+}
+
+/* SDL_AudioCVT only keeps the ratio of the rates, in (rate_incr). It's
+   dst/src rounded to a double, so its continued fraction expansion reaches
+   the reduced rates exactly, for any rates below about 2^25 Hz. */
+static void
+SDL_GetResampleRates(const double rate_incr, int *src_rate, int *dst_rate)
+{
+    double x = rate_incr;
+    Sint64 h0 = 0, h1 = 1;      /* numerators of the last two convergents */
+    Sint64 k0 = 1, k1 = 0;      /* and their denominators */
+    int i;
+
+    for (i = 0; i < 64; i++) {
+        const double a = SDL_floor(x);
+        const Sint64 h = ((Sint64) a * h1) + h0;
+        const Sint64 k = ((Sint64) a * k1) + k0;
+
+        if ((h > 0x7FFFFFFF) || (k > 0x7FFFFFFF)) {
+            break;
+        }
+        h0 = h1;
+        h1 = h;
+        k0 = k1;
+        k1 = k;
+        if ((((double) h) / ((double) k)) == rate_incr) {
+            break;
+        }
+        x = 1.0 / (x - a);
+    }
+
+    *src_rate = (int) k1;
+    *dst_rate = (int) h1;
+}
+
+static void
+SDL_ResampleCVT(SDL_AudioCVT * cvt, const int chans, SDL_AudioFormat format)
+{
+    const int framelen = chans * sizeof (float);
+    const int inframes = cvt->len_cvt / framelen;
+    const float *src = (const float *) cvt->buf;
+    float *dst = (float *) (cvt->buf + (inframes * framelen));
+    int maxframes = ((cvt->len * cvt->len_mult) - (inframes * framelen)) / framelen;
+    SDL_ResampleFilter *filter;
+    int src_rate, dst_rate;
+    int outframes = 0;
+    int pos = 0;
+    int frac = 0;
+
+    SDL_GetResampleRates(cvt->rate_incr, &src_rate, &dst_rate);
+    filter = SDL_AcquireResampleFilter(src_rate, dst_rate);
+
+#ifdef DEBUG_CONVERT
+    printf("Resampling %d channels from %d Hz to %d Hz\n", chans, src_rate, dst_rate);
+#endif
+
+    /* The filter was built by SDL_BuildAudioCVT(), this only fails if it was
+       freed since and there's no memory to build it again. */
+    if (filter != NULL) {
+        outframes = SDL_ResampleFrames(filter, chans, src, inframes,
+                                       &pos, &frac, inframes, dst, maxframes);
+        SDL_ReleaseResampleFilter(filter);
+    }
+
+    SDL_memmove(cvt->buf, dst, outframes * framelen);
+    cvt->len_cvt = outframes * framelen;
+    if (cvt->filters[++cvt->filter_index]) {
+        cvt->filters[cvt->filter_index] (cvt, format);
+    }
+}
+
+/* SDL_AudioFilter has no room for the channel count, so bake it in. */
+#define RESAMPLER_FUNCS(chans) \
+    static void SDLCALL \
+    SDL_ResampleCVT_##chans(SDL_AudioCVT * cvt, SDL_AudioFormat format) { \
+        SDL_ResampleCVT(cvt, chans, format); \
+    }
+RESAMPLER_FUNCS(1)
+RESAMPLER_FUNCS(2)
+RESAMPLER_FUNCS(4)
+RESAMPLER_FUNCS(6)
+RESAMPLER_FUNCS(8)
+#undef RESAMPLER_FUNCS
+
+
+struct SDL_AudioResampler
+{
+    SDL_ResampleFilter *filter;
+    int channels;
+    float *history;             /* buffered input frames */
+    int history_frames;
+    int history_max;
+    int pos;                    /* input frame of the next output frame... */
+    int frac;                   /* ...plus this many 1/L of a frame */
+    SDL_bool flushing;
+    int flush_end;              /* first frame of the padding when flushing */
+};
+
+SDL_AudioResampler *
+SDL_CreateAudioResampler(int channels, int src_rate, int dst_rate)
+{
+    SDL_AudioResampler *resampler;
+
+    if ((channels <= 0) || (src_rate <= 0) || (dst_rate <= 0)) {
+        SDL_SetError("Invalid resampler parameters");
+        return NULL;
+    }
+
+    resampler = (SDL_AudioResampler *) SDL_calloc(1, sizeof (*resampler));
+    if (resampler == NULL) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    resampler->channels = channels;
+    resampler->filter = SDL_AcquireResampleFilter(src_rate, dst_rate);
+    if (resampler->filter == NULL) {
+        SDL_free(resampler);
+        return NULL;
+    }
+
+    /* Room for the filter's history plus a decent chunk of input */
+    resampler->history_max = resampler->filter->taps * 2 + 1024;
+    resampler->history = (float *) SDL_malloc(resampler->history_max * channels * sizeof (float));
+    if (resampler->history == NULL) {
+        SDL_FreeAudioResampler(resampler);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    SDL_ResetAudioResampler(resampler);
+    return resampler;
+}
+
+void
+SDL_ResetAudioResampler(SDL_AudioResampler *resampler)
+{
+    /* Start with half a filter of silence, so the first output frame is
+       centered on the first input frame, just like SDL_ConvertAudio(). */
+    const int lead = (resampler->filter->taps / 2) - 1;
+
+    SDL_memset(resampler->history, '\0', lead * resampler->channels * sizeof (float));
+    resampler->history_frames = lead;
+    resampler->pos = lead;
+    resampler->frac = 0;
+    resampler->flushing = SDL_FALSE;
+    resampler->flush_end = 0;
+}
+
+static int
+SDL_ReserveResamplerHistory(SDL_AudioResampler *resampler, int frames)
+{
+    const int needed = resampler->history_frames + frames;
+
+    if (needed > resampler->history_max) {
+        int newmax = resampler->history_max * 2;
+        float *ptr;
+
+        if (newmax < needed) {
+            newmax = needed;
+        }
+        ptr = (float *) SDL_realloc(resampler->history, newmax * resampler->channels * sizeof (float));
+        if (ptr == NULL) {
+            return SDL_OutOfMemory();
+        }
+        resampler->history = ptr;
+        resampler->history_max = newmax;
+    }
+    return 0;
+}
+
+int
+SDL_ResampleAudio(SDL_AudioResampler *resampler, const float *inbuf,
+                  int inframes, float *outbuf, int outframes)
+{
+    const int chans = resampler->channels;
+    const int half = resampler->filter->taps / 2;
+    int endpos, written, consumed;
+
+    if (inframes > 0) {
+        if (resampler->flushing) {
+            /* More data after all; drop the padding and keep going */
+            resampler->history_frames = resampler->flush_end;
+            resampler->flushing = SDL_FALSE;
+        }
+        if (SDL_ReserveResamplerHistory(resampler, inframes) < 0) {
+            return -1;
+        }
+        SDL_memcpy(resampler->history + (resampler->history_frames * chans),
+                   inbuf, inframes * chans * sizeof (float));
+        resampler->history_frames += inframes;
+    }
+
+    /* Only produce frames that have all the input they need */
+    if (resampler->flushing) {
+        endpos = resampler->flush_end;
+    } else {
+        endpos = resampler->history_frames - half;
+    }
+
+    written = SDL_ResampleFrames(resampler->filter, chans,
+                                 resampler->history, resampler->history_frames,
+                                 &resampler->pos, &resampler->frac, endpos,
+                                 outbuf, outframes);
+
+    if (resampler->flushing && (resampler->pos >= resampler->flush_end)) {
+        SDL_ResetAudioResampler(resampler);
+        return written;
+    }
+
+    /* Drop the input that no future output frame will touch */
+    consumed = resampler->pos - (half - 1);
+    if (consumed > 0) {
+        resampler->history_frames -= consumed;
+        SDL_memmove(resampler->history, resampler->history + (consumed * chans),
+                    resampler->history_frames * chans * sizeof (float));
+        resampler->pos -= consumed;
+        resampler->flush_end -= consumed;
+    }
+
+    return written;
+}
+
+int
+SDL_FlushAudioResampler(SDL_AudioResampler *resampler)
+{
+    const int chans = resampler->channels;
+    const int half = resampler->filter->taps / 2;
+
+    if (resampler->flushing) {
+        return 0;
+    }
+
+    /* Pad the end with silence so the last frames can be finished */
+    if (SDL_ReserveResamplerHistory(resampler, half) < 0) {
+        return -1;
+    }
+    SDL_memset(resampler->history + (resampler->history_frames * chans), '\0',
+               half * chans * sizeof (float));
+    resampler->flush_end = resampler->history_frames;
+    resampler->history_frames += half;
+    resampler->flushing = SDL_TRUE;
+    return 0;
+}
+
+void
+SDL_FreeAudioResampler(SDL_AudioResampler *resampler)
+{
+    if (resampler) {
+        if (resampler->filter) {
+            SDL_ReleaseResampleFilter(resampler->filter);
+        }
+        SDL_free(resampler->history);
+        SDL_free(resampler);
+    }
+}
+
+
 int
 SDL_ConvertAudio(SDL_AudioCVT * cvt)
 {
@@ -834,6 +1526,472 @@ SDL_ConvertAudio(SDL_AudioCVT * cvt)
 }
 
 
+/* Vectorized converters between the native endian sample formats that
+   devices and applications use the most. These produce the same results
+   as the generated converters in SDL_audiotypecvt.c, except that out of
+   range float samples are clamped instead of wrapping around. */
+
+#define DIVBY127 0.0078740157480315f
+#define DIVBY32767 3.05185094759972e-05f
+#define DIVBY2147483647 4.6566128752458e-10f
+
+#if HAVE_AVX2_INTRINSICS
+#define HAVE_AVX2_TYPECVT 1
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define HAVE_NEON_TYPECVT 1
+#include <arm_neon.h>
+#endif
+
+/* The scalar versions handle whatever is left over from the vector loops.
+   Converters that grow the data work from the end of the buffer backwards
+   so they can run in place. */
+static SDL_INLINE float
+SDL_ClampSample(const float sample)
+{
+    if (sample < -1.0f) {
+        return -1.0f;
+    } else if (sample > 1.0f) {
+        return 1.0f;
+    }
+    return sample;
+}
+
+static SDL_INLINE Sint32
+SDL_FloatToS32(const float sample)
+{
+    const double val = (double) SDL_ClampSample(sample) * 2147483647.0;
+    return (Sint32) val;
+}
+
+#define SCALAR_S16_TO_F32(dst, src, i) dst[i] = ((float) src[i]) * DIVBY32767
+#define SCALAR_F32_TO_S16(dst, src, i) dst[i] = (Sint16) (SDL_ClampSample(src[i]) * 32767.0f)
+#define SCALAR_S32_TO_F32(dst, src, i) dst[i] = ((float) src[i]) * DIVBY2147483647
+#define SCALAR_F32_TO_S32(dst, src, i) dst[i] = SDL_FloatToS32(src[i])
+#define SCALAR_U8_TO_F32(dst, src, i) dst[i] = (((float) src[i]) * DIVBY127) - 1.0f
+#define SCALAR_F32_TO_U8(dst, src, i) dst[i] = (Uint8) ((SDL_ClampSample(src[i]) + 1.0f) * 127.0f)
+
+#ifdef __SSE2__
+static void
+SDL_Convert_S16_to_F32_SSE2(float *dst, const Sint16 *src, int num)
+{
+    const __m128 divby32767 = _mm_set1_ps(DIVBY32767);
+    int i = num;
+
+    while (i & 7) {
+        --i;
+        SCALAR_S16_TO_F32(dst, src, i);
+    }
+    while (i) {
+        __m128i ints, lo, hi;
+        i -= 8;
+        ints = _mm_loadu_si128((const __m128i *) &src[i]);
+        lo = _mm_srai_epi32(_mm_unpacklo_epi16(ints, ints), 16);
+        hi = _mm_srai_epi32(_mm_unpackhi_epi16(ints, ints), 16);
+        _mm_storeu_ps(&dst[i + 4], _mm_mul_ps(_mm_cvtepi32_ps(hi), divby32767));
+        _mm_storeu_ps(&dst[i], _mm_mul_ps(_mm_cvtepi32_ps(lo), divby32767));
+    }
+}
+
+static void
+SDL_Convert_F32_to_S16_SSE2(Sint16 *dst, const float *src, int num)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 mul = _mm_set1_ps(32767.0f);
+    int i;
+
+    /* Large negative values convert to 0x80000000 and packs saturates
+       everything else, so only the top needs to be clamped. */
+    for (i = 0; i + 16 <= num; i += 16) {
+        const __m128i a = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(_mm_loadu_ps(&src[i]), one), mul));
+        const __m128i b = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(_mm_loadu_ps(&src[i + 4]), one), mul));
+        const __m128i c = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(_mm_loadu_ps(&src[i + 8]), one), mul));
+        const __m128i d = _mm_cvttps_epi32(_mm_mul_ps(_mm_min_ps(_mm_loadu_ps(&src[i + 12]), one), mul));
+        _mm_storeu_si128((__m128i *) &dst[i], _mm_packs_epi32(a, b));
+        _mm_storeu_si128((__m128i *) &dst[i + 8], _mm_packs_epi32(c, d));
+    }
+    for (; i < num; i++) {
+        SCALAR_F32_TO_S16(dst, src, i);
+    }
+}
+
+static void
+SDL_Convert_S32_to_F32_SSE2(float *dst, const Sint32 *src, int num)
+{
+    const __m128 divby2147483647 = _mm_set1_ps(DIVBY2147483647);
+    int i;
+
+    for (i = 0; i + 4 <= num; i += 4) {
+        const __m128i ints = _mm_loadu_si128((const __m128i *) &src[i]);
+        _mm_storeu_ps(&dst[i], _mm_mul_ps(_mm_cvtepi32_ps(ints), divby2147483647));
+    }
+    for (; i < num; i++) {
+        SCALAR_S32_TO_F32(dst, src, i);
+    }
+}
+
+static void
+SDL_Convert_F32_to_S32_SSE2(Sint32 *dst, const float *src, int num)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 minus_one = _mm_set1_ps(-1.0f);
+    const __m128 mul = _mm_set1_ps(2147483648.0f);
+    int i;
+
+    for (i = 0; i + 4 <= num; i += 4) {
+        const __m128 a = _mm_min_ps(_mm_max_ps(_mm_loadu_ps(&src[i]), minus_one), one);
+        const __m128 scaled = _mm_mul_ps(a, mul);
+        /* 1.0f overflows to 0x80000000, flip it to 0x7FFFFFFF */
+        const __m128i overflow = _mm_castps_si128(_mm_cmpge_ps(scaled, mul));
+        _mm_storeu_si128((__m128i *) &dst[i], _mm_xor_si128(_mm_cvttps_epi32(scaled), overflow));
+    }
+    for (; i < num; i++) {
+        SCALAR_F32_TO_S32(dst, src, i);
+    }
+}
+
+static void
+SDL_Convert_U8_to_F32_SSE2(float *dst, const Uint8 *src, int num)
+{
+    const __m128 divby127 = _mm_set1_ps(DIVBY127);
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128i zero = _mm_setzero_si128();
+    int i = num;
+
+    while (i & 15) {
+        --i;
+        SCALAR_U8_TO_F32(dst, src, i);
+    }
+    while (i) {
+        __m128i bytes, lo, hi;
+        i -= 16;
+        bytes = _mm_loadu_si128((const __m128i *) &src[i]);
+        lo = _mm_unpacklo_epi8(bytes, zero);
+        hi = _mm_unpackhi_epi8(bytes, zero);
+        _mm_storeu_ps(&dst[i + 12], _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(hi, zero)), divby127), one));
+        _mm_storeu_ps(&dst[i + 8], _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(hi, zero)), divby127), one));
+        _mm_storeu_ps(&dst[i + 4], _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_unpackhi_epi16(lo, zero)), divby127), one));
+        _mm_storeu_ps(&dst[i], _mm_sub_ps(_mm_mul_ps(_mm_cvtepi32_ps(_mm_unpacklo_epi16(lo, zero)), divby127), one));
+    }
+}
+
+static void
+SDL_Convert_F32_to_U8_SSE2(Uint8 *dst, const float *src, int num)
+{
+    const __m128 one = _mm_set1_ps(1.0f);
+    const __m128 minus_one = _mm_set1_ps(-1.0f);
+    const __m128 mul = _mm_set1_ps(127.0f);
+    int i;
+
+    for (i = 0; i + 16 <= num; i += 16) {
+        __m128i a, b, c, d;
+        a = _mm_cvttps_epi32(_mm_mul_ps(_mm_add_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(&src[i]), minus_one), one), one), mul));
+        b = _mm_cvttps_epi32(_mm_mul_ps(_mm_add_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(&src[i + 4]), minus_one), one), one), mul));
+        c = _mm_cvttps_epi32(_mm_mul_ps(_mm_add_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(&src[i + 8]), minus_one), one), one), mul));
+        d = _mm_cvttps_epi32(_mm_mul_ps(_mm_add_ps(_mm_min_ps(_mm_max_ps(_mm_loadu_ps(&src[i + 12]), minus_one), one), one), mul));
+        _mm_storeu_si128((__m128i *) &dst[i], _mm_packus_epi16(_mm_packs_epi32(a, b), _mm_packs_epi32(c, d)));
+    }
+    for (; i < num; i++) {
+        SCALAR_F32_TO_U8(dst, src, i);
+    }
+}
+#endif /* __SSE2__ */
+
+#if HAVE_AVX2_TYPECVT
+static void SDL_TARGETING("avx2")
+SDL_Convert_S16_to_F32_AVX2(float *dst, const Sint16 *src, int num)
+{
+    const __m256 divby32767 = _mm256_set1_ps(DIVBY32767);
+    int i = num;
+
+    while (i & 15) {
+        --i;
+        SCALAR_S16_TO_F32(dst, src, i);
+    }
+    while (i) {
+        __m256i lo, hi;
+        i -= 16;
+        lo = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *) &src[i]));
+        hi = _mm256_cvtepi16_epi32(_mm_loadu_si128((const __m128i *) &src[i + 8]));
+        _mm256_storeu_ps(&dst[i + 8], _mm256_mul_ps(_mm256_cvtepi32_ps(hi), divby32767));
+        _mm256_storeu_ps(&dst[i], _mm256_mul_ps(_mm256_cvtepi32_ps(lo), divby32767));
+    }
+}
+
+static void SDL_TARGETING("avx2")
+SDL_Convert_F32_to_S16_AVX2(Sint16 *dst, const float *src, int num)
+{
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 mul = _mm256_set1_ps(32767.0f);
+    int i;
+
+    for (i = 0; i + 16 <= num; i += 16) {
+        const __m256 a = _mm256_min_ps(_mm256_loadu_ps(&src[i]), one);
+        const __m256 b = _mm256_min_ps(_mm256_loadu_ps(&src[i + 8]), one);
+        const __m256i ia = _mm256_cvttps_epi32(_mm256_mul_ps(a, mul));
+        const __m256i ib = _mm256_cvttps_epi32(_mm256_mul_ps(b, mul));
+        /* packs works within 128-bit lanes, put the quarters back in order */
+        const __m256i packed = _mm256_permute4x64_epi64(_mm256_packs_epi32(ia, ib), 0xD8);
+        _mm256_storeu_si256((__m256i *) &dst[i], packed);
+    }
+    for (; i < num; i++) {
+        SCALAR_F32_TO_S16(dst, src, i);
+    }
+}
+
+static void SDL_TARGETING("avx2")
+SDL_Convert_S32_to_F32_AVX2(float *dst, const Sint32 *src, int num)
+{
+    const __m256 divby2147483647 = _mm256_set1_ps(DIVBY2147483647);
+    int i;
+
+    for (i = 0; i + 8 <= num; i += 8) {
+        const __m256i ints = _mm256_loadu_si256((const __m256i *) &src[i]);
+        _mm256_storeu_ps(&dst[i], _mm256_mul_ps(_mm256_cvtepi32_ps(ints), divby2147483647));
+    }
+    for (; i < num; i++) {
+        SCALAR_S32_TO_F32(dst, src, i);
+    }
+}
+
+static void SDL_TARGETING("avx2")
+SDL_Convert_F32_to_S32_AVX2(Sint32 *dst, const float *src, int num)
+{
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 minus_one = _mm256_set1_ps(-1.0f);
+    const __m256 mul = _mm256_set1_ps(2147483648.0f);
+    int i;
+
+    for (i = 0; i + 8 <= num; i += 8) {
+        const __m256 a = _mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(&src[i]), minus_one), one);
+        const __m256 scaled = _mm256_mul_ps(a, mul);
+        const __m256i overflow = _mm256_castps_si256(_mm256_cmp_ps(scaled, mul, _CMP_GE_OQ));
+        _mm256_storeu_si256((__m256i *) &dst[i], _mm256_xor_si256(_mm256_cvttps_epi32(scaled), overflow));
+    }
+    for (; i < num; i++) {
+        SCALAR_F32_TO_S32(dst, src, i);
+    }
+}
+
+static void SDL_TARGETING("avx2")
+SDL_Convert_U8_to_F32_AVX2(float *dst, const Uint8 *src, int num)
+{
+    const __m256 divby127 = _mm256_set1_ps(DIVBY127);
+    const __m256 one = _mm256_set1_ps(1.0f);
+    int i = num;
+
+    while (i & 15) {
+        --i;
+        SCALAR_U8_TO_F32(dst, src, i);
+    }
+    while (i) {
+        __m128i bytes;
+        __m256i lo, hi;
+        i -= 16;
+        bytes = _mm_loadu_si128((const __m128i *) &src[i]);
+        lo = _mm256_cvtepu8_epi32(bytes);
+        hi = _mm256_cvtepu8_epi32(_mm_srli_si128(bytes, 8));
+        _mm256_storeu_ps(&dst[i + 8], _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(hi), divby127), one));
+        _mm256_storeu_ps(&dst[i], _mm256_sub_ps(_mm256_mul_ps(_mm256_cvtepi32_ps(lo), divby127), one));
+    }
+}
+
+static void SDL_TARGETING("avx2")
+SDL_Convert_F32_to_U8_AVX2(Uint8 *dst, const float *src, int num)
+{
+    const __m256 one = _mm256_set1_ps(1.0f);
+    const __m256 minus_one = _mm256_set1_ps(-1.0f);
+    const __m256 mul = _mm256_set1_ps(127.0f);
+    const __m256i order = _mm256_setr_epi32(0, 4, 1, 5, 2, 6, 3, 7);
+    int i;
+
+    for (i = 0; i + 32 <= num; i += 32) {
+        __m256i a, b, c, d, packed;
+        a = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_add_ps(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(&src[i]), minus_one), one), one), mul));
+        b = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_add_ps(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(&src[i + 8]), minus_one), one), one), mul));
+        c = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_add_ps(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(&src[i + 16]), minus_one), one), one), mul));
+        d = _mm256_cvttps_epi32(_mm256_mul_ps(_mm256_add_ps(_mm256_min_ps(_mm256_max_ps(_mm256_loadu_ps(&src[i + 24]), minus_one), one), one), mul));
+        packed = _mm256_packus_epi16(_mm256_packs_epi32(a, b), _mm256_packs_epi32(c, d));
+        _mm256_storeu_si256((__m256i *) &dst[i], _mm256_permutevar8x32_epi32(packed, order));
+    }
+    for (; i < num; i++) {
+        SCALAR_F32_TO_U8(dst, src, i);
+    }
+}
+#endif /* HAVE_AVX2_TYPECVT */
+
+#if HAVE_NEON_TYPECVT
+static void
+SDL_Convert_S16_to_F32_NEON(float *dst, const Sint16 *src, int num)
+{
+    int i = num;
+
+    while (i & 7) {
+        --i;
+        SCALAR_S16_TO_F32(dst, src, i);
+    }
+    while (i) {
+        int16x8_t ints;
+        i -= 8;
+        ints = vld1q_s16(&src[i]);
+        vst1q_f32(&dst[i + 4], vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_high_s16(ints))), DIVBY32767));
+        vst1q_f32(&dst[i], vmulq_n_f32(vcvtq_f32_s32(vmovl_s16(vget_low_s16(ints))), DIVBY32767));
+    }
+}
+
+static void
+SDL_Convert_F32_to_S16_NEON(Sint16 *dst, const float *src, int num)
+{
+    int i;
+
+    /* vcvtq_s32_f32 and vqmovn_s32 saturate, so there's no need to clamp */
+    for (i = 0; i + 8 <= num; i += 8) {
+        const int32x4_t a = vcvtq_s32_f32(vmulq_n_f32(vld1q_f32(&src[i]), 32767.0f));
+        const int32x4_t b = vcvtq_s32_f32(vmulq_n_f32(vld1q_f32(&src[i + 4]), 32767.0f));
+        vst1q_s16(&dst[i], vcombine_s16(vqmovn_s32(a), vqmovn_s32(b)));
+    }
+    for (; i < num; i++) {
+        SCALAR_F32_TO_S16(dst, src, i);
+    }
+}
+
+static void
+SDL_Convert_S32_to_F32_NEON(float *dst, const Sint32 *src, int num)
+{
+    int i;
+
+    for (i = 0; i + 4 <= num; i += 4) {
+        vst1q_f32(&dst[i], vmulq_n_f32(vcvtq_f32_s32(vld1q_s32(&src[i])), DIVBY2147483647));
+    }
+    for (; i < num; i++) {
+        SCALAR_S32_TO_F32(dst, src, i);
+    }
+}
+
+static void
+SDL_Convert_F32_to_S32_NEON(Sint32 *dst, const float *src, int num)
+{
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t minus_one = vdupq_n_f32(-1.0f);
+    int i;
+
+    for (i = 0; i + 4 <= num; i += 4) {
+        const float32x4_t a = vminq_f32(vmaxq_f32(vld1q_f32(&src[i]), minus_one), one);
+        vst1q_s32(&dst[i], vcvtq_s32_f32(vmulq_n_f32(a, 2147483648.0f)));
+    }
+    for (; i < num; i++) {
+        SCALAR_F32_TO_S32(dst, src, i);
+    }
+}
+
+static void
+SDL_Convert_U8_to_F32_NEON(float *dst, const Uint8 *src, int num)
+{
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    int i = num;
+
+    while (i & 15) {
+        --i;
+        SCALAR_U8_TO_F32(dst, src, i);
+    }
+    while (i) {
+        uint8x16_t bytes;
+        uint16x8_t lo, hi;
+        i -= 16;
+        bytes = vld1q_u8(&src[i]);
+        lo = vmovl_u8(vget_low_u8(bytes));
+        hi = vmovl_u8(vget_high_u8(bytes));
+        vst1q_f32(&dst[i + 12], vsubq_f32(vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(hi))), DIVBY127), one));
+        vst1q_f32(&dst[i + 8], vsubq_f32(vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(hi))), DIVBY127), one));
+        vst1q_f32(&dst[i + 4], vsubq_f32(vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_high_u16(lo))), DIVBY127), one));
+        vst1q_f32(&dst[i], vsubq_f32(vmulq_n_f32(vcvtq_f32_u32(vmovl_u16(vget_low_u16(lo))), DIVBY127), one));
+    }
+}
+
+static void
+SDL_Convert_F32_to_U8_NEON(Uint8 *dst, const float *src, int num)
+{
+    const float32x4_t one = vdupq_n_f32(1.0f);
+    const float32x4_t minus_one = vdupq_n_f32(-1.0f);
+    int i;
+
+    for (i = 0; i + 8 <= num; i += 8) {
+        const float32x4_t fa = vminq_f32(vmaxq_f32(vld1q_f32(&src[i]), minus_one), one);
+        const float32x4_t fb = vminq_f32(vmaxq_f32(vld1q_f32(&src[i + 4]), minus_one), one);
+        const int32x4_t a = vcvtq_s32_f32(vmulq_n_f32(vaddq_f32(fa, one), 127.0f));
+        const int32x4_t b = vcvtq_s32_f32(vmulq_n_f32(vaddq_f32(fb, one), 127.0f));
+        const uint16x8_t words = vcombine_u16(vqmovun_s32(a), vqmovun_s32(b));
+        vst1_u8(&dst[i], vqmovn_u16(words));
+    }
+    for (; i < num; i++) {
+        SCALAR_F32_TO_U8(dst, src, i);
+    }
+}
+#endif /* HAVE_NEON_TYPECVT */
+
+/* The filters only differ in the kernel they run, generate them all. */
+#define TYPECVT_FILTER(simd, from, to, fromtype, totype, dst_fmt) \
+static void SDLCALL \
+SDL_Convert_##from##_to_##to##_Filter_##simd(SDL_AudioCVT * cvt, SDL_AudioFormat format) \
+{ \
+    const int num = cvt->len_cvt / sizeof (fromtype); \
+    SDL_Convert_##from##_to_##to##_##simd((totype *) cvt->buf, (const fromtype *) cvt->buf, num); \
+    cvt->len_cvt = num * sizeof (totype); \
+    if (cvt->filters[++cvt->filter_index]) { \
+        cvt->filters[cvt->filter_index] (cvt, dst_fmt); \
+    } \
+}
+
+#define TYPECVT_FILTERS(simd) \
+    TYPECVT_FILTER(simd, S16, F32, Sint16, float, AUDIO_F32SYS) \
+    TYPECVT_FILTER(simd, F32, S16, float, Sint16, AUDIO_S16SYS) \
+    TYPECVT_FILTER(simd, S32, F32, Sint32, float, AUDIO_F32SYS) \
+    TYPECVT_FILTER(simd, F32, S32, float, Sint32, AUDIO_S32SYS) \
+    TYPECVT_FILTER(simd, U8, F32, Uint8, float, AUDIO_F32SYS) \
+    TYPECVT_FILTER(simd, F32, U8, float, Uint8, AUDIO_U8)
+
+#define TYPECVT_CHOOSE(simd) \
+    if (src_fmt == AUDIO_S16SYS && dst_fmt == AUDIO_F32SYS) { \
+        return SDL_Convert_S16_to_F32_Filter_##simd; \
+    } else if (src_fmt == AUDIO_F32SYS && dst_fmt == AUDIO_S16SYS) { \
+        return SDL_Convert_F32_to_S16_Filter_##simd; \
+    } else if (src_fmt == AUDIO_S32SYS && dst_fmt == AUDIO_F32SYS) { \
+        return SDL_Convert_S32_to_F32_Filter_##simd; \
+    } else if (src_fmt == AUDIO_F32SYS && dst_fmt == AUDIO_S32SYS) { \
+        return SDL_Convert_F32_to_S32_Filter_##simd; \
+    } else if (src_fmt == AUDIO_U8 && dst_fmt == AUDIO_F32SYS) { \
+        return SDL_Convert_U8_to_F32_Filter_##simd; \
+    } else if (src_fmt == AUDIO_F32SYS && dst_fmt == AUDIO_U8) { \
+        return SDL_Convert_F32_to_U8_Filter_##simd; \
+    }
+
+#ifdef __SSE2__
+TYPECVT_FILTERS(SSE2)
+#endif
+#if HAVE_AVX2_TYPECVT
+TYPECVT_FILTERS(AVX2)
+#endif
+#if HAVE_NEON_TYPECVT
+TYPECVT_FILTERS(NEON)
+#endif
+
+#if HAVE_NEON_TYPECVT || HAVE_AVX2_TYPECVT || defined(__SSE2__)
+/* SDL_HINT_AUDIO_SIMD_CONVERTERS can also name the only converters to use,
+   if the CPU supports them. */
+static SDL_bool
+SDL_WantTypeCVT(const char *simd)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_AUDIO_SIMD_CONVERTERS);
+
+    if (!hint || !*hint || SDL_strcmp(hint, "1") == 0 || SDL_strcasecmp(hint, "true") == 0) {
+        return SDL_TRUE;
+    }
+    return (SDL_strcasecmp(hint, simd) == 0) ? SDL_TRUE : SDL_FALSE;
+}
+#endif
+
 static SDL_AudioFilter
 SDL_HandTunedTypeCVT(SDL_AudioFormat src_fmt, SDL_AudioFormat dst_fmt)
 {
@@ -841,6 +1999,25 @@ SDL_HandTunedTypeCVT(SDL_AudioFormat src_fmt, SDL_AudioFormat dst_fmt)
      * Fill in any future conversions that are specialized to a
      *  processor, platform, compiler, or library here.
      */
+    if (!SDL_GetHintBoolean(SDL_HINT_AUDIO_SIMD_CONVERTERS, SDL_TRUE)) {
+        return NULL;
+    }
+
+#if HAVE_NEON_TYPECVT
+    if (SDL_WantTypeCVT("neon")) {
+        TYPECVT_CHOOSE(NEON)
+    }
+#endif
+#if HAVE_AVX2_TYPECVT
+    if (SDL_WantTypeCVT("avx2") && SDL_HasAVX2()) {
+        TYPECVT_CHOOSE(AVX2)
+    }
+#endif
+#ifdef __SSE2__
+    if (SDL_WantTypeCVT("sse2") && SDL_HasSSE2()) {
+        TYPECVT_CHOOSE(SSE2)
+    }
+#endif
 
     return NULL;                /* no specialized converter code available. */
 }
@@ -907,39 +2084,6 @@ SDL_HandTunedResampleCVT(SDL_AudioCVT * cvt, int dst_channels,
     return NULL;                /* no specialized converter code available. */
 }
 
-static int
-SDL_FindFrequencyMultiple(const int src_rate, const int dst_rate)
-{
-    int retval = 0;
-
-    /* If we only built with the arbitrary resamplers, ignore multiples. */
-#if !LESS_RESAMPLERS
-    int lo, hi;
-    int div;
-
-    SDL_assert(src_rate != 0);
-    SDL_assert(dst_rate != 0);
-    SDL_assert(src_rate != dst_rate);
-
-    if (src_rate < dst_rate) {
-        lo = src_rate;
-        hi = dst_rate;
-    } else {
-        lo = dst_rate;
-        hi = src_rate;
-    }
-
-    /* zero means "not a supported multiple" ... we only do 2x and 4x. */
-    if ((hi % lo) != 0)
-        return 0;               /* not a multiple. */
-
-    div = hi / lo;
-    retval = ((div == 2) || (div == 4)) ? div : 0;
-#endif
-
-    return retval;
-}
-
 static int
 SDL_BuildAudioResampleCVT(SDL_AudioCVT * cvt, int dst_channels,
                           int src_rate, int dst_rate)
@@ -948,37 +2092,39 @@ SDL_BuildAudioResampleCVT(SDL_AudioCVT * cvt, int dst_channels,
         SDL_AudioFilter filter = SDL_HandTunedResampleCVT(cvt, dst_channels,
                                                           src_rate, dst_rate);
 
-        /* No hand-tuned converter? Try the autogenerated ones. */
+        /* No hand-tuned converter? Use the polyphase resampler. */
         if (filter == NULL) {
-            int i;
-            const int upsample = (src_rate < dst_rate) ? 1 : 0;
-            const int multiple =
-                SDL_FindFrequencyMultiple(src_rate, dst_rate);
-
-            for (i = 0; sdl_audio_rate_filters[i].filter != NULL; i++) {
-                const SDL_AudioRateFilters *filt = &sdl_audio_rate_filters[i];
-                if ((filt->fmt == cvt->dst_format) &&
-                    (filt->channels == dst_channels) &&
-                    (filt->upsample == upsample) &&
-                    (filt->multiple == multiple)) {
-                    filter = filt->filter;
-                    break;
-                }
+            SDL_ResampleFilter *resampler;
+
+            switch (dst_channels) {
+            case 1: filter = SDL_ResampleCVT_1; break;
+            case 2: filter = SDL_ResampleCVT_2; break;
+            case 4: filter = SDL_ResampleCVT_4; break;
+            case 6: filter = SDL_ResampleCVT_6; break;
+            case 8: filter = SDL_ResampleCVT_8; break;
+            default:
+                SDL_SetError("No conversion available for these rates");
+                return -1;
             }
 
-            if (filter == NULL) {
-                SDL_SetError("No conversion available for these rates");
+            /* Build the filter table now, so running out of memory is
+               reported here rather than in SDL_ConvertAudio(). */
+            resampler = SDL_AcquireResampleFilter(src_rate, dst_rate);
+            if (resampler == NULL) {
                 return -1;
             }
+            SDL_ReleaseResampleFilter(resampler);
         }
 
         /* Update (cvt) with filter details... */
         cvt->filters[cvt->filter_index++] = filter;
         if (src_rate < dst_rate) {
             const double mult = ((double) dst_rate) / ((double) src_rate);
-            cvt->len_mult *= (int) SDL_ceil(mult);
+            /* the output is written after the input before moving it down */
+            cvt->len_mult *= (int) SDL_ceil(mult) + 1;
             cvt->len_ratio *= mult;
         } else {
+            cvt->len_mult *= 2;
             cvt->len_ratio /= ((double) src_rate) / ((double) dst_rate);
         }
 
@@ -1043,8 +2189,13 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
     cvt->len_ratio = 1.0;
     cvt->rate_incr = ((double) dst_rate) / ((double) src_rate);
 
-    /* Convert data types, if necessary. Updates (cvt). */
-    if (SDL_BuildAudioTypeCVT(cvt, src_fmt, dst_fmt) == -1) {
+    /* Convert data types, if necessary. Updates (cvt). The resampler
+       works in float, so go through that when the rates differ. */
+    if (src_rate != dst_rate) {
+        if (SDL_BuildAudioTypeCVT(cvt, src_fmt, AUDIO_F32SYS) == -1) {
+            return -1;
+        }
+    } else if (SDL_BuildAudioTypeCVT(cvt, src_fmt, dst_fmt) == -1) {
         return -1;              /* shouldn't happen, but just in case... */
     }
 
@@ -1100,10 +2251,15 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
     }
 
     /* Do rate conversion, if necessary. Updates (cvt). */
-    if (SDL_BuildAudioResampleCVT(cvt, dst_channels, src_rate, dst_rate) ==
+    if (SDL_BuildAudioResampleCVT(cvt, src_channels, src_rate, dst_rate) ==
         -1) {
         return -1;              /* shouldn't happen, but just in case... */
     }
+    if (src_rate != dst_rate) {
+        if (SDL_BuildAudioTypeCVT(cvt, AUDIO_F32SYS, dst_fmt) == -1) {
+            return -1;
+        }
+    }
 
     /* Set up the filter information */
     if (cvt->filter_index != 0) {
@@ -1118,4 +2274,334 @@ SDL_BuildAudioCVT(SDL_AudioCVT * cvt,
 }
 
 
+/* Audio streams: SDL_AudioCVT for the format and channel conversion, the
+   bandlimited resampler above for the rate, and a FIFO of output bytes. */
+
+/* Input is converted this many sample frames at a time, which bounds the
+   size of the work buffer no matter how much is put at once. */
+#define SDL_AUDIOSTREAM_CHUNK_FRAMES 4096
+
+struct _SDL_AudioStream
+{
+    SDL_AudioFormat src_format;
+    Uint8 src_channels;
+    int src_rate;
+    SDL_AudioFormat dst_format;
+    Uint8 dst_channels;
+    int dst_rate;
+    int src_frame_size;
+    int dst_frame_size;
+
+    /* Without a resampler, cvt_before_resampling does the whole job. */
+    SDL_AudioCVT cvt_before_resampling;
+    SDL_AudioCVT cvt_after_resampling;
+    SDL_AudioResampler *resampler;
+
+    /* Scratch space for the conversion before resampling */
+    Uint8 *work_buffer;
+    int work_buffer_len;
+
+    /* A partial sample frame left over from the last put */
+    Uint8 *staging_buffer;
+    int staging_len;
+
+    /* Converted data waiting to be read, from queue[head] to queue[tail] */
+    Uint8 *queue;
+    int queue_max;
+    int queue_head;
+    int queue_tail;
+};
+
+/* Make room for (len) more bytes at the end of the queue */
+static Uint8 *
+SDL_AudioStreamReserve(SDL_AudioStream *stream, int len)
+{
+    const int queued = stream->queue_tail - stream->queue_head;
+
+    if ((stream->queue_tail + len) > stream->queue_max) {
+        /* Move what's left to the front, and grow if that wasn't enough */
+        if (stream->queue_head > 0) {
+            SDL_memmove(stream->queue, stream->queue + stream->queue_head, queued);
+            stream->queue_head = 0;
+            stream->queue_tail = queued;
+        }
+        if ((queued + len) > stream->queue_max) {
+            int newmax = stream->queue_max * 2;
+            Uint8 *ptr;
+
+            if (newmax < (queued + len)) {
+                newmax = queued + len;
+            }
+            ptr = (Uint8 *) SDL_realloc(stream->queue, newmax);
+            if (ptr == NULL) {
+                SDL_OutOfMemory();
+                return NULL;
+            }
+            stream->queue = ptr;
+            stream->queue_max = newmax;
+        }
+    }
+
+    return stream->queue + stream->queue_tail;
+}
+
+/* Run the resampler, converting its output straight into the queue */
+static int
+SDL_AudioStreamResample(SDL_AudioStream *stream, const float *inbuf, int inframes)
+{
+    const int framelen = stream->dst_channels * sizeof (float);
+    SDL_AudioCVT *cvt = &stream->cvt_after_resampling;
+    int maxframes = (int) ((((Sint64) inframes) * stream->dst_rate) / stream->src_rate) + 16;
+    int outframes;
+
+    do {
+        Uint8 *ptr = SDL_AudioStreamReserve(stream, maxframes * framelen * cvt->len_mult);
+        if (ptr == NULL) {
+            return -1;
+        }
+        outframes = SDL_ResampleAudio(stream->resampler, inbuf, inframes, (float *) ptr, maxframes);
+        if (outframes < 0) {
+            return -1;
+        }
+        inframes = 0;  /* the rest comes out of the resampler's history */
+
+        if (cvt->needed) {
+            cvt->buf = ptr;
+            cvt->len = outframes * framelen;
+            SDL_ConvertAudio(cvt);
+            stream->queue_tail += cvt->len_cvt;
+        } else {
+            stream->queue_tail += outframes * framelen;
+        }
+    } while (outframes == maxframes);
+
+    return 0;
+}
+
+/* Convert (len) bytes of whole sample frames into the queue */
+static int
+SDL_AudioStreamConvert(SDL_AudioStream *stream, const Uint8 *buf, int len)
+{
+    SDL_AudioCVT *cvt = &stream->cvt_before_resampling;
+
+    while (len > 0) {
+        const int chunk = SDL_min(len, SDL_AUDIOSTREAM_CHUNK_FRAMES * stream->src_frame_size);
+        const int needed = chunk * cvt->len_mult;
+        Uint8 *ptr;
+
+        if (stream->resampler == NULL) {
+            /* Convert in place at the end of the queue; a single copy */
+            ptr = SDL_AudioStreamReserve(stream, needed);
+            if (ptr == NULL) {
+                return -1;
+            }
+        } else {
+            if (needed > stream->work_buffer_len) {
+                ptr = (Uint8 *) SDL_realloc(stream->work_buffer, needed);
+                if (ptr == NULL) {
+                    return SDL_OutOfMemory();
+                }
+                stream->work_buffer = ptr;
+                stream->work_buffer_len = needed;
+            }
+            ptr = stream->work_buffer;
+        }
+
+        SDL_memcpy(ptr, buf, chunk);
+        if (cvt->needed) {
+            cvt->buf = ptr;
+            cvt->len = chunk;
+            SDL_ConvertAudio(cvt);
+        } else {
+            cvt->len_cvt = chunk;
+        }
+
+        if (stream->resampler == NULL) {
+            stream->queue_tail += cvt->len_cvt;
+        } else if (SDL_AudioStreamResample(stream, (const float *) ptr,
+                       cvt->len_cvt / (stream->dst_channels * sizeof (float))) < 0) {
+            return -1;
+        }
+
+        buf += chunk;
+        len -= chunk;
+    }
+
+    return 0;
+}
+
+SDL_AudioStream *
+SDL_NewAudioStream(const SDL_AudioFormat src_format,
+                   const Uint8 src_channels,
+                   const int src_rate,
+                   const SDL_AudioFormat dst_format,
+                   const Uint8 dst_channels,
+                   const int dst_rate)
+{
+    SDL_AudioStream *stream;
+
+    stream = (SDL_AudioStream *) SDL_calloc(1, sizeof (SDL_AudioStream));
+    if (stream == NULL) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    stream->src_format = src_format;
+    stream->src_channels = src_channels;
+    stream->src_rate = src_rate;
+    stream->dst_format = dst_format;
+    stream->dst_channels = dst_channels;
+    stream->dst_rate = dst_rate;
+    stream->src_frame_size = (SDL_AUDIO_BITSIZE(src_format) / 8) * src_channels;
+    stream->dst_frame_size = (SDL_AUDIO_BITSIZE(dst_format) / 8) * dst_channels;
+
+    if (src_rate != dst_rate) {
+        /* Resample in float, with the destination channel layout */
+        if ((SDL_BuildAudioCVT(&stream->cvt_before_resampling,
+                               src_format, src_channels, src_rate,
+                               AUDIO_F32SYS, dst_channels, src_rate) < 0) ||
+            (SDL_BuildAudioCVT(&stream->cvt_after_resampling,
+                               AUDIO_F32SYS, dst_channels, dst_rate,
+                               dst_format, dst_channels, dst_rate) < 0)) {
+            SDL_FreeAudioStream(stream);
+            return NULL;
+        }
+        stream->resampler = SDL_CreateAudioResampler(dst_channels, src_rate, dst_rate);
+        if (stream->resampler == NULL) {
+            SDL_FreeAudioStream(stream);
+            return NULL;
+        }
+    } else if (SDL_BuildAudioCVT(&stream->cvt_before_resampling,
+                                 src_format, src_channels, src_rate,
+                                 dst_format, dst_channels, dst_rate) < 0) {
+        SDL_FreeAudioStream(stream);
+        return NULL;
+    }
+
+    stream->staging_buffer = (Uint8 *) SDL_malloc(stream->src_frame_size);
+    if (stream->staging_buffer == NULL) {
+        SDL_FreeAudioStream(stream);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+
+    return stream;
+}
+
+int
+SDL_AudioStreamPut(SDL_AudioStream *stream, const void *buf, int len)
+{
+    const Uint8 *ptr = (const Uint8 *) buf;
+    int whole;
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (!buf) {
+        return SDL_InvalidParamError("buf");
+    } else if (len <= 0) {
+        return 0;
+    }
+
+    /* Finish off a sample frame split across two puts */
+    if (stream->staging_len > 0) {
+        const int cpy = SDL_min(len, stream->src_frame_size - stream->staging_len);
+        SDL_memcpy(stream->staging_buffer + stream->staging_len, ptr, cpy);
+        stream->staging_len += cpy;
+        ptr += cpy;
+        len -= cpy;
+        if (stream->staging_len < stream->src_frame_size) {
+            return 0;
+        }
+        stream->staging_len = 0;
+        if (SDL_AudioStreamConvert(stream, stream->staging_buffer, stream->src_frame_size) < 0) {
+            return -1;
+        }
+    }
+
+    whole = len - (len % stream->src_frame_size);
+    if (SDL_AudioStreamConvert(stream, ptr, whole) < 0) {
+        return -1;
+    }
+
+    /* Hold on to the start of the next frame */
+    stream->staging_len = len - whole;
+    SDL_memcpy(stream->staging_buffer, ptr + whole, stream->staging_len);
+    return 0;
+}
+
+int
+SDL_AudioStreamGet(SDL_AudioStream *stream, void *buf, int len)
+{
+    int cpy;
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    } else if (!buf) {
+        return SDL_InvalidParamError("buf");
+    } else if (len <= 0) {
+        return 0;
+    } else if ((len % stream->dst_frame_size) != 0) {
+        return SDL_SetError("Can't request partial sample frames");
+    }
+
+    cpy = SDL_min(len, stream->queue_tail - stream->queue_head);
+    SDL_memcpy(buf, stream->queue + stream->queue_head, cpy);
+    stream->queue_head += cpy;
+    if (stream->queue_head == stream->queue_tail) {
+        stream->queue_head = stream->queue_tail = 0;
+    }
+    return cpy;
+}
+
+int
+SDL_AudioStreamAvailable(SDL_AudioStream *stream)
+{
+    return stream ? (stream->queue_tail - stream->queue_head) : 0;
+}
+
+int
+SDL_AudioStreamFlush(SDL_AudioStream *stream)
+{
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+
+    /* A partial frame can't be converted, so it's dropped. */
+    stream->staging_len = 0;
+
+    if (stream->resampler != NULL) {
+        if (SDL_FlushAudioResampler(stream->resampler) < 0) {
+            return -1;
+        }
+        return SDL_AudioStreamResample(stream, NULL, 0);
+    }
+    return 0;
+}
+
+void
+SDL_AudioStreamClear(SDL_AudioStream *stream)
+{
+    if (!stream) {
+        SDL_InvalidParamError("stream");
+    } else {
+        stream->queue_head = stream->queue_tail = 0;
+        stream->staging_len = 0;
+        if (stream->resampler != NULL) {
+            SDL_ResetAudioResampler(stream->resampler);
+        }
+    }
+}
+
+void
+SDL_FreeAudioStream(SDL_AudioStream *stream)
+{
+    if (stream) {
+        SDL_FreeAudioResampler(stream->resampler);
+        SDL_free(stream->work_buffer);
+        SDL_free(stream->staging_buffer);
+        SDL_free(stream->queue);
+        SDL_free(stream);
+    }
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
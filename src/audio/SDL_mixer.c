@@ -85,6 +85,309 @@ static const Uint8 mix8[] = {
 #define ADJUST_VOLUME(s, v) (s = (s*v)/SDL_MIX_MAXVOLUME)
 #define ADJUST_VOLUME_U8(s, v)  (s = (((s-128)*v)/SDL_MIX_MAXVOLUME)+128)
 
+/* Native endian S16 and F32 are what nearly everyone mixes in, so those
+   get vectorized paths. These mix any number of sources at once, adding
+   up in a wider accumulator and only clipping at the end, so each source
+   and the destination are only touched once. */
+
+#if HAVE_AVX2_INTRINSICS
+#define HAVE_AVX2_MIXER 1
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define HAVE_NEON_MIXER 1
+#include <arm_neon.h>
+#endif
+
+static void
+SDL_MixS16_Scalar(Sint16 * dst, const Sint16 * const * src,
+                  const int *volume, int num_src, int start, int num)
+{
+    const int max_audioval = ((1 << (16 - 1)) - 1);
+    const int min_audioval = -(1 << (16 - 1));
+    int i, j;
+
+    for (i = start; i < num; ++i) {
+        int dst_sample = dst[i];
+        for (j = 0; j < num_src; ++j) {
+            int src_sample = src[j][i];
+            ADJUST_VOLUME(src_sample, volume[j]);
+            dst_sample += src_sample;
+        }
+        if (dst_sample > max_audioval) {
+            dst_sample = max_audioval;
+        } else if (dst_sample < min_audioval) {
+            dst_sample = min_audioval;
+        }
+        dst[i] = (Sint16) dst_sample;
+    }
+}
+
+static void
+SDL_MixF32_Scalar(float * dst, const float * const * src,
+                  const int *volume, int num_src, int start, int num)
+{
+    const float fmaxvolume = 1.0f / ((float) SDL_MIX_MAXVOLUME);
+    const float max_audioval = 3.402823466e+38F;
+    const float min_audioval = -3.402823466e+38F;
+    int i, j;
+
+    for (i = start; i < num; ++i) {
+        float dst_sample = dst[i];
+        for (j = 0; j < num_src; ++j) {
+            dst_sample += (src[j][i] * (float) volume[j]) * fmaxvolume;
+        }
+        if (dst_sample > max_audioval) {
+            dst_sample = max_audioval;
+        } else if (dst_sample < min_audioval) {
+            dst_sample = min_audioval;
+        }
+        dst[i] = dst_sample;
+    }
+}
+
+#ifdef __SSE2__
+/* (s * volume) / SDL_MIX_MAXVOLUME for eight samples, rounding toward
+   zero like ADJUST_VOLUME does, as two vectors of 32-bit values. */
+static SDL_INLINE void
+SDL_AdjustVolumeS16_SSE2(__m128i samples, __m128i volume, __m128i *lo, __m128i *hi)
+{
+    const __m128i bias = _mm_set1_epi32(SDL_MIX_MAXVOLUME - 1);
+    const __m128i plo = _mm_mullo_epi16(samples, volume);
+    const __m128i phi = _mm_mulhi_epi16(samples, volume);
+    __m128i a = _mm_unpacklo_epi16(plo, phi);
+    __m128i b = _mm_unpackhi_epi16(plo, phi);
+    a = _mm_add_epi32(a, _mm_and_si128(_mm_srai_epi32(a, 31), bias));
+    b = _mm_add_epi32(b, _mm_and_si128(_mm_srai_epi32(b, 31), bias));
+    *lo = _mm_srai_epi32(a, 7);
+    *hi = _mm_srai_epi32(b, 7);
+}
+
+static void
+SDL_MixS16_SSE2(Sint16 * dst, const Sint16 * const * src,
+                const int *volume, int num_src, int num)
+{
+    int i, j;
+
+    for (i = 0; i + 8 <= num; i += 8) {
+        const __m128i d = _mm_loadu_si128((const __m128i *) &dst[i]);
+        __m128i acclo = _mm_srai_epi32(_mm_unpacklo_epi16(d, d), 16);
+        __m128i acchi = _mm_srai_epi32(_mm_unpackhi_epi16(d, d), 16);
+        for (j = 0; j < num_src; ++j) {
+            const __m128i s = _mm_loadu_si128((const __m128i *) &src[j][i]);
+            __m128i lo, hi;
+            if (volume[j] == SDL_MIX_MAXVOLUME) {
+                lo = _mm_srai_epi32(_mm_unpacklo_epi16(s, s), 16);
+                hi = _mm_srai_epi32(_mm_unpackhi_epi16(s, s), 16);
+            } else {
+                SDL_AdjustVolumeS16_SSE2(s, _mm_set1_epi16((Sint16) volume[j]), &lo, &hi);
+            }
+            acclo = _mm_add_epi32(acclo, lo);
+            acchi = _mm_add_epi32(acchi, hi);
+        }
+        _mm_storeu_si128((__m128i *) &dst[i], _mm_packs_epi32(acclo, acchi));
+    }
+    SDL_MixS16_Scalar(dst, src, volume, num_src, i, num);
+}
+#endif /* __SSE2__ */
+
+#ifdef __SSE__
+static void
+SDL_MixF32_SSE(float * dst, const float * const * src,
+               const int *volume, int num_src, int num)
+{
+    const __m128 fmaxvolume = _mm_set1_ps(1.0f / ((float) SDL_MIX_MAXVOLUME));
+    const __m128 max_audioval = _mm_set1_ps(3.402823466e+38F);
+    const __m128 min_audioval = _mm_set1_ps(-3.402823466e+38F);
+    int i, j;
+
+    for (i = 0; i + 8 <= num; i += 8) {
+        __m128 acc0 = _mm_loadu_ps(&dst[i]);
+        __m128 acc1 = _mm_loadu_ps(&dst[i + 4]);
+        for (j = 0; j < num_src; ++j) {
+            const __m128 fvolume = _mm_set1_ps((float) volume[j]);
+            const __m128 s0 = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(&src[j][i]), fvolume), fmaxvolume);
+            const __m128 s1 = _mm_mul_ps(_mm_mul_ps(_mm_loadu_ps(&src[j][i + 4]), fvolume), fmaxvolume);
+            acc0 = _mm_add_ps(acc0, s0);
+            acc1 = _mm_add_ps(acc1, s1);
+        }
+        _mm_storeu_ps(&dst[i], _mm_max_ps(_mm_min_ps(acc0, max_audioval), min_audioval));
+        _mm_storeu_ps(&dst[i + 4], _mm_max_ps(_mm_min_ps(acc1, max_audioval), min_audioval));
+    }
+    SDL_MixF32_Scalar(dst, src, volume, num_src, i, num);
+}
+#endif /* __SSE__ */
+
+#if HAVE_AVX2_MIXER
+static void SDL_TARGETING("avx2")
+SDL_MixS16_AVX2(Sint16 * dst, const Sint16 * const * src,
+                const int *volume, int num_src, int num)
+{
+    const __m256i bias = _mm256_set1_epi32(SDL_MIX_MAXVOLUME - 1);
+    int i, j;
+
+    /* The unpacks and packs all work within 128-bit lanes, so the
+       samples end up back where they started. */
+    for (i = 0; i + 16 <= num; i += 16) {
+        const __m256i d = _mm256_loadu_si256((const __m256i *) &dst[i]);
+        __m256i acclo = _mm256_srai_epi32(_mm256_unpacklo_epi16(d, d), 16);
+        __m256i acchi = _mm256_srai_epi32(_mm256_unpackhi_epi16(d, d), 16);
+        for (j = 0; j < num_src; ++j) {
+            const __m256i s = _mm256_loadu_si256((const __m256i *) &src[j][i]);
+            __m256i lo, hi;
+            if (volume[j] == SDL_MIX_MAXVOLUME) {
+                lo = _mm256_srai_epi32(_mm256_unpacklo_epi16(s, s), 16);
+                hi = _mm256_srai_epi32(_mm256_unpackhi_epi16(s, s), 16);
+            } else {
+                const __m256i v = _mm256_set1_epi16((Sint16) volume[j]);
+                const __m256i plo = _mm256_mullo_epi16(s, v);
+                const __m256i phi = _mm256_mulhi_epi16(s, v);
+                lo = _mm256_unpacklo_epi16(plo, phi);
+                hi = _mm256_unpackhi_epi16(plo, phi);
+                lo = _mm256_srai_epi32(_mm256_add_epi32(lo, _mm256_and_si256(_mm256_srai_epi32(lo, 31), bias)), 7);
+                hi = _mm256_srai_epi32(_mm256_add_epi32(hi, _mm256_and_si256(_mm256_srai_epi32(hi, 31), bias)), 7);
+            }
+            acclo = _mm256_add_epi32(acclo, lo);
+            acchi = _mm256_add_epi32(acchi, hi);
+        }
+        _mm256_storeu_si256((__m256i *) &dst[i], _mm256_packs_epi32(acclo, acchi));
+    }
+    SDL_MixS16_Scalar(dst, src, volume, num_src, i, num);
+}
+
+static void SDL_TARGETING("avx2")
+SDL_MixF32_AVX2(float * dst, const float * const * src,
+                const int *volume, int num_src, int num)
+{
+    const __m256 fmaxvolume = _mm256_set1_ps(1.0f / ((float) SDL_MIX_MAXVOLUME));
+    const __m256 max_audioval = _mm256_set1_ps(3.402823466e+38F);
+    const __m256 min_audioval = _mm256_set1_ps(-3.402823466e+38F);
+    int i, j;
+
+    for (i = 0; i + 16 <= num; i += 16) {
+        __m256 acc0 = _mm256_loadu_ps(&dst[i]);
+        __m256 acc1 = _mm256_loadu_ps(&dst[i + 8]);
+        for (j = 0; j < num_src; ++j) {
+            const __m256 fvolume = _mm256_set1_ps((float) volume[j]);
+            const __m256 s0 = _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[j][i]), fvolume), fmaxvolume);
+            const __m256 s1 = _mm256_mul_ps(_mm256_mul_ps(_mm256_loadu_ps(&src[j][i + 8]), fvolume), fmaxvolume);
+            acc0 = _mm256_add_ps(acc0, s0);
+            acc1 = _mm256_add_ps(acc1, s1);
+        }
+        _mm256_storeu_ps(&dst[i], _mm256_max_ps(_mm256_min_ps(acc0, max_audioval), min_audioval));
+        _mm256_storeu_ps(&dst[i + 8], _mm256_max_ps(_mm256_min_ps(acc1, max_audioval), min_audioval));
+    }
+    SDL_MixF32_Scalar(dst, src, volume, num_src, i, num);
+}
+#endif /* HAVE_AVX2_MIXER */
+
+#if HAVE_NEON_MIXER
+static SDL_INLINE int32x4_t
+SDL_AdjustVolumeS16_NEON(int16x4_t samples, int16x4_t volume)
+{
+    const int32x4_t product = vmull_s16(samples, volume);
+    const int32x4_t bias = vandq_s32(vshrq_n_s32(product, 31), vdupq_n_s32(SDL_MIX_MAXVOLUME - 1));
+    return vshrq_n_s32(vaddq_s32(product, bias), 7);
+}
+
+static void
+SDL_MixS16_NEON(Sint16 * dst, const Sint16 * const * src,
+                const int *volume, int num_src, int num)
+{
+    int i, j;
+
+    for (i = 0; i + 8 <= num; i += 8) {
+        const int16x8_t d = vld1q_s16(&dst[i]);
+        int32x4_t acclo = vmovl_s16(vget_low_s16(d));
+        int32x4_t acchi = vmovl_s16(vget_high_s16(d));
+        for (j = 0; j < num_src; ++j) {
+            const int16x8_t s = vld1q_s16(&src[j][i]);
+            if (volume[j] == SDL_MIX_MAXVOLUME) {
+                acclo = vaddq_s32(acclo, vmovl_s16(vget_low_s16(s)));
+                acchi = vaddq_s32(acchi, vmovl_s16(vget_high_s16(s)));
+            } else {
+                const int16x4_t v = vdup_n_s16((Sint16) volume[j]);
+                acclo = vaddq_s32(acclo, SDL_AdjustVolumeS16_NEON(vget_low_s16(s), v));
+                acchi = vaddq_s32(acchi, SDL_AdjustVolumeS16_NEON(vget_high_s16(s), v));
+            }
+        }
+        vst1q_s16(&dst[i], vcombine_s16(vqmovn_s32(acclo), vqmovn_s32(acchi)));
+    }
+    SDL_MixS16_Scalar(dst, src, volume, num_src, i, num);
+}
+
+static void
+SDL_MixF32_NEON(float * dst, const float * const * src,
+                const int *volume, int num_src, int num)
+{
+    const float fmaxvolume = 1.0f / ((float) SDL_MIX_MAXVOLUME);
+    const float32x4_t max_audioval = vdupq_n_f32(3.402823466e+38F);
+    const float32x4_t min_audioval = vdupq_n_f32(-3.402823466e+38F);
+    int i, j;
+
+    for (i = 0; i + 8 <= num; i += 8) {
+        float32x4_t acc0 = vld1q_f32(&dst[i]);
+        float32x4_t acc1 = vld1q_f32(&dst[i + 4]);
+        for (j = 0; j < num_src; ++j) {
+            const float fvolume = (float) volume[j];
+            acc0 = vaddq_f32(acc0, vmulq_n_f32(vmulq_n_f32(vld1q_f32(&src[j][i]), fvolume), fmaxvolume));
+            acc1 = vaddq_f32(acc1, vmulq_n_f32(vmulq_n_f32(vld1q_f32(&src[j][i + 4]), fvolume), fmaxvolume));
+        }
+        vst1q_f32(&dst[i], vmaxq_f32(vminq_f32(acc0, max_audioval), min_audioval));
+        vst1q_f32(&dst[i + 4], vmaxq_f32(vminq_f32(acc1, max_audioval), min_audioval));
+    }
+    SDL_MixF32_Scalar(dst, src, volume, num_src, i, num);
+}
+#endif /* HAVE_NEON_MIXER */
+
+static void
+SDL_MixS16(Sint16 * dst, const Sint16 * const * src,
+           const int *volume, int num_src, int num)
+{
+#if HAVE_NEON_MIXER
+    SDL_MixS16_NEON(dst, src, volume, num_src, num);
+#else
+#if HAVE_AVX2_MIXER
+    if (SDL_HasAVX2()) {
+        SDL_MixS16_AVX2(dst, src, volume, num_src, num);
+        return;
+    }
+#endif
+#ifdef __SSE2__
+    if (SDL_HasSSE2()) {
+        SDL_MixS16_SSE2(dst, src, volume, num_src, num);
+        return;
+    }
+#endif
+    SDL_MixS16_Scalar(dst, src, volume, num_src, 0, num);
+#endif
+}
+
+static void
+SDL_MixF32(float * dst, const float * const * src,
+           const int *volume, int num_src, int num)
+{
+#if HAVE_NEON_MIXER
+    SDL_MixF32_NEON(dst, src, volume, num_src, num);
+#else
+#if HAVE_AVX2_MIXER
+    if (SDL_HasAVX2()) {
+        SDL_MixF32_AVX2(dst, src, volume, num_src, num);
+        return;
+    }
+#endif
+#ifdef __SSE__
+    if (SDL_HasSSE()) {
+        SDL_MixF32_SSE(dst, src, volume, num_src, num);
+        return;
+    }
+#endif
+    SDL_MixF32_Scalar(dst, src, volume, num_src, 0, num);
+#endif
+}
+
+
 
 void
 SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
@@ -94,6 +397,16 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
         return;
     }
 
+    if (format == AUDIO_S16SYS) {
+        const Sint16 *src16 = (const Sint16 *) src;
+        SDL_MixS16((Sint16 *) dst, &src16, &volume, 1, len / 2);
+        return;
+    } else if (format == AUDIO_F32SYS) {
+        const float *src32 = (const float *) src;
+        SDL_MixF32((float *) dst, &src32, &volume, 1, len / 4);
+        return;
+    }
+
     switch (format) {
 
     case AUDIO_U8:
@@ -366,4 +679,27 @@ SDL_MixAudioFormat(Uint8 * dst, const Uint8 * src, SDL_AudioFormat format,
     }
 }
 
+void
+SDL_MixAudioFormatMulti(Uint8 * dst, const Uint8 ** src, SDL_AudioFormat format,
+                        Uint32 len, const int *volume, int num_src)
+{
+    int i;
+
+    if (!dst || !src || !volume) {
+        SDL_InvalidParamError(!dst ? "dst" : !src ? "src" : "volume");
+        return;
+    }
+
+    if (format == AUDIO_S16SYS) {
+        SDL_MixS16((Sint16 *) dst, (const Sint16 * const *) src, volume, num_src, len / 2);
+    } else if (format == AUDIO_F32SYS) {
+        SDL_MixF32((float *) dst, (const float * const *) src, volume, num_src, len / 4);
+    } else {
+        /* Everything else mixes one source at a time */
+        for (i = 0; i < num_src; ++i) {
+            SDL_MixAudioFormat(dst, src[i], format, len, volume[i]);
+        }
+    }
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -50,25 +50,47 @@ extern void SDL_RemoveAudioDevice(const int iscapture, void *handle);
 extern void SDL_OpenedAudioDeviceDisconnected(SDL_AudioDevice *device);
 
 
-/* This is the size of a packet when using SDL_QueueAudio(). We allocate
-   these as necessary and pool them, under the assumption that we'll
-   eventually end up with a handful that keep recycling, meeting whatever
-   the app needs. We keep packing data tightly as more arrives to avoid
-   wasting space, and if we get a giant block of data, we'll split them
-   into multiple packets behind the scenes. My expectation is that most
-   apps will have 2-3 of these in the pool. 8k should cover most needs, but
-   if this is crippling for some embedded system, we can #ifdef this.
-   The system preallocates enough packets for 2 callbacks' worth of data. */
-#define SDL_AUDIOBUFFERQUEUE_PACKETLEN (8 * 1024)
-
-/* Used by apps that queue audio instead of using the callback. */
-typedef struct SDL_AudioBufferQueue
+/* This is the smallest ring we allocate when using SDL_QueueAudio(). The
+   ring starts out big enough for 2 callbacks' worth of data and doubles
+   whenever the app queues more than fits, so it quickly settles at
+   whatever size the app needs and then never allocates again. */
+#define SDL_AUDIOQUEUE_MINSIZE (8 * 1024)
+
+/* Storage for an SDL_AudioQueue, allocated along with its data. */
+typedef struct SDL_AudioQueueRing
 {
-    Uint8 data[SDL_AUDIOBUFFERQUEUE_PACKETLEN];  /* packet data. */
-    Uint32 datalen;  /* bytes currently in use in this packet. */
-    Uint32 startpos;  /* bytes currently consumed in this packet. */
-    struct SDL_AudioBufferQueue *next;  /* next item in linked list. */
-} SDL_AudioBufferQueue;
+    Uint8 *data;
+    Uint32 size;  /* bytes of storage, always a power of two. */
+    struct SDL_AudioQueueRing *next;  /* on the retired list. */
+} SDL_AudioQueueRing;
+
+/* Used by apps that queue audio instead of using the callback.
+
+   This is a single producer, single consumer ring. One side is the audio
+   thread; the other is the application, which holds (lock) to keep its
+   own threads out. Each side only moves its own position, and neither
+   waits on the other; only SDL_ClearQueuedAudio() holds the device lock
+   as well, to move the consumer's position.
+
+   The positions keep counting across rings, so the producer can grow the
+   queue by copying it into a bigger ring and publishing that in (pending).
+   The consumer switches to it the next time it reads and puts the ring it
+   was reading on the (retired) list, which the producer frees later. Only
+   playback grows; the audio thread produces for capture, so its ring is
+   allocated once and anything that doesn't fit is dropped. */
+typedef struct SDL_AudioQueue
+{
+    SDL_AudioQueueRing *write_ring;  /* the newest ring, producer only. */
+    SDL_AudioQueueRing *read_ring;  /* consumer only. */
+    void *pending;  /* an SDL_AudioQueueRing the consumer hasn't picked up. */
+    void *retired;  /* SDL_AudioQueueRings the consumer is done with. */
+    SDL_atomic_t head;  /* total bytes consumed, wraps around. */
+    SDL_atomic_t tail;  /* total bytes produced, wraps around. */
+    SDL_mutex *lock;  /* held by the application's side. */
+    SDL_atomic_t max_queued_bytes;  /* high water mark. */
+    SDL_atomic_t underruns;  /* playback needed more than was queued. */
+    SDL_atomic_t dropped_bytes;  /* didn't fit in the ring. */
+} SDL_AudioQueue;
 
 typedef struct SDL_AudioDriverImpl
 {
@@ -136,15 +158,6 @@ typedef struct SDL_AudioDriver
 } SDL_AudioDriver;
 
 
-/* Streamer */
-typedef struct
-{
-    Uint8 *buffer;
-    int max_len;                /* the maximum length in bytes */
-    int read_pos, write_pos;    /* the position of the write and read heads in bytes */
-} SDL_AudioStreamer;
-
-
 /* Define the SDL audio driver structure */
 struct SDL_AudioDevice
 {
@@ -152,15 +165,14 @@ struct SDL_AudioDevice
     /* Data common to all devices */
     SDL_AudioDeviceID id;
 
-    /* The current audio specification (shared with audio thread) */
+    /* The device's current audio specification */
     SDL_AudioSpec spec;
 
-    /* An audio conversion block for audio format emulation */
-    SDL_AudioCVT convert;
+    /* The callback's expected audio specification (converted vs device's spec). */
+    SDL_AudioSpec callbackspec;
 
-    /* The streamer, if sample rate conversion necessitates it */
-    int use_streamer;
-    SDL_AudioStreamer streamer;
+    /* Stream that converts and resamples. NULL if not needed. */
+    SDL_AudioStream *stream;
 
     /* Current state flags */
     SDL_atomic_t shutdown; /* true if we are signaling the play thread to end. */
@@ -168,8 +180,11 @@ struct SDL_AudioDevice
     SDL_atomic_t paused;
     SDL_bool iscapture;
 
-    /* Fake audio buffer for when the audio hardware is busy */
-    Uint8 *fake_stream;
+    /* Scratch buffer used in the bridge between SDL and the user callback. */
+    Uint8 *work_buffer;
+
+    /* Size, in bytes, of work_buffer. */
+    Uint32 work_buffer_len;
 
     /* A mutex for locking the mixing buffers */
     SDL_mutex *mixer_lock;
@@ -178,11 +193,8 @@ struct SDL_AudioDevice
     SDL_Thread *thread;
     SDL_threadID threadid;
 
-    /* Queued buffers (if app not using callback). */
-    SDL_AudioBufferQueue *buffer_queue_head; /* device fed from here. */
-    SDL_AudioBufferQueue *buffer_queue_tail; /* queue fills to here. */
-    SDL_AudioBufferQueue *buffer_queue_pool; /* these are unused packets. */
-    Uint32 queued_bytes;  /* number of bytes of audio data in the queue. */
+    /* Queued audio (if app not using callback). */
+    SDL_AudioQueue queue;
 
     /* * * */
     /* Data private to this driver */
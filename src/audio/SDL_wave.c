@@ -26,7 +26,31 @@
 #include "SDL_wave.h"
 
 
+/* A WAVE file whose headers have been read, with the data decoded a block
+   at a time as it's asked for. For PCM data a block is one sample frame,
+   which is copied straight to the caller. */
+struct SDL_WAVStream
+{
+    SDL_RWops *src;
+    int freesrc;
+    Uint16 encoding;
+    Uint16 channels;
+    Uint16 blockalign;          /* Bytes per encoded block */
+    Uint16 frames_per_block;
+    Sint16 aCoeff[7][2];        /* MS ADPCM predictor coefficients */
+    int frame_size;             /* Bytes per decoded sample frame */
+    Uint32 num_frames;
+    Uint32 frame;               /* Where the next read starts */
+    Uint32 data_pos;            /* Bytes of the data chunk read so far */
+    Sint64 riff_left;           /* Bytes from the data chunk to the end of the RIFF chunk */
+    Uint8 *block;               /* An encoded block, when it can't be read in place */
+    Uint8 *decoded;             /* The decoded frames of the last block */
+    Uint32 decoded_frame;       /* First frame in 'decoded' */
+    Uint32 decoded_frames;      /* Number of frames in 'decoded' */
+};
+
 static int ReadChunk(SDL_RWops * src, Chunk * chunk);
+static int SkipChunk(SDL_RWops * src, Uint32 length);
 
 struct MS_ADPCM_decodestate
 {
@@ -35,49 +59,48 @@ struct MS_ADPCM_decodestate
     Sint16 iSamp1;
     Sint16 iSamp2;
 };
-static struct MS_ADPCM_decoder
-{
-    WaveFMT wavefmt;
-    Uint16 wSamplesPerBlock;
-    Uint16 wNumCoef;
-    Sint16 aCoeff[7][2];
-    /* * * */
-    struct MS_ADPCM_decodestate state[2];
-} MS_ADPCM_state;
 
 static int
-InitMS_ADPCM(WaveFMT * format)
+InitMS_ADPCM(SDL_WAVStream * stream, const Chunk * chunk)
 {
-    Uint8 *rogue_feel;
+    const Uint8 *rogue_feel;
+    Uint16 wNumCoef;
     int i;
 
     /* Set the rogue pointer to the MS_ADPCM specific data */
-    MS_ADPCM_state.wavefmt.encoding = SDL_SwapLE16(format->encoding);
-    MS_ADPCM_state.wavefmt.channels = SDL_SwapLE16(format->channels);
-    MS_ADPCM_state.wavefmt.frequency = SDL_SwapLE32(format->frequency);
-    MS_ADPCM_state.wavefmt.byterate = SDL_SwapLE32(format->byterate);
-    MS_ADPCM_state.wavefmt.blockalign = SDL_SwapLE16(format->blockalign);
-    MS_ADPCM_state.wavefmt.bitspersample =
-        SDL_SwapLE16(format->bitspersample);
-    rogue_feel = (Uint8 *) format + sizeof(*format);
-    if (sizeof(*format) == 16) {
-        /* const Uint16 extra_info = ((rogue_feel[1] << 8) | rogue_feel[0]); */
-        rogue_feel += sizeof(Uint16);
+    if (chunk->length < sizeof(WaveFMT) + 3 * sizeof(Uint16) + 7 * 2 * sizeof(Sint16)) {
+        SDL_SetError("Invalid MS_ADPCM format chunk");
+        return (-1);
     }
-    MS_ADPCM_state.wSamplesPerBlock = ((rogue_feel[1] << 8) | rogue_feel[0]);
+    rogue_feel = chunk->data + sizeof(WaveFMT);
+    /* const Uint16 extra_info = ((rogue_feel[1] << 8) | rogue_feel[0]); */
+    rogue_feel += sizeof(Uint16);
+    stream->frames_per_block = ((rogue_feel[1] << 8) | rogue_feel[0]);
     rogue_feel += sizeof(Uint16);
-    MS_ADPCM_state.wNumCoef = ((rogue_feel[1] << 8) | rogue_feel[0]);
+    wNumCoef = ((rogue_feel[1] << 8) | rogue_feel[0]);
     rogue_feel += sizeof(Uint16);
-    if (MS_ADPCM_state.wNumCoef != 7) {
+    if (wNumCoef != 7) {
         SDL_SetError("Unknown set of MS_ADPCM coefficients");
         return (-1);
     }
-    for (i = 0; i < MS_ADPCM_state.wNumCoef; ++i) {
-        MS_ADPCM_state.aCoeff[i][0] = ((rogue_feel[1] << 8) | rogue_feel[0]);
+    for (i = 0; i < wNumCoef; ++i) {
+        stream->aCoeff[i][0] = ((rogue_feel[1] << 8) | rogue_feel[0]);
         rogue_feel += sizeof(Uint16);
-        MS_ADPCM_state.aCoeff[i][1] = ((rogue_feel[1] << 8) | rogue_feel[0]);
+        stream->aCoeff[i][1] = ((rogue_feel[1] << 8) | rogue_feel[0]);
         rogue_feel += sizeof(Uint16);
     }
+
+    /* Make sure a block holds as many samples as it says */
+    if (stream->channels > 2) {
+        SDL_SetError("MS ADPCM decoder can only handle 2 channels");
+        return (-1);
+    }
+    if (stream->frames_per_block < 2 ||
+        stream->blockalign < 7 * stream->channels +
+        ((stream->frames_per_block - 2) * stream->channels + 1) / 2) {
+        SDL_SetError("Invalid MS_ADPCM block size");
+        return (-1);
+    }
     return (0);
 }
 
@@ -115,103 +138,94 @@ MS_ADPCM_nibble(struct MS_ADPCM_decodestate *state,
     return (new_sample);
 }
 
+/* Decodes the block at 'encoded' into stream->decoded */
 static int
-MS_ADPCM_decode(Uint8 ** audio_buf, Uint32 * audio_len)
+MS_ADPCM_decode(SDL_WAVStream * stream, const Uint8 * encoded)
 {
+    struct MS_ADPCM_decodestate states[2];
     struct MS_ADPCM_decodestate *state[2];
-    Uint8 *freeable, *encoded, *decoded;
-    Sint32 encoded_len, samplesleft;
+    Uint8 *decoded;
+    Sint32 samplesleft;
     Sint8 nybble;
     Uint8 stereo;
     Sint16 *coeff[2];
     Sint32 new_sample;
 
-    /* Allocate the proper sized output buffer */
-    encoded_len = *audio_len;
-    encoded = *audio_buf;
-    freeable = *audio_buf;
-    *audio_len = (encoded_len / MS_ADPCM_state.wavefmt.blockalign) *
-        MS_ADPCM_state.wSamplesPerBlock *
-        MS_ADPCM_state.wavefmt.channels * sizeof(Sint16);
-    *audio_buf = (Uint8 *) SDL_malloc(*audio_len);
-    if (*audio_buf == NULL) {
-        return SDL_OutOfMemory();
-    }
-    decoded = *audio_buf;
+    decoded = stream->decoded;
 
     /* Get ready... Go! */
-    stereo = (MS_ADPCM_state.wavefmt.channels == 2);
-    state[0] = &MS_ADPCM_state.state[0];
-    state[1] = &MS_ADPCM_state.state[stereo];
-    while (encoded_len >= MS_ADPCM_state.wavefmt.blockalign) {
-        /* Grab the initial information for this block */
-        state[0]->hPredictor = *encoded++;
-        if (stereo) {
-            state[1]->hPredictor = *encoded++;
-        }
-        state[0]->iDelta = ((encoded[1] << 8) | encoded[0]);
+    stereo = (stream->channels == 2);
+    state[0] = &states[0];
+    state[1] = &states[stereo];
+
+    /* Grab the initial information for this block */
+    state[0]->hPredictor = *encoded++;
+    if (stereo) {
+        state[1]->hPredictor = *encoded++;
+    }
+    state[0]->iDelta = ((encoded[1] << 8) | encoded[0]);
+    encoded += sizeof(Sint16);
+    if (stereo) {
+        state[1]->iDelta = ((encoded[1] << 8) | encoded[0]);
         encoded += sizeof(Sint16);
-        if (stereo) {
-            state[1]->iDelta = ((encoded[1] << 8) | encoded[0]);
-            encoded += sizeof(Sint16);
-        }
-        state[0]->iSamp1 = ((encoded[1] << 8) | encoded[0]);
+    }
+    state[0]->iSamp1 = ((encoded[1] << 8) | encoded[0]);
+    encoded += sizeof(Sint16);
+    if (stereo) {
+        state[1]->iSamp1 = ((encoded[1] << 8) | encoded[0]);
         encoded += sizeof(Sint16);
-        if (stereo) {
-            state[1]->iSamp1 = ((encoded[1] << 8) | encoded[0]);
-            encoded += sizeof(Sint16);
-        }
-        state[0]->iSamp2 = ((encoded[1] << 8) | encoded[0]);
+    }
+    state[0]->iSamp2 = ((encoded[1] << 8) | encoded[0]);
+    encoded += sizeof(Sint16);
+    if (stereo) {
+        state[1]->iSamp2 = ((encoded[1] << 8) | encoded[0]);
         encoded += sizeof(Sint16);
-        if (stereo) {
-            state[1]->iSamp2 = ((encoded[1] << 8) | encoded[0]);
-            encoded += sizeof(Sint16);
-        }
-        coeff[0] = MS_ADPCM_state.aCoeff[state[0]->hPredictor];
-        coeff[1] = MS_ADPCM_state.aCoeff[state[1]->hPredictor];
+    }
+    if (state[0]->hPredictor >= SDL_arraysize(stream->aCoeff) ||
+        state[1]->hPredictor >= SDL_arraysize(stream->aCoeff)) {
+        return SDL_SetError("Invalid MS_ADPCM predictor");
+    }
+    coeff[0] = stream->aCoeff[state[0]->hPredictor];
+    coeff[1] = stream->aCoeff[state[1]->hPredictor];
+
+    /* Store the two initial samples we start with */
+    decoded[0] = state[0]->iSamp2 & 0xFF;
+    decoded[1] = state[0]->iSamp2 >> 8;
+    decoded += 2;
+    if (stereo) {
+        decoded[0] = state[1]->iSamp2 & 0xFF;
+        decoded[1] = state[1]->iSamp2 >> 8;
+        decoded += 2;
+    }
+    decoded[0] = state[0]->iSamp1 & 0xFF;
+    decoded[1] = state[0]->iSamp1 >> 8;
+    decoded += 2;
+    if (stereo) {
+        decoded[0] = state[1]->iSamp1 & 0xFF;
+        decoded[1] = state[1]->iSamp1 >> 8;
+        decoded += 2;
+    }
 
-        /* Store the two initial samples we start with */
-        decoded[0] = state[0]->iSamp2 & 0xFF;
-        decoded[1] = state[0]->iSamp2 >> 8;
+    /* Decode and store the other samples in this block */
+    samplesleft = (stream->frames_per_block - 2) * stream->channels;
+    while (samplesleft > 0) {
+        nybble = (*encoded) >> 4;
+        new_sample = MS_ADPCM_nibble(state[0], nybble, coeff[0]);
+        decoded[0] = new_sample & 0xFF;
+        new_sample >>= 8;
+        decoded[1] = new_sample & 0xFF;
         decoded += 2;
-        if (stereo) {
-            decoded[0] = state[1]->iSamp2 & 0xFF;
-            decoded[1] = state[1]->iSamp2 >> 8;
-            decoded += 2;
-        }
-        decoded[0] = state[0]->iSamp1 & 0xFF;
-        decoded[1] = state[0]->iSamp1 >> 8;
+
+        nybble = (*encoded) & 0x0F;
+        new_sample = MS_ADPCM_nibble(state[1], nybble, coeff[1]);
+        decoded[0] = new_sample & 0xFF;
+        new_sample >>= 8;
+        decoded[1] = new_sample & 0xFF;
         decoded += 2;
-        if (stereo) {
-            decoded[0] = state[1]->iSamp1 & 0xFF;
-            decoded[1] = state[1]->iSamp1 >> 8;
-            decoded += 2;
-        }
 
-        /* Decode and store the other samples in this block */
-        samplesleft = (MS_ADPCM_state.wSamplesPerBlock - 2) *
-            MS_ADPCM_state.wavefmt.channels;
-        while (samplesleft > 0) {
-            nybble = (*encoded) >> 4;
-            new_sample = MS_ADPCM_nibble(state[0], nybble, coeff[0]);
-            decoded[0] = new_sample & 0xFF;
-            new_sample >>= 8;
-            decoded[1] = new_sample & 0xFF;
-            decoded += 2;
-
-            nybble = (*encoded) & 0x0F;
-            new_sample = MS_ADPCM_nibble(state[1], nybble, coeff[1]);
-            decoded[0] = new_sample & 0xFF;
-            new_sample >>= 8;
-            decoded[1] = new_sample & 0xFF;
-            decoded += 2;
-
-            ++encoded;
-            samplesleft -= 2;
-        }
-        encoded_len -= MS_ADPCM_state.wavefmt.blockalign;
+        ++encoded;
+        samplesleft -= 2;
     }
-    SDL_free(freeable);
     return (0);
 }
 
@@ -220,33 +234,35 @@ struct IMA_ADPCM_decodestate
     Sint32 sample;
     Sint8 index;
 };
-static struct IMA_ADPCM_decoder
-{
-    WaveFMT wavefmt;
-    Uint16 wSamplesPerBlock;
-    /* * * */
-    struct IMA_ADPCM_decodestate state[2];
-} IMA_ADPCM_state;
 
 static int
-InitIMA_ADPCM(WaveFMT * format)
+InitIMA_ADPCM(SDL_WAVStream * stream, const Chunk * chunk)
 {
-    Uint8 *rogue_feel;
+    const Uint8 *rogue_feel;
+    Uint32 groups;
 
     /* Set the rogue pointer to the IMA_ADPCM specific data */
-    IMA_ADPCM_state.wavefmt.encoding = SDL_SwapLE16(format->encoding);
-    IMA_ADPCM_state.wavefmt.channels = SDL_SwapLE16(format->channels);
-    IMA_ADPCM_state.wavefmt.frequency = SDL_SwapLE32(format->frequency);
-    IMA_ADPCM_state.wavefmt.byterate = SDL_SwapLE32(format->byterate);
-    IMA_ADPCM_state.wavefmt.blockalign = SDL_SwapLE16(format->blockalign);
-    IMA_ADPCM_state.wavefmt.bitspersample =
-        SDL_SwapLE16(format->bitspersample);
-    rogue_feel = (Uint8 *) format + sizeof(*format);
-    if (sizeof(*format) == 16) {
-        /* const Uint16 extra_info = ((rogue_feel[1] << 8) | rogue_feel[0]); */
-        rogue_feel += sizeof(Uint16);
+    if (chunk->length < sizeof(WaveFMT) + 2 * sizeof(Uint16)) {
+        SDL_SetError("Invalid IMA_ADPCM format chunk");
+        return (-1);
+    }
+    rogue_feel = chunk->data + sizeof(WaveFMT);
+    /* const Uint16 extra_info = ((rogue_feel[1] << 8) | rogue_feel[0]); */
+    rogue_feel += sizeof(Uint16);
+    stream->frames_per_block = ((rogue_feel[1] << 8) | rogue_feel[0]);
+
+    /* Check to make sure we have enough variables in the state array,
+       and that a block holds as many samples as it says */
+    if (stream->channels > 2) {
+        SDL_SetError("IMA ADPCM decoder can only handle 2 channels");
+        return (-1);
+    }
+    groups = (stream->frames_per_block + 6) / 8;
+    if (stream->frames_per_block < 1 ||
+        stream->blockalign < 4 * stream->channels * (1 + groups)) {
+        SDL_SetError("Invalid IMA_ADPCM block size");
+        return (-1);
     }
-    IMA_ADPCM_state.wSamplesPerBlock = ((rogue_feel[1] << 8) | rogue_feel[0]);
     return (0);
 }
 
@@ -306,7 +322,7 @@ IMA_ADPCM_nibble(struct IMA_ADPCM_decodestate *state, Uint8 nybble)
 
 /* Fill the decode buffer with a channel block of data (8 samples) */
 static void
-Fill_IMA_ADPCM_block(Uint8 * decoded, Uint8 * encoded,
+Fill_IMA_ADPCM_block(Uint8 * decoded, const Uint8 * encoded,
                      int channel, int numchannels,
                      struct IMA_ADPCM_decodestate *state)
 {
@@ -334,84 +350,104 @@ Fill_IMA_ADPCM_block(Uint8 * decoded, Uint8 * encoded,
     }
 }
 
+/* Decodes the block at 'encoded' into stream->decoded, which has room for
+   the samples that fill out the last group of 8 */
 static int
-IMA_ADPCM_decode(Uint8 ** audio_buf, Uint32 * audio_len)
+IMA_ADPCM_decode(SDL_WAVStream * stream, const Uint8 * encoded)
 {
-    struct IMA_ADPCM_decodestate *state;
-    Uint8 *freeable, *encoded, *decoded;
-    Sint32 encoded_len, samplesleft;
+    struct IMA_ADPCM_decodestate state[2];
+    Uint8 *decoded;
+    Sint32 samplesleft;
     unsigned int c, channels;
 
-    /* Check to make sure we have enough variables in the state array */
-    channels = IMA_ADPCM_state.wavefmt.channels;
-    if (channels > SDL_arraysize(IMA_ADPCM_state.state)) {
-        SDL_SetError("IMA ADPCM decoder can only handle %u channels",
-                     (unsigned int)SDL_arraysize(IMA_ADPCM_state.state));
-        return (-1);
-    }
-    state = IMA_ADPCM_state.state;
+    channels = stream->channels;
+    decoded = stream->decoded;
 
-    /* Allocate the proper sized output buffer */
-    encoded_len = *audio_len;
-    encoded = *audio_buf;
-    freeable = *audio_buf;
-    *audio_len = (encoded_len / IMA_ADPCM_state.wavefmt.blockalign) *
-        IMA_ADPCM_state.wSamplesPerBlock *
-        IMA_ADPCM_state.wavefmt.channels * sizeof(Sint16);
-    *audio_buf = (Uint8 *) SDL_malloc(*audio_len);
-    if (*audio_buf == NULL) {
-        return SDL_OutOfMemory();
+    /* Grab the initial information for this block */
+    for (c = 0; c < channels; ++c) {
+        /* Fill the state information for this block */
+        state[c].sample = ((encoded[1] << 8) | encoded[0]);
+        encoded += 2;
+        if (state[c].sample & 0x8000) {
+            state[c].sample -= 0x10000;
+        }
+        state[c].index = *encoded++;
+        /* Reserved byte in buffer header, should be 0 */
+        if (*encoded++ != 0) {
+            /* Uh oh, corrupt data?  Buggy code? */ ;
+        }
+
+        /* Store the initial sample we start with */
+        decoded[0] = (Uint8) (state[c].sample & 0xFF);
+        decoded[1] = (Uint8) (state[c].sample >> 8);
+        decoded += 2;
     }
-    decoded = *audio_buf;
 
-    /* Get ready... Go! */
-    while (encoded_len >= IMA_ADPCM_state.wavefmt.blockalign) {
-        /* Grab the initial information for this block */
+    /* Decode and store the other samples in this block */
+    samplesleft = (stream->frames_per_block - 1) * channels;
+    while (samplesleft > 0) {
         for (c = 0; c < channels; ++c) {
-            /* Fill the state information for this block */
-            state[c].sample = ((encoded[1] << 8) | encoded[0]);
-            encoded += 2;
-            if (state[c].sample & 0x8000) {
-                state[c].sample -= 0x10000;
-            }
-            state[c].index = *encoded++;
-            /* Reserved byte in buffer header, should be 0 */
-            if (*encoded++ != 0) {
-                /* Uh oh, corrupt data?  Buggy code? */ ;
-            }
-
-            /* Store the initial sample we start with */
-            decoded[0] = (Uint8) (state[c].sample & 0xFF);
-            decoded[1] = (Uint8) (state[c].sample >> 8);
-            decoded += 2;
+            Fill_IMA_ADPCM_block(decoded, encoded,
+                                 c, channels, &state[c]);
+            encoded += 4;
+            samplesleft -= 8;
         }
+        decoded += (channels * 8 * 2);
+    }
+    return (0);
+}
 
-        /* Decode and store the other samples in this block */
-        samplesleft = (IMA_ADPCM_state.wSamplesPerBlock - 1) * channels;
-        while (samplesleft > 0) {
-            for (c = 0; c < channels; ++c) {
-                Fill_IMA_ADPCM_block(decoded, encoded,
-                                     c, channels, &state[c]);
-                encoded += 4;
-                samplesleft -= 8;
-            }
-            decoded += (channels * 8 * 2);
+/* Reads up to 'size' bytes of the data chunk, retrying short reads until
+   the source runs dry, and returns the number of bytes read */
+static size_t
+ReadData(SDL_WAVStream * stream, Uint8 * dst, size_t size)
+{
+    size_t lenread = 0;
+    size_t result;
+
+    while (lenread < size) {
+        result = SDL_RWread(stream->src, dst + lenread, 1, size - lenread);
+        if (result == 0) {
+            break;
         }
-        encoded_len -= IMA_ADPCM_state.wavefmt.blockalign;
+        lenread += result;
     }
-    SDL_free(freeable);
-    return (0);
+    stream->data_pos += (Uint32) lenread;
+    return lenread;
 }
 
-SDL_AudioSpec *
-SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
-               SDL_AudioSpec * spec, Uint8 ** audio_buf, Uint32 * audio_len)
+/* Reads the next block of the data chunk, in place if the source is in
+   memory, returning NULL on error */
+static const Uint8 *
+ReadBlock(SDL_WAVStream * stream)
 {
+    const Uint8 *view;
+    size_t available, lenread;
+
+    view = (const Uint8 *) SDL_RWGetView(stream->src, &available);
+    if (view && available >= stream->blockalign) {
+        SDL_RWseek(stream->src, stream->blockalign, RW_SEEK_CUR);
+        stream->data_pos += stream->blockalign;
+        return view;
+    }
+
+    lenread = ReadData(stream, stream->block, stream->blockalign);
+    if (lenread != stream->blockalign) {
+        SDL_Error(SDL_EFREAD);
+        return NULL;
+    }
+    return stream->block;
+}
+
+SDL_WAVStream *
+SDL_OpenWAVStream_RW(SDL_RWops * src, int freesrc, SDL_AudioSpec * spec)
+{
+    SDL_WAVStream *stream = NULL;
     int was_error;
     Chunk chunk;
+    Uint32 header[2];
     int lenread;
     int IEEE_float_encoded, MS_ADPCM_encoded, IMA_ADPCM_encoded;
-    int samplesize;
 
     /* WAV magic header */
     Uint32 RIFFchunk;
@@ -431,6 +467,15 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
         goto done;
     }
 
+    stream = (SDL_WAVStream *) SDL_calloc(1, sizeof(*stream));
+    if (stream == NULL) {
+        SDL_OutOfMemory();
+        was_error = 1;
+        goto done;
+    }
+    stream->src = src;
+    stream->freesrc = freesrc;
+
     /* Check the magic header */
     RIFFchunk = SDL_ReadLE32(src);
     wavelen = SDL_ReadLE32(src);
@@ -469,8 +514,21 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
         was_error = 1;
         goto done;
     }
+    if (chunk.length < sizeof(*format)) {
+        SDL_SetError("Invalid WAVE format chunk");
+        was_error = 1;
+        goto done;
+    }
+    stream->encoding = SDL_SwapLE16(format->encoding);
+    stream->channels = SDL_SwapLE16(format->channels);
+    stream->blockalign = SDL_SwapLE16(format->blockalign);
+    if (stream->channels == 0 || stream->channels > 255) {
+        SDL_SetError("Invalid number of WAVE channels: %d", stream->channels);
+        was_error = 1;
+        goto done;
+    }
     IEEE_float_encoded = MS_ADPCM_encoded = IMA_ADPCM_encoded = 0;
-    switch (SDL_SwapLE16(format->encoding)) {
+    switch (stream->encoding) {
     case PCM_CODE:
         /* We can understand this */
         break;
@@ -480,7 +538,7 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
         break;
     case MS_ADPCM_CODE:
         /* Try to understand this */
-        if (InitMS_ADPCM(format) < 0) {
+        if (InitMS_ADPCM(stream, &chunk) < 0) {
             was_error = 1;
             goto done;
         }
@@ -488,7 +546,7 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
         break;
     case IMA_ADPCM_CODE:
         /* Try to understand this */
-        if (InitIMA_ADPCM(format) < 0) {
+        if (InitIMA_ADPCM(stream, &chunk) < 0) {
             was_error = 1;
             goto done;
         }
@@ -500,7 +558,7 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
         goto done;
     default:
         SDL_SetError("Unknown WAVE data format: 0x%.4x",
-                     SDL_SwapLE16(format->encoding));
+                     stream->encoding);
         was_error = 1;
         goto done;
     }
@@ -542,56 +600,243 @@ SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
                      SDL_SwapLE16(format->bitspersample));
         goto done;
     }
-    spec->channels = (Uint8) SDL_SwapLE16(format->channels);
+    spec->channels = (Uint8) stream->channels;
     spec->samples = 4096;       /* Good default buffer size */
+    stream->frame_size = ((SDL_AUDIO_BITSIZE(spec->format)) / 8) * spec->channels;
 
-    /* Read the audio data chunk */
-    *audio_buf = NULL;
-    do {
-        SDL_free(*audio_buf);
-        *audio_buf = NULL;
-        lenread = ReadChunk(src, &chunk);
-        if (lenread < 0) {
+    /* Find the audio data chunk, leaving the data to be read later */
+    for ( ;; ) {
+        if (SDL_RWread(src, header, sizeof(header), 1) != 1) {
+            SDL_Error(SDL_EFREAD);
             was_error = 1;
             goto done;
         }
-        *audio_len = lenread;
-        *audio_buf = chunk.data;
-        if (chunk.magic != DATA)
-            headerDiff += lenread + 2 * sizeof(Uint32);
-    } while (chunk.magic != DATA);
-    headerDiff += 2 * sizeof(Uint32);   /* for the data chunk and len */
-
-    if (MS_ADPCM_encoded) {
-        if (MS_ADPCM_decode(audio_buf, audio_len) < 0) {
+        chunk.magic = SDL_SwapLE32(header[0]);
+        chunk.length = SDL_SwapLE32(header[1]);
+        if (chunk.magic == DATA) {
+            break;
+        }
+        if (SkipChunk(src, chunk.length) < 0) {
             was_error = 1;
             goto done;
         }
+        headerDiff += chunk.length + 2 * sizeof(Uint32);
     }
-    if (IMA_ADPCM_encoded) {
-        if (IMA_ADPCM_decode(audio_buf, audio_len) < 0) {
+    headerDiff += 2 * sizeof(Uint32);   /* for the data chunk and len */
+    stream->riff_left = (Sint64) wavelen - headerDiff;
+
+    if (MS_ADPCM_encoded || IMA_ADPCM_encoded) {
+        stream->num_frames = (chunk.length / stream->blockalign) * stream->frames_per_block;
+        stream->block = (Uint8 *) SDL_malloc(stream->blockalign);
+        /* IMA ADPCM decodes up to 7 samples past the end of a block */
+        stream->decoded = (Uint8 *) SDL_malloc((stream->frames_per_block + 7) * stream->frame_size);
+        if (stream->block == NULL || stream->decoded == NULL) {
+            SDL_OutOfMemory();
             was_error = 1;
             goto done;
         }
+    } else {
+        stream->frames_per_block = 1;
+        stream->blockalign = (Uint16) stream->frame_size;
+        stream->num_frames = chunk.length / stream->frame_size;
     }
 
-    /* Don't return a buffer that isn't a multiple of samplesize */
-    samplesize = ((SDL_AUDIO_BITSIZE(spec->format)) / 8) * spec->channels;
-    *audio_len &= ~(samplesize - 1);
-
   done:
     SDL_free(format);
-    if (src) {
-        if (freesrc) {
+    if (was_error) {
+        if (stream) {
+            SDL_free(stream->block);
+            SDL_free(stream->decoded);
+            SDL_free(stream);
+            stream = NULL;
+        }
+        if (src && freesrc) {
             SDL_RWclose(src);
-        } else {
-            /* seek to the end of the file (given by the RIFF chunk) */
-            SDL_RWseek(src, wavelen - chunk.length - headerDiff, RW_SEEK_CUR);
         }
     }
-    if (was_error) {
-        spec = NULL;
+    return (stream);
+}
+
+int
+SDL_ReadWAVStream(SDL_WAVStream * stream, void *buf, int len)
+{
+    Uint8 *dst = (Uint8 *) buf;
+    Uint32 frames, count, partial;
+    const Uint8 *encoded;
+    size_t lenread;
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+    if (len < stream->frame_size) {
+        return SDL_InvalidParamError("len");
+    }
+    frames = SDL_min((Uint32) len / stream->frame_size, stream->num_frames - stream->frame);
+
+    if (stream->frames_per_block == 1) {
+        /* PCM data is already in the right format */
+        lenread = ReadData(stream, dst, frames * stream->frame_size);
+        count = (Uint32) lenread / stream->frame_size;
+        partial = (Uint32) lenread % stream->frame_size;
+        if (partial && SDL_RWseek(stream->src, -(Sint64) partial, RW_SEEK_CUR) >= 0) {
+            /* The data ran out mid-frame; leave the source at its start */
+            stream->data_pos -= partial;
+        }
+        stream->frame += count;
+        if (count == 0 && frames > 0) {
+            return SDL_Error(SDL_EFREAD);
+        }
+        return (int) (count * stream->frame_size);
+    }
+
+    count = 0;
+    while (count < frames) {
+        Uint32 offset, available;
+
+        if (stream->frame < stream->decoded_frame ||
+            stream->frame >= stream->decoded_frame + stream->decoded_frames) {
+            /* The source is at the start of the block with this frame */
+            stream->decoded_frames = 0;
+            encoded = ReadBlock(stream);
+            if (encoded == NULL) {
+                break;
+            }
+            if (stream->encoding == MS_ADPCM_CODE) {
+                if (MS_ADPCM_decode(stream, encoded) < 0) {
+                    break;
+                }
+            } else {
+                if (IMA_ADPCM_decode(stream, encoded) < 0) {
+                    break;
+                }
+            }
+            stream->decoded_frame = stream->frame - stream->frame % stream->frames_per_block;
+            stream->decoded_frames = stream->frames_per_block;
+        }
+
+        offset = stream->frame - stream->decoded_frame;
+        available = SDL_min(stream->decoded_frames - offset, frames - count);
+        SDL_memcpy(dst, stream->decoded + offset * stream->frame_size, available * stream->frame_size);
+        dst += available * stream->frame_size;
+        stream->frame += available;
+        count += available;
+    }
+    if (count == 0 && frames > 0) {
+        return (-1);
+    }
+    return (int) (count * stream->frame_size);
+}
+
+int
+SDL_SeekWAVStream(SDL_WAVStream * stream, Uint32 frame)
+{
+    Uint32 block_pos;
+
+    if (!stream) {
+        return SDL_InvalidParamError("stream");
+    }
+    if (frame > stream->num_frames) {
+        return SDL_InvalidParamError("frame");
+    }
+
+    /* Move the source to the start of the block with this frame, unless
+       it's already been decoded */
+    block_pos = (frame / stream->frames_per_block) * stream->blockalign;
+    if (stream->decoded_frames &&
+        frame >= stream->decoded_frame &&
+        frame < stream->decoded_frame + stream->decoded_frames) {
+        stream->frame = frame;
+        return 0;
     }
+    if (block_pos != stream->data_pos) {
+        if (SDL_RWseek(stream->src, (Sint64) block_pos - stream->data_pos, RW_SEEK_CUR) < 0) {
+            return -1;
+        }
+        stream->data_pos = block_pos;
+    }
+    stream->decoded_frames = 0;
+    stream->frame = frame;
+    return 0;
+}
+
+Uint32
+SDL_TellWAVStream(SDL_WAVStream * stream)
+{
+    if (!stream) {
+        SDL_InvalidParamError("stream");
+        return 0;
+    }
+    return stream->frame;
+}
+
+Uint32
+SDL_GetWAVStreamLength(SDL_WAVStream * stream)
+{
+    if (!stream) {
+        SDL_InvalidParamError("stream");
+        return 0;
+    }
+    return stream->num_frames;
+}
+
+void
+SDL_CloseWAVStream(SDL_WAVStream * stream)
+{
+    if (!stream) {
+        return;
+    }
+    if (stream->freesrc) {
+        SDL_RWclose(stream->src);
+    } else {
+        /* seek to the end of the file (given by the RIFF chunk) */
+        SDL_RWseek(stream->src, stream->riff_left - stream->data_pos, RW_SEEK_CUR);
+    }
+    SDL_free(stream->block);
+    SDL_free(stream->decoded);
+    SDL_free(stream);
+}
+
+SDL_AudioSpec *
+SDL_LoadWAV_RW(SDL_RWops * src, int freesrc,
+               SDL_AudioSpec * spec, Uint8 ** audio_buf, Uint32 * audio_len)
+{
+    SDL_WAVStream *stream;
+    Uint32 length, done;
+    int lenread;
+
+    stream = SDL_OpenWAVStream_RW(src, freesrc, spec);
+    if (stream == NULL) {
+        return NULL;
+    }
+
+    /* Decode it all at once */
+    if ((Uint64) stream->num_frames * stream->frame_size > 0xFFFFFFFF) {
+        SDL_SetError("WAVE data is too large");
+        SDL_CloseWAVStream(stream);
+        return NULL;
+    }
+    length = stream->num_frames * stream->frame_size;
+    *audio_buf = (Uint8 *) SDL_malloc(length ? length : 1);
+    if (*audio_buf == NULL) {
+        SDL_OutOfMemory();
+        SDL_CloseWAVStream(stream);
+        return NULL;
+    }
+    for (done = 0; done < length; done += lenread) {
+        lenread = SDL_ReadWAVStream(stream, *audio_buf + done, (int) SDL_min(length - done, 0x40000000));
+        if (lenread <= 0) {
+            if (lenread == 0) {
+                SDL_Error(SDL_EFREAD);
+            }
+            SDL_free(*audio_buf);
+            *audio_buf = NULL;
+            SDL_CloseWAVStream(stream);
+            return NULL;
+        }
+    }
+    *audio_len = length;
+
+    SDL_CloseWAVStream(stream);
     return (spec);
 }
 
@@ -621,4 +866,24 @@ ReadChunk(SDL_RWops * src, Chunk * chunk)
     return (chunk->length);
 }
 
+/* Skips over the data of a chunk, reading it if the source can't seek */
+static int
+SkipChunk(SDL_RWops * src, Uint32 length)
+{
+    Uint8 buffer[1024];
+    size_t size;
+
+    if (SDL_RWseek(src, length, RW_SEEK_CUR) >= 0) {
+        return (0);
+    }
+    while (length > 0) {
+        size = SDL_min(length, sizeof(buffer));
+        if (SDL_RWread(src, buffer, size, 1) != 1) {
+            return SDL_Error(SDL_EFREAD);
+        }
+        length -= (Uint32) size;
+    }
+    return (0);
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
@@ -51,14 +51,24 @@ static void nacl_audio_callback(void* samples, uint32_t buffer_size, PP_TimeDelt
     SDL_LockMutex(private->mutex);  /* !!! FIXME: is this mutex necessary? */
 
     if (SDL_AtomicGet(&_this->enabled) && !SDL_AtomicGet(&_this->paused)) {
-        if (_this->convert.needed) {
+        if (_this->stream) {
+            const int stream_len = _this->callbackspec.size;
+            int got;
+
             SDL_LockMutex(_this->mixer_lock);
-            (*_this->spec.callback) (_this->spec.userdata,
-                                     (Uint8 *) _this->convert.buf,
-                                     _this->convert.len);
+            while (SDL_AudioStreamAvailable(_this->stream) < ((int) buffer_size)) {
+                (*_this->spec.callback) (_this->spec.userdata, _this->work_buffer, stream_len);
+                if (SDL_AudioStreamPut(_this->stream, _this->work_buffer, stream_len) == -1) {
+                    SDL_AudioStreamClear(_this->stream);
+                    break;
+                }
+            }
             SDL_UnlockMutex(_this->mixer_lock);
-            SDL_ConvertAudio(&_this->convert);
-            SDL_memcpy(samples, _this->convert.buf, _this->convert.len_cvt);
+
+            got = SDL_AudioStreamGet(_this->stream, samples, buffer_size);
+            if (got != ((int) buffer_size)) {
+                SDL_memset(samples, _this->spec.silence, buffer_size);
+            }
         } else {
             SDL_LockMutex(_this->mixer_lock);
             (*_this->spec.callback) (_this->spec.userdata, (Uint8 *) samples, buffer_size);
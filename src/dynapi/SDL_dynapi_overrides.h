@@ -612,3 +612,48 @@
 #define SDL_CreateRGBSurfaceWithFormat SDL_CreateRGBSurfaceWithFormat_REAL
 #define SDL_CreateRGBSurfaceWithFormatFrom SDL_CreateRGBSurfaceWithFormatFrom_REAL
 #define SDL_GetHintBoolean SDL_GetHintBoolean_REAL
+#define SDL_PollEvents SDL_PollEvents_REAL
+#define SDL_GetTicksNS SDL_GetTicksNS_REAL
+#define SDL_DelayNS SDL_DelayNS_REAL
+#define SDL_AddTimerNS SDL_AddTimerNS_REAL
+#define SDL_NewAudioStream SDL_NewAudioStream_REAL
+#define SDL_AudioStreamPut SDL_AudioStreamPut_REAL
+#define SDL_AudioStreamGet SDL_AudioStreamGet_REAL
+#define SDL_AudioStreamAvailable SDL_AudioStreamAvailable_REAL
+#define SDL_AudioStreamFlush SDL_AudioStreamFlush_REAL
+#define SDL_AudioStreamClear SDL_AudioStreamClear_REAL
+#define SDL_FreeAudioStream SDL_FreeAudioStream_REAL
+#define SDL_MixAudioFormatMulti SDL_MixAudioFormatMulti_REAL
+#define SDL_GetQueuedAudioStats SDL_GetQueuedAudioStats_REAL
+#define SDL_RenderFlush SDL_RenderFlush_REAL
+#define SDL_RenderDrawPointF SDL_RenderDrawPointF_REAL
+#define SDL_RenderDrawPointsF SDL_RenderDrawPointsF_REAL
+#define SDL_RenderDrawLineF SDL_RenderDrawLineF_REAL
+#define SDL_RenderDrawLinesF SDL_RenderDrawLinesF_REAL
+#define SDL_RenderDrawRectF SDL_RenderDrawRectF_REAL
+#define SDL_RenderDrawRectsF SDL_RenderDrawRectsF_REAL
+#define SDL_RenderFillRectF SDL_RenderFillRectF_REAL
+#define SDL_RenderFillRectsF SDL_RenderFillRectsF_REAL
+#define SDL_RenderCopyF SDL_RenderCopyF_REAL
+#define SDL_RenderCopyExF SDL_RenderCopyExF_REAL
+#define SDL_RenderCopySprites SDL_RenderCopySprites_REAL
+#define SDL_SetSurfaceScaleMode SDL_SetSurfaceScaleMode_REAL
+#define SDL_GetSurfaceScaleMode SDL_GetSurfaceScaleMode_REAL
+#define SDL_GetBlitCacheStats SDL_GetBlitCacheStats_REAL
+#define SDL_RWGetView SDL_RWGetView_REAL
+#define SDL_RWreadAsync SDL_RWreadAsync_REAL
+#define SDL_GetAsyncReadStatus SDL_GetAsyncReadStatus_REAL
+#define SDL_WaitAsyncRead SDL_WaitAsyncRead_REAL
+#define SDL_CancelAsyncRead SDL_CancelAsyncRead_REAL
+#define SDL_CreateBufferedRW SDL_CreateBufferedRW_REAL
+#define SDL_FlushBufferedRW SDL_FlushBufferedRW_REAL
+#define SDL_GetMemoryFunctions SDL_GetMemoryFunctions_REAL
+#define SDL_SetMemoryFunctions SDL_SetMemoryFunctions_REAL
+#define SDL_GetNumAllocations SDL_GetNumAllocations_REAL
+#define SDL_GetNumAllocatedBytes SDL_GetNumAllocatedBytes_REAL
+#define SDL_OpenWAVStream_RW SDL_OpenWAVStream_RW_REAL
+#define SDL_ReadWAVStream SDL_ReadWAVStream_REAL
+#define SDL_SeekWAVStream SDL_SeekWAVStream_REAL
+#define SDL_TellWAVStream SDL_TellWAVStream_REAL
+#define SDL_GetWAVStreamLength SDL_GetWAVStreamLength_REAL
+#define SDL_CloseWAVStream SDL_CloseWAVStream_REAL
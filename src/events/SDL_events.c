@@ -36,6 +36,10 @@
 /* An arbitrary limit so we don't have unbounded growth */
 #define SDL_MAX_QUEUED_EVENTS   65535
 
+/* The number of lock-free ring entries, must be a power of 2 */
+#define SDL_EVENT_RING_SIZE     1024
+#define SDL_EVENT_RING_MASK     (SDL_EVENT_RING_SIZE-1)
+
 /* Public data -- the event filter */
 SDL_EventFilter SDL_EventOK = NULL;
 void *SDL_EventOKParam;
@@ -54,6 +58,7 @@ typedef struct {
 
 static SDL_DisabledEventBlock *SDL_disabled_events[256];
 static Uint32 SDL_userevents = SDL_USEREVENT;
+static SDL_bool SDL_coalesce_motion_events = SDL_FALSE;
 
 /* Private data -- event queue */
 typedef struct _SDL_EventEntry
@@ -70,6 +75,30 @@ typedef struct _SDL_SysWMEntry
     struct _SDL_SysWMEntry *next;
 } SDL_SysWMEntry;
 
+/* Private data -- lock-free ring that producers push into without taking
+   the queue lock.  It is drained into the event list by whoever holds the
+   lock, so the list stays the one place where events are examined.
+ */
+typedef struct
+{
+    SDL_atomic_t sequence;
+    SDL_Event event;
+    SDL_SysWMmsg msg;
+} SDL_EventRingEntry;
+
+typedef struct
+{
+    SDL_atomic_t enqueue_pos;
+
+    char cache_pad1[SDL_CACHELINE_SIZE-sizeof(SDL_atomic_t)];
+
+    unsigned dequeue_pos;   /* only touched with the queue locked */
+
+    char cache_pad2[SDL_CACHELINE_SIZE-sizeof(unsigned)];
+
+    SDL_EventRingEntry entries[SDL_EVENT_RING_SIZE];
+} SDL_EventRing;
+
 static struct
 {
     SDL_mutex *lock;
@@ -81,9 +110,21 @@ static struct
     SDL_EventEntry *free;
     SDL_SysWMEntry *wmmsg_used;
     SDL_SysWMEntry *wmmsg_free;
-} SDL_EventQ = { NULL, { 1 }, { 0 }, 0, NULL, NULL, NULL, NULL, NULL };
+    void *ring;                 /* an SDL_EventRing, read atomically by producers */
+    SDL_atomic_t ring_users;    /* producers pushing onto the ring right now */
+} SDL_EventQ = { NULL, { 1 }, { 0 }, 0, NULL, NULL, NULL, NULL, NULL, NULL, { 0 } };
 
 
+static void SDLCALL
+SDL_CoalesceMotionEventsChanged(void *userdata, const char *name, const char *oldValue, const char *hint)
+{
+    if (hint && *hint == '1') {
+        SDL_coalesce_motion_events = SDL_TRUE;
+    } else {
+        SDL_coalesce_motion_events = SDL_FALSE;
+    }
+}
+
 /* Public functions */
 
 void
@@ -93,6 +134,7 @@ SDL_StopEventLoop(void)
     int i;
     SDL_EventEntry *entry;
     SDL_SysWMEntry *wmmsg;
+    void *ring;
 
     if (SDL_EventQ.lock) {
         SDL_LockMutex(SDL_EventQ.lock);
@@ -127,6 +169,17 @@ SDL_StopEventLoop(void)
         wmmsg = next;
     }
 
+    /* Producers push onto the ring without the lock, so take it away from
+       them and wait for the ones already in there before freeing it.
+     */
+    ring = SDL_AtomicSetPtr(&SDL_EventQ.ring, NULL);
+    if (ring) {
+        while (SDL_AtomicGet(&SDL_EventQ.ring_users) > 0) {
+            SDL_Delay(0);
+        }
+        SDL_free(ring);
+    }
+
     SDL_AtomicSet(&SDL_EventQ.count, 0);
     SDL_EventQ.max_events_seen = 0;
     SDL_EventQ.head = NULL;
@@ -148,6 +201,10 @@ SDL_StopEventLoop(void)
     }
     SDL_EventOK = NULL;
 
+    SDL_DelHintCallback(SDL_HINT_EVENT_COALESCE_MOTION,
+                        SDL_CoalesceMotionEventsChanged, NULL);
+    SDL_coalesce_motion_events = SDL_FALSE;
+
     if (SDL_EventQ.lock) {
         SDL_UnlockMutex(SDL_EventQ.lock);
         SDL_DestroyMutex(SDL_EventQ.lock);
@@ -175,6 +232,27 @@ SDL_StartEventLoop(void)
     }
 #endif /* !SDL_THREADS_DISABLED */
 
+    /* Set up the lock-free ring, if requested.  If that fails we just use
+       the locked event list, which is always available.
+     */
+    if (!SDL_EventQ.ring && SDL_GetHintBoolean(SDL_HINT_EVENT_QUEUE_LOCKFREE, SDL_FALSE)) {
+        SDL_EventRing *ring = (SDL_EventRing *)SDL_malloc(sizeof(*ring));
+        if (ring) {
+            int i;
+
+            for (i = 0; i < SDL_EVENT_RING_SIZE; ++i) {
+                SDL_AtomicSet(&ring->entries[i].sequence, i);
+            }
+            SDL_AtomicSet(&ring->enqueue_pos, 0);
+            ring->dequeue_pos = 0;
+            SDL_AtomicSetPtr(&SDL_EventQ.ring, ring);
+        }
+    }
+
+    /* See if we should merge consecutive motion events */
+    SDL_AddHintCallback(SDL_HINT_EVENT_COALESCE_MOTION,
+                        SDL_CoalesceMotionEventsChanged, NULL);
+
     /* Process most event types */
     SDL_EventState(SDL_TEXTINPUT, SDL_DISABLE);
     SDL_EventState(SDL_TEXTEDITING, SDL_DISABLE);
@@ -186,6 +264,48 @@ SDL_StartEventLoop(void)
 }
 
 
+/* Merge a motion event into the one queued right before it, if they come
+   from the same device and nothing changed but the position.
+ */
+static SDL_bool
+SDL_CoalesceEvent(SDL_Event *prev, const SDL_Event *event)
+{
+    if (prev->type != event->type) {
+        return SDL_FALSE;
+    }
+
+    switch (event->type) {
+    case SDL_MOUSEMOTION:
+        if (prev->motion.windowID != event->motion.windowID ||
+            prev->motion.which != event->motion.which ||
+            prev->motion.state != event->motion.state) {
+            return SDL_FALSE;
+        }
+        prev->motion.timestamp = event->motion.timestamp;
+        prev->motion.x = event->motion.x;
+        prev->motion.y = event->motion.y;
+        prev->motion.xrel += event->motion.xrel;
+        prev->motion.yrel += event->motion.yrel;
+        return SDL_TRUE;
+
+    case SDL_FINGERMOTION:
+        if (prev->tfinger.touchId != event->tfinger.touchId ||
+            prev->tfinger.fingerId != event->tfinger.fingerId) {
+            return SDL_FALSE;
+        }
+        prev->tfinger.timestamp = event->tfinger.timestamp;
+        prev->tfinger.x = event->tfinger.x;
+        prev->tfinger.y = event->tfinger.y;
+        prev->tfinger.dx += event->tfinger.dx;
+        prev->tfinger.dy += event->tfinger.dy;
+        prev->tfinger.pressure = event->tfinger.pressure;
+        return SDL_TRUE;
+
+    default:
+        return SDL_FALSE;
+    }
+}
+
 /* Add an event to the event queue -- called with the queue locked */
 static int
 SDL_AddEvent(SDL_Event * event)
@@ -194,6 +314,11 @@ SDL_AddEvent(SDL_Event * event)
     const int initial_count = SDL_AtomicGet(&SDL_EventQ.count);
     int final_count;
 
+    if (SDL_coalesce_motion_events && SDL_EventQ.tail &&
+        SDL_CoalesceEvent(&SDL_EventQ.tail->event, event)) {
+        return 1;
+    }
+
     if (initial_count >= SDL_MAX_QUEUED_EVENTS) {
         SDL_SetError("Event queue is full (%d events)", initial_count);
         return 0;
@@ -236,6 +361,162 @@ SDL_AddEvent(SDL_Event * event)
     return 1;
 }
 
+/* Add an event to the lock-free ring -- may be called without the queue locked */
+static SDL_bool
+SDL_EnqueueEventRing(SDL_EventRing *ring, const SDL_Event *event)
+{
+    SDL_EventRingEntry *entry;
+    unsigned queue_pos;
+    unsigned entry_seq;
+    int delta;
+
+    queue_pos = (unsigned)SDL_AtomicGet(&ring->enqueue_pos);
+    for ( ; ; ) {
+        entry = &ring->entries[queue_pos & SDL_EVENT_RING_MASK];
+        entry_seq = (unsigned)SDL_AtomicGet(&entry->sequence);
+
+        delta = (int)(entry_seq - queue_pos);
+        if (delta == 0) {
+            /* The entry and the queue position match, try to claim the entry */
+            if (SDL_AtomicCAS(&ring->enqueue_pos, (int)queue_pos, (int)(queue_pos+1))) {
+                entry->event = *event;
+                if (event->type == SDL_SYSWMEVENT) {
+                    entry->msg = *event->syswm.msg;
+                    entry->event.syswm.msg = &entry->msg;
+                }
+                /* Publish the entry to the consumer */
+                SDL_AtomicSet(&entry->sequence, (int)(queue_pos+1));
+                return SDL_TRUE;
+            }
+        } else if (delta < 0) {
+            /* We ran into an entry that hasn't been drained yet, the ring is full */
+            return SDL_FALSE;
+        } else {
+            /* Another producer got here first, get the new queue position */
+            queue_pos = (unsigned)SDL_AtomicGet(&ring->enqueue_pos);
+        }
+    }
+}
+
+/* Push events onto the lock-free ring, returning how many fit -- called
+   without the queue locked.  Registering as a ring user before looking at
+   the ring keeps SDL_StopEventLoop() from freeing it underneath us.
+ */
+static int
+SDL_PushEventsToRing(SDL_Event *events, int numevents)
+{
+    SDL_EventRing *ring;
+    int used = 0;
+
+    SDL_AtomicIncRef(&SDL_EventQ.ring_users);
+    ring = (SDL_EventRing *)SDL_AtomicGetPtr(&SDL_EventQ.ring);
+    if (ring) {
+        while (used < numevents && SDL_EnqueueEventRing(ring, &events[used])) {
+            ++used;
+        }
+    }
+    (void) SDL_AtomicDecRef(&SDL_EventQ.ring_users);
+
+    return used;
+}
+
+/* Move published ring entries onto the event list -- called with the queue locked */
+static void
+SDL_DrainEventRing(void)
+{
+    SDL_EventRing *ring = SDL_EventQ.ring;
+    SDL_EventRingEntry *entry;
+    unsigned queue_pos;
+
+    if (!ring) {
+        return;
+    }
+
+    queue_pos = ring->dequeue_pos;
+    while (SDL_AtomicGet(&SDL_EventQ.count) < SDL_MAX_QUEUED_EVENTS) {
+        entry = &ring->entries[queue_pos & SDL_EVENT_RING_MASK];
+        if ((unsigned)SDL_AtomicGet(&entry->sequence) != queue_pos+1) {
+            /* The ring is empty, or the next producer hasn't finished yet */
+            break;
+        }
+        SDL_AddEvent(&entry->event);
+
+        /* Hand the entry back to the producers for the next lap */
+        SDL_AtomicSet(&entry->sequence, (int)(queue_pos+SDL_EVENT_RING_SIZE));
+        ++queue_pos;
+    }
+    ring->dequeue_pos = queue_pos;
+}
+
+/* Copy an event for the application -- called with the queue locked */
+static void
+SDL_CopyEventOut(SDL_Event *dst, const SDL_Event *src)
+{
+    SDL_SysWMEntry *wmmsg;
+
+    *dst = *src;
+    if (src->type == SDL_SYSWMEVENT) {
+        /* We need to copy the wmmsg somewhere safe.
+           For now we'll guarantee it's valid at least until
+           the next call to SDL_PeepEvents()
+         */
+        if (SDL_EventQ.wmmsg_free) {
+            wmmsg = SDL_EventQ.wmmsg_free;
+            SDL_EventQ.wmmsg_free = wmmsg->next;
+        } else {
+            wmmsg = (SDL_SysWMEntry *)SDL_malloc(sizeof(*wmmsg));
+        }
+        wmmsg->msg = *src->syswm.msg;
+        wmmsg->next = SDL_EventQ.wmmsg_used;
+        SDL_EventQ.wmmsg_used = wmmsg;
+        dst->syswm.msg = &wmmsg->msg;
+    }
+}
+
+/* Retrieve events straight from the lock-free ring, only moving events
+   outside the requested range onto the event list.  Everything on the ring
+   is newer than the event list, so this must only be used once the list
+   has been searched -- called with the queue locked
+ */
+static int
+SDL_GetEventsFromRing(SDL_Event *events, int numevents, Uint32 minType, Uint32 maxType)
+{
+    SDL_EventRing *ring = SDL_EventQ.ring;
+    SDL_EventRingEntry *entry;
+    unsigned queue_pos;
+    Uint32 type;
+    SDL_Event *last = NULL;
+    int used = 0;
+
+    queue_pos = ring->dequeue_pos;
+    while (used < numevents) {
+        entry = &ring->entries[queue_pos & SDL_EVENT_RING_MASK];
+        if ((unsigned)SDL_AtomicGet(&entry->sequence) != queue_pos+1) {
+            break;
+        }
+        type = entry->event.type;
+        if (minType <= type && type <= maxType) {
+            if (!last || !SDL_coalesce_motion_events ||
+                !SDL_CoalesceEvent(last, &entry->event)) {
+                last = &events[used];
+                SDL_CopyEventOut(last, &entry->event);
+                ++used;
+            }
+        } else if (SDL_AddEvent(&entry->event)) {
+            /* The retrieved events are no longer consecutive */
+            last = NULL;
+        } else {
+            /* The event list is full, leave the rest on the ring */
+            break;
+        }
+        SDL_AtomicSet(&entry->sequence, (int)(queue_pos+SDL_EVENT_RING_SIZE));
+        ++queue_pos;
+    }
+    ring->dequeue_pos = queue_pos;
+
+    return used;
+}
+
 /* Remove an event from the queue -- called with the queue locked */
 static void
 SDL_CutEvent(SDL_EventEntry *entry)
@@ -277,11 +558,27 @@ SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
         }
         return (-1);
     }
-    /* Lock the event queue */
+
     used = 0;
+    if (action == SDL_ADDEVENT && SDL_EventQ.ring) {
+        /* Producers only need the queue lock if the ring fills up */
+        used = SDL_PushEventsToRing(events, numevents);
+        if (used == numevents) {
+            return (used);
+        }
+    }
+
+    /* Lock the event queue */
     if (!SDL_EventQ.lock || SDL_LockMutex(SDL_EventQ.lock) == 0) {
+        /* Anything in the ring was pushed before what we're about to do.
+           Events being retrieved are taken from the ring after the list.
+         */
+        if (action != SDL_GETEVENT || !events) {
+            SDL_DrainEventRing();
+        }
+
         if (action == SDL_ADDEVENT) {
-            for (i = 0; i < numevents; ++i) {
+            for (i = used; i < numevents; ++i) {
                 used += SDL_AddEvent(&events[i]);
             }
         } else {
@@ -306,24 +603,7 @@ SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
                 type = entry->event.type;
                 if (minType <= type && type <= maxType) {
                     if (events) {
-                        events[used] = entry->event;
-                        if (entry->event.type == SDL_SYSWMEVENT) {
-                            /* We need to copy the wmmsg somewhere safe.
-                               For now we'll guarantee it's valid at least until
-                               the next call to SDL_PeepEvents()
-                             */
-                            if (SDL_EventQ.wmmsg_free) {
-                                wmmsg = SDL_EventQ.wmmsg_free;
-                                SDL_EventQ.wmmsg_free = wmmsg->next;
-                            } else {
-                                wmmsg = (SDL_SysWMEntry *)SDL_malloc(sizeof(*wmmsg));
-                            }
-                            wmmsg->msg = *entry->event.syswm.msg;
-                            wmmsg->next = SDL_EventQ.wmmsg_used;
-                            SDL_EventQ.wmmsg_used = wmmsg;
-                            events[used].syswm.msg = &wmmsg->msg;
-                        }
-
+                        SDL_CopyEventOut(&events[used], &entry->event);
                         if (action == SDL_GETEVENT) {
                             SDL_CutEvent(entry);
                         }
@@ -331,6 +611,10 @@ SDL_PeepEvents(SDL_Event * events, int numevents, SDL_eventaction action,
                     ++used;
                 }
             }
+
+            if (action == SDL_GETEVENT && events && SDL_EventQ.ring && used < numevents) {
+                used += SDL_GetEventsFromRing(&events[used], numevents - used, minType, maxType);
+            }
         }
         if (SDL_EventQ.lock) {
             SDL_UnlockMutex(SDL_EventQ.lock);
@@ -379,6 +663,7 @@ SDL_FlushEvents(Uint32 minType, Uint32 maxType)
     if (SDL_EventQ.lock && SDL_LockMutex(SDL_EventQ.lock) == 0) {
         SDL_EventEntry *entry, *next;
         Uint32 type;
+        SDL_DrainEventRing();
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             type = entry->event.type;
@@ -418,6 +703,20 @@ SDL_PollEvent(SDL_Event * event)
     return SDL_WaitEventTimeout(event, 0);
 }
 
+int
+SDL_PollEvents(SDL_Event * events, int numevents)
+{
+    if (!events) {
+        return SDL_InvalidParamError("events");
+    }
+    if (numevents <= 0) {
+        return 0;
+    }
+
+    SDL_PumpEvents();
+    return SDL_PeepEvents(events, numevents, SDL_GETEVENT, SDL_FIRSTEVENT, SDL_LASTEVENT);
+}
+
 int
 SDL_WaitEvent(SDL_Event * event)
 {
@@ -554,6 +853,7 @@ SDL_FilterEvents(SDL_EventFilter filter, void *userdata)
 {
     if (SDL_EventQ.lock && SDL_LockMutex(SDL_EventQ.lock) == 0) {
         SDL_EventEntry *entry, *next;
+        SDL_DrainEventRing();
         for (entry = SDL_EventQ.head; entry; entry = next) {
             next = entry->next;
             if (!filter(userdata, &entry->event)) {
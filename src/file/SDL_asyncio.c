@@ -0,0 +1,428 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+/* Need this so Linux systems define pread64 and off64_t */
+#define _LARGEFILE64_SOURCE
+#include "../SDL_internal.h"
+
+/* Asynchronous reads from SDL_RWops, done by a small pool of threads */
+
+#include "SDL_atomic.h"
+#include "SDL_hints.h"
+#include "SDL_mutex.h"
+#include "SDL_rwops.h"
+#include "SDL_thread.h"
+#include "../thread/SDL_systhread.h"
+
+#if defined(HAVE_STDIO_H) && (defined(HAVE_PREAD64) || defined(HAVE_PREAD))
+#define SDL_ASYNCIO_PREAD_SUPPORTED 1
+#include <errno.h>
+#include <sys/types.h>
+#include <unistd.h>
+#endif
+
+#define DEFAULT_ASYNCIO_THREADS 4
+
+/* Reads from streams that have to be seeked take turns, with streams
+   spread across this many locks */
+#define NUM_CONTEXT_LOCKS       16
+
+struct SDL_AsyncRead
+{
+    SDL_RWops *context;
+    Sint64 offset;
+    void *ptr;
+    size_t size;
+    size_t nread;
+    SDL_AsyncStatus status;
+    SDL_bool started;
+    struct SDL_AsyncRead *next;
+};
+
+static SDL_SpinLock async_init_lock;
+static SDL_mutex *async_lock;
+static SDL_cond *async_work_cond;       /* Signaled when a read is queued */
+static SDL_cond *async_done_cond;       /* Broadcast when a read finishes */
+static SDL_AsyncRead *async_queue_head;
+static SDL_AsyncRead *async_queue_tail;
+static SDL_Thread **async_threads;
+static int async_num_threads;
+static SDL_bool async_quit;
+static SDL_mutex *async_context_locks[NUM_CONTEXT_LOCKS];
+
+/* Reads up to 'size' bytes at 'offset' by seeking, one read at a time for
+   each group of streams, returning SDL_FALSE on error */
+static SDL_bool
+SDL_ReadAtSeek(SDL_RWops * context, Sint64 offset, void *ptr, size_t size, size_t * nread)
+{
+    SDL_mutex *lock = async_context_locks[((size_t) context / sizeof (void *)) % NUM_CONTEXT_LOCKS];
+    size_t result;
+    SDL_bool retval = SDL_TRUE;
+
+    SDL_LockMutex(lock);
+    if (SDL_RWseek(context, offset, RW_SEEK_SET) != offset) {
+        retval = SDL_FALSE;
+    } else {
+        while (*nread < size) {
+            result = SDL_RWread(context, (Uint8 *) ptr + *nread, 1, size - *nread);
+            if (result == 0) {
+                break;
+            }
+            *nread += result;
+        }
+    }
+    SDL_UnlockMutex(lock);
+    return retval;
+}
+
+/* Reads up to 'size' bytes at 'offset', returning SDL_FALSE on error */
+static SDL_bool
+SDL_ReadAt(SDL_RWops * context, Sint64 offset, void *ptr, size_t size, size_t * nread)
+{
+    *nread = 0;
+    if (offset < 0) {
+        return SDL_FALSE;
+    }
+
+    switch (context->type) {
+    case SDL_RWOPS_MEMORY:
+    case SDL_RWOPS_MEMORY_RO:
+    case SDL_RWOPS_MAPFILE:
+        {
+            /* These don't need the stream position, so can all go at once */
+            const Uint64 length = (Uint64) (context->hidden.mem.stop - context->hidden.mem.base);
+            if ((Uint64) offset < length) {
+                *nread = (size_t) SDL_min((Uint64) size, length - (Uint64) offset);
+                SDL_memcpy(ptr, context->hidden.mem.base + offset, *nread);
+            }
+            return SDL_TRUE;
+        }
+
+#ifdef SDL_ASYNCIO_PREAD_SUPPORTED
+    case SDL_RWOPS_STDFILE:
+        {
+            const int fd = fileno(context->hidden.stdio.fp);
+#ifndef HAVE_PREAD64
+            /* off_t may be 32 bits, so reads past that have to seek */
+            const Sint64 end = offset + (Sint64) size;
+            if ((Sint64) (off_t) end != end) {
+                return SDL_ReadAtSeek(context, offset, ptr, size, nread);
+            }
+#endif
+            while (*nread < size) {
+#ifdef HAVE_PREAD64
+                ssize_t result = pread64(fd, (Uint8 *) ptr + *nread, size - *nread, (off64_t) (offset + *nread));
+#else
+                ssize_t result = pread(fd, (Uint8 *) ptr + *nread, size - *nread, (off_t) (offset + *nread));
+#endif
+                if (result < 0) {
+                    if (errno == EINTR) {
+                        continue;
+                    }
+                    return SDL_FALSE;
+                }
+                if (result == 0) {
+                    break;
+                }
+                *nread += (size_t) result;
+            }
+            return SDL_TRUE;
+        }
+#endif
+
+    default:
+        return SDL_ReadAtSeek(context, offset, ptr, size, nread);
+    }
+}
+
+static int SDLCALL
+SDL_AsyncReadThread(void *arg)
+{
+    SDL_AsyncRead *request;
+    SDL_bool succeeded;
+    size_t nread;
+
+    SDL_LockMutex(async_lock);
+    for ( ; ; ) {
+        while (!async_queue_head && !async_quit) {
+            SDL_CondWait(async_work_cond, async_lock);
+        }
+        if (async_quit) {
+            break;
+        }
+
+        request = async_queue_head;
+        async_queue_head = request->next;
+        if (!async_queue_head) {
+            async_queue_tail = NULL;
+        }
+        request->started = SDL_TRUE;
+        SDL_UnlockMutex(async_lock);
+
+        succeeded = SDL_ReadAt(request->context, request->offset, request->ptr, request->size, &nread);
+
+        SDL_LockMutex(async_lock);
+        request->nread = nread;
+        request->status = succeeded ? SDL_ASYNC_COMPLETE : SDL_ASYNC_FAILED;
+        SDL_CondBroadcast(async_done_cond);
+    }
+    SDL_UnlockMutex(async_lock);
+    return 0;
+}
+
+/* Must be called with async_lock held */
+static int
+SDL_StartAsyncThreads(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_ASYNCIO_THREADS);
+    int i, num_threads = hint ? SDL_atoi(hint) : DEFAULT_ASYNCIO_THREADS;
+
+    for (i = 0; i < NUM_CONTEXT_LOCKS; ++i) {
+        if (!async_context_locks[i]) {
+            async_context_locks[i] = SDL_CreateMutex();
+            if (!async_context_locks[i]) {
+                return -1;
+            }
+        }
+    }
+
+    num_threads = SDL_max(num_threads, 1);
+    async_threads = (SDL_Thread **) SDL_calloc(num_threads, sizeof (*async_threads));
+    if (!async_threads) {
+        return SDL_OutOfMemory();
+    }
+    for (i = 0; i < num_threads; ++i) {
+        char name[64];
+        SDL_snprintf(name, sizeof (name), "SDLAsyncIOThread%d", i);
+        async_threads[i] = SDL_CreateThreadInternal(SDL_AsyncReadThread, name, 0, NULL);
+        if (!async_threads[i]) {
+            break;
+        }
+        ++async_num_threads;
+    }
+    if (async_num_threads == 0) {
+        SDL_free(async_threads);
+        async_threads = NULL;
+        return -1;
+    }
+    return 0;
+}
+
+static int
+SDL_InitAsyncIO(void)
+{
+    SDL_AtomicLock(&async_init_lock);
+    if (!async_lock) {
+        async_work_cond = SDL_CreateCond();
+        async_done_cond = SDL_CreateCond();
+        if (async_work_cond && async_done_cond) {
+            async_lock = SDL_CreateMutex();
+        }
+        if (!async_lock) {
+            if (async_work_cond) {
+                SDL_DestroyCond(async_work_cond);
+                async_work_cond = NULL;
+            }
+            if (async_done_cond) {
+                SDL_DestroyCond(async_done_cond);
+                async_done_cond = NULL;
+            }
+        }
+    }
+    SDL_AtomicUnlock(&async_init_lock);
+    return async_lock ? 0 : -1;
+}
+
+SDL_AsyncRead *
+SDL_RWreadAsync(SDL_RWops * context, Sint64 offset, void *ptr, size_t size)
+{
+    SDL_AsyncRead *request;
+
+    if (!context) {
+        SDL_InvalidParamError("context");
+        return NULL;
+    }
+    if (!ptr && size > 0) {
+        SDL_InvalidParamError("ptr");
+        return NULL;
+    }
+    if (offset < 0) {
+        SDL_InvalidParamError("offset");
+        return NULL;
+    }
+    if (SDL_InitAsyncIO() < 0) {
+        return NULL;
+    }
+
+    request = (SDL_AsyncRead *) SDL_calloc(1, sizeof (*request));
+    if (!request) {
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    request->context = context;
+    request->offset = offset;
+    request->ptr = ptr;
+    request->size = size;
+    request->status = SDL_ASYNC_PENDING;
+
+    SDL_LockMutex(async_lock);
+    if (!async_threads && SDL_StartAsyncThreads() < 0) {
+        SDL_UnlockMutex(async_lock);
+        SDL_free(request);
+        return NULL;
+    }
+    if (async_queue_tail) {
+        async_queue_tail->next = request;
+    } else {
+        async_queue_head = request;
+    }
+    async_queue_tail = request;
+    SDL_CondSignal(async_work_cond);
+    SDL_UnlockMutex(async_lock);
+
+    return request;
+}
+
+SDL_AsyncStatus
+SDL_GetAsyncReadStatus(SDL_AsyncRead * request, size_t * nread)
+{
+    SDL_AsyncStatus status;
+
+    if (!request) {
+        SDL_InvalidParamError("request");
+        return SDL_ASYNC_FAILED;
+    }
+
+    SDL_LockMutex(async_lock);
+    status = request->status;
+    if (nread) {
+        *nread = request->nread;
+    }
+    SDL_UnlockMutex(async_lock);
+    return status;
+}
+
+SDL_AsyncStatus
+SDL_WaitAsyncRead(SDL_AsyncRead * request, size_t * nread)
+{
+    SDL_AsyncStatus status;
+
+    if (!request) {
+        SDL_InvalidParamError("request");
+        return SDL_ASYNC_FAILED;
+    }
+
+    SDL_LockMutex(async_lock);
+    while (request->status == SDL_ASYNC_PENDING) {
+        SDL_CondWait(async_done_cond, async_lock);
+    }
+    status = request->status;
+    if (nread) {
+        *nread = request->nread;
+    }
+    SDL_UnlockMutex(async_lock);
+
+    if (status == SDL_ASYNC_FAILED) {
+        SDL_SetError("Couldn't read %u bytes at offset %" SDL_PRIs64,
+                     (unsigned int) request->size, request->offset);
+    }
+    SDL_free(request);
+    return status;
+}
+
+int
+SDL_CancelAsyncRead(SDL_AsyncRead * request)
+{
+    SDL_AsyncRead **link;
+    int retval = -1;
+
+    if (!request) {
+        return SDL_InvalidParamError("request");
+    }
+
+    SDL_LockMutex(async_lock);
+    if (!request->started && request->status == SDL_ASYNC_PENDING) {
+        for (link = &async_queue_head; *link; link = &(*link)->next) {
+            if (*link == request) {
+                *link = request->next;
+                break;
+            }
+        }
+        if (async_queue_tail == request) {
+            for (async_queue_tail = async_queue_head;
+                 async_queue_tail && async_queue_tail->next;
+                 async_queue_tail = async_queue_tail->next) {
+            }
+        }
+        request->status = SDL_ASYNC_CANCELED;
+        retval = 0;
+    }
+    SDL_UnlockMutex(async_lock);
+
+    if (retval < 0) {
+        SDL_SetError("The read has already started");
+    }
+    return retval;
+}
+
+void
+SDL_QuitAsyncIO(void)
+{
+    SDL_AsyncRead *request;
+    int i;
+
+    if (!async_lock) {
+        return;
+    }
+
+    /* Reads that haven't started yet are canceled */
+    SDL_LockMutex(async_lock);
+    for (request = async_queue_head; request; request = request->next) {
+        request->status = SDL_ASYNC_CANCELED;
+    }
+    async_queue_head = async_queue_tail = NULL;
+    async_quit = SDL_TRUE;
+    SDL_CondBroadcast(async_work_cond);
+    SDL_CondBroadcast(async_done_cond);
+    SDL_UnlockMutex(async_lock);
+
+    for (i = 0; i < async_num_threads; ++i) {
+        SDL_WaitThread(async_threads[i], NULL);
+    }
+    SDL_free(async_threads);
+    async_threads = NULL;
+    async_num_threads = 0;
+    async_quit = SDL_FALSE;
+
+    for (i = 0; i < NUM_CONTEXT_LOCKS; ++i) {
+        if (async_context_locks[i]) {
+            SDL_DestroyMutex(async_context_locks[i]);
+            async_context_locks[i] = NULL;
+        }
+    }
+    SDL_DestroyCond(async_work_cond);
+    async_work_cond = NULL;
+    SDL_DestroyCond(async_done_cond);
+    async_done_cond = NULL;
+    SDL_DestroyMutex(async_lock);
+    async_lock = NULL;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -32,6 +32,7 @@
 */
 
 #include "SDL_endian.h"
+#include "SDL_hints.h"
 #include "SDL_rwops.h"
 
 #ifdef __APPLE__
@@ -47,6 +48,14 @@
 #include "nacl_io/nacl_io.h"
 #endif
 
+/* Android opens files through its own paths in SDL_RWFromFile() */
+#if defined(HAVE_STDIO_H) && defined(HAVE_MMAP) && !defined(__ANDROID__)
+#define SDL_RWOPS_MMAP_SUPPORTED 1
+#include <sys/types.h>
+#include <sys/stat.h>
+#include <sys/mman.h>
+#endif
+
 #ifdef __WIN32__
 
 /* Functions to read/write Win32 API file pointers */
@@ -459,6 +468,273 @@ mem_close(SDL_RWops * context)
     return 0;
 }
 
+#ifdef SDL_RWOPS_MMAP_SUPPORTED
+
+/* Functions to read memory-mapped files, which are otherwise memory streams */
+
+static int SDLCALL
+mmap_close(SDL_RWops * context)
+{
+    int status = 0;
+    if (context) {
+        if (munmap(context->hidden.mem.base, context->hidden.mem.stop - context->hidden.mem.base) != 0) {
+            status = SDL_SetError("Couldn't unmap file");
+        }
+        SDL_FreeRW(context);
+    }
+    return status;
+}
+
+/* Maps a file just opened for reading, closing 'fp' if that worked */
+static SDL_RWops *
+mmap_open(FILE * fp, const char *mode)
+{
+    SDL_RWops *rwops;
+    struct stat st;
+    void *base;
+
+    if (SDL_strcmp(mode, "r") != 0 && SDL_strcmp(mode, "rb") != 0) {
+        return NULL;
+    }
+    if (!SDL_GetHintBoolean(SDL_HINT_RWOPS_MMAP, SDL_FALSE)) {
+        return NULL;
+    }
+
+    /* Empty files can't be mapped, and pipes and devices can't be trusted to */
+    if (fstat(fileno(fp), &st) < 0 || !S_ISREG(st.st_mode) ||
+        st.st_size <= 0 || (Uint64) st.st_size > (Uint64) (~(size_t) 0)) {
+        return NULL;
+    }
+    base = mmap(NULL, (size_t) st.st_size, PROT_READ, MAP_PRIVATE, fileno(fp), 0);
+    if (base == MAP_FAILED) {
+        return NULL;
+    }
+
+    rwops = SDL_AllocRW();
+    if (rwops == NULL) {
+        munmap(base, (size_t) st.st_size);
+        return NULL;
+    }
+    rwops->size = mem_size;
+    rwops->seek = mem_seek;
+    rwops->read = mem_read;
+    rwops->write = mem_writeconst;
+    rwops->close = mmap_close;
+    rwops->hidden.mem.base = (Uint8 *) base;
+    rwops->hidden.mem.here = rwops->hidden.mem.base;
+    rwops->hidden.mem.stop = rwops->hidden.mem.base + (size_t) st.st_size;
+    rwops->type = SDL_RWOPS_MAPFILE;
+
+    /* The mapping stays valid after the file is closed */
+    fclose(fp);
+    return rwops;
+}
+#endif /* SDL_RWOPS_MMAP_SUPPORTED */
+
+/* Functions to buffer reads and writes to another SDL_RWops
+
+   While reading, data[0..len) holds what the source has from 'offset'
+   on, and the source is positioned after it. While writing, data[0..pos)
+   is waiting to be written to the source at 'offset'.
+*/
+
+#define DEFAULT_RW_BUFFER_SIZE  (64 * 1024)
+
+typedef struct SDL_RWBuffer
+{
+    SDL_RWops *source;
+    SDL_bool autoclose;
+    SDL_bool writing;
+    Uint8 *data;
+    size_t size;
+    size_t pos;
+    size_t len;
+    Sint64 offset;
+} SDL_RWBuffer;
+
+static int
+buffered_flush(SDL_RWBuffer * buffer)
+{
+    if (buffer->writing) {
+        if (buffer->pos > 0) {
+            if (SDL_RWwrite(buffer->source, buffer->data, 1, buffer->pos) != buffer->pos) {
+                return -1;
+            }
+            buffer->offset += buffer->pos;
+        }
+        buffer->writing = SDL_FALSE;
+    } else {
+        buffer->offset += buffer->pos;
+        if (buffer->pos != buffer->len) {
+            /* Give back what was read ahead */
+            if (SDL_RWseek(buffer->source, buffer->offset, RW_SEEK_SET) < 0) {
+                buffer->offset -= buffer->pos;
+                return -1;
+            }
+        }
+    }
+    buffer->pos = buffer->len = 0;
+    return 0;
+}
+
+static Sint64 SDLCALL
+buffered_size(SDL_RWops * context)
+{
+    SDL_RWBuffer *buffer = (SDL_RWBuffer *) context->hidden.unknown.data1;
+
+    if (buffer->writing && buffered_flush(buffer) < 0) {
+        return -1;
+    }
+    return SDL_RWsize(buffer->source);
+}
+
+static Sint64 SDLCALL
+buffered_seek(SDL_RWops * context, Sint64 offset, int whence)
+{
+    SDL_RWBuffer *buffer = (SDL_RWBuffer *) context->hidden.unknown.data1;
+    const Sint64 here = buffer->offset + buffer->pos;
+    Sint64 target;
+
+    switch (whence) {
+    case RW_SEEK_SET:
+        target = offset;
+        break;
+    case RW_SEEK_CUR:
+        target = here + offset;
+        break;
+    case RW_SEEK_END:
+        if (buffered_flush(buffer) < 0) {
+            return -1;
+        }
+        target = SDL_RWseek(buffer->source, offset, RW_SEEK_END);
+        if (target >= 0) {
+            buffer->offset = target;
+        }
+        return target;
+    default:
+        return SDL_SetError("Unknown value for 'whence'");
+    }
+
+    if (target == here) {
+        return here;
+    }
+
+    /* Seeking within what has been read ahead doesn't touch the source */
+    if (!buffer->writing && target >= buffer->offset &&
+        target <= buffer->offset + (Sint64) buffer->len) {
+        buffer->pos = (size_t) (target - buffer->offset);
+        return target;
+    }
+
+    if (buffer->writing && buffered_flush(buffer) < 0) {
+        return -1;
+    }
+    target = SDL_RWseek(buffer->source, target, RW_SEEK_SET);
+    if (target >= 0) {
+        buffer->offset = target;
+        buffer->pos = buffer->len = 0;
+    }
+    return target;
+}
+
+static size_t SDLCALL
+buffered_read(SDL_RWops * context, void *ptr, size_t size, size_t maxnum)
+{
+    SDL_RWBuffer *buffer = (SDL_RWBuffer *) context->hidden.unknown.data1;
+    Uint8 *dst = (Uint8 *) ptr;
+    size_t total_bytes, copied = 0, amount;
+
+    total_bytes = (maxnum * size);
+    if ((maxnum <= 0) || (size <= 0)
+        || ((total_bytes / maxnum) != (size_t) size)) {
+        return 0;
+    }
+    if (buffer->writing && buffered_flush(buffer) < 0) {
+        return 0;
+    }
+
+    for ( ; ; ) {
+        amount = SDL_min(buffer->len - buffer->pos, total_bytes - copied);
+        SDL_memcpy(dst + copied, buffer->data + buffer->pos, amount);
+        buffer->pos += amount;
+        copied += amount;
+        if (copied == total_bytes) {
+            break;
+        }
+
+        /* The buffer is used up */
+        buffer->offset += buffer->len;
+        buffer->pos = buffer->len = 0;
+        if (total_bytes - copied >= buffer->size) {
+            /* Big reads go straight into the caller's memory */
+            amount = SDL_RWread(buffer->source, dst + copied, 1, total_bytes - copied);
+            buffer->offset += amount;
+            copied += amount;
+            break;
+        }
+        buffer->len = SDL_RWread(buffer->source, buffer->data, 1, buffer->size);
+        if (buffer->len == 0) {
+            break;
+        }
+    }
+    return (copied / size);
+}
+
+static size_t SDLCALL
+buffered_write(SDL_RWops * context, const void *ptr, size_t size, size_t num)
+{
+    SDL_RWBuffer *buffer = (SDL_RWBuffer *) context->hidden.unknown.data1;
+    size_t total_bytes, written;
+
+    total_bytes = (num * size);
+    if ((num <= 0) || (size <= 0)
+        || ((total_bytes / num) != (size_t) size)) {
+        return 0;
+    }
+
+    if (!buffer->writing) {
+        if (buffered_flush(buffer) < 0) {
+            return 0;
+        }
+        buffer->writing = SDL_TRUE;
+    }
+    if (buffer->pos + total_bytes > buffer->size) {
+        if (buffered_flush(buffer) < 0) {
+            return 0;
+        }
+        buffer->writing = SDL_TRUE;
+        if (total_bytes >= buffer->size) {
+            /* Big writes go straight from the caller's memory */
+            written = SDL_RWwrite(buffer->source, ptr, size, num);
+            buffer->offset += written * size;
+            return written;
+        }
+    }
+    SDL_memcpy(buffer->data + buffer->pos, ptr, total_bytes);
+    buffer->pos += total_bytes;
+    return num;
+}
+
+static int SDLCALL
+buffered_close(SDL_RWops * context)
+{
+    int status = 0;
+    if (context) {
+        SDL_RWBuffer *buffer = (SDL_RWBuffer *) context->hidden.unknown.data1;
+        /* A source that stays open is left where this stream was */
+        if ((buffer->writing || !buffer->autoclose) && buffered_flush(buffer) < 0) {
+            status = -1;
+        }
+        if (buffer->autoclose && SDL_RWclose(buffer->source) < 0) {
+            status = -1;
+        }
+        SDL_free(buffer->data);
+        SDL_free(buffer);
+        SDL_FreeRW(context);
+    }
+    return status;
+}
+
 
 /* Functions to create SDL_RWops structures from various data sources */
 
@@ -539,7 +815,12 @@ SDL_RWFromFile(const char *file, const char *mode)
         if (fp == NULL) {
             SDL_SetError("Couldn't open %s", file);
         } else {
-            rwops = SDL_RWFromFP(fp, 1);
+#ifdef SDL_RWOPS_MMAP_SUPPORTED
+            rwops = mmap_open(fp, mode);
+#endif
+            if (rwops == NULL) {
+                rwops = SDL_RWFromFP(fp, 1);
+            }
         }
     }
 #else
@@ -633,6 +914,67 @@ SDL_RWFromConstMem(const void *mem, int size)
     return rwops;
 }
 
+SDL_RWops *
+SDL_CreateBufferedRW(SDL_RWops * context, size_t buffer_size, SDL_bool autoclose)
+{
+    SDL_RWops *rwops;
+    SDL_RWBuffer *buffer;
+    Sint64 offset;
+
+    if (!context) {
+        SDL_InvalidParamError("context");
+        return NULL;
+    }
+    if (buffer_size == 0) {
+        buffer_size = DEFAULT_RW_BUFFER_SIZE;
+    }
+
+    /* Streams that can't tell where they are start at 0 */
+    offset = SDL_RWtell(context);
+    if (offset < 0) {
+        offset = 0;
+    }
+
+    buffer = (SDL_RWBuffer *) SDL_calloc(1, sizeof (*buffer));
+    if (buffer) {
+        buffer->data = (Uint8 *) SDL_malloc(buffer_size);
+    }
+    if (!buffer || !buffer->data) {
+        SDL_free(buffer);
+        SDL_OutOfMemory();
+        return NULL;
+    }
+    buffer->source = context;
+    buffer->autoclose = autoclose;
+    buffer->size = buffer_size;
+    buffer->offset = offset;
+
+    rwops = SDL_AllocRW();
+    if (rwops == NULL) {
+        SDL_free(buffer->data);
+        SDL_free(buffer);
+        return NULL;
+    }
+    rwops->size = buffered_size;
+    rwops->seek = buffered_seek;
+    rwops->read = buffered_read;
+    rwops->write = buffered_write;
+    rwops->close = buffered_close;
+    rwops->hidden.unknown.data1 = buffer;
+    rwops->hidden.unknown.data2 = NULL;
+    rwops->type = SDL_RWOPS_BUFFERED;
+    return rwops;
+}
+
+int
+SDL_FlushBufferedRW(SDL_RWops * context)
+{
+    if (!context || context->type != SDL_RWOPS_BUFFERED) {
+        return SDL_InvalidParamError("context");
+    }
+    return buffered_flush((SDL_RWBuffer *) context->hidden.unknown.data1);
+}
+
 SDL_RWops *
 SDL_AllocRW(void)
 {
@@ -653,14 +995,81 @@ SDL_FreeRW(SDL_RWops * area)
     SDL_free(area);
 }
 
+const void *
+SDL_RWGetView(SDL_RWops * context, size_t * size)
+{
+    if (size) {
+        *size = 0;
+    }
+    if (context == NULL) {
+        return NULL;
+    }
+
+    switch (context->type) {
+    case SDL_RWOPS_MEMORY:
+    case SDL_RWOPS_MEMORY_RO:
+    case SDL_RWOPS_MAPFILE:
+        if (size) {
+            *size = (size_t) (context->hidden.mem.stop - context->hidden.mem.here);
+        }
+        return context->hidden.mem.here;
+    default:
+        return NULL;
+    }
+}
+
 /* Functions for dynamically reading and writing endian-specific values */
 
+/* Values are read and written directly when they fit in a buffered or
+   memory stream's buffer, so parsing a file field by field doesn't go
+   through the stream's functions for every field */
+static SDL_INLINE void
+SDL_RWreadValue(SDL_RWops * src, void *value, size_t size)
+{
+    if (src->type == SDL_RWOPS_BUFFERED) {
+        SDL_RWBuffer *buffer = (SDL_RWBuffer *) src->hidden.unknown.data1;
+        if (!buffer->writing && (buffer->len - buffer->pos) >= size) {
+            SDL_memcpy(value, buffer->data + buffer->pos, size);
+            buffer->pos += size;
+            return;
+        }
+    } else if (src->type == SDL_RWOPS_MEMORY || src->type == SDL_RWOPS_MEMORY_RO ||
+               src->type == SDL_RWOPS_MAPFILE) {
+        if ((size_t) (src->hidden.mem.stop - src->hidden.mem.here) >= size) {
+            SDL_memcpy(value, src->hidden.mem.here, size);
+            src->hidden.mem.here += size;
+            return;
+        }
+    }
+    SDL_RWread(src, value, size, 1);
+}
+
+static SDL_INLINE size_t
+SDL_RWwriteValue(SDL_RWops * dst, const void *value, size_t size)
+{
+    if (dst->type == SDL_RWOPS_BUFFERED) {
+        SDL_RWBuffer *buffer = (SDL_RWBuffer *) dst->hidden.unknown.data1;
+        if (buffer->writing && (buffer->size - buffer->pos) >= size) {
+            SDL_memcpy(buffer->data + buffer->pos, value, size);
+            buffer->pos += size;
+            return 1;
+        }
+    } else if (dst->type == SDL_RWOPS_MEMORY) {
+        if ((size_t) (dst->hidden.mem.stop - dst->hidden.mem.here) >= size) {
+            SDL_memcpy(dst->hidden.mem.here, value, size);
+            dst->hidden.mem.here += size;
+            return 1;
+        }
+    }
+    return SDL_RWwrite(dst, value, size, 1);
+}
+
 Uint8
 SDL_ReadU8(SDL_RWops * src)
 {
     Uint8 value = 0;
 
-    SDL_RWread(src, &value, sizeof (value), 1);
+    SDL_RWreadValue(src, &value, sizeof (value));
     return value;
 }
 
@@ -669,7 +1078,7 @@ SDL_ReadLE16(SDL_RWops * src)
 {
     Uint16 value = 0;
 
-    SDL_RWread(src, &value, sizeof (value), 1);
+    SDL_RWreadValue(src, &value, sizeof (value));
     return SDL_SwapLE16(value);
 }
 
@@ -678,7 +1087,7 @@ SDL_ReadBE16(SDL_RWops * src)
 {
     Uint16 value = 0;
 
-    SDL_RWread(src, &value, sizeof (value), 1);
+    SDL_RWreadValue(src, &value, sizeof (value));
     return SDL_SwapBE16(value);
 }
 
@@ -687,7 +1096,7 @@ SDL_ReadLE32(SDL_RWops * src)
 {
     Uint32 value = 0;
 
-    SDL_RWread(src, &value, sizeof (value), 1);
+    SDL_RWreadValue(src, &value, sizeof (value));
     return SDL_SwapLE32(value);
 }
 
@@ -696,7 +1105,7 @@ SDL_ReadBE32(SDL_RWops * src)
 {
     Uint32 value = 0;
 
-    SDL_RWread(src, &value, sizeof (value), 1);
+    SDL_RWreadValue(src, &value, sizeof (value));
     return SDL_SwapBE32(value);
 }
 
@@ -705,7 +1114,7 @@ SDL_ReadLE64(SDL_RWops * src)
 {
     Uint64 value = 0;
 
-    SDL_RWread(src, &value, sizeof (value), 1);
+    SDL_RWreadValue(src, &value, sizeof (value));
     return SDL_SwapLE64(value);
 }
 
@@ -714,56 +1123,56 @@ SDL_ReadBE64(SDL_RWops * src)
 {
     Uint64 value = 0;
 
-    SDL_RWread(src, &value, sizeof (value), 1);
+    SDL_RWreadValue(src, &value, sizeof (value));
     return SDL_SwapBE64(value);
 }
 
 size_t
 SDL_WriteU8(SDL_RWops * dst, Uint8 value)
 {
-    return SDL_RWwrite(dst, &value, sizeof (value), 1);
+    return SDL_RWwriteValue(dst, &value, sizeof (value));
 }
 
 size_t
 SDL_WriteLE16(SDL_RWops * dst, Uint16 value)
 {
     const Uint16 swapped = SDL_SwapLE16(value);
-    return SDL_RWwrite(dst, &swapped, sizeof (swapped), 1);
+    return SDL_RWwriteValue(dst, &swapped, sizeof (swapped));
 }
 
 size_t
 SDL_WriteBE16(SDL_RWops * dst, Uint16 value)
 {
     const Uint16 swapped = SDL_SwapBE16(value);
-    return SDL_RWwrite(dst, &swapped, sizeof (swapped), 1);
+    return SDL_RWwriteValue(dst, &swapped, sizeof (swapped));
 }
 
 size_t
 SDL_WriteLE32(SDL_RWops * dst, Uint32 value)
 {
     const Uint32 swapped = SDL_SwapLE32(value);
-    return SDL_RWwrite(dst, &swapped, sizeof (swapped), 1);
+    return SDL_RWwriteValue(dst, &swapped, sizeof (swapped));
 }
 
 size_t
 SDL_WriteBE32(SDL_RWops * dst, Uint32 value)
 {
     const Uint32 swapped = SDL_SwapBE32(value);
-    return SDL_RWwrite(dst, &swapped, sizeof (swapped), 1);
+    return SDL_RWwriteValue(dst, &swapped, sizeof (swapped));
 }
 
 size_t
 SDL_WriteLE64(SDL_RWops * dst, Uint64 value)
 {
     const Uint64 swapped = SDL_SwapLE64(value);
-    return SDL_RWwrite(dst, &swapped, sizeof (swapped), 1);
+    return SDL_RWwriteValue(dst, &swapped, sizeof (swapped));
 }
 
 size_t
 SDL_WriteBE64(SDL_RWops * dst, Uint64 value)
 {
     const Uint64 swapped = SDL_SwapBE64(value);
-    return SDL_RWwrite(dst, &swapped, sizeof (swapped), 1);
+    return SDL_RWwriteValue(dst, &swapped, sizeof (swapped));
 }
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -77,6 +77,235 @@ static char texture_magic;
 
 static int UpdateLogicalSize(SDL_Renderer *renderer);
 
+/* Draws everything that's been batched up */
+static int
+FlushRenderCommands(SDL_Renderer *renderer)
+{
+    int retval;
+
+    if (renderer->num_commands == 0) {
+        return 0;
+    }
+
+    retval = renderer->RunCommandQueue(renderer, renderer->commands,
+                                       renderer->num_commands, renderer->command_data);
+
+    renderer->num_commands = 0;
+    renderer->command_data_used = 0;
+    ++renderer->render_command_generation;
+    return retval;
+}
+
+/* Draws the batch before a texture in it changes */
+static int
+FlushRenderCommandsIfTextureNeeded(SDL_Texture *texture)
+{
+    SDL_Renderer *renderer = texture->renderer;
+
+    if (texture->last_command_generation == renderer->render_command_generation) {
+        return FlushRenderCommands(renderer);
+    }
+    return 0;
+}
+
+/* Returns room for count items at the end of the command data, merging them
+   into the last command if it draws the same way */
+static void *
+AllocateRenderCommand(SDL_Renderer *renderer, SDL_RenderCommandType type,
+                      SDL_Texture *texture, size_t itemsize, int count)
+{
+    SDL_RenderCommand *cmd = NULL;
+    SDL_BlendMode blendMode;
+    Uint8 r, g, b, a;
+    size_t first, needed;
+
+    if (texture) {
+        blendMode = texture->blendMode;
+        r = texture->r;
+        g = texture->g;
+        b = texture->b;
+        a = texture->a;
+    } else {
+        blendMode = renderer->blendMode;
+        r = renderer->r;
+        g = renderer->g;
+        b = renderer->b;
+        a = renderer->a;
+    }
+
+    /* Clears don't have any items and the ends of separate lines can't be joined */
+    if (renderer->num_commands > 0 &&
+        type != SDL_RENDERCMD_CLEAR && type != SDL_RENDERCMD_DRAW_LINES) {
+        cmd = &renderer->commands[renderer->num_commands - 1];
+        if (cmd->command != type || cmd->texture != texture || cmd->blendMode != blendMode ||
+            cmd->r != r || cmd->g != g || cmd->b != b || cmd->a != a) {
+            cmd = NULL;
+        }
+    }
+
+    if (cmd) {
+        first = renderer->command_data_used;
+    } else {
+        /* Keep every command's items aligned for the doubles in SDL_RenderCopyExData */
+        first = (renderer->command_data_used + 7) & ~((size_t) 7);
+    }
+    needed = first + itemsize * count;
+
+    if (!renderer->command_data || needed > renderer->command_data_allocated) {
+        size_t allocated = SDL_max(renderer->command_data_allocated, 4096);
+        Uint8 *data;
+
+        while (allocated < needed) {
+            allocated *= 2;
+        }
+        data = (Uint8 *) SDL_realloc(renderer->command_data, allocated);
+        if (!data) {
+            SDL_OutOfMemory();
+            return NULL;
+        }
+        renderer->command_data = data;
+        renderer->command_data_allocated = allocated;
+    }
+
+    if (!cmd) {
+        if (renderer->num_commands == renderer->max_commands) {
+            int max_commands = SDL_max(renderer->max_commands * 2, 64);
+            SDL_RenderCommand *commands;
+
+            commands = (SDL_RenderCommand *) SDL_realloc(renderer->commands, max_commands * sizeof(*commands));
+            if (!commands) {
+                SDL_OutOfMemory();
+                return NULL;
+            }
+            renderer->commands = commands;
+            renderer->max_commands = max_commands;
+        }
+        cmd = &renderer->commands[renderer->num_commands++];
+        cmd->command = type;
+        cmd->texture = texture;
+        cmd->blendMode = blendMode;
+        cmd->r = r;
+        cmd->g = g;
+        cmd->b = b;
+        cmd->a = a;
+        cmd->first = first;
+        cmd->count = 0;
+    }
+    cmd->count += count;
+    renderer->command_data_used = needed;
+    if (texture) {
+        texture->last_command_generation = renderer->render_command_generation;
+    }
+
+    return renderer->command_data + first;
+}
+
+static int
+QueueCmdClear(SDL_Renderer *renderer)
+{
+    if (!renderer->batching) {
+        return renderer->RenderClear(renderer);
+    }
+    if (!AllocateRenderCommand(renderer, SDL_RENDERCMD_CLEAR, NULL, 0, 0)) {
+        return -1;
+    }
+    return 0;
+}
+
+static int
+QueueCmdDrawPoints(SDL_Renderer *renderer, const SDL_FPoint * points, int count)
+{
+    SDL_FPoint *items;
+
+    if (!renderer->batching) {
+        return renderer->RenderDrawPoints(renderer, points, count);
+    }
+    items = (SDL_FPoint *) AllocateRenderCommand(renderer, SDL_RENDERCMD_DRAW_POINTS, NULL,
+                                                 sizeof(*items), count);
+    if (!items) {
+        return -1;
+    }
+    SDL_memcpy(items, points, count * sizeof(*items));
+    return 0;
+}
+
+static int
+QueueCmdDrawLines(SDL_Renderer *renderer, const SDL_FPoint * points, int count)
+{
+    SDL_FPoint *items;
+
+    if (!renderer->batching) {
+        return renderer->RenderDrawLines(renderer, points, count);
+    }
+    items = (SDL_FPoint *) AllocateRenderCommand(renderer, SDL_RENDERCMD_DRAW_LINES, NULL,
+                                                 sizeof(*items), count);
+    if (!items) {
+        return -1;
+    }
+    SDL_memcpy(items, points, count * sizeof(*items));
+    return 0;
+}
+
+static int
+QueueCmdFillRects(SDL_Renderer *renderer, const SDL_FRect * rects, int count)
+{
+    SDL_FRect *items;
+
+    if (!renderer->batching) {
+        return renderer->RenderFillRects(renderer, rects, count);
+    }
+    items = (SDL_FRect *) AllocateRenderCommand(renderer, SDL_RENDERCMD_FILL_RECTS, NULL,
+                                                sizeof(*items), count);
+    if (!items) {
+        return -1;
+    }
+    SDL_memcpy(items, rects, count * sizeof(*items));
+    return 0;
+}
+
+static int
+QueueCmdCopy(SDL_Renderer *renderer, SDL_Texture * texture,
+             const SDL_Rect * srcrect, const SDL_FRect * dstrect)
+{
+    SDL_RenderCopyData *item;
+
+    if (!renderer->batching) {
+        return renderer->RenderCopy(renderer, texture, srcrect, dstrect);
+    }
+    item = (SDL_RenderCopyData *) AllocateRenderCommand(renderer, SDL_RENDERCMD_COPY, texture,
+                                                        sizeof(*item), 1);
+    if (!item) {
+        return -1;
+    }
+    item->srcrect = *srcrect;
+    item->dstrect = *dstrect;
+    item->color.r = item->color.g = item->color.b = item->color.a = 255;
+    return 0;
+}
+
+static int
+QueueCmdCopyEx(SDL_Renderer *renderer, SDL_Texture * texture,
+               const SDL_Rect * srcrect, const SDL_FRect * dstrect,
+               const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip)
+{
+    SDL_RenderCopyExData *item;
+
+    if (!renderer->batching) {
+        return renderer->RenderCopyEx(renderer, texture, srcrect, dstrect, angle, center, flip);
+    }
+    item = (SDL_RenderCopyExData *) AllocateRenderCommand(renderer, SDL_RENDERCMD_COPY_EX, texture,
+                                                          sizeof(*item), 1);
+    if (!item) {
+        return -1;
+    }
+    item->srcrect = *srcrect;
+    item->dstrect = *dstrect;
+    item->angle = angle;
+    item->center = *center;
+    item->flip = flip;
+    return 0;
+}
+
 int
 SDL_GetNumRenderDrivers(void)
 {
@@ -110,6 +339,8 @@ SDL_RendererEventWatch(void *userdata, SDL_Event *event)
     if (event->type == SDL_WINDOWEVENT) {
         SDL_Window *window = SDL_GetWindowFromID(event->window.windowID);
         if (window == renderer->window) {
+            FlushRenderCommands(renderer);
+
             if (renderer->WindowEvent) {
                 renderer->WindowEvent(renderer, &event->window);
             }
@@ -290,6 +521,14 @@ SDL_CreateRenderer(SDL_Window * window, int index, Uint32 flags)
         renderer->scale.x = 1.0f;
         renderer->scale.y = 1.0f;
 
+        /* Applications that pick a driver may be drawing with it directly too */
+        if (renderer->RunCommandQueue) {
+            renderer->batching = SDL_GetHintBoolean(SDL_HINT_RENDER_BATCHING,
+                                                    SDL_GetHint(SDL_HINT_RENDER_DRIVER) == NULL);
+        }
+        /* New textures start out at 0, so they don't look like they're in the first batch */
+        renderer->render_command_generation = 1;
+
         if (SDL_GetWindowFlags(window) & (SDL_WINDOW_HIDDEN|SDL_WINDOW_MINIMIZED)) {
             renderer->hidden = SDL_TRUE;
         } else {
@@ -325,6 +564,12 @@ SDL_CreateSoftwareRenderer(SDL_Surface * surface)
         renderer->scale.x = 1.0f;
         renderer->scale.y = 1.0f;
 
+        /* Applications often read the surface without presenting it */
+        if (renderer->RunCommandQueue) {
+            renderer->batching = SDL_GetHintBoolean(SDL_HINT_RENDER_BATCHING, SDL_FALSE);
+        }
+        renderer->render_command_generation = 1;
+
         SDL_RenderSetViewport(renderer, NULL);
     }
     return renderer;
@@ -616,6 +861,10 @@ SDL_SetTextureColorMod(SDL_Texture * texture, Uint8 r, Uint8 g, Uint8 b)
 
     CHECK_TEXTURE_MAGIC(texture, -1);
 
+    if (r != texture->r || g != texture->g || b != texture->b) {
+        FlushRenderCommandsIfTextureNeeded(texture);
+    }
+
     renderer = texture->renderer;
     if (r < 255 || g < 255 || b < 255) {
         texture->modMode |= SDL_TEXTUREMODULATE_COLOR;
@@ -659,6 +908,10 @@ SDL_SetTextureAlphaMod(SDL_Texture * texture, Uint8 alpha)
 
     CHECK_TEXTURE_MAGIC(texture, -1);
 
+    if (alpha != texture->a) {
+        FlushRenderCommandsIfTextureNeeded(texture);
+    }
+
     renderer = texture->renderer;
     if (alpha < 255) {
         texture->modMode |= SDL_TEXTUREMODULATE_ALPHA;
@@ -693,6 +946,10 @@ SDL_SetTextureBlendMode(SDL_Texture * texture, SDL_BlendMode blendMode)
 
     CHECK_TEXTURE_MAGIC(texture, -1);
 
+    if (blendMode != texture->blendMode) {
+        FlushRenderCommandsIfTextureNeeded(texture);
+    }
+
     renderer = texture->renderer;
     texture->blendMode = blendMode;
     if (texture->native) {
@@ -824,7 +1081,11 @@ SDL_UpdateTexture(SDL_Texture * texture, const SDL_Rect * rect,
 
     if ((rect->w == 0) || (rect->h == 0)) {
         return 0;  /* nothing to do. */
-    } else if (texture->yuv) {
+    }
+
+    FlushRenderCommandsIfTextureNeeded(texture);
+
+    if (texture->yuv) {
         return SDL_UpdateTextureYUV(texture, rect, pixels, pitch);
     } else if (texture->native) {
         return SDL_UpdateTextureNative(texture, rect, pixels, pitch);
@@ -924,6 +1185,8 @@ int SDL_UpdateYUVTexture(SDL_Texture * texture, const SDL_Rect * rect,
         rect = &full_rect;
     }
 
+    FlushRenderCommandsIfTextureNeeded(texture);
+
     if (texture->yuv) {
         return SDL_UpdateTextureYUVPlanar(texture, rect, Yplane, Ypitch, Uplane, Upitch, Vplane, Vpitch);
     } else {
@@ -978,6 +1241,8 @@ SDL_LockTexture(SDL_Texture * texture, const SDL_Rect * rect,
         rect = &full_rect;
     }
 
+    FlushRenderCommandsIfTextureNeeded(texture);
+
     if (texture->yuv) {
         return SDL_LockTextureYUV(texture, rect, pixels, pitch);
     } else if (texture->native) {
@@ -1085,6 +1350,8 @@ SDL_SetRenderTarget(SDL_Renderer *renderer, SDL_Texture *texture)
         }
     }
 
+    FlushRenderCommands(renderer);
+
     if (texture && !renderer->target) {
         /* Make a backup of the viewport */
         renderer->viewport_backup = renderer->viewport;
@@ -1254,6 +1521,8 @@ SDL_RenderSetViewport(SDL_Renderer * renderer, const SDL_Rect * rect)
 {
     CHECK_RENDERER_MAGIC(renderer, -1);
 
+    FlushRenderCommands(renderer);
+
     if (rect) {
         renderer->viewport.x = (int)SDL_floor(rect->x * renderer->scale.x);
         renderer->viewport.y = (int)SDL_floor(rect->y * renderer->scale.y);
@@ -1287,6 +1556,8 @@ SDL_RenderSetClipRect(SDL_Renderer * renderer, const SDL_Rect * rect)
 {
     CHECK_RENDERER_MAGIC(renderer, -1)
 
+    FlushRenderCommands(renderer);
+
     if (rect) {
         renderer->clipping_enabled = SDL_TRUE;
         renderer->clip_rect.x = (int)SDL_floor(rect->x * renderer->scale.x);
@@ -1404,22 +1675,32 @@ SDL_RenderClear(SDL_Renderer * renderer)
     if (renderer->hidden) {
         return 0;
     }
-    return renderer->RenderClear(renderer);
+    return QueueCmdClear(renderer);
 }
 
 int
 SDL_RenderDrawPoint(SDL_Renderer * renderer, int x, int y)
 {
-    SDL_Point point;
+    SDL_FPoint fpoint;
 
-    point.x = x;
-    point.y = y;
-    return SDL_RenderDrawPoints(renderer, &point, 1);
+    fpoint.x = (float) x;
+    fpoint.y = (float) y;
+    return SDL_RenderDrawPointsF(renderer, &fpoint, 1);
+}
+
+int
+SDL_RenderDrawPointF(SDL_Renderer * renderer, float x, float y)
+{
+    SDL_FPoint fpoint;
+
+    fpoint.x = x;
+    fpoint.y = y;
+    return SDL_RenderDrawPointsF(renderer, &fpoint, 1);
 }
 
 static int
 RenderDrawPointsWithRects(SDL_Renderer * renderer,
-                     const SDL_Point * points, int count)
+                     const SDL_FPoint * points, int count)
 {
     SDL_FRect *frects;
     int i;
@@ -1436,7 +1717,7 @@ RenderDrawPointsWithRects(SDL_Renderer * renderer,
         frects[i].h = renderer->scale.y;
     }
 
-    status = renderer->RenderFillRects(renderer, frects, count);
+    status = QueueCmdFillRects(renderer, frects, count);
 
     SDL_stack_free(frects);
 
@@ -1460,46 +1741,75 @@ SDL_RenderDrawPoints(SDL_Renderer * renderer,
         return 0;
     }
 
-    /* Don't draw while we're hidden */
-    if (renderer->hidden) {
-        return 0;
-    }
-
-    if (renderer->scale.x != 1.0f || renderer->scale.y != 1.0f) {
-        return RenderDrawPointsWithRects(renderer, points, count);
-    }
-
     fpoints = SDL_stack_alloc(SDL_FPoint, count);
     if (!fpoints) {
         return SDL_OutOfMemory();
     }
     for (i = 0; i < count; ++i) {
-        fpoints[i].x = points[i].x * renderer->scale.x;
-        fpoints[i].y = points[i].y * renderer->scale.y;
+        fpoints[i].x = (float) points[i].x;
+        fpoints[i].y = (float) points[i].y;
     }
 
-    status = renderer->RenderDrawPoints(renderer, fpoints, count);
+    status = SDL_RenderDrawPointsF(renderer, fpoints, count);
 
     SDL_stack_free(fpoints);
 
     return status;
 }
 
+int
+SDL_RenderDrawPointsF(SDL_Renderer * renderer,
+                      const SDL_FPoint * points, int count)
+{
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (!points) {
+        return SDL_SetError("SDL_RenderDrawPointsF(): Passed NULL points");
+    }
+    if (count < 1) {
+        return 0;
+    }
+
+    /* Don't draw while we're hidden */
+    if (renderer->hidden) {
+        return 0;
+    }
+
+    if (renderer->scale.x != 1.0f || renderer->scale.y != 1.0f) {
+        return RenderDrawPointsWithRects(renderer, points, count);
+    }
+
+    /* Unscaled points go to the renderer as they are */
+    return QueueCmdDrawPoints(renderer, points, count);
+}
+
 int
 SDL_RenderDrawLine(SDL_Renderer * renderer, int x1, int y1, int x2, int y2)
 {
-    SDL_Point points[2];
+    SDL_FPoint points[2];
+
+    points[0].x = (float) x1;
+    points[0].y = (float) y1;
+    points[1].x = (float) x2;
+    points[1].y = (float) y2;
+    return SDL_RenderDrawLinesF(renderer, points, 2);
+}
+
+int
+SDL_RenderDrawLineF(SDL_Renderer * renderer, float x1, float y1, float x2, float y2)
+{
+    SDL_FPoint points[2];
 
     points[0].x = x1;
     points[0].y = y1;
     points[1].x = x2;
     points[1].y = y2;
-    return SDL_RenderDrawLines(renderer, points, 2);
+    return SDL_RenderDrawLinesF(renderer, points, 2);
 }
 
 static int
 RenderDrawLinesWithRects(SDL_Renderer * renderer,
-                     const SDL_Point * points, int count)
+                     const SDL_FPoint * points, int count)
 {
     SDL_FRect *frect;
     SDL_FRect *frects;
@@ -1516,8 +1826,8 @@ RenderDrawLinesWithRects(SDL_Renderer * renderer,
     nrects = 0;
     for (i = 0; i < count-1; ++i) {
         if (points[i].x == points[i+1].x) {
-            int minY = SDL_min(points[i].y, points[i+1].y);
-            int maxY = SDL_max(points[i].y, points[i+1].y);
+            float minY = SDL_min(points[i].y, points[i+1].y);
+            float maxY = SDL_max(points[i].y, points[i+1].y);
 
             frect = &frects[nrects++];
             frect->x = points[i].x * renderer->scale.x;
@@ -1525,8 +1835,8 @@ RenderDrawLinesWithRects(SDL_Renderer * renderer,
             frect->w = renderer->scale.x;
             frect->h = (maxY - minY + 1) * renderer->scale.y;
         } else if (points[i].y == points[i+1].y) {
-            int minX = SDL_min(points[i].x, points[i+1].x);
-            int maxX = SDL_max(points[i].x, points[i+1].x);
+            float minX = SDL_min(points[i].x, points[i+1].x);
+            float maxX = SDL_max(points[i].x, points[i+1].x);
 
             frect = &frects[nrects++];
             frect->x = minX * renderer->scale.x;
@@ -1539,11 +1849,11 @@ RenderDrawLinesWithRects(SDL_Renderer * renderer,
             fpoints[0].y = points[i].y * renderer->scale.y;
             fpoints[1].x = points[i+1].x * renderer->scale.x;
             fpoints[1].y = points[i+1].y * renderer->scale.y;
-            status += renderer->RenderDrawLines(renderer, fpoints, 2);
+            status += QueueCmdDrawLines(renderer, fpoints, 2);
         }
     }
 
-    status += renderer->RenderFillRects(renderer, frects, nrects);
+    status += QueueCmdFillRects(renderer, frects, nrects);
 
     SDL_stack_free(frects);
 
@@ -1570,44 +1880,80 @@ SDL_RenderDrawLines(SDL_Renderer * renderer,
         return 0;
     }
 
-    /* Don't draw while we're hidden */
-    if (renderer->hidden) {
-        return 0;
-    }
-
-    if (renderer->scale.x != 1.0f || renderer->scale.y != 1.0f) {
-        return RenderDrawLinesWithRects(renderer, points, count);
-    }
-
     fpoints = SDL_stack_alloc(SDL_FPoint, count);
     if (!fpoints) {
         return SDL_OutOfMemory();
     }
     for (i = 0; i < count; ++i) {
-        fpoints[i].x = points[i].x * renderer->scale.x;
-        fpoints[i].y = points[i].y * renderer->scale.y;
+        fpoints[i].x = (float) points[i].x;
+        fpoints[i].y = (float) points[i].y;
     }
 
-    status = renderer->RenderDrawLines(renderer, fpoints, count);
+    status = SDL_RenderDrawLinesF(renderer, fpoints, count);
 
     SDL_stack_free(fpoints);
 
     return status;
 }
 
+int
+SDL_RenderDrawLinesF(SDL_Renderer * renderer,
+                     const SDL_FPoint * points, int count)
+{
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (!points) {
+        return SDL_SetError("SDL_RenderDrawLinesF(): Passed NULL points");
+    }
+    if (count < 2) {
+        return 0;
+    }
+
+    /* Don't draw while we're hidden */
+    if (renderer->hidden) {
+        return 0;
+    }
+
+    if (renderer->scale.x != 1.0f || renderer->scale.y != 1.0f) {
+        return RenderDrawLinesWithRects(renderer, points, count);
+    }
+
+    /* Unscaled points go to the renderer as they are */
+    return QueueCmdDrawLines(renderer, points, count);
+}
+
 int
 SDL_RenderDrawRect(SDL_Renderer * renderer, const SDL_Rect * rect)
 {
-    SDL_Rect full_rect;
-    SDL_Point points[5];
+    SDL_FRect frect;
+
+    if (!rect) {
+        return SDL_RenderDrawRectF(renderer, NULL);
+    }
+    frect.x = (float) rect->x;
+    frect.y = (float) rect->y;
+    frect.w = (float) rect->w;
+    frect.h = (float) rect->h;
+    return SDL_RenderDrawRectF(renderer, &frect);
+}
+
+int
+SDL_RenderDrawRectF(SDL_Renderer * renderer, const SDL_FRect * rect)
+{
+    SDL_FRect full_rect;
+    SDL_FPoint points[5];
 
     CHECK_RENDERER_MAGIC(renderer, -1);
 
     /* If 'rect' == NULL, then outline the whole surface */
     if (!rect) {
-        SDL_RenderGetViewport(renderer, &full_rect);
-        full_rect.x = 0;
-        full_rect.y = 0;
+        SDL_Rect viewport = { 0, 0, 0, 0 };
+
+        SDL_RenderGetViewport(renderer, &viewport);
+        full_rect.x = 0.0f;
+        full_rect.y = 0.0f;
+        full_rect.w = (float) viewport.w;
+        full_rect.h = (float) viewport.h;
         rect = &full_rect;
     }
 
@@ -1621,7 +1967,7 @@ SDL_RenderDrawRect(SDL_Renderer * renderer, const SDL_Rect * rect)
     points[3].y = rect->y+rect->h-1;
     points[4].x = rect->x;
     points[4].y = rect->y;
-    return SDL_RenderDrawLines(renderer, points, 5);
+    return SDL_RenderDrawLinesF(renderer, points, 5);
 }
 
 int
@@ -1652,21 +1998,68 @@ SDL_RenderDrawRects(SDL_Renderer * renderer,
     return 0;
 }
 
+int
+SDL_RenderDrawRectsF(SDL_Renderer * renderer,
+                     const SDL_FRect * rects, int count)
+{
+    int i;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (!rects) {
+        return SDL_SetError("SDL_RenderDrawRectsF(): Passed NULL rects");
+    }
+    if (count < 1) {
+        return 0;
+    }
+
+    /* Don't draw while we're hidden */
+    if (renderer->hidden) {
+        return 0;
+    }
+
+    for (i = 0; i < count; ++i) {
+        if (SDL_RenderDrawRectF(renderer, &rects[i]) < 0) {
+            return -1;
+        }
+    }
+    return 0;
+}
+
 int
 SDL_RenderFillRect(SDL_Renderer * renderer, const SDL_Rect * rect)
 {
-    SDL_Rect full_rect = { 0, 0, 0, 0 };
+    SDL_FRect frect;
+
+    if (!rect) {
+        return SDL_RenderFillRectF(renderer, NULL);
+    }
+    frect.x = (float) rect->x;
+    frect.y = (float) rect->y;
+    frect.w = (float) rect->w;
+    frect.h = (float) rect->h;
+    return SDL_RenderFillRectsF(renderer, &frect, 1);
+}
+
+int
+SDL_RenderFillRectF(SDL_Renderer * renderer, const SDL_FRect * rect)
+{
+    SDL_FRect full_rect;
 
     CHECK_RENDERER_MAGIC(renderer, -1);
 
     /* If 'rect' == NULL, then outline the whole surface */
     if (!rect) {
-        SDL_RenderGetViewport(renderer, &full_rect);
-        full_rect.x = 0;
-        full_rect.y = 0;
+        SDL_Rect viewport = { 0, 0, 0, 0 };
+
+        SDL_RenderGetViewport(renderer, &viewport);
+        full_rect.x = 0.0f;
+        full_rect.y = 0.0f;
+        full_rect.w = (float) viewport.w;
+        full_rect.h = (float) viewport.h;
         rect = &full_rect;
     }
-    return SDL_RenderFillRects(renderer, rect, 1);
+    return SDL_RenderFillRectsF(renderer, rect, 1);
 }
 
 int
@@ -1686,11 +2079,50 @@ SDL_RenderFillRects(SDL_Renderer * renderer,
         return 0;
     }
 
+    frects = SDL_stack_alloc(SDL_FRect, count);
+    if (!frects) {
+        return SDL_OutOfMemory();
+    }
+    for (i = 0; i < count; ++i) {
+        frects[i].x = (float) rects[i].x;
+        frects[i].y = (float) rects[i].y;
+        frects[i].w = (float) rects[i].w;
+        frects[i].h = (float) rects[i].h;
+    }
+
+    status = SDL_RenderFillRectsF(renderer, frects, count);
+
+    SDL_stack_free(frects);
+
+    return status;
+}
+
+int
+SDL_RenderFillRectsF(SDL_Renderer * renderer,
+                     const SDL_FRect * rects, int count)
+{
+    SDL_FRect *frects;
+    int i;
+    int status;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    if (!rects) {
+        return SDL_SetError("SDL_RenderFillRectsF(): Passed NULL rects");
+    }
+    if (count < 1) {
+        return 0;
+    }
+
     /* Don't draw while we're hidden */
     if (renderer->hidden) {
         return 0;
     }
 
+    if (renderer->scale.x == 1.0f && renderer->scale.y == 1.0f) {
+        return QueueCmdFillRects(renderer, rects, count);
+    }
+
     frects = SDL_stack_alloc(SDL_FRect, count);
     if (!frects) {
         return SDL_OutOfMemory();
@@ -1702,19 +2134,52 @@ SDL_RenderFillRects(SDL_Renderer * renderer,
         frects[i].h = rects[i].h * renderer->scale.y;
     }
 
-    status = renderer->RenderFillRects(renderer, frects, count);
+    status = QueueCmdFillRects(renderer, frects, count);
 
     SDL_stack_free(frects);
 
     return status;
 }
 
+/* Same test as SDL_HasIntersection(), for rectangles with float coordinates */
+static SDL_bool
+HasIntersectionF(const SDL_FRect * A, const SDL_FRect * B)
+{
+    if (A->w <= 0.0f || A->h <= 0.0f || B->w <= 0.0f || B->h <= 0.0f) {
+        return SDL_FALSE;
+    }
+    if (A->x >= B->x + B->w || B->x >= A->x + A->w) {
+        return SDL_FALSE;
+    }
+    if (A->y >= B->y + B->h || B->y >= A->y + A->h) {
+        return SDL_FALSE;
+    }
+    return SDL_TRUE;
+}
+
 int
 SDL_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
                const SDL_Rect * srcrect, const SDL_Rect * dstrect)
+{
+    SDL_FRect dstfrect;
+
+    if (!dstrect) {
+        return SDL_RenderCopyF(renderer, texture, srcrect, NULL);
+    }
+    dstfrect.x = (float) dstrect->x;
+    dstfrect.y = (float) dstrect->y;
+    dstfrect.w = (float) dstrect->w;
+    dstfrect.h = (float) dstrect->h;
+    return SDL_RenderCopyF(renderer, texture, srcrect, &dstfrect);
+}
+
+int
+SDL_RenderCopyF(SDL_Renderer * renderer, SDL_Texture * texture,
+                const SDL_Rect * srcrect, const SDL_FRect * dstrect)
 {
     SDL_Rect real_srcrect = { 0, 0, 0, 0 };
-    SDL_Rect real_dstrect = { 0, 0, 0, 0 };
+    SDL_Rect viewport = { 0, 0, 0, 0 };
+    SDL_FRect real_dstrect;
     SDL_FRect frect;
 
     CHECK_RENDERER_MAGIC(renderer, -1);
@@ -1739,11 +2204,13 @@ SDL_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
         }
     }
 
-    SDL_RenderGetViewport(renderer, &real_dstrect);
-    real_dstrect.x = 0;
-    real_dstrect.y = 0;
+    SDL_RenderGetViewport(renderer, &viewport);
+    real_dstrect.x = 0.0f;
+    real_dstrect.y = 0.0f;
+    real_dstrect.w = (float) viewport.w;
+    real_dstrect.h = (float) viewport.h;
     if (dstrect) {
-        if (!SDL_HasIntersection(dstrect, &real_dstrect)) {
+        if (!HasIntersectionF(dstrect, &real_dstrect)) {
             return 0;
         }
         real_dstrect = *dstrect;
@@ -1758,7 +2225,7 @@ SDL_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
     frect.w = real_dstrect.w * renderer->scale.x;
     frect.h = real_dstrect.h * renderer->scale.y;
 
-    return renderer->RenderCopy(renderer, texture, &real_srcrect, &frect);
+    return QueueCmdCopy(renderer, texture, &real_srcrect, &frect);
 }
 
 
@@ -1766,15 +2233,50 @@ int
 SDL_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
                const SDL_Rect * srcrect, const SDL_Rect * dstrect,
                const double angle, const SDL_Point *center, const SDL_RendererFlip flip)
+{
+    SDL_FRect dstfrect;
+    SDL_FPoint fcenter;
+
+    if (dstrect) {
+        dstfrect.x = (float) dstrect->x;
+        dstfrect.y = (float) dstrect->y;
+        dstfrect.w = (float) dstrect->w;
+        dstfrect.h = (float) dstrect->h;
+    } else {
+        SDL_Rect viewport = { 0, 0, 0, 0 };
+
+        SDL_RenderGetViewport(renderer, &viewport);
+        dstfrect.x = 0.0f;
+        dstfrect.y = 0.0f;
+        dstfrect.w = (float) viewport.w;
+        dstfrect.h = (float) viewport.h;
+    }
+
+    if (center) {
+        fcenter.x = (float) center->x;
+        fcenter.y = (float) center->y;
+    } else {
+        /* The integer API has always rotated around a whole pixel */
+        fcenter.x = (float) (((int) dstfrect.w) / 2);
+        fcenter.y = (float) (((int) dstfrect.h) / 2);
+    }
+
+    return SDL_RenderCopyExF(renderer, texture, srcrect, &dstfrect, angle, &fcenter, flip);
+}
+
+int
+SDL_RenderCopyExF(SDL_Renderer * renderer, SDL_Texture * texture,
+                  const SDL_Rect * srcrect, const SDL_FRect * dstrect,
+                  const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip)
 {
     SDL_Rect real_srcrect = { 0, 0, 0, 0 };
-    SDL_Rect real_dstrect = { 0, 0, 0, 0 };
-    SDL_Point real_center;
+    SDL_FRect real_dstrect;
+    SDL_FPoint real_center;
     SDL_FRect frect;
     SDL_FPoint fcenter;
 
     if (flip == SDL_FLIP_NONE && (int)(angle/360) == angle/360) { /* fast path when we don't need rotation or flipping */
-        return SDL_RenderCopy(renderer, texture, srcrect, dstrect);
+        return SDL_RenderCopyF(renderer, texture, srcrect, dstrect);
     }
 
     CHECK_RENDERER_MAGIC(renderer, -1);
@@ -1806,9 +2308,13 @@ SDL_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
     if (dstrect) {
         real_dstrect = *dstrect;
     } else {
-        SDL_RenderGetViewport(renderer, &real_dstrect);
-        real_dstrect.x = 0;
-        real_dstrect.y = 0;
+        SDL_Rect viewport = { 0, 0, 0, 0 };
+
+        SDL_RenderGetViewport(renderer, &viewport);
+        real_dstrect.x = 0.0f;
+        real_dstrect.y = 0.0f;
+        real_dstrect.w = (float) viewport.w;
+        real_dstrect.h = (float) viewport.h;
     }
 
     if (texture->native) {
@@ -1818,8 +2324,8 @@ SDL_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
     if (center) {
         real_center = *center;
     } else {
-        real_center.x = real_dstrect.w/2;
-        real_center.y = real_dstrect.h/2;
+        real_center.x = real_dstrect.w / 2.0f;
+        real_center.y = real_dstrect.h / 2.0f;
     }
 
     frect.x = real_dstrect.x * renderer->scale.x;
@@ -1830,7 +2336,157 @@ SDL_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
     fcenter.x = real_center.x * renderer->scale.x;
     fcenter.y = real_center.y * renderer->scale.y;
 
-    return renderer->RenderCopyEx(renderer, texture, &real_srcrect, &frect, angle, &fcenter, flip);
+    return QueueCmdCopyEx(renderer, texture, &real_srcrect, &frect, angle, &fcenter, flip);
+}
+
+/* Hands a sprite's modulation straight to the driver, without the queue
+   flush that SDL_SetTextureColorMod() and SDL_SetTextureAlphaMod() do */
+static int
+SetTextureModulation(SDL_Texture * texture, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
+{
+    SDL_Renderer *renderer = texture->renderer;
+    int status = 0;
+
+    if (r < 255 || g < 255 || b < 255) {
+        texture->modMode |= SDL_TEXTUREMODULATE_COLOR;
+    } else {
+        texture->modMode &= ~SDL_TEXTUREMODULATE_COLOR;
+    }
+    if (a < 255) {
+        texture->modMode |= SDL_TEXTUREMODULATE_ALPHA;
+    } else {
+        texture->modMode &= ~SDL_TEXTUREMODULATE_ALPHA;
+    }
+    texture->r = r;
+    texture->g = g;
+    texture->b = b;
+    texture->a = a;
+    if (renderer->SetTextureColorMod && renderer->SetTextureColorMod(renderer, texture) < 0) {
+        status = -1;
+    }
+    if (renderer->SetTextureAlphaMod && renderer->SetTextureAlphaMod(renderer, texture) < 0) {
+        status = -1;
+    }
+    return status;
+}
+
+int
+SDL_RenderCopySprites(SDL_Renderer * renderer, SDL_Texture * texture,
+                      const SDL_Sprite * sprites, int count)
+{
+    SDL_Rect texture_rect;
+    SDL_Rect viewport = { 0, 0, 0, 0 };
+    SDL_FRect viewport_rect;
+    SDL_RenderCopyData *items = NULL;
+    Uint8 r, g, b, a;
+    SDL_bool modulated = SDL_FALSE;
+    int i, n;
+    int status = 0;
+
+    CHECK_RENDERER_MAGIC(renderer, -1);
+    CHECK_TEXTURE_MAGIC(texture, -1);
+
+    if (renderer != texture->renderer) {
+        return SDL_SetError("Texture was not created with this renderer");
+    }
+    if (!sprites) {
+        return SDL_SetError("SDL_RenderCopySprites(): Passed NULL sprites");
+    }
+    if (count < 1) {
+        return 0;
+    }
+
+    /* Don't draw while we're hidden */
+    if (renderer->hidden) {
+        return 0;
+    }
+
+    texture_rect.x = 0;
+    texture_rect.y = 0;
+    texture_rect.w = texture->w;
+    texture_rect.h = texture->h;
+
+    SDL_RenderGetViewport(renderer, &viewport);
+    viewport_rect.x = 0.0f;
+    viewport_rect.y = 0.0f;
+    viewport_rect.w = (float) viewport.w;
+    viewport_rect.h = (float) viewport.h;
+
+    if (texture->native) {
+        texture = texture->native;
+    }
+    r = texture->r;
+    g = texture->g;
+    b = texture->b;
+    a = texture->a;
+
+    if (renderer->batching) {
+        /* Room for all of them in one command, given back below if some are culled */
+        items = (SDL_RenderCopyData *) AllocateRenderCommand(renderer, SDL_RENDERCMD_COPY, texture, sizeof (*items), count);
+        if (!items) {
+            return -1;
+        }
+    }
+
+    n = 0;
+    for (i = 0; i < count; ++i) {
+        const SDL_Sprite *sprite = &sprites[i];
+        SDL_Rect srcrect;
+        SDL_FRect dstrect;
+
+        if (!SDL_IntersectRect(&sprite->srcrect, &texture_rect, &srcrect) ||
+            !HasIntersectionF(&sprite->dstrect, &viewport_rect)) {
+            continue;
+        }
+
+        dstrect.x = sprite->dstrect.x * renderer->scale.x;
+        dstrect.y = sprite->dstrect.y * renderer->scale.y;
+        dstrect.w = sprite->dstrect.w * renderer->scale.x;
+        dstrect.h = sprite->dstrect.h * renderer->scale.y;
+
+        if (items) {
+            items[n].srcrect = srcrect;
+            items[n].dstrect = dstrect;
+            items[n].color = sprite->color;
+        } else {
+            /* Without a queue, the texture modulation has to carry the sprite color */
+            const SDL_Color *color = &sprite->color;
+
+            if ((color->r & color->g & color->b & color->a) != 255) {
+                if (SetTextureModulation(texture, (Uint8) ((r * color->r) / 255),
+                                                  (Uint8) ((g * color->g) / 255),
+                                                  (Uint8) ((b * color->b) / 255),
+                                                  (Uint8) ((a * color->a) / 255)) < 0) {
+                    status = -1;
+                }
+                modulated = SDL_TRUE;
+            } else if (modulated) {
+                if (SetTextureModulation(texture, r, g, b, a) < 0) {
+                    status = -1;
+                }
+                modulated = SDL_FALSE;
+            }
+            if (renderer->RenderCopy(renderer, texture, &srcrect, &dstrect) < 0) {
+                status = -1;
+            }
+        }
+        ++n;
+    }
+
+    if (items) {
+        SDL_RenderCommand *cmd = &renderer->commands[renderer->num_commands - 1];
+
+        cmd->count -= (count - n);
+        renderer->command_data_used -= (count - n) * sizeof (*items);
+        if (cmd->count == 0) {
+            --renderer->num_commands;
+        }
+    } else if (modulated) {
+        if (SetTextureModulation(texture, r, g, b, a) < 0) {
+            status = -1;
+        }
+    }
+    return status;
 }
 
 int
@@ -1845,6 +2501,8 @@ SDL_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
         return SDL_Unsupported();
     }
 
+    FlushRenderCommands(renderer);
+
     if (!format) {
         format = SDL_GetWindowPixelFormat(renderer->window);
     }
@@ -1870,11 +2528,21 @@ SDL_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
                                       format, pixels, pitch);
 }
 
+int
+SDL_RenderFlush(SDL_Renderer * renderer)
+{
+    CHECK_RENDERER_MAGIC(renderer, -1);
+
+    return FlushRenderCommands(renderer);
+}
+
 void
 SDL_RenderPresent(SDL_Renderer * renderer)
 {
     CHECK_RENDERER_MAGIC(renderer, );
 
+    FlushRenderCommands(renderer);
+
     /* Don't draw while we're hidden */
     if (renderer->hidden) {
         return;
@@ -1894,6 +2562,8 @@ SDL_DestroyTexture(SDL_Texture * texture)
         SDL_SetRenderTarget(renderer, NULL);
     }
 
+    FlushRenderCommandsIfTextureNeeded(texture);
+
     texture->magic = NULL;
 
     if (texture->next) {
@@ -1924,6 +2594,8 @@ SDL_DestroyRenderer(SDL_Renderer * renderer)
 
     SDL_DelEventWatch(SDL_RendererEventWatch, renderer);
 
+    FlushRenderCommands(renderer);
+
     /* Free existing textures for this renderer */
     while (renderer->textures) {
         SDL_DestroyTexture(renderer->textures);
@@ -1936,6 +2608,9 @@ SDL_DestroyRenderer(SDL_Renderer * renderer)
     /* It's no longer magical... */
     renderer->magic = NULL;
 
+    SDL_free(renderer->commands);
+    SDL_free(renderer->command_data);
+
     /* Free the renderer instance */
     renderer->DestroyRenderer(renderer);
 }
@@ -1946,6 +2621,7 @@ int SDL_GL_BindTexture(SDL_Texture *texture, float *texw, float *texh)
 
     CHECK_TEXTURE_MAGIC(texture, -1);
     renderer = texture->renderer;
+    FlushRenderCommands(renderer);
     if (texture->native) {
         return SDL_GL_BindTexture(texture->native, texw, texh);
     } else if (renderer && renderer->GL_BindTexture) {
@@ -1961,6 +2637,7 @@ int SDL_GL_UnbindTexture(SDL_Texture *texture)
 
     CHECK_TEXTURE_MAGIC(texture, -1);
     renderer = texture->renderer;
+    FlushRenderCommands(renderer);
     if (texture->native) {
         return SDL_GL_UnbindTexture(texture->native);
     } else if (renderer && renderer->GL_UnbindTexture) {
@@ -31,19 +31,44 @@
 
 typedef struct SDL_RenderDriver SDL_RenderDriver;
 
+/* Drawing commands recorded by SDL_render.c for drivers that can take them in a batch */
+typedef enum
+{
+    SDL_RENDERCMD_CLEAR,
+    SDL_RENDERCMD_DRAW_POINTS,
+    SDL_RENDERCMD_DRAW_LINES,
+    SDL_RENDERCMD_FILL_RECTS,
+    SDL_RENDERCMD_COPY,
+    SDL_RENDERCMD_COPY_EX
+} SDL_RenderCommandType;
+
+typedef struct
+{
+    SDL_RenderCommandType command;
+    SDL_Texture *texture;       /**< The texture for copies, NULL otherwise */
+    SDL_BlendMode blendMode;    /**< The draw blend mode, or the texture's for copies */
+    Uint8 r, g, b, a;           /**< The draw color, or the texture modulation for copies */
+    size_t first;               /**< Byte offset of the first item in the command data */
+    int count;                  /**< Number of points, rects or copies */
+} SDL_RenderCommand;
+
+/* The items in the command data for SDL_RENDERCMD_COPY */
 typedef struct
 {
-    float x;
-    float y;
-} SDL_FPoint;
+    SDL_Rect srcrect;
+    SDL_FRect dstrect;
+    SDL_Color color;            /**< Multiplied with the texture modulation */
+} SDL_RenderCopyData;
 
+/* The items in the command data for SDL_RENDERCMD_COPY_EX */
 typedef struct
 {
-    float x;
-    float y;
-    float w;
-    float h;
-} SDL_FRect;
+    SDL_Rect srcrect;
+    SDL_FRect dstrect;
+    double angle;
+    SDL_FPoint center;
+    SDL_RendererFlip flip;
+} SDL_RenderCopyExData;
 
 /* Define the SDL texture structure */
 struct SDL_Texture
@@ -68,6 +93,8 @@ struct SDL_Texture
 
     void *driverdata;           /**< Driver specific texture representation */
 
+    Uint32 last_command_generation; /**< The batch of commands the texture was last drawn in */
+
     SDL_Texture *prev;
     SDL_Texture *next;
 };
@@ -114,6 +141,8 @@ struct SDL_Renderer
                        const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip);
     int (*RenderReadPixels) (SDL_Renderer * renderer, const SDL_Rect * rect,
                              Uint32 format, void * pixels, int pitch);
+    int (*RunCommandQueue) (SDL_Renderer * renderer, const SDL_RenderCommand * commands,
+                            int count, const void *data);
     void (*RenderPresent) (SDL_Renderer * renderer);
     void (*DestroyTexture) (SDL_Renderer * renderer, SDL_Texture * texture);
 
@@ -161,6 +190,16 @@ struct SDL_Renderer
     Uint8 r, g, b, a;                   /**< Color for drawing operations values */
     SDL_BlendMode blendMode;            /**< The drawing blend mode */
 
+    /* Drawing commands waiting to be passed to RunCommandQueue */
+    SDL_bool batching;
+    SDL_RenderCommand *commands;
+    int num_commands;
+    int max_commands;
+    Uint8 *command_data;
+    size_t command_data_used;
+    size_t command_data_allocated;
+    Uint32 render_command_generation;
+
     void *driverdata;
 };
 
@@ -0,0 +1,486 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+/* YUV to 32-bit RGB conversion, shared by all the YUV layouts.
+
+   Every converter does the same fixed point arithmetic, so they all give
+   exactly the same result:
+
+     Y' = (Y - y_offset) * y_scale + 4096
+     R = (Y' + (V - 128) * v_to_r) >> 13
+     G = (Y' - (U - 128) * u_to_g - (V - 128) * v_to_g) >> 13
+     B = (Y' + (U - 128) * u_to_b) >> 13
+
+   clamped to 0-255. The vector versions multiply (Y, 1) and (U, V) pairs of
+   16-bit values with a multiply-add into 32-bit sums.
+*/
+
+#include "SDL_cpuinfo.h"
+#include "SDL_hints.h"
+#include "SDL_yuv_rgb_c.h"
+
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+#ifdef __SSE2__
+#define HAVE_SSE2_YUV 1
+#include <emmintrin.h>
+#endif
+#if HAVE_AVX2_INTRINSICS
+#define HAVE_AVX2_YUV 1
+#include <immintrin.h>
+#endif
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define HAVE_NEON_YUV 1
+#include <arm_neon.h>
+#endif
+#endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
+
+/* y_offset, y_scale, v_to_r, u_to_g, v_to_g and u_to_b for each mode */
+static const Sint16 yuv_coefficients[][6] = {
+    { 0, 8192, 11485, 2819, 5850, 14516 },      /* SDL_YUV_CONVERSION_JPEG */
+    { 16, 9539, 13075, 3209, 6660, 16525 },     /* SDL_YUV_CONVERSION_BT601 */
+    { 16, 9539, 14686, 1747, 4366, 17305 }      /* SDL_YUV_CONVERSION_BT709 */
+};
+
+#define YUV_CLAMP(x)    ((x) < 0 ? 0 : (x) >= (256 << 13) ? 255 : ((x) >> 13))
+
+static void
+ConvertRow_Scalar(const SDL_YUVToRGBInfo * info, const Uint8 * y,
+                  const Uint8 * u, const Uint8 * v, Uint32 * dst, int width)
+{
+    const int y_step = (info->layout == SDL_YUV_LAYOUT_PACKED) ? 2 : 1;
+    const int uv_step = (info->layout == SDL_YUV_LAYOUT_PLANAR) ? 1 :
+                        (info->layout == SDL_YUV_LAYOUT_SEMIPLANAR) ? 2 : 4;
+    int x;
+
+    for (x = 0; x < width; ++x) {
+        const int Y = (y[x * y_step] - info->y_offset) * info->y_scale + 4096;
+        const int U = u[(x / 2) * uv_step] - 128;
+        const int V = v[(x / 2) * uv_step] - 128;
+        const int R = Y + V * info->v_to_r;
+        const int G = Y - U * info->u_to_g - V * info->v_to_g;
+        const int B = Y + U * info->u_to_b;
+
+        dst[x] = ((Uint32) YUV_CLAMP(R) << info->r_shift) |
+                 ((Uint32) YUV_CLAMP(G) << info->g_shift) |
+                 ((Uint32) YUV_CLAMP(B) << info->b_shift) | info->alpha;
+    }
+}
+
+/* The rest of a row after the pixels a vector converter did */
+#define CONVERT_REMAINING_PIXELS(x)                                         \
+    if (x < width) {                                                        \
+        const int y_step = (info->layout == SDL_YUV_LAYOUT_PACKED) ? 2 : 1; \
+        const int uv_step = (info->layout == SDL_YUV_LAYOUT_PLANAR) ? 1 :   \
+                            (info->layout == SDL_YUV_LAYOUT_SEMIPLANAR) ? 2 : 4; \
+        ConvertRow_Scalar(info, y + x * y_step, u + (x / 2) * uv_step,      \
+                          v + (x / 2) * uv_step, dst + x, width - x);       \
+    }
+
+#if HAVE_SSE2_YUV
+/* Converts 8 pixels, given as 16-bit Y, U and V with the offsets subtracted */
+static SDL_INLINE void
+StorePixels_SSE2(const SDL_YUVToRGBInfo * info, __m128i y16, __m128i u16, __m128i v16,
+                 Uint32 * dst)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i max = _mm_set1_epi16(255);
+    const __m128i y_coef = _mm_set1_epi32((4096 << 16) | (Uint16) info->y_scale);
+    const __m128i r_coef = _mm_set1_epi32((Sint32) ((Uint32) (Uint16) info->v_to_r << 16));
+    const __m128i g_coef = _mm_set1_epi32((Sint32) (((Uint32) (Uint16) -info->v_to_g << 16) |
+                                                    (Uint16) -info->u_to_g));
+    const __m128i b_coef = _mm_set1_epi32((Uint16) info->u_to_b);
+    const __m128i one = _mm_set1_epi16(1);
+    __m128i ylo, yhi, uvlo, uvhi, r, g, b, lo, hi;
+
+    ylo = _mm_madd_epi16(_mm_unpacklo_epi16(y16, one), y_coef);
+    yhi = _mm_madd_epi16(_mm_unpackhi_epi16(y16, one), y_coef);
+    uvlo = _mm_unpacklo_epi16(u16, v16);
+    uvhi = _mm_unpackhi_epi16(u16, v16);
+
+    r = _mm_packs_epi32(_mm_srai_epi32(_mm_add_epi32(ylo, _mm_madd_epi16(uvlo, r_coef)), 13),
+                        _mm_srai_epi32(_mm_add_epi32(yhi, _mm_madd_epi16(uvhi, r_coef)), 13));
+    g = _mm_packs_epi32(_mm_srai_epi32(_mm_add_epi32(ylo, _mm_madd_epi16(uvlo, g_coef)), 13),
+                        _mm_srai_epi32(_mm_add_epi32(yhi, _mm_madd_epi16(uvhi, g_coef)), 13));
+    b = _mm_packs_epi32(_mm_srai_epi32(_mm_add_epi32(ylo, _mm_madd_epi16(uvlo, b_coef)), 13),
+                        _mm_srai_epi32(_mm_add_epi32(yhi, _mm_madd_epi16(uvhi, b_coef)), 13));
+    r = _mm_min_epi16(_mm_max_epi16(r, zero), max);
+    g = _mm_min_epi16(_mm_max_epi16(g, zero), max);
+    b = _mm_min_epi16(_mm_max_epi16(b, zero), max);
+
+    lo = _mm_or_si128(_mm_or_si128(_mm_sll_epi32(_mm_unpacklo_epi16(r, zero), _mm_cvtsi32_si128(info->r_shift)),
+                                   _mm_sll_epi32(_mm_unpacklo_epi16(g, zero), _mm_cvtsi32_si128(info->g_shift))),
+                      _mm_or_si128(_mm_sll_epi32(_mm_unpacklo_epi16(b, zero), _mm_cvtsi32_si128(info->b_shift)),
+                                   _mm_set1_epi32(info->alpha)));
+    hi = _mm_or_si128(_mm_or_si128(_mm_sll_epi32(_mm_unpackhi_epi16(r, zero), _mm_cvtsi32_si128(info->r_shift)),
+                                   _mm_sll_epi32(_mm_unpackhi_epi16(g, zero), _mm_cvtsi32_si128(info->g_shift))),
+                      _mm_or_si128(_mm_sll_epi32(_mm_unpackhi_epi16(b, zero), _mm_cvtsi32_si128(info->b_shift)),
+                                   _mm_set1_epi32(info->alpha)));
+    _mm_storeu_si128((__m128i *) dst, lo);
+    _mm_storeu_si128((__m128i *) (dst + 4), hi);
+}
+
+/* Splits 16-bit chroma pairs, each in a 32-bit lane, into one vector of each
+   with every value repeated for the two pixels that share it */
+#define SPLIT_CHROMA_PAIRS_SSE2(pairs, first, second)                       \
+    first = _mm_and_si128(pairs, _mm_set1_epi32(0xFFFF));                   \
+    first = _mm_or_si128(first, _mm_slli_epi32(first, 16));                 \
+    second = _mm_srli_epi32(pairs, 16);                                     \
+    second = _mm_or_si128(second, _mm_slli_epi32(second, 16));
+
+static void
+ConvertRow_SSE2(const SDL_YUVToRGBInfo * info, const Uint8 * y,
+                const Uint8 * u, const Uint8 * v, Uint32 * dst, int width)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i low_bytes = _mm_set1_epi16(0xFF);
+    const __m128i y_offset = _mm_set1_epi16(info->y_offset);
+    const __m128i uv_offset = _mm_set1_epi16(128);
+    const SDL_bool u_first = (u < v) ? SDL_TRUE : SDL_FALSE;
+    const Uint8 *uv = u_first ? u : v;
+    const Uint8 *packed = (y < uv) ? y : uv;
+    __m128i y16, u16, v16, pairs, first, second;
+    int x;
+
+    for (x = 0; x + 8 <= width; x += 8) {
+        switch (info->layout) {
+        case SDL_YUV_LAYOUT_PLANAR:
+            y16 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) (y + x)), zero);
+            u16 = _mm_cvtsi32_si128(*(const int *) (u + x / 2));
+            u16 = _mm_unpacklo_epi8(_mm_unpacklo_epi8(u16, u16), zero);
+            v16 = _mm_cvtsi32_si128(*(const int *) (v + x / 2));
+            v16 = _mm_unpacklo_epi8(_mm_unpacklo_epi8(v16, v16), zero);
+            break;
+        case SDL_YUV_LAYOUT_SEMIPLANAR:
+            y16 = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) (y + x)), zero);
+            pairs = _mm_unpacklo_epi8(_mm_loadl_epi64((const __m128i *) (uv + x)), zero);
+            SPLIT_CHROMA_PAIRS_SSE2(pairs, first, second);
+            u16 = u_first ? first : second;
+            v16 = u_first ? second : first;
+            break;
+        default:
+            pairs = _mm_loadu_si128((const __m128i *) (packed + x * 2));
+            if (y < uv) {
+                y16 = _mm_and_si128(pairs, low_bytes);
+                pairs = _mm_srli_epi16(pairs, 8);
+            } else {
+                y16 = _mm_srli_epi16(pairs, 8);
+                pairs = _mm_and_si128(pairs, low_bytes);
+            }
+            SPLIT_CHROMA_PAIRS_SSE2(pairs, first, second);
+            u16 = u_first ? first : second;
+            v16 = u_first ? second : first;
+            break;
+        }
+        StorePixels_SSE2(info, _mm_sub_epi16(y16, y_offset), _mm_sub_epi16(u16, uv_offset),
+                         _mm_sub_epi16(v16, uv_offset), dst + x);
+    }
+    CONVERT_REMAINING_PIXELS(x);
+}
+#endif /* HAVE_SSE2_YUV */
+
+#if HAVE_AVX2_YUV
+/* Converts 16 pixels, given as 16-bit Y, U and V with the offsets subtracted */
+static SDL_INLINE void SDL_TARGETING("avx2")
+StorePixels_AVX2(const SDL_YUVToRGBInfo * info, __m256i y16, __m256i u16, __m256i v16,
+                 Uint32 * dst)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    const __m256i max = _mm256_set1_epi16(255);
+    const __m256i y_coef = _mm256_set1_epi32((4096 << 16) | (Uint16) info->y_scale);
+    const __m256i r_coef = _mm256_set1_epi32((Sint32) ((Uint32) (Uint16) info->v_to_r << 16));
+    const __m256i g_coef = _mm256_set1_epi32((Sint32) (((Uint32) (Uint16) -info->v_to_g << 16) |
+                                                       (Uint16) -info->u_to_g));
+    const __m256i b_coef = _mm256_set1_epi32((Uint16) info->u_to_b);
+    const __m256i one = _mm256_set1_epi16(1);
+    __m256i ylo, yhi, uvlo, uvhi, r, g, b, lo, hi;
+
+    /* The unpacks work within each 128-bit lane, so lo has pixels 0-3 and
+       8-11 and hi has 4-7 and 12-15, put back in order when storing */
+    ylo = _mm256_madd_epi16(_mm256_unpacklo_epi16(y16, one), y_coef);
+    yhi = _mm256_madd_epi16(_mm256_unpackhi_epi16(y16, one), y_coef);
+    uvlo = _mm256_unpacklo_epi16(u16, v16);
+    uvhi = _mm256_unpackhi_epi16(u16, v16);
+
+    r = _mm256_packs_epi32(_mm256_srai_epi32(_mm256_add_epi32(ylo, _mm256_madd_epi16(uvlo, r_coef)), 13),
+                           _mm256_srai_epi32(_mm256_add_epi32(yhi, _mm256_madd_epi16(uvhi, r_coef)), 13));
+    g = _mm256_packs_epi32(_mm256_srai_epi32(_mm256_add_epi32(ylo, _mm256_madd_epi16(uvlo, g_coef)), 13),
+                           _mm256_srai_epi32(_mm256_add_epi32(yhi, _mm256_madd_epi16(uvhi, g_coef)), 13));
+    b = _mm256_packs_epi32(_mm256_srai_epi32(_mm256_add_epi32(ylo, _mm256_madd_epi16(uvlo, b_coef)), 13),
+                           _mm256_srai_epi32(_mm256_add_epi32(yhi, _mm256_madd_epi16(uvhi, b_coef)), 13));
+    r = _mm256_min_epi16(_mm256_max_epi16(r, zero), max);
+    g = _mm256_min_epi16(_mm256_max_epi16(g, zero), max);
+    b = _mm256_min_epi16(_mm256_max_epi16(b, zero), max);
+
+    lo = _mm256_or_si256(_mm256_or_si256(_mm256_sll_epi32(_mm256_unpacklo_epi16(r, zero), _mm_cvtsi32_si128(info->r_shift)),
+                                         _mm256_sll_epi32(_mm256_unpacklo_epi16(g, zero), _mm_cvtsi32_si128(info->g_shift))),
+                         _mm256_or_si256(_mm256_sll_epi32(_mm256_unpacklo_epi16(b, zero), _mm_cvtsi32_si128(info->b_shift)),
+                                         _mm256_set1_epi32(info->alpha)));
+    hi = _mm256_or_si256(_mm256_or_si256(_mm256_sll_epi32(_mm256_unpackhi_epi16(r, zero), _mm_cvtsi32_si128(info->r_shift)),
+                                         _mm256_sll_epi32(_mm256_unpackhi_epi16(g, zero), _mm_cvtsi32_si128(info->g_shift))),
+                         _mm256_or_si256(_mm256_sll_epi32(_mm256_unpackhi_epi16(b, zero), _mm_cvtsi32_si128(info->b_shift)),
+                                         _mm256_set1_epi32(info->alpha)));
+    _mm256_storeu_si256((__m256i *) dst, _mm256_permute2x128_si256(lo, hi, 0x20));
+    _mm256_storeu_si256((__m256i *) (dst + 8), _mm256_permute2x128_si256(lo, hi, 0x31));
+}
+
+#define SPLIT_CHROMA_PAIRS_AVX2(pairs, first, second)                       \
+    first = _mm256_and_si256(pairs, _mm256_set1_epi32(0xFFFF));             \
+    first = _mm256_or_si256(first, _mm256_slli_epi32(first, 16));           \
+    second = _mm256_srli_epi32(pairs, 16);                                  \
+    second = _mm256_or_si256(second, _mm256_slli_epi32(second, 16));
+
+static void SDL_TARGETING("avx2")
+ConvertRow_AVX2(const SDL_YUVToRGBInfo * info, const Uint8 * y,
+                const Uint8 * u, const Uint8 * v, Uint32 * dst, int width)
+{
+    const __m256i low_bytes = _mm256_set1_epi16(0xFF);
+    const __m256i y_offset = _mm256_set1_epi16(info->y_offset);
+    const __m256i uv_offset = _mm256_set1_epi16(128);
+    const SDL_bool u_first = (u < v) ? SDL_TRUE : SDL_FALSE;
+    const Uint8 *uv = u_first ? u : v;
+    const Uint8 *packed = (y < uv) ? y : uv;
+    __m128i c;
+    __m256i y16, u16, v16, pairs, first, second;
+    int x;
+
+    for (x = 0; x + 16 <= width; x += 16) {
+        switch (info->layout) {
+        case SDL_YUV_LAYOUT_PLANAR:
+            y16 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *) (y + x)));
+            c = _mm_loadl_epi64((const __m128i *) (u + x / 2));
+            u16 = _mm256_cvtepu8_epi16(_mm_unpacklo_epi8(c, c));
+            c = _mm_loadl_epi64((const __m128i *) (v + x / 2));
+            v16 = _mm256_cvtepu8_epi16(_mm_unpacklo_epi8(c, c));
+            break;
+        case SDL_YUV_LAYOUT_SEMIPLANAR:
+            y16 = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *) (y + x)));
+            pairs = _mm256_cvtepu8_epi16(_mm_loadu_si128((const __m128i *) (uv + x)));
+            SPLIT_CHROMA_PAIRS_AVX2(pairs, first, second);
+            u16 = u_first ? first : second;
+            v16 = u_first ? second : first;
+            break;
+        default:
+            pairs = _mm256_loadu_si256((const __m256i *) (packed + x * 2));
+            if (y < uv) {
+                y16 = _mm256_and_si256(pairs, low_bytes);
+                pairs = _mm256_srli_epi16(pairs, 8);
+            } else {
+                y16 = _mm256_srli_epi16(pairs, 8);
+                pairs = _mm256_and_si256(pairs, low_bytes);
+            }
+            SPLIT_CHROMA_PAIRS_AVX2(pairs, first, second);
+            u16 = u_first ? first : second;
+            v16 = u_first ? second : first;
+            break;
+        }
+        StorePixels_AVX2(info, _mm256_sub_epi16(y16, y_offset), _mm256_sub_epi16(u16, uv_offset),
+                         _mm256_sub_epi16(v16, uv_offset), dst + x);
+    }
+    CONVERT_REMAINING_PIXELS(x);
+}
+#endif /* HAVE_AVX2_YUV */
+
+#if HAVE_NEON_YUV
+/* Converts 8 pixels, given as 16-bit Y, U and V with the offsets subtracted */
+static SDL_INLINE void
+StorePixels_NEON(const SDL_YUVToRGBInfo * info, int16x8_t y16, int16x8_t u16, int16x8_t v16,
+                 Uint32 * dst)
+{
+    const int32x4_t round = vdupq_n_s32(4096);
+    const int32x4_t ylo = vmlal_n_s16(round, vget_low_s16(y16), info->y_scale);
+    const int32x4_t yhi = vmlal_n_s16(round, vget_high_s16(y16), info->y_scale);
+    const int16x4_t ulo = vget_low_s16(u16), uhi = vget_high_s16(u16);
+    const int16x4_t vlo = vget_low_s16(v16), vhi = vget_high_s16(v16);
+    uint16x8_t r, g, b;
+
+    /* The narrowing shifts clamp to 0-65535, and the narrowing moves to 0-255 */
+    r = vmovl_u8(vqmovn_u16(vcombine_u16(vqshrun_n_s32(vmlal_n_s16(ylo, vlo, info->v_to_r), 13),
+                                         vqshrun_n_s32(vmlal_n_s16(yhi, vhi, info->v_to_r), 13))));
+    g = vmovl_u8(vqmovn_u16(vcombine_u16(vqshrun_n_s32(vmlsl_n_s16(vmlsl_n_s16(ylo, ulo, info->u_to_g), vlo, info->v_to_g), 13),
+                                         vqshrun_n_s32(vmlsl_n_s16(vmlsl_n_s16(yhi, uhi, info->u_to_g), vhi, info->v_to_g), 13))));
+    b = vmovl_u8(vqmovn_u16(vcombine_u16(vqshrun_n_s32(vmlal_n_s16(ylo, ulo, info->u_to_b), 13),
+                                         vqshrun_n_s32(vmlal_n_s16(yhi, uhi, info->u_to_b), 13))));
+
+    vst1q_u32(dst, vorrq_u32(vorrq_u32(vshlq_u32(vmovl_u16(vget_low_u16(r)), vdupq_n_s32(info->r_shift)),
+                                       vshlq_u32(vmovl_u16(vget_low_u16(g)), vdupq_n_s32(info->g_shift))),
+                             vorrq_u32(vshlq_u32(vmovl_u16(vget_low_u16(b)), vdupq_n_s32(info->b_shift)),
+                                       vdupq_n_u32(info->alpha))));
+    vst1q_u32(dst + 4, vorrq_u32(vorrq_u32(vshlq_u32(vmovl_u16(vget_high_u16(r)), vdupq_n_s32(info->r_shift)),
+                                           vshlq_u32(vmovl_u16(vget_high_u16(g)), vdupq_n_s32(info->g_shift))),
+                                 vorrq_u32(vshlq_u32(vmovl_u16(vget_high_u16(b)), vdupq_n_s32(info->b_shift)),
+                                           vdupq_n_u32(info->alpha))));
+}
+
+static void
+ConvertRow_NEON(const SDL_YUVToRGBInfo * info, const Uint8 * y,
+                const Uint8 * u, const Uint8 * v, Uint32 * dst, int width)
+{
+    const int16x8_t y_offset = vdupq_n_s16(info->y_offset);
+    const int16x8_t uv_offset = vdupq_n_s16(128);
+    const SDL_bool u_first = (u < v) ? SDL_TRUE : SDL_FALSE;
+    const Uint8 *uv = u_first ? u : v;
+    const Uint8 *packed = (y < uv) ? y : uv;
+    uint8x8_t y8, u8, v8, first, second;
+    uint8x8x2_t bytes;
+    Uint32 samples;
+    int x;
+
+    for (x = 0; x + 8 <= width; x += 8) {
+        switch (info->layout) {
+        case SDL_YUV_LAYOUT_PLANAR:
+            y8 = vld1_u8(y + x);
+            SDL_memcpy(&samples, u + x / 2, sizeof (samples));
+            u8 = vreinterpret_u8_u32(vdup_n_u32(samples));
+            u8 = vzip_u8(u8, u8).val[0];
+            SDL_memcpy(&samples, v + x / 2, sizeof (samples));
+            v8 = vreinterpret_u8_u32(vdup_n_u32(samples));
+            v8 = vzip_u8(v8, v8).val[0];
+            break;
+        case SDL_YUV_LAYOUT_SEMIPLANAR:
+            y8 = vld1_u8(y + x);
+            bytes = vuzp_u8(vld1_u8(uv + x), vld1_u8(uv + x));
+            first = vzip_u8(bytes.val[0], bytes.val[0]).val[0];
+            second = vzip_u8(bytes.val[1], bytes.val[1]).val[0];
+            u8 = u_first ? first : second;
+            v8 = u_first ? second : first;
+            break;
+        default:
+            bytes = vld2_u8(packed + x * 2);
+            y8 = (y < uv) ? bytes.val[0] : bytes.val[1];
+            bytes = vuzp_u8((y < uv) ? bytes.val[1] : bytes.val[0],
+                            (y < uv) ? bytes.val[1] : bytes.val[0]);
+            first = vzip_u8(bytes.val[0], bytes.val[0]).val[0];
+            second = vzip_u8(bytes.val[1], bytes.val[1]).val[0];
+            u8 = u_first ? first : second;
+            v8 = u_first ? second : first;
+            break;
+        }
+        StorePixels_NEON(info,
+                         vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(y8)), y_offset),
+                         vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(u8)), uv_offset),
+                         vsubq_s16(vreinterpretq_s16_u16(vmovl_u8(v8)), uv_offset),
+                         dst + x);
+    }
+    CONVERT_REMAINING_PIXELS(x);
+}
+#endif /* HAVE_NEON_YUV */
+
+SDL_YUVConversionMode
+SDL_GetYUVConversionModeHint(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_YUV_CONVERSION_MODE);
+
+    if (hint) {
+        if (SDL_strcasecmp(hint, "BT601") == 0) {
+            return SDL_YUV_CONVERSION_BT601;
+        }
+        if (SDL_strcasecmp(hint, "BT709") == 0) {
+            return SDL_YUV_CONVERSION_BT709;
+        }
+    }
+    return SDL_YUV_CONVERSION_JPEG;
+}
+
+/* Returns the position of an 8-bit channel, or -1 if the mask isn't one */
+static int
+GetChannelShift(Uint32 mask)
+{
+    int shift;
+
+    for (shift = 0; shift <= 24; shift += 8) {
+        if (mask == ((Uint32) 0xFF << shift)) {
+            return shift;
+        }
+    }
+    return -1;
+}
+
+int
+SDL_SetupYUVToRGB(SDL_YUVToRGBInfo * info, SDL_YUVLayout layout,
+                  SDL_YUVConversionMode mode, Uint32 dst_format)
+{
+    const Sint16 *coefficients = yuv_coefficients[mode];
+    int bpp;
+    Uint32 Rmask, Gmask, Bmask, Amask;
+
+    if (!SDL_PixelFormatEnumToMasks(dst_format, &bpp, &Rmask, &Gmask, &Bmask, &Amask) || bpp != 32) {
+        return -1;
+    }
+    info->r_shift = GetChannelShift(Rmask);
+    info->g_shift = GetChannelShift(Gmask);
+    info->b_shift = GetChannelShift(Bmask);
+    if (info->r_shift < 0 || info->g_shift < 0 || info->b_shift < 0 ||
+        (Amask && GetChannelShift(Amask) < 0)) {
+        return -1;
+    }
+    info->alpha = Amask;
+
+    info->layout = layout;
+    info->y_offset = coefficients[0];
+    info->y_scale = coefficients[1];
+    info->v_to_r = coefficients[2];
+    info->u_to_g = coefficients[3];
+    info->v_to_g = coefficients[4];
+    info->u_to_b = coefficients[5];
+
+    /* Fastest first, the first one the CPU supports is used */
+#if HAVE_NEON_YUV
+    info->ConvertRow = ConvertRow_NEON;
+    return 0;
+#else
+#if HAVE_AVX2_YUV
+    if (SDL_HasAVX2()) {
+        info->ConvertRow = ConvertRow_AVX2;
+        return 0;
+    }
+#endif
+#if HAVE_SSE2_YUV
+    if (SDL_HasSSE2()) {
+        info->ConvertRow = ConvertRow_SSE2;
+        return 0;
+    }
+#endif
+    info->ConvertRow = ConvertRow_Scalar;
+    return 0;
+#endif
+}
+
+void
+SDL_ConvertYUVToRGB(const SDL_YUVToRGBInfo * info,
+                    const Uint8 * y, const Uint8 * u, const Uint8 * v,
+                    int y_pitch, int uv_pitch, int w, int h,
+                    void *dst, int dst_pitch)
+{
+    Uint8 *dst_row = (Uint8 *) dst;
+    int row;
+
+    for (row = 0; row < h; ++row) {
+        const int uv_row = (info->layout == SDL_YUV_LAYOUT_PACKED) ? row : row / 2;
+
+        info->ConvertRow(info, y, u + uv_row * uv_pitch, v + uv_row * uv_pitch,
+                         (Uint32 *) dst_row, w);
+        y += y_pitch;
+        dst_row += dst_pitch;
+    }
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,81 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#include "SDL_pixels.h"
+
+/* Conversion of YUV images to the 32-bit RGB formats with 8 bits per channel,
+   using SSE2, AVX2 or NEON when the CPU has them */
+
+typedef enum
+{
+    SDL_YUV_LAYOUT_PLANAR,          /* YV12 and IYUV: U and V planes at half size */
+    SDL_YUV_LAYOUT_SEMIPLANAR,      /* NV12 and NV21: one interleaved chroma plane at half size */
+    SDL_YUV_LAYOUT_PACKED           /* YUY2, UYVY and YVYU: two pixels in every four bytes */
+} SDL_YUVLayout;
+
+typedef enum
+{
+    SDL_YUV_CONVERSION_JPEG,        /* Full range BT.601 */
+    SDL_YUV_CONVERSION_BT601,       /* Video range (16-235) BT.601 */
+    SDL_YUV_CONVERSION_BT709        /* Video range (16-235) BT.709 */
+} SDL_YUVConversionMode;
+
+typedef struct SDL_YUVToRGBInfo SDL_YUVToRGBInfo;
+
+/* Converts one row. y, u and v point at the first sample of each, which may
+   be interleaved as the layout says. */
+typedef void (*SDL_YUVToRGBRowFunc) (const SDL_YUVToRGBInfo * info,
+                                     const Uint8 * y, const Uint8 * u,
+                                     const Uint8 * v, Uint32 * dst, int width);
+
+struct SDL_YUVToRGBInfo
+{
+    SDL_YUVLayout layout;
+
+    /* Coefficients, with 13 fractional bits */
+    Sint16 y_offset;
+    Sint16 y_scale;
+    Sint16 v_to_r;
+    Sint16 u_to_g;
+    Sint16 v_to_g;
+    Sint16 u_to_b;
+
+    /* Where the channels go in the destination pixels */
+    int r_shift, g_shift, b_shift;
+    Uint32 alpha;
+
+    SDL_YUVToRGBRowFunc ConvertRow;
+};
+
+extern SDL_YUVConversionMode SDL_GetYUVConversionModeHint(void);
+
+/* Returns -1 if dst_format isn't a 32-bit format with 8 bits per channel */
+extern int SDL_SetupYUVToRGB(SDL_YUVToRGBInfo * info, SDL_YUVLayout layout,
+                             SDL_YUVConversionMode mode, Uint32 dst_format);
+
+/* For the packed layout, uv_pitch is the same as y_pitch */
+extern void SDL_ConvertYUVToRGB(const SDL_YUVToRGBInfo * info,
+                                const Uint8 * y, const Uint8 * u, const Uint8 * v,
+                                int y_pitch, int uv_pitch, int w, int h,
+                                void *dst, int dst_pitch);
+
+/* vi: set ts=4 sw=4 expandtab: */
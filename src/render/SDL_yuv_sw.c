@@ -885,6 +885,22 @@ free_bits_at_bottom(Uint32 a)
     return 1 + free_bits_at_bottom(a >> 1);
 }
 
+static SDL_YUVLayout
+GetYUVLayout(Uint32 format)
+{
+    switch (format) {
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        return SDL_YUV_LAYOUT_SEMIPLANAR;
+    case SDL_PIXELFORMAT_YUY2:
+    case SDL_PIXELFORMAT_UYVY:
+    case SDL_PIXELFORMAT_YVYU:
+        return SDL_YUV_LAYOUT_PACKED;
+    default:
+        return SDL_YUV_LAYOUT_PLANAR;
+    }
+}
+
 static int
 SDL_SW_SetupYUVDisplay(SDL_SW_YUVTexture * swdata, Uint32 target_format)
 {
@@ -901,6 +917,27 @@ SDL_SW_SetupYUVDisplay(SDL_SW_YUVTexture * swdata, Uint32 target_format)
     }
 
     swdata->target_format = target_format;
+    SDL_FreeSurface(swdata->display);
+    swdata->display = NULL;
+
+    /* Targets with 8 bits per channel are converted directly. NV12, NV21 and
+       the video range modes go through ARGB8888 for the others, since the
+       tables below only do full range BT.601 in the original formats. */
+    swdata->Display1X = NULL;
+    swdata->Display2X = NULL;
+    if (SDL_SetupYUVToRGB(&swdata->rgb, GetYUVLayout(swdata->format), swdata->mode, target_format) == 0) {
+        swdata->rgb_format = target_format;
+        return 0;
+    }
+    if (swdata->format == SDL_PIXELFORMAT_NV12 || swdata->format == SDL_PIXELFORMAT_NV21 ||
+        swdata->mode != SDL_YUV_CONVERSION_JPEG) {
+        SDL_SetupYUVToRGB(&swdata->rgb, GetYUVLayout(swdata->format), swdata->mode, SDL_PIXELFORMAT_ARGB8888);
+        swdata->rgb_format = SDL_PIXELFORMAT_ARGB8888;
+        return 0;
+    }
+    swdata->rgb.ConvertRow = NULL;
+    swdata->rgb_format = SDL_PIXELFORMAT_UNKNOWN;
+
     r_2_pix_alloc = &swdata->rgb_2_pix[0 * 768];
     g_2_pix_alloc = &swdata->rgb_2_pix[1 * 768];
     b_2_pix_alloc = &swdata->rgb_2_pix[2 * 768];
@@ -1011,9 +1048,6 @@ SDL_SW_SetupYUVDisplay(SDL_SW_YUVTexture * swdata, Uint32 target_format)
         /* We should never get here (caught above) */
         break;
     }
-
-    SDL_FreeSurface(swdata->display);
-    swdata->display = NULL;
     return 0;
 }
 
@@ -1034,6 +1068,8 @@ SDL_SW_CreateYUVTexture(Uint32 format, int w, int h)
     case SDL_PIXELFORMAT_YUY2:
     case SDL_PIXELFORMAT_UYVY:
     case SDL_PIXELFORMAT_YVYU:
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
         break;
     default:
         SDL_SetError("Unsupported YUV format");
@@ -1048,6 +1084,7 @@ SDL_SW_CreateYUVTexture(Uint32 format, int w, int h)
 
     swdata->format = format;
     swdata->target_format = SDL_PIXELFORMAT_UNKNOWN;
+    swdata->mode = SDL_GetYUVConversionModeHint();
     swdata->w = w;
     swdata->h = h;
     swdata->pixels = (Uint8 *) SDL_malloc(w * h * 2);
@@ -1086,6 +1123,13 @@ SDL_SW_CreateYUVTexture(Uint32 format, int w, int h)
         swdata->planes[1] = swdata->planes[0] + swdata->pitches[0] * h;
         swdata->planes[2] = swdata->planes[1] + swdata->pitches[1] * h / 2;
         break;
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        swdata->pitches[0] = w;
+        swdata->pitches[1] = swdata->pitches[0];
+        swdata->planes[0] = swdata->pixels;
+        swdata->planes[1] = swdata->planes[0] + swdata->pitches[0] * h;
+        break;
     case SDL_PIXELFORMAT_YUY2:
     case SDL_PIXELFORMAT_UYVY:
     case SDL_PIXELFORMAT_YVYU:
@@ -1160,6 +1204,38 @@ SDL_SW_UpdateYUVTexture(SDL_SW_YUVTexture * swdata, const SDL_Rect * rect,
             }
         }
         break;
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        if (rect->x == 0 && rect->y == 0 &&
+            rect->w == swdata->w && rect->h == swdata->h) {
+                SDL_memcpy(swdata->pixels, pixels,
+                           (swdata->h * swdata->w) + (swdata->h * swdata->w) / 2);
+        } else {
+            Uint8 *src, *dst;
+            int row;
+            size_t length;
+
+            /* Copy the Y plane */
+            src = (Uint8 *) pixels;
+            dst = swdata->planes[0] + rect->y * swdata->pitches[0] + rect->x;
+            length = rect->w;
+            for (row = 0; row < rect->h; ++row) {
+                SDL_memcpy(dst, src, length);
+                src += pitch;
+                dst += swdata->pitches[0];
+            }
+
+            /* Copy the interleaved chroma plane */
+            src = (Uint8 *) pixels + rect->h * pitch;
+            dst = swdata->planes[1] + rect->y/2 * swdata->pitches[1] + rect->x/2 * 2;
+            length = rect->w / 2 * 2;
+            for (row = 0; row < rect->h/2; ++row) {
+                SDL_memcpy(dst, src, length);
+                src += pitch;
+                dst += swdata->pitches[1];
+            }
+        }
+        break;
     case SDL_PIXELFORMAT_YUY2:
     case SDL_PIXELFORMAT_UYVY:
     case SDL_PIXELFORMAT_YVYU:
@@ -1246,11 +1322,13 @@ SDL_SW_LockYUVTexture(SDL_SW_YUVTexture * swdata, const SDL_Rect * rect,
     switch (swdata->format) {
     case SDL_PIXELFORMAT_YV12:
     case SDL_PIXELFORMAT_IYUV:
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
         if (rect
             && (rect->x != 0 || rect->y != 0 || rect->w != swdata->w
                 || rect->h != swdata->h)) {
             return SDL_SetError
-                ("YV12 and IYUV textures only support full surface locks");
+                ("YV12, IYUV, NV12 and NV21 textures only support full surface locks");
         }
         break;
     }
@@ -1269,6 +1347,31 @@ SDL_SW_UnlockYUVTexture(SDL_SW_YUVTexture * swdata)
 {
 }
 
+static int
+SDL_SW_ConvertToRGB(SDL_SW_YUVTexture * swdata, const Uint8 *lum,
+                    const Uint8 *Cb, const Uint8 *Cr, void *pixels, int pitch)
+{
+    const int uv_pitch = (swdata->rgb.layout == SDL_YUV_LAYOUT_PACKED) ?
+                         swdata->pitches[0] : swdata->pitches[1];
+
+    if (swdata->rgb_format == swdata->target_format) {
+        SDL_ConvertYUVToRGB(&swdata->rgb, lum, Cb, Cr, swdata->pitches[0], uv_pitch,
+                            swdata->w, swdata->h, pixels, pitch);
+        return 0;
+    }
+
+    if (!swdata->argb) {
+        swdata->argb = (Uint8 *) SDL_malloc(swdata->w * swdata->h * 4);
+        if (!swdata->argb) {
+            return SDL_OutOfMemory();
+        }
+    }
+    SDL_ConvertYUVToRGB(&swdata->rgb, lum, Cb, Cr, swdata->pitches[0], uv_pitch,
+                        swdata->w, swdata->h, swdata->argb, swdata->w * 4);
+    return SDL_ConvertPixels(swdata->w, swdata->h, swdata->rgb_format, swdata->argb,
+                             swdata->w * 4, swdata->target_format, pixels, pitch);
+}
+
 int
 SDL_SW_CopyYUVToRGB(SDL_SW_YUVTexture * swdata, const SDL_Rect * srcrect,
                     Uint32 target_format, int w, int h, void *pixels,
@@ -1302,7 +1405,7 @@ SDL_SW_CopyYUVToRGB(SDL_SW_YUVTexture * swdata, const SDL_Rect * srcrect,
          */
         stretch = 1;
     } else if ((srcrect->w != w) || (srcrect->h != h)) {
-        if ((w == 2 * srcrect->w) && (h == 2 * srcrect->h)) {
+        if ((w == 2 * srcrect->w) && (h == 2 * srcrect->h) && swdata->Display2X) {
             scale_2x = 1;
         } else {
             stretch = 1;
@@ -1368,12 +1471,26 @@ SDL_SW_CopyYUVToRGB(SDL_SW_YUVTexture * swdata, const SDL_Rect * srcrect,
         Cr = lum + 1;
         Cb = lum + 3;
         break;
+    case SDL_PIXELFORMAT_NV12:
+        lum = swdata->planes[0];
+        Cr = swdata->planes[1] + 1;
+        Cb = swdata->planes[1];
+        break;
+    case SDL_PIXELFORMAT_NV21:
+        lum = swdata->planes[0];
+        Cr = swdata->planes[1];
+        Cb = swdata->planes[1] + 1;
+        break;
     default:
         return SDL_SetError("Unsupported YUV format in copy");
     }
     mod = (pitch / targetbpp);
 
-    if (scale_2x) {
+    if (swdata->rgb.ConvertRow) {
+        if (SDL_SW_ConvertToRGB(swdata, lum, Cb, Cr, pixels, pitch) < 0) {
+            return -1;
+        }
+    } else if (scale_2x) {
         mod -= (swdata->w * 2);
         swdata->Display2X(swdata->colortab, swdata->rgb_2_pix,
                           lum, Cr, Cb, pixels, swdata->h, swdata->w, mod);
@@ -1396,6 +1513,7 @@ SDL_SW_DestroyYUVTexture(SDL_SW_YUVTexture * swdata)
         SDL_free(swdata->pixels);
         SDL_free(swdata->colortab);
         SDL_free(swdata->rgb_2_pix);
+        SDL_free(swdata->argb);
         SDL_FreeSurface(swdata->stretch);
         SDL_FreeSurface(swdata->display);
         SDL_free(swdata);
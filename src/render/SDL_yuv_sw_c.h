@@ -21,6 +21,7 @@
 #include "../SDL_internal.h"
 
 #include "SDL_video.h"
+#include "SDL_yuv_rgb_c.h"
 
 /* This is the software implementation of the YUV texture support */
 
@@ -41,6 +42,14 @@ struct SDL_SW_YUVTexture
                        unsigned char *cb, unsigned char *out,
                        int rows, int cols, int mod);
 
+    /* Conversion to 32-bit RGB, used instead of the functions above for
+       targets with 8 bits per channel, and through an ARGB8888 image for
+       anything the tables can't do */
+    SDL_YUVConversionMode mode;
+    SDL_YUVToRGBInfo rgb;
+    Uint32 rgb_format;
+    Uint8 *argb;
+
     /* These are just so we don't have to allocate them separately */
     Uint16 pitches[3];
     Uint8 *planes[3];
@@ -82,6 +82,8 @@ static int GL_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
 static int GL_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
                          const SDL_Rect * srcrect, const SDL_FRect * dstrect,
                          const double angle, const SDL_FPoint *center, const SDL_RendererFlip flip);
+static int GL_RunCommandQueue(SDL_Renderer * renderer, const SDL_RenderCommand * commands,
+                              int count, const void *data);
 static int GL_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
                                Uint32 pixel_format, void * pixels, int pitch);
 static void GL_RenderPresent(SDL_Renderer * renderer);
@@ -442,6 +444,7 @@ GL_CreateRenderer(SDL_Window * window, Uint32 flags)
     renderer->RenderFillRects = GL_RenderFillRects;
     renderer->RenderCopy = GL_RenderCopy;
     renderer->RenderCopyEx = GL_RenderCopyEx;
+    renderer->RunCommandQueue = GL_RunCommandQueue;
     renderer->RenderReadPixels = GL_RenderReadPixels;
     renderer->RenderPresent = GL_RenderPresent;
     renderer->DestroyTexture = GL_DestroyTexture;
@@ -1115,33 +1118,31 @@ GL_SetBlendMode(GL_RenderData * data, int blendMode)
 }
 
 static void
-GL_SetDrawingState(SDL_Renderer * renderer)
+GL_SetDrawingState(SDL_Renderer * renderer, Uint8 r, Uint8 g, Uint8 b, Uint8 a,
+                   SDL_BlendMode blendMode)
 {
     GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
 
     GL_ActivateRenderer(renderer);
 
-    GL_SetColor(data, renderer->r,
-                      renderer->g,
-                      renderer->b,
-                      renderer->a);
+    GL_SetColor(data, r, g, b, a);
 
-    GL_SetBlendMode(data, renderer->blendMode);
+    GL_SetBlendMode(data, blendMode);
 
     GL_SetShader(data, SHADER_SOLID);
 }
 
 static int
-GL_RenderClear(SDL_Renderer * renderer)
+GL_Clear(SDL_Renderer * renderer, Uint8 r, Uint8 g, Uint8 b, Uint8 a)
 {
     GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
 
     GL_ActivateRenderer(renderer);
 
-    data->glClearColor((GLfloat) renderer->r * inv255f,
-                       (GLfloat) renderer->g * inv255f,
-                       (GLfloat) renderer->b * inv255f,
-                       (GLfloat) renderer->a * inv255f);
+    data->glClearColor((GLfloat) r * inv255f,
+                       (GLfloat) g * inv255f,
+                       (GLfloat) b * inv255f,
+                       (GLfloat) a * inv255f);
 
     if (renderer->clipping_enabled) {
         data->glDisable(GL_SCISSOR_TEST);
@@ -1156,6 +1157,12 @@ GL_RenderClear(SDL_Renderer * renderer)
     return 0;
 }
 
+static int
+GL_RenderClear(SDL_Renderer * renderer)
+{
+    return GL_Clear(renderer, renderer->r, renderer->g, renderer->b, renderer->a);
+}
+
 static int
 GL_RenderDrawPoints(SDL_Renderer * renderer, const SDL_FPoint * points,
                     int count)
@@ -1163,7 +1170,8 @@ GL_RenderDrawPoints(SDL_Renderer * renderer, const SDL_FPoint * points,
     GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
     int i;
 
-    GL_SetDrawingState(renderer);
+    GL_SetDrawingState(renderer, renderer->r, renderer->g, renderer->b, renderer->a,
+                       renderer->blendMode);
 
     data->glBegin(GL_POINTS);
     for (i = 0; i < count; ++i) {
@@ -1174,15 +1182,12 @@ GL_RenderDrawPoints(SDL_Renderer * renderer, const SDL_FPoint * points,
     return 0;
 }
 
-static int
-GL_RenderDrawLines(SDL_Renderer * renderer, const SDL_FPoint * points,
-                   int count)
+/* Draws a connected line with the current drawing state */
+static void
+GL_DrawLines(GL_RenderData * data, const SDL_FPoint * points, int count)
 {
-    GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
     int i;
 
-    GL_SetDrawingState(renderer);
-
     if (count > 2 &&
         points[0].x == points[count-1].x && points[0].y == points[count-1].y) {
         data->glBegin(GL_LINE_LOOP);
@@ -1235,6 +1240,19 @@ GL_RenderDrawLines(SDL_Renderer * renderer, const SDL_FPoint * points,
 #endif
         data->glEnd();
     }
+}
+
+static int
+GL_RenderDrawLines(SDL_Renderer * renderer, const SDL_FPoint * points,
+                   int count)
+{
+    GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
+
+    GL_SetDrawingState(renderer, renderer->r, renderer->g, renderer->b, renderer->a,
+                       renderer->blendMode);
+
+    GL_DrawLines(data, points, count);
+
     return GL_CheckError("", renderer);
 }
 
@@ -1244,7 +1262,8 @@ GL_RenderFillRects(SDL_Renderer * renderer, const SDL_FRect * rects, int count)
     GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
     int i;
 
-    GL_SetDrawingState(renderer);
+    GL_SetDrawingState(renderer, renderer->r, renderer->g, renderer->b, renderer->a,
+                       renderer->blendMode);
 
     for (i = 0; i < count; ++i) {
         const SDL_FRect *rect = &rects[i];
@@ -1329,15 +1348,17 @@ GL_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
     maxv = (GLfloat) (srcrect->y + srcrect->h) / texture->h;
     maxv *= texturedata->texh;
 
-    data->glBegin(GL_TRIANGLE_STRIP);
+    /* The same quad GL_DrawCopies() draws, so that batching doesn't change
+       which texels the driver samples along the diagonal of a scaled copy */
+    data->glBegin(GL_QUADS);
     data->glTexCoord2f(minu, minv);
     data->glVertex2f(minx, miny);
     data->glTexCoord2f(maxu, minv);
     data->glVertex2f(maxx, miny);
-    data->glTexCoord2f(minu, maxv);
-    data->glVertex2f(minx, maxy);
     data->glTexCoord2f(maxu, maxv);
     data->glVertex2f(maxx, maxy);
+    data->glTexCoord2f(minu, maxv);
+    data->glVertex2f(minx, maxy);
     data->glEnd();
 
     data->glDisable(texturedata->type);
@@ -1397,15 +1418,16 @@ GL_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
     data->glTranslatef((GLfloat)dstrect->x + centerx, (GLfloat)dstrect->y + centery, (GLfloat)0.0);
     data->glRotated(angle, (GLdouble)0.0, (GLdouble)0.0, (GLdouble)1.0);
 
-    data->glBegin(GL_TRIANGLE_STRIP);
+    /* As in GL_RenderCopy(), the same quad GL_DrawCopiesEx() draws */
+    data->glBegin(GL_QUADS);
     data->glTexCoord2f(minu, minv);
     data->glVertex2f(minx, miny);
     data->glTexCoord2f(maxu, minv);
     data->glVertex2f(maxx, miny);
-    data->glTexCoord2f(minu, maxv);
-    data->glVertex2f(minx, maxy);
     data->glTexCoord2f(maxu, maxv);
     data->glVertex2f(maxx, maxy);
+    data->glTexCoord2f(minu, maxv);
+    data->glVertex2f(minx, maxy);
     data->glEnd();
     data->glPopMatrix();
 
@@ -1414,6 +1436,187 @@ GL_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
     return GL_CheckError("", renderer);
 }
 
+/* Gets the texture coordinates for a source rectangle */
+static void
+GL_GetTexCoords(SDL_Texture * texture, const SDL_Rect * srcrect,
+                GLfloat *minu, GLfloat *maxu, GLfloat *minv, GLfloat *maxv)
+{
+    GL_TextureData *texturedata = (GL_TextureData *) texture->driverdata;
+
+    *minu = (GLfloat) srcrect->x / texture->w;
+    *minu *= texturedata->texw;
+    *maxu = (GLfloat) (srcrect->x + srcrect->w) / texture->w;
+    *maxu *= texturedata->texw;
+    *minv = (GLfloat) srcrect->y / texture->h;
+    *minv *= texturedata->texh;
+    *maxv = (GLfloat) (srcrect->y + srcrect->h) / texture->h;
+    *maxv *= texturedata->texh;
+}
+
+/* Draws a run of copies from one texture as a single list of quads */
+static void
+GL_DrawCopies(SDL_Renderer * renderer, SDL_Texture * texture,
+              const SDL_RenderCopyData * copies, int count)
+{
+    GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
+    GLfloat minx, miny, maxx, maxy;
+    GLfloat minu, maxu, minv, maxv;
+    int i;
+
+    data->glBegin(GL_QUADS);
+    for (i = 0; i < count; ++i) {
+        const SDL_FRect *dstrect = &copies[i].dstrect;
+        const SDL_Color *color = &copies[i].color;
+
+        /* glColor is allowed between glBegin() and glEnd() */
+        GL_SetColor(data, (Uint8) ((texture->r * color->r) / 255),
+                          (Uint8) ((texture->g * color->g) / 255),
+                          (Uint8) ((texture->b * color->b) / 255),
+                          (Uint8) ((texture->a * color->a) / 255));
+
+        minx = dstrect->x;
+        miny = dstrect->y;
+        maxx = dstrect->x + dstrect->w;
+        maxy = dstrect->y + dstrect->h;
+        GL_GetTexCoords(texture, &copies[i].srcrect, &minu, &maxu, &minv, &maxv);
+
+        data->glTexCoord2f(minu, minv);
+        data->glVertex2f(minx, miny);
+        data->glTexCoord2f(maxu, minv);
+        data->glVertex2f(maxx, miny);
+        data->glTexCoord2f(maxu, maxv);
+        data->glVertex2f(maxx, maxy);
+        data->glTexCoord2f(minu, maxv);
+        data->glVertex2f(minx, maxy);
+    }
+    data->glEnd();
+}
+
+/* Like GL_DrawCopies(), but rotating the corners of each quad on the CPU
+   rather than changing the modelview matrix for every copy */
+static void
+GL_DrawCopiesEx(SDL_Renderer * renderer, SDL_Texture * texture,
+                const SDL_RenderCopyExData * copies, int count)
+{
+    GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
+    GLfloat minx, miny, maxx, maxy;
+    GLfloat minu, maxu, minv, maxv;
+    GLfloat centerx, centery, cangle, sangle;
+    int i;
+
+    data->glBegin(GL_QUADS);
+    for (i = 0; i < count; ++i) {
+        const SDL_RenderCopyExData *copy = &copies[i];
+        const SDL_FRect *dstrect = &copy->dstrect;
+        const double radians = copy->angle * M_PI / 180.0;
+
+        centerx = copy->center.x;
+        centery = copy->center.y;
+        cangle = (GLfloat) SDL_cos(radians);
+        sangle = (GLfloat) SDL_sin(radians);
+
+        if (copy->flip & SDL_FLIP_HORIZONTAL) {
+            minx =  dstrect->w - centerx;
+            maxx = -centerx;
+        } else {
+            minx = -centerx;
+            maxx =  dstrect->w - centerx;
+        }
+        if (copy->flip & SDL_FLIP_VERTICAL) {
+            miny =  dstrect->h - centery;
+            maxy = -centery;
+        } else {
+            miny = -centery;
+            maxy =  dstrect->h - centery;
+        }
+        centerx += dstrect->x;
+        centery += dstrect->y;
+        GL_GetTexCoords(texture, &copy->srcrect, &minu, &maxu, &minv, &maxv);
+
+        data->glTexCoord2f(minu, minv);
+        data->glVertex2f(minx * cangle - miny * sangle + centerx, minx * sangle + miny * cangle + centery);
+        data->glTexCoord2f(maxu, minv);
+        data->glVertex2f(maxx * cangle - miny * sangle + centerx, maxx * sangle + miny * cangle + centery);
+        data->glTexCoord2f(maxu, maxv);
+        data->glVertex2f(maxx * cangle - maxy * sangle + centerx, maxx * sangle + maxy * cangle + centery);
+        data->glTexCoord2f(minu, maxv);
+        data->glVertex2f(minx * cangle - maxy * sangle + centerx, minx * sangle + maxy * cangle + centery);
+    }
+    data->glEnd();
+}
+
+static int
+GL_RunCommandQueue(SDL_Renderer * renderer, const SDL_RenderCommand * commands,
+                   int count, const void *vertices)
+{
+    GL_RenderData *data = (GL_RenderData *) renderer->driverdata;
+    int i, j;
+
+    GL_ActivateRenderer(renderer);
+
+    for (i = 0; i < count; ++i) {
+        const SDL_RenderCommand *cmd = &commands[i];
+        const Uint8 *items = (const Uint8 *) vertices + cmd->first;
+
+        switch (cmd->command) {
+        case SDL_RENDERCMD_CLEAR:
+            GL_Clear(renderer, cmd->r, cmd->g, cmd->b, cmd->a);
+            break;
+
+        case SDL_RENDERCMD_DRAW_POINTS: {
+            const SDL_FPoint *points = (const SDL_FPoint *) items;
+
+            GL_SetDrawingState(renderer, cmd->r, cmd->g, cmd->b, cmd->a, cmd->blendMode);
+            data->glBegin(GL_POINTS);
+            for (j = 0; j < cmd->count; ++j) {
+                data->glVertex2f(0.5f + points[j].x, 0.5f + points[j].y);
+            }
+            data->glEnd();
+            break;
+        }
+
+        case SDL_RENDERCMD_DRAW_LINES:
+            GL_SetDrawingState(renderer, cmd->r, cmd->g, cmd->b, cmd->a, cmd->blendMode);
+            GL_DrawLines(data, (const SDL_FPoint *) items, cmd->count);
+            break;
+
+        case SDL_RENDERCMD_FILL_RECTS: {
+            const SDL_FRect *rects = (const SDL_FRect *) items;
+
+            GL_SetDrawingState(renderer, cmd->r, cmd->g, cmd->b, cmd->a, cmd->blendMode);
+            data->glBegin(GL_QUADS);
+            for (j = 0; j < cmd->count; ++j) {
+                const SDL_FRect *rect = &rects[j];
+
+                data->glVertex2f(rect->x, rect->y);
+                data->glVertex2f(rect->x + rect->w, rect->y);
+                data->glVertex2f(rect->x + rect->w, rect->y + rect->h);
+                data->glVertex2f(rect->x, rect->y + rect->h);
+            }
+            data->glEnd();
+            break;
+        }
+
+        case SDL_RENDERCMD_COPY:
+        case SDL_RENDERCMD_COPY_EX: {
+            GL_TextureData *texturedata = (GL_TextureData *) cmd->texture->driverdata;
+
+            if (GL_SetupCopy(renderer, cmd->texture) < 0) {
+                return -1;
+            }
+            if (cmd->command == SDL_RENDERCMD_COPY) {
+                GL_DrawCopies(renderer, cmd->texture, (const SDL_RenderCopyData *) items, cmd->count);
+            } else {
+                GL_DrawCopiesEx(renderer, cmd->texture, (const SDL_RenderCopyExData *) items, cmd->count);
+            }
+            data->glDisable(texturedata->type);
+            break;
+        }
+        }
+    }
+    return GL_CheckError("", renderer);
+}
+
 static int
 GL_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
                     Uint32 pixel_format, void * pixels, int pitch)
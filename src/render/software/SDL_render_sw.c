@@ -33,6 +33,8 @@
 #include "SDL_drawline.h"
 #include "SDL_drawpoint.h"
 #include "SDL_rotate.h"
+#include "../../video/SDL_pixels_c.h"
+#include "../../video/SDL_rowjob_c.h"
 
 /* SDL surface based renderer implementation */
 
@@ -68,6 +70,8 @@ static int SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
 static int SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
                           const SDL_Rect * srcrect, const SDL_FRect * dstrect,
                           const double angle, const SDL_FPoint * center, const SDL_RendererFlip flip);
+static int SW_RunCommandQueue(SDL_Renderer * renderer, const SDL_RenderCommand * commands,
+                              int count, const void *data);
 static int SW_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
                                Uint32 format, void * pixels, int pitch);
 static void SW_RenderPresent(SDL_Renderer * renderer);
@@ -95,12 +99,270 @@ SDL_RenderDriver SW_RenderDriver = {
      0}
 };
 
+/* Drawing that is recorded when SDL_HINT_RENDER_SOFTWARE_THREADS is set */
+typedef enum
+{
+    SW_COMMAND_CLEAR,
+    SW_COMMAND_DRAW_POINTS,
+    SW_COMMAND_FILL_RECTS,
+    SW_COMMAND_COPY,
+    SW_COMMAND_COPY_SCALED,
+    SW_COMMAND_COPY_EX
+} SW_CommandType;
+
+typedef struct
+{
+    SW_CommandType type;
+    SDL_Rect clip_rect;         /* The clip rectangle of the target when this was recorded */
+    union {
+        struct {
+            SDL_BlendMode blendMode;
+            Uint8 r, g, b, a;
+            Uint32 color;
+            int first, count;   /* Range of SW_RenderData points or rects */
+        } draw;
+        struct {
+            SDL_Surface *src;
+            SDL_BlitMap map;    /* How the texture was set up to blit when this was recorded */
+            SDL_Rect srcrect;
+            SDL_Rect dstrect;
+            SDL_bool stretch;
+            SDL_StretchFilters *filters;    /* Released when the commands are drawn */
+            double angle;
+            double centerx, centery;
+            int smooth, flipx, flipy;
+        } copy;
+    } data;
+} SW_Command;
+
 typedef struct
 {
     SDL_Surface *surface;
     SDL_Surface *window;
+
+    /* Recorded drawing, drawn in bands by this many threads of the surface
+       thread pool; nothing is recorded unless it's more than 1 */
+    int num_threads;
+    SDL_Surface *target;
+    SW_Command *commands;
+    int num_commands, max_commands;
+    SDL_Point *points;
+    int num_points, max_points;
+    SDL_Rect *rects;
+    int num_rects, max_rects;
 } SW_RenderData;
 
+/* Smallest band of rows each thread draws at a time */
+#define SW_MIN_BAND_HEIGHT  16
+
+
+static SDL_bool
+SW_GrowArray(void **array, int *maxcount, int count, size_t size)
+{
+    if (count > *maxcount) {
+        int newmax = SDL_max(*maxcount * 2, SDL_max(count, 64));
+        void *newarray = SDL_realloc(*array, newmax * size);
+        if (!newarray) {
+            SDL_OutOfMemory();
+            return SDL_FALSE;
+        }
+        *array = newarray;
+        *maxcount = newmax;
+    }
+    return SDL_TRUE;
+}
+
+static void
+SW_RunCommand(SW_RenderData * data, const SW_Command * cmd, const SDL_Rect * band)
+{
+    SDL_Surface target = *data->target;
+    SDL_Surface src;
+    SDL_BlitMap map;
+    SDL_Rect srcrect, dstrect;
+    int y, y0, y1;
+
+    /* Each thread draws into its own copy of the target, clipped to its band */
+    if (!SDL_IntersectRect(&cmd->clip_rect, band, &target.clip_rect)) {
+        return;
+    }
+
+    switch (cmd->type) {
+    case SW_COMMAND_CLEAR:
+        SDL_FillRect(&target, NULL, cmd->data.draw.color);
+        break;
+    case SW_COMMAND_DRAW_POINTS:
+        if (cmd->data.draw.blendMode == SDL_BLENDMODE_NONE) {
+            SDL_DrawPoints(&target, &data->points[cmd->data.draw.first], cmd->data.draw.count,
+                           cmd->data.draw.color);
+        } else {
+            SDL_BlendPoints(&target, &data->points[cmd->data.draw.first], cmd->data.draw.count,
+                            cmd->data.draw.blendMode,
+                            cmd->data.draw.r, cmd->data.draw.g, cmd->data.draw.b, cmd->data.draw.a);
+        }
+        break;
+    case SW_COMMAND_FILL_RECTS:
+        if (cmd->data.draw.blendMode == SDL_BLENDMODE_NONE) {
+            SDL_FillRects(&target, &data->rects[cmd->data.draw.first], cmd->data.draw.count,
+                          cmd->data.draw.color);
+        } else {
+            SDL_BlendFillRects(&target, &data->rects[cmd->data.draw.first], cmd->data.draw.count,
+                               cmd->data.draw.blendMode,
+                               cmd->data.draw.r, cmd->data.draw.g, cmd->data.draw.b, cmd->data.draw.a);
+        }
+        break;
+    default:
+        /* The blitters write into the blit map, so each thread uses its own copy */
+        src = *cmd->data.copy.src;
+        map = cmd->data.copy.map;
+        src.map = &map;
+
+        if (cmd->type == SW_COMMAND_COPY) {
+            if (SDL_ClipBlit(&src, &cmd->data.copy.srcrect, &target, &cmd->data.copy.dstrect, &srcrect, &dstrect)) {
+                map.blit(&src, &srcrect, &target, &dstrect);
+            }
+        } else if (cmd->type == SW_COMMAND_COPY_SCALED) {
+            /* The rectangles were already clipped, so only draw the rows in this
+               band, picking the same source rows a single stretch blit would */
+            const SDL_Rect *final_src = &cmd->data.copy.srcrect;
+            const SDL_Rect *final_dst = &cmd->data.copy.dstrect;
+            const Sint64 incy = ((Sint64) final_src->h << 16) / final_dst->h;
+
+            y0 = SDL_max(final_dst->y, target.clip_rect.y);
+            y1 = SDL_min(final_dst->y + final_dst->h, target.clip_rect.y + target.clip_rect.h);
+            if (cmd->data.copy.stretch) {
+                SDL_SoftStretchRows(&src, final_src, &target, final_dst, cmd->data.copy.filters, y0, y1);
+                break;
+            }
+            srcrect = *final_src;
+            dstrect = *final_dst;
+            srcrect.h = dstrect.h = 1;
+            for (y = y0; y < y1; ++y) {
+                srcrect.y = final_src->y + (int) (((y - final_dst->y) * incy) >> 16);
+                dstrect.y = y;
+                map.blit(&src, &srcrect, &target, &dstrect);
+            }
+        } else {
+            SDLgfx_transformBlit(&src, &cmd->data.copy.srcrect, &target, &cmd->data.copy.dstrect,
+                                 cmd->data.copy.angle, cmd->data.copy.centerx, cmd->data.copy.centery,
+                                 cmd->data.copy.smooth, cmd->data.copy.flipx, cmd->data.copy.flipy);
+        }
+        break;
+    }
+}
+
+/* Draws all of the recorded commands into rows y to y + h - 1 of the target */
+static void
+SW_RunBand(void *userdata, int y, int h)
+{
+    SW_RenderData *data = (SW_RenderData *) userdata;
+    SDL_Rect band;
+    int i;
+
+    band.x = 0;
+    band.y = y;
+    band.w = data->target->w;
+    band.h = h;
+    for (i = 0; i < data->num_commands; ++i) {
+        SW_RunCommand(data, &data->commands[i], &band);
+    }
+}
+
+/* Draw everything that was recorded, using all of the threads */
+static void
+SW_FlushCommands(SDL_Renderer * renderer)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+    int i;
+
+    if (!data->num_commands) {
+        return;
+    }
+
+    SDL_RunRowJobThreads(SW_RunBand, data, data->target->h, SW_MIN_BAND_HEIGHT, data->num_threads);
+
+    for (i = 0; i < data->num_commands; ++i) {
+        if (data->commands[i].type == SW_COMMAND_COPY_SCALED) {
+            SDL_ReleaseStretchFilters(data->commands[i].data.copy.filters);
+        }
+    }
+    data->num_commands = 0;
+    data->num_points = 0;
+    data->num_rects = 0;
+}
+
+/* Returns SDL_TRUE if drawing into 'surface' should be recorded, otherwise
+   draws what was recorded so far, so the caller can draw right away */
+static SDL_bool
+SW_CanRecord(SDL_Renderer * renderer, SDL_Surface * surface)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+
+    if (data->num_threads < 2 || SDL_MUSTLOCK(surface) ||
+        SDL_ISPIXELFORMAT_INDEXED(surface->format->format)) {
+        SW_FlushCommands(renderer);
+        return SDL_FALSE;
+    }
+    if (surface != data->target) {
+        SW_FlushCommands(renderer);
+        data->target = surface;
+    }
+    return SDL_TRUE;
+}
+
+/* Returns a new command to fill in, or NULL if the caller should draw right away */
+static SW_Command *
+SW_AddCommand(SDL_Renderer * renderer, SDL_Surface * surface, SW_CommandType type, int count)
+{
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
+    SW_Command *cmd;
+
+    if (!SW_CanRecord(renderer, surface)) {
+        return NULL;
+    }
+
+    if (!SW_GrowArray((void **) &data->commands, &data->max_commands,
+                      data->num_commands + 1, sizeof (*data->commands))) {
+        SW_FlushCommands(renderer);
+        return NULL;
+    }
+    cmd = &data->commands[data->num_commands];
+    cmd->type = type;
+    cmd->clip_rect = surface->clip_rect;
+
+    if (type == SW_COMMAND_DRAW_POINTS) {
+        if (!SW_GrowArray((void **) &data->points, &data->max_points,
+                          data->num_points + count, sizeof (*data->points))) {
+            SW_FlushCommands(renderer);
+            return NULL;
+        }
+        cmd->data.draw.first = data->num_points;
+        cmd->data.draw.count = count;
+        data->num_points += count;
+    } else if (type == SW_COMMAND_FILL_RECTS) {
+        if (!SW_GrowArray((void **) &data->rects, &data->max_rects,
+                          data->num_rects + count, sizeof (*data->rects))) {
+            SW_FlushCommands(renderer);
+            return NULL;
+        }
+        cmd->data.draw.first = data->num_rects;
+        cmd->data.draw.count = count;
+        data->num_rects += count;
+    }
+    ++data->num_commands;
+    return cmd;
+}
+
+/* RLE encoding and decoding a texture replaces its pixels, which recorded copies
+   still use, so draw them before anything that could change how the texture blits */
+static void
+SW_FlushIfEncoded(SDL_Renderer * renderer, SDL_Surface * surface)
+{
+    if ((surface->flags & SDL_RLEACCEL) || (surface->map->info.flags & SDL_COPY_RLE_DESIRED)) {
+        SW_FlushCommands(renderer);
+    }
+}
+
+
 
 static SDL_Surface *
 SW_ActivateRenderer(SDL_Renderer * renderer)
@@ -127,6 +389,7 @@ SW_CreateRendererForSurface(SDL_Surface * surface)
 {
     SDL_Renderer *renderer;
     SW_RenderData *data;
+    const char *hint;
 
     if (!surface) {
         SDL_SetError("Can't create renderer for NULL surface");
@@ -147,6 +410,8 @@ SW_CreateRendererForSurface(SDL_Surface * surface)
     }
     data->surface = surface;
     data->window = surface;
+    hint = SDL_GetHint(SDL_HINT_RENDER_SOFTWARE_THREADS);
+    data->num_threads = hint ? SDL_atoi(hint) : 0;
 
     renderer->WindowEvent = SW_WindowEvent;
     renderer->GetOutputSize = SW_GetOutputSize;
@@ -166,6 +431,7 @@ SW_CreateRendererForSurface(SDL_Surface * surface)
     renderer->RenderFillRects = SW_RenderFillRects;
     renderer->RenderCopy = SW_RenderCopy;
     renderer->RenderCopyEx = SW_RenderCopyEx;
+    renderer->RunCommandQueue = SW_RunCommandQueue;
     renderer->RenderReadPixels = SW_RenderReadPixels;
     renderer->RenderPresent = SW_RenderPresent;
     renderer->DestroyTexture = SW_DestroyTexture;
@@ -196,6 +462,7 @@ SW_WindowEvent(SDL_Renderer * renderer, const SDL_WindowEvent *event)
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
 
     if (event->event == SDL_WINDOWEVENT_SIZE_CHANGED) {
+        SW_FlushCommands(renderer);
         data->surface = NULL;
         data->window = NULL;
     }
@@ -220,6 +487,20 @@ SW_GetOutputSize(SDL_Renderer * renderer, int *w, int *h)
     }
 }
 
+static SDL_ScaleMode
+GetScaleQuality(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY);
+
+    if (!hint || *hint == '0' || SDL_strcasecmp(hint, "nearest") == 0) {
+        return SDL_ScaleModeNearest;
+    } else if (*hint == '2' || SDL_strcasecmp(hint, "best") == 0) {
+        return SDL_ScaleModeBest;
+    } else {
+        return SDL_ScaleModeLinear;
+    }
+}
+
 static int
 SW_CreateTexture(SDL_Renderer * renderer, SDL_Texture * texture)
 {
@@ -238,6 +519,7 @@ SW_CreateTexture(SDL_Renderer * renderer, SDL_Texture * texture)
                            texture->b);
     SDL_SetSurfaceAlphaMod(texture->driverdata, texture->a);
     SDL_SetSurfaceBlendMode(texture->driverdata, texture->blendMode);
+    SDL_SetSurfaceScaleMode(texture->driverdata, GetScaleQuality());
 
     if (texture->access == SDL_TEXTUREACCESS_STATIC) {
         SDL_SetSurfaceRLE(texture->driverdata, 1);
@@ -253,6 +535,7 @@ static int
 SW_SetTextureColorMod(SDL_Renderer * renderer, SDL_Texture * texture)
 {
     SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
+    SW_FlushIfEncoded(renderer, surface);
     /* If the color mod is ever enabled (non-white), permanently disable RLE (which doesn't support
      * color mod) to avoid potentially frequent RLE encoding/decoding.
      */
@@ -267,6 +550,7 @@ static int
 SW_SetTextureAlphaMod(SDL_Renderer * renderer, SDL_Texture * texture)
 {
     SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
+    SW_FlushIfEncoded(renderer, surface);
     /* If the texture ever has multiple alpha values (surface alpha plus alpha channel), permanently
      * disable RLE (which doesn't support this) to avoid potentially frequent RLE encoding/decoding.
      */
@@ -280,6 +564,7 @@ static int
 SW_SetTextureBlendMode(SDL_Renderer * renderer, SDL_Texture * texture)
 {
     SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
+    SW_FlushIfEncoded(renderer, surface);
     /* If add or mod blending are ever enabled, permanently disable RLE (which doesn't support
      * them) to avoid potentially frequent RLE encoding/decoding.
      */
@@ -298,6 +583,7 @@ SW_UpdateTexture(SDL_Renderer * renderer, SDL_Texture * texture,
     int row;
     size_t length;
 
+    SW_FlushCommands(renderer);
     if(SDL_MUSTLOCK(surface))
         SDL_LockSurface(surface);
     src = (Uint8 *) pixels;
@@ -321,6 +607,7 @@ SW_LockTexture(SDL_Renderer * renderer, SDL_Texture * texture,
 {
     SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
 
+    SW_FlushCommands(renderer);
     *pixels =
         (void *) ((Uint8 *) surface->pixels + rect->y * surface->pitch +
                   rect->x * surface->format->BytesPerPixel);
@@ -338,6 +625,7 @@ SW_SetRenderTarget(SDL_Renderer * renderer, SDL_Texture * texture)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
 
+    SW_FlushCommands(renderer);
     if (texture ) {
         data->surface = (SDL_Surface *) texture->driverdata;
     } else {
@@ -380,6 +668,7 @@ static int
 SW_RenderClear(SDL_Renderer * renderer)
 {
     SDL_Surface *surface = SW_ActivateRenderer(renderer);
+    SW_Command *cmd;
     Uint32 color;
     SDL_Rect clip_rect;
 
@@ -390,6 +679,16 @@ SW_RenderClear(SDL_Renderer * renderer)
     color = SDL_MapRGBA(surface->format,
                         renderer->r, renderer->g, renderer->b, renderer->a);
 
+    cmd = SW_AddCommand(renderer, surface, SW_COMMAND_CLEAR, 0);
+    if (cmd) {
+        cmd->clip_rect.x = 0;
+        cmd->clip_rect.y = 0;
+        cmd->clip_rect.w = surface->w;
+        cmd->clip_rect.h = surface->h;
+        cmd->data.draw.color = color;
+        return 0;
+    }
+
     /* By definition the clear ignores the clip rect */
     clip_rect = surface->clip_rect;
     SDL_SetClipRect(surface, NULL);
@@ -402,15 +701,22 @@ static int
 SW_RenderDrawPoints(SDL_Renderer * renderer, const SDL_FPoint * points,
                     int count)
 {
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
     SDL_Surface *surface = SW_ActivateRenderer(renderer);
     SDL_Point *final_points;
+    SW_Command *cmd;
     int i, status;
 
     if (!surface) {
         return -1;
     }
 
-    final_points = SDL_stack_alloc(SDL_Point, count);
+    cmd = SW_AddCommand(renderer, surface, SW_COMMAND_DRAW_POINTS, count);
+    if (cmd) {
+        final_points = &data->points[cmd->data.draw.first];
+    } else {
+        final_points = SDL_stack_alloc(SDL_Point, count);
+    }
     if (!final_points) {
         return SDL_OutOfMemory();
     }
@@ -429,6 +735,18 @@ SW_RenderDrawPoints(SDL_Renderer * renderer, const SDL_FPoint * points,
         }
     }
 
+    if (cmd) {
+        cmd->data.draw.blendMode = renderer->blendMode;
+        cmd->data.draw.r = renderer->r;
+        cmd->data.draw.g = renderer->g;
+        cmd->data.draw.b = renderer->b;
+        cmd->data.draw.a = renderer->a;
+        cmd->data.draw.color = SDL_MapRGBA(surface->format,
+                                           renderer->r, renderer->g, renderer->b,
+                                           renderer->a);
+        return 0;
+    }
+
     /* Draw the points! */
     if (renderer->blendMode == SDL_BLENDMODE_NONE) {
         Uint32 color = SDL_MapRGBA(surface->format,
@@ -459,6 +777,9 @@ SW_RenderDrawLines(SDL_Renderer * renderer, const SDL_FPoint * points,
         return -1;
     }
 
+    /* Clipping changes which pixels a line covers, so lines aren't drawn in bands */
+    SW_FlushCommands(renderer);
+
     final_points = SDL_stack_alloc(SDL_Point, count);
     if (!final_points) {
         return SDL_OutOfMemory();
@@ -499,15 +820,22 @@ SW_RenderDrawLines(SDL_Renderer * renderer, const SDL_FPoint * points,
 static int
 SW_RenderFillRects(SDL_Renderer * renderer, const SDL_FRect * rects, int count)
 {
+    SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
     SDL_Surface *surface = SW_ActivateRenderer(renderer);
     SDL_Rect *final_rects;
+    SW_Command *cmd;
     int i, status;
 
     if (!surface) {
         return -1;
     }
 
-    final_rects = SDL_stack_alloc(SDL_Rect, count);
+    cmd = SW_AddCommand(renderer, surface, SW_COMMAND_FILL_RECTS, count);
+    if (cmd) {
+        final_rects = &data->rects[cmd->data.draw.first];
+    } else {
+        final_rects = SDL_stack_alloc(SDL_Rect, count);
+    }
     if (!final_rects) {
         return SDL_OutOfMemory();
     }
@@ -530,6 +858,18 @@ SW_RenderFillRects(SDL_Renderer * renderer, const SDL_FRect * rects, int count)
         }
     }
 
+    if (cmd) {
+        cmd->data.draw.blendMode = renderer->blendMode;
+        cmd->data.draw.r = renderer->r;
+        cmd->data.draw.g = renderer->g;
+        cmd->data.draw.b = renderer->b;
+        cmd->data.draw.a = renderer->a;
+        cmd->data.draw.color = SDL_MapRGBA(surface->format,
+                                           renderer->r, renderer->g, renderer->b,
+                                           renderer->a);
+        return 0;
+    }
+
     if (renderer->blendMode == SDL_BLENDMODE_NONE) {
         Uint32 color = SDL_MapRGBA(surface->format,
                                    renderer->r, renderer->g, renderer->b,
@@ -546,6 +886,79 @@ SW_RenderFillRects(SDL_Renderer * renderer, const SDL_FRect * rects, int count)
     return status;
 }
 
+/* Records a copy, setting up the texture the way SDL_BlitSurface() or
+   SDL_BlitScaled() would. Returns SDL_FALSE if it should be drawn right away. */
+static SDL_bool
+SW_RecordCopy(SDL_Renderer * renderer, SDL_Surface * surface, SDL_Surface * src,
+              const SDL_Rect * srcrect, const SDL_Rect * dstrect, SDL_bool scaled, int *retval)
+{
+    static const int complex_copy_flags = (
+        SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA |
+        SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD |
+        SDL_COPY_COLORKEY
+    );
+    SDL_Rect final_src, final_dst;
+    SW_Command *cmd;
+    int flags = src->map->info.flags;
+    SDL_bool stretch;
+
+    *retval = 0;
+    if (!SW_CanRecord(renderer, surface)) {
+        return SDL_FALSE;
+    }
+
+    if (scaled) {
+        if (!SDL_ClipBlitScaled(src, srcrect, surface, dstrect, &final_src, &final_dst)) {
+            /* Nothing to draw */
+            return SDL_TRUE;
+        }
+        flags |= SDL_COPY_NEAREST;
+    } else {
+        final_src = *srcrect;
+        final_dst = *dstrect;
+        flags &= ~SDL_COPY_NEAREST;
+    }
+
+    if (flags != src->map->info.flags || src->map->dst != surface) {
+        SW_FlushIfEncoded(renderer, src);
+        if (flags != src->map->info.flags) {
+            src->map->info.flags = flags;
+            SDL_InvalidateMap(src->map);
+        }
+        if (SDL_MapSurface(src, surface) < 0) {
+            *retval = -1;
+            return SDL_TRUE;
+        }
+    }
+
+    stretch = !(flags & complex_copy_flags) &&
+              src->format->format == surface->format->format &&
+              !SDL_ISPIXELFORMAT_INDEXED(src->format->format);
+
+    /* Filtering before blending goes through a temporary surface, which isn't recorded */
+    if (scaled && !stretch && src->map->scale_mode != SDL_ScaleModeNearest &&
+        !(flags & SDL_COPY_COLORKEY) && SDL_CanFilterStretch(src->format)) {
+        SW_FlushCommands(renderer);
+        return SDL_FALSE;
+    }
+
+    cmd = SW_AddCommand(renderer, surface, scaled ? SW_COMMAND_COPY_SCALED : SW_COMMAND_COPY, 0);
+    if (!cmd) {
+        return SDL_FALSE;
+    }
+    cmd->data.copy.src = src;
+    cmd->data.copy.map = *src->map;
+    cmd->data.copy.srcrect = final_src;
+    cmd->data.copy.dstrect = final_dst;
+    cmd->data.copy.stretch = stretch;
+    cmd->data.copy.filters = NULL;
+    if (scaled && stretch) {
+        /* The bands share one set of filter tables, set up before any of them run */
+        cmd->data.copy.filters = SDL_AcquireStretchFilters(src, &final_src, &final_dst, src->map->scale_mode);
+    }
+    return SDL_TRUE;
+}
+
 static int
 SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
               const SDL_Rect * srcrect, const SDL_FRect * dstrect)
@@ -553,6 +966,7 @@ SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
     SDL_Surface *surface = SW_ActivateRenderer(renderer);
     SDL_Surface *src = (SDL_Surface *) texture->driverdata;
     SDL_Rect final_rect;
+    int retval;
 
     if (!surface) {
         return -1;
@@ -569,28 +983,22 @@ SW_RenderCopy(SDL_Renderer * renderer, SDL_Texture * texture,
     final_rect.h = (int)dstrect->h;
 
     if ( srcrect->w == final_rect.w && srcrect->h == final_rect.h ) {
+        if (SW_RecordCopy(renderer, surface, src, srcrect, &final_rect, SDL_FALSE, &retval)) {
+            return retval;
+        }
         return SDL_BlitSurface(src, srcrect, surface, &final_rect);
     } else {
         /* If scaling is ever done, permanently disable RLE (which doesn't support scaling)
          * to avoid potentially frequent RLE encoding/decoding.
          */
         SDL_SetSurfaceRLE(surface, 0);
+        if (SW_RecordCopy(renderer, surface, src, srcrect, &final_rect, SDL_TRUE, &retval)) {
+            return retval;
+        }
         return SDL_BlitScaled(src, srcrect, surface, &final_rect);
     }
 }
 
-static int
-GetScaleQuality(void)
-{
-    const char *hint = SDL_GetHint(SDL_HINT_RENDER_SCALE_QUALITY);
-
-    if (!hint || *hint == '0' || SDL_strcasecmp(hint, "nearest") == 0) {
-        return 0;
-    } else {
-        return 1;
-    }
-}
-
 static int
 SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
                 const SDL_Rect * srcrect, const SDL_FRect * dstrect,
@@ -599,6 +1007,7 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
     SDL_Surface *surface = SW_ActivateRenderer(renderer);
     SDL_Surface *src = (SDL_Surface *) texture->driverdata;
     SDL_Rect final_rect, tmp_rect;
+    SW_Command *cmd;
     SDL_Surface *surface_rotated, *surface_scaled;
     int retval, dstwidth, dstheight, abscenterx, abscentery;
     double cangle, sangle, px, py, p1x, p1y, p2x, p2y, p3x, p3y, p4x, p4y;
@@ -617,6 +1026,33 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
     final_rect.w = (int)dstrect->w;
     final_rect.h = (int)dstrect->h;
 
+    /* Sample 32-bit textures straight into the target, without any temporary surfaces */
+    if (SDLgfx_canTransformBlit(src, srcrect, surface)) {
+        /* The pixels are read directly, so permanently disable RLE to avoid decoding it every time */
+        SW_FlushIfEncoded(renderer, src);
+        SDL_SetSurfaceRLE(src, 0);
+
+        cmd = SW_AddCommand(renderer, surface, SW_COMMAND_COPY_EX, 0);
+        if (cmd) {
+            cmd->data.copy.src = src;
+            cmd->data.copy.map = *src->map;
+            cmd->data.copy.srcrect = *srcrect;
+            cmd->data.copy.dstrect = final_rect;
+            cmd->data.copy.angle = angle;
+            cmd->data.copy.centerx = center->x;
+            cmd->data.copy.centery = center->y;
+            cmd->data.copy.smooth = GetScaleQuality();
+            cmd->data.copy.flipx = flip & SDL_FLIP_HORIZONTAL;
+            cmd->data.copy.flipy = flip & SDL_FLIP_VERTICAL;
+            return 0;
+        }
+        return SDLgfx_transformBlit(src, srcrect, surface, &final_rect, angle, center->x, center->y, GetScaleQuality(),
+                                    flip & SDL_FLIP_HORIZONTAL, flip & SDL_FLIP_VERTICAL);
+    }
+
+    /* The rest uses temporary surfaces, so it isn't recorded */
+    SW_FlushCommands(renderer);
+
     /* SDLgfx_rotateSurface doesn't accept a source rectangle, so crop and scale if we need to */
     tmp_rect = final_rect;
     tmp_rect.x = 0;
@@ -726,6 +1162,103 @@ SW_RenderCopyEx(SDL_Renderer * renderer, SDL_Texture * texture,
     return retval;
 }
 
+/* Multiplies a sprite color into the texture modulation for the copies that
+   have one, or puts the texture's own modulation back when color is NULL */
+static void
+SW_ModulateTexture(SDL_Renderer * renderer, SDL_Texture * texture, const SDL_Color * color)
+{
+    SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
+    Uint8 r = texture->r, g = texture->g, b = texture->b, a = texture->a;
+
+    if (color) {
+        r = (Uint8) ((r * color->r) / 255);
+        g = (Uint8) ((g * color->g) / 255);
+        b = (Uint8) ((b * color->b) / 255);
+        a = (Uint8) ((a * color->a) / 255);
+    }
+
+    /* Same reasoning as SW_SetTextureColorMod() and SW_SetTextureAlphaMod() */
+    SW_FlushIfEncoded(renderer, surface);
+    if ((r & g & b) != 255 || (a != 255 && surface->format->Amask)) {
+        SDL_SetSurfaceRLE(surface, 0);
+    }
+    SDL_SetSurfaceColorMod(surface, r, g, b);
+    SDL_SetSurfaceAlphaMod(surface, a);
+}
+
+static int
+SW_RunCommandQueue(SDL_Renderer * renderer, const SDL_RenderCommand * commands,
+                   int count, const void *data)
+{
+    /* The drawing functions take the color and blend mode from the renderer,
+       so give them the ones each command was recorded with. Textures can't
+       change while they're queued, so copies are drawn with their state. */
+    const SDL_BlendMode blendMode = renderer->blendMode;
+    const Uint8 r = renderer->r, g = renderer->g, b = renderer->b, a = renderer->a;
+    SDL_bool modulated = SDL_FALSE;
+    int i, j, status = 0;
+
+    for (i = 0; i < count; ++i) {
+        const SDL_RenderCommand *cmd = &commands[i];
+        const Uint8 *items = (const Uint8 *) data + cmd->first;
+
+        renderer->blendMode = cmd->blendMode;
+        renderer->r = cmd->r;
+        renderer->g = cmd->g;
+        renderer->b = cmd->b;
+        renderer->a = cmd->a;
+
+        switch (cmd->command) {
+        case SDL_RENDERCMD_CLEAR:
+            status |= SW_RenderClear(renderer);
+            break;
+        case SDL_RENDERCMD_DRAW_POINTS:
+            status |= SW_RenderDrawPoints(renderer, (const SDL_FPoint *) items, cmd->count);
+            break;
+        case SDL_RENDERCMD_DRAW_LINES:
+            status |= SW_RenderDrawLines(renderer, (const SDL_FPoint *) items, cmd->count);
+            break;
+        case SDL_RENDERCMD_FILL_RECTS:
+            status |= SW_RenderFillRects(renderer, (const SDL_FRect *) items, cmd->count);
+            break;
+        case SDL_RENDERCMD_COPY:
+            for (j = 0; j < cmd->count; ++j) {
+                const SDL_RenderCopyData *copy = (const SDL_RenderCopyData *) items + j;
+                const SDL_Color *color = &copy->color;
+
+                if ((color->r & color->g & color->b & color->a) != 255) {
+                    SW_ModulateTexture(renderer, cmd->texture, color);
+                    modulated = SDL_TRUE;
+                } else if (modulated) {
+                    SW_ModulateTexture(renderer, cmd->texture, NULL);
+                    modulated = SDL_FALSE;
+                }
+                status |= SW_RenderCopy(renderer, cmd->texture, &copy->srcrect, &copy->dstrect);
+            }
+            if (modulated) {
+                SW_ModulateTexture(renderer, cmd->texture, NULL);
+                modulated = SDL_FALSE;
+            }
+            break;
+        case SDL_RENDERCMD_COPY_EX:
+            for (j = 0; j < cmd->count; ++j) {
+                const SDL_RenderCopyExData *copy = (const SDL_RenderCopyExData *) items + j;
+                status |= SW_RenderCopyEx(renderer, cmd->texture, &copy->srcrect, &copy->dstrect,
+                                          copy->angle, &copy->center, copy->flip);
+            }
+            break;
+        }
+    }
+
+    renderer->blendMode = blendMode;
+    renderer->r = r;
+    renderer->g = g;
+    renderer->b = b;
+    renderer->a = a;
+
+    return status < 0 ? -1 : 0;
+}
+
 static int
 SW_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
                     Uint32 format, void * pixels, int pitch)
@@ -739,6 +1272,8 @@ SW_RenderReadPixels(SDL_Renderer * renderer, const SDL_Rect * rect,
         return -1;
     }
 
+    SW_FlushCommands(renderer);
+
     if (renderer->viewport.x || renderer->viewport.y) {
         final_rect.x = renderer->viewport.x + rect->x;
         final_rect.y = renderer->viewport.y + rect->y;
@@ -767,6 +1302,7 @@ SW_RenderPresent(SDL_Renderer * renderer)
 {
     SDL_Window *window = renderer->window;
 
+    SW_FlushCommands(renderer);
     if (window) {
         SDL_UpdateWindowSurface(window);
     }
@@ -777,6 +1313,7 @@ SW_DestroyTexture(SDL_Renderer * renderer, SDL_Texture * texture)
 {
     SDL_Surface *surface = (SDL_Surface *) texture->driverdata;
 
+    SW_FlushCommands(renderer);
     SDL_FreeSurface(surface);
 }
 
@@ -785,6 +1322,12 @@ SW_DestroyRenderer(SDL_Renderer * renderer)
 {
     SW_RenderData *data = (SW_RenderData *) renderer->driverdata;
 
+    if (data) {
+        SW_FlushCommands(renderer);
+        SDL_free(data->commands);
+        SDL_free(data->points);
+        SDL_free(data->rects);
+    }
     SDL_free(data);
     SDL_free(renderer);
 }
@@ -39,6 +39,7 @@ Andreas Schiffler -- aschiffler at ferzkopp dot net
 
 #include "SDL.h"
 #include "SDL_rotate.h"
+#include "../../video/SDL_blit.h"
 
 /* ---- Internally used structures */
 
@@ -81,6 +82,11 @@ to a situation where the program can segfault.
 */
 #define VALUE_LIMIT 0.001
 
+/* !
+\brief Number of pixels SDLgfx_transformBlit() samples before handing them to a blitter.
+*/
+#define TRANSFORM_SPAN 256
+
 /* !
 \brief Returns colorkey info for a surface
 */
@@ -577,3 +583,256 @@ SDLgfx_rotateSurface(SDL_Surface * src, double angle, int centerx, int centery,
     */
     return (rz_dst);
 }
+
+/* !
+\brief Linearly interpolates between two 8888 pixels, two channels at a time.
+
+\param p0 The first pixel.
+\param p1 The second pixel.
+\param f The weight of the second pixel, 0 to 255.
+\return The interpolated pixel.
+*/
+static SDL_INLINE Uint32
+_lerpPixel8888(Uint32 p0, Uint32 p1, Uint32 f)
+{
+    const Uint32 rb = ((((p0 & 0x00FF00FF) * (256 - f)) + ((p1 & 0x00FF00FF) * f)) >> 8) & 0x00FF00FF;
+    const Uint32 ag = ((((p0 >> 8) & 0x00FF00FF) * (256 - f)) + (((p1 >> 8) & 0x00FF00FF) * f)) & 0xFF00FF00;
+    return rb | ag;
+}
+
+/* !
+\brief Checks whether a surface has 32 bit pixels with 8 bit channels.
+*/
+static int
+_is8888(const SDL_PixelFormat *format)
+{
+    return format->BytesPerPixel == 4 && !SDL_ISPIXELFORMAT_INDEXED(format->format) &&
+           format->Rloss == 0 && format->Gloss == 0 && format->Bloss == 0 &&
+           (format->Amask == 0 || format->Aloss == 0);
+}
+
+/* !
+\brief Narrows the steps [first, last) of a row to those where pos + step * inc lies in [0, limit).
+*/
+static void
+_clipSpan(Sint32 pos, Sint32 inc, Sint32 limit, int *first, int *last)
+{
+    double lo, hi, tmp;
+
+    if (inc == 0) {
+        if ((Uint32) pos >= (Uint32) limit) {
+            *last = *first;
+        }
+        return;
+    }
+    lo = (double) -pos / inc;
+    hi = (double) (limit - pos) / inc;
+    if (inc < 0) {
+        tmp = lo;
+        lo = hi;
+        hi = tmp;
+    }
+    if (lo > *first) {
+        *first = (lo >= *last) ? *last : (int) SDL_floor(lo);
+    }
+    if (hi + 1 < *last) {
+        *last = (hi + 1 <= *first) ? *first : (int) SDL_ceil(hi) + 1;
+    }
+
+    /* The estimate above can be off by one step because of rounding, so fix up the ends */
+    while (*first < *last && (Uint32) (pos + *first * inc) >= (Uint32) limit) {
+        ++*first;
+    }
+    while (*last > *first && (Uint32) (pos + (*last - 1) * inc) >= (Uint32) limit) {
+        --*last;
+    }
+}
+
+/* The blit flags of 'src' that apply to the sampled spans */
+#define TRANSFORM_BLIT_FLAGS(src) \
+    ((src)->map->info.flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | \
+                               SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD))
+
+/* !
+\brief Checks whether SDLgfx_transformBlit() can draw 'srcrect' of 'src' onto 'dst'.
+
+Both surfaces need 32 bit pixels with 8 bit channels, the source can't
+have a colorkey, the source rectangle has to be small enough for 16.16
+fixed point positions, and there has to be a blitter for the formats and
+blend mode to combine the sampled spans with the destination.
+*/
+int
+SDLgfx_canTransformBlit(SDL_Surface * src, const SDL_Rect * srcrect, SDL_Surface * dst)
+{
+    return _is8888(src->format) && _is8888(dst->format) && SDL_GetColorKey(src, NULL) < 0 &&
+           srcrect->w < 8192 && srcrect->h < 8192 &&
+           SDL_ChooseSpanBlit(src->format->format, dst->format->format, TRANSFORM_BLIT_FLAGS(src)) != NULL;
+}
+
+/* !
+\brief Draws a scaled, rotated and flipped rectangle of 'src' straight onto 'dst'.
+
+Every destination pixel inside the clip rectangle that the rotated
+destination rectangle covers is mapped back into the source rectangle and
+sampled there, then combined with the destination using the color mod,
+alpha mod and blend mode of 'src', exactly like SDL_BlitScaled() would.
+No temporary surfaces are created.
+
+\param src Source surface, see SDLgfx_canTransformBlit().
+\param srcrect The rectangle of the source to draw.
+\param dst Destination surface.
+\param dstrect Where the unrotated source rectangle would be drawn.
+\param angle The angle to rotate in degrees, clockwise.
+\param centerx The horizontal coordinate of the center of rotation, relative to dstrect.
+\param centery The vertical coordinate of the center of rotation, relative to dstrect.
+\param smooth Antialiasing flag; set to SMOOTHING_ON to enable bilinear filtering.
+\param flipx Set to 1 to flip the image horizontally
+\param flipy Set to 1 to flip the image vertically
+\return 0 on success, -1 on error.
+*/
+int
+SDLgfx_transformBlit(SDL_Surface * src, const SDL_Rect * srcrect, SDL_Surface * dst, const SDL_Rect * dstrect,
+                     double angle, double centerx, double centery, int smooth, int flipx, int flipy)
+{
+    const double radangle = angle * (M_PI / 180.0);
+    const double sangle = SDL_sin(radangle);
+    const double cangle = SDL_cos(radangle);
+    const double cx = dstrect->x + centerx;
+    const double cy = dstrect->y + centery;
+    const double scalex = (double) srcrect->w / dstrect->w;
+    const double scaley = (double) srcrect->h / dstrect->h;
+    const Sint32 srcw = srcrect->w << 16;
+    const Sint32 srch = srcrect->h << 16;
+    const Uint8 *srcpixels;
+    const int srcpitch = src->pitch;
+    const int lastx = srcrect->w - 1;
+    const int lasty = srcrect->h - 1;
+    double minx, miny, maxx, maxy;
+    Uint32 span[TRANSFORM_SPAN];
+    SDL_BlitInfo info;
+    SDL_BlitFunc blit;
+    Sint32 incx_x, incx_y;
+    int x, y, left, x0, y0, x1, y1, first, last, i, n;
+
+    if (dstrect->w <= 0 || dstrect->h <= 0 || srcrect->w <= 0 || srcrect->h <= 0) {
+        return 0;
+    }
+
+    /* Bounding box of the rotated destination rectangle */
+    minx = maxx = cx;
+    miny = maxy = cy;
+    for (i = 0; i < 4; ++i) {
+        const double px = ((i & 1) ? dstrect->w : 0) - centerx;
+        const double py = ((i & 2) ? dstrect->h : 0) - centery;
+        const double qx = px * cangle - py * sangle + cx;
+        const double qy = px * sangle + py * cangle + cy;
+        if (i == 0 || qx < minx) minx = qx;
+        if (i == 0 || qx > maxx) maxx = qx;
+        if (i == 0 || qy < miny) miny = qy;
+        if (i == 0 || qy > maxy) maxy = qy;
+    }
+    left = (int) SDL_floor(minx);
+    x0 = SDL_max(left, dst->clip_rect.x);
+    y0 = SDL_max((int) SDL_floor(miny), dst->clip_rect.y);
+    x1 = SDL_min((int) SDL_ceil(maxx), dst->clip_rect.x + dst->clip_rect.w);
+    y1 = SDL_min((int) SDL_ceil(maxy), dst->clip_rect.y + dst->clip_rect.h);
+    if (x0 >= x1 || y0 >= y1) {
+        return 0;
+    }
+
+    /* The sampled spans are combined with the destination by the regular blitters,
+       using the color mod, alpha mod and blend mode of the source surface */
+    SDL_zero(info);
+    info.src = (Uint8 *) span;
+    info.src_pitch = sizeof (span);
+    info.src_fmt = src->format;
+    info.dst_fmt = dst->format;
+    info.dst_pitch = dst->pitch;
+    info.flags = TRANSFORM_BLIT_FLAGS(src);
+    info.r = src->map->info.r;
+    info.g = src->map->info.g;
+    info.b = src->map->info.b;
+    info.a = src->map->info.a;
+    blit = SDL_ChooseSpanBlit(src->format->format, dst->format->format, info.flags);
+    if (blit == NULL) {
+        return SDL_SetError("Blit combination not supported");
+    }
+
+    /* Source position steps, in 16.16 fixed point, for one destination pixel to the right */
+    incx_x = (Sint32) (cangle * scalex * (flipx ? -65536.0 : 65536.0));
+    incx_y = (Sint32) (-sangle * scaley * (flipy ? -65536.0 : 65536.0));
+
+    if (SDL_MUSTLOCK(src)) {
+        SDL_LockSurface(src);
+    }
+    if (SDL_MUSTLOCK(dst)) {
+        SDL_LockSurface(dst);
+    }
+    srcpixels = (const Uint8 *) src->pixels + srcrect->y * srcpitch + srcrect->x * 4;
+
+    for (y = y0; y < y1; ++y) {
+        /* Map the center of the leftmost pixel of the bounding box back into the unrotated
+           rectangle and step from there, so the result doesn't depend on the clip rectangle */
+        const double px = left + 0.5 - cx;
+        const double py = y + 0.5 - cy;
+        double u = px * cangle + py * sangle + centerx;
+        double v = -px * sangle + py * cangle + centery;
+        Sint32 sx, sy;
+
+        if (flipx) {
+            u = dstrect->w - u;
+        }
+        if (flipy) {
+            v = dstrect->h - v;
+        }
+        sx = (Sint32) SDL_floor(u * scalex * 65536.0) + (x0 - left) * incx_x;
+        sy = (Sint32) SDL_floor(v * scaley * 65536.0) + (x0 - left) * incx_y;
+
+        /* Only the part of the row inside of the rotated rectangle is drawn */
+        first = 0;
+        last = x1 - x0;
+        _clipSpan(sx, incx_x, srcw, &first, &last);
+        _clipSpan(sy, incx_y, srch, &first, &last);
+        sx += first * incx_x;
+        sy += first * incx_y;
+
+        for (x = first; x < last; x += n) {
+            n = SDL_min(last - x, TRANSFORM_SPAN);
+
+            if (smooth) {
+                /* Sample between the four nearest source pixels, clamped to the source rectangle */
+                for (i = 0; i < n; ++i, sx += incx_x, sy += incx_y) {
+                    const Sint32 bx = sx - 0x8000;
+                    const Sint32 by = sy - 0x8000;
+                    const Uint32 fx = (bx < 0) ? 0 : ((bx >> 8) & 0xFF);
+                    const Uint32 fy = (by < 0) ? 0 : ((by >> 8) & 0xFF);
+                    const int ix0 = (bx < 0) ? 0 : (bx >> 16);
+                    const int iy0 = (by < 0) ? 0 : (by >> 16);
+                    const int ix1 = (ix0 < lastx) ? ix0 + 1 : lastx;
+                    const Uint32 *row0 = (const Uint32 *) (srcpixels + iy0 * srcpitch);
+                    const Uint32 *row1 = (iy0 < lasty) ? (const Uint32 *) ((const Uint8 *) row0 + srcpitch) : row0;
+                    span[i] = _lerpPixel8888(_lerpPixel8888(row0[ix0], row0[ix1], fx),
+                                             _lerpPixel8888(row1[ix0], row1[ix1], fx), fy);
+                }
+            } else {
+                for (i = 0; i < n; ++i, sx += incx_x, sy += incx_y) {
+                    span[i] = ((const Uint32 *) (srcpixels + (sy >> 16) * srcpitch))[sx >> 16];
+                }
+            }
+
+            info.src_w = info.dst_w = n;
+            info.src_h = info.dst_h = 1;
+            info.src = (Uint8 *) span;
+            info.dst = (Uint8 *) dst->pixels + y * dst->pitch + (x0 + x) * 4;
+            blit(&info);
+        }
+    }
+
+    if (SDL_MUSTLOCK(dst)) {
+        SDL_UnlockSurface(dst);
+    }
+    if (SDL_MUSTLOCK(src)) {
+        SDL_UnlockSurface(src);
+    }
+    return 0;
+}
@@ -25,4 +25,6 @@
 
 extern SDL_Surface *SDLgfx_rotateSurface(SDL_Surface * src, double angle, int centerx, int centery, int smooth, int flipx, int flipy, int dstwidth, int dstheight, double cangle, double sangle);
 extern void SDLgfx_rotozoomSurfaceSizeTrig(int width, int height, double angle, int *dstwidth, int *dstheight, double *cangle, double *sangle);
+extern int SDLgfx_canTransformBlit(SDL_Surface * src, const SDL_Rect * srcrect, SDL_Surface * dst);
+extern int SDLgfx_transformBlit(SDL_Surface * src, const SDL_Rect * srcrect, SDL_Surface * dst, const SDL_Rect * dstrect, double angle, double centerx, double centery, int smooth, int flipx, int flipy);
 
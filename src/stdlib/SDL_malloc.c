@@ -28,30 +28,11 @@
 /* This file contains portable memory management functions for SDL */
 
 #include "SDL_stdinc.h"
+#include "SDL_atomic.h"
+#include "SDL_error.h"
+#include "SDL_thread.h"
 
-#if defined(HAVE_MALLOC)
-
-void *SDL_malloc(size_t size)
-{
-    return malloc(size);
-}
-
-void *SDL_calloc(size_t nmemb, size_t size)
-{
-    return calloc(nmemb, size);
-}
-
-void *SDL_realloc(void *ptr, size_t size)
-{
-    return realloc(ptr, size);
-}
-
-void SDL_free(void *ptr)
-{
-    free(ptr);
-}
-
-#else  /* the rest of this is a LOT of tapdancing to implement malloc. :) */
+#ifndef HAVE_MALLOC  /* the rest of this is a LOT of tapdancing to implement malloc. :) */
 
 #define LACKS_SYS_TYPES_H
 #define LACKS_STDIO_H
@@ -60,6 +41,20 @@ void SDL_free(void *ptr)
 #define LACKS_STDLIB_H
 #define ABORT
 #define USE_LOCKS 1
+#define USE_DL_PREFIX
+
+/* With SDL_MALLOC_ARENAS > 1, threads allocate from that many heaps, each
+   with its own lock and picked by thread ID, instead of all waiting on the
+   lock of a single heap. Every chunk records the heap it came from, so it
+   can be freed or reallocated from any thread.
+*/
+#ifndef SDL_MALLOC_ARENAS
+#define SDL_MALLOC_ARENAS 1
+#endif
+#if SDL_MALLOC_ARENAS > 1
+#define MSPACES 1
+#define FOOTERS 1
+#endif
 
 /*
   This is a version (aka dlmalloc) of malloc/free/realloc written by
@@ -638,10 +633,6 @@ DEFAULT_MMAP_THRESHOLD       default: 256K
 
 #define memset  SDL_memset
 #define memcpy  SDL_memcpy
-#define malloc  SDL_malloc
-#define calloc  SDL_calloc
-#define realloc SDL_realloc
-#define free    SDL_free
 
 /*
   mallopt tuning options.  SVID/XPG defines four standard parameter
@@ -3217,7 +3208,7 @@ internal_malloc_stats(mstate m)
 #else /* ONLY_MSPACES */
 #if MSPACES
 #define internal_malloc(m, b)\
-   (m == gm)? dlmalloc(b) : mspace_malloc(m, b)
+   ((m == gm)? dlmalloc(b) : mspace_malloc(m, b))
 #define internal_free(m, mem)\
    if (m == gm) dlfree(mem); else mspace_free(m,mem);
 #else /* MSPACES */
@@ -4943,12 +4934,13 @@ mspace_malloc_stats(mspace msp)
 size_t
 mspace_footprint(mspace msp)
 {
-    size_t result;
+    size_t result = 0;
     mstate ms = (mstate) msp;
     if (ok_magic(ms)) {
         result = ms->footprint;
+    } else {
+        USAGE_ERROR_ACTION(ms, ms);
     }
-    USAGE_ERROR_ACTION(ms, ms);
     return result;
 }
 
@@ -4956,12 +4948,13 @@ mspace_footprint(mspace msp)
 size_t
 mspace_max_footprint(mspace msp)
 {
-    size_t result;
+    size_t result = 0;
     mstate ms = (mstate) msp;
     if (ok_magic(ms)) {
         result = ms->max_footprint;
+    } else {
+        USAGE_ERROR_ACTION(ms, ms);
     }
-    USAGE_ERROR_ACTION(ms, ms);
     return result;
 }
 
@@ -4986,6 +4979,53 @@ mspace_mallopt(int param_number, int value)
 
 #endif /* MSPACES */
 
+#if SDL_MALLOC_ARENAS > 1
+
+static mspace SDL_arenas[SDL_MALLOC_ARENAS];
+
+/* Returns NULL if a heap couldn't be set up, so the global one is used */
+static mspace
+SDL_GetArena(void)
+{
+    const Uint64 id = (Uint64) SDL_ThreadID();
+    const Uint32 hash = (Uint32) (id ^ (id >> 32)) * 2654435761u;
+    void **slot = (void **) &SDL_arenas[(hash >> 16) % SDL_MALLOC_ARENAS];
+    mspace arena = SDL_AtomicGetPtr(slot);
+
+    if (!arena) {
+        arena = create_mspace(0, 1);
+        if (arena && !SDL_AtomicCASPtr(slot, NULL, arena)) {
+            /* Another thread got there first */
+            destroy_mspace(arena);
+            arena = SDL_AtomicGetPtr(slot);
+        }
+    }
+    return arena;
+}
+
+static void *SDLCALL
+SDL_ArenaMalloc(size_t size)
+{
+    mspace arena = SDL_GetArena();
+    return arena ? mspace_malloc(arena, size) : dlmalloc(size);
+}
+
+static void *SDLCALL
+SDL_ArenaCalloc(size_t nmemb, size_t size)
+{
+    mspace arena = SDL_GetArena();
+    return arena ? mspace_calloc(arena, nmemb, size) : dlcalloc(nmemb, size);
+}
+
+/* Blocks stay in the heap they came from, whichever thread grows them */
+static void *SDLCALL
+SDL_ArenaRealloc(void *ptr, size_t size)
+{
+    return ptr ? dlrealloc(ptr, size) : SDL_ArenaMalloc(size);
+}
+
+#endif /* SDL_MALLOC_ARENAS > 1 */
+
 /* -------------------- Alternative MORECORE functions ------------------- */
 
 /*
@@ -5261,4 +5301,246 @@ History:
 
 #endif /* !HAVE_MALLOC */
 
+#if defined(HAVE_MALLOC)
+#define real_malloc malloc
+#define real_calloc calloc
+#define real_realloc realloc
+#define real_free free
+#elif SDL_MALLOC_ARENAS > 1
+#define real_malloc SDL_ArenaMalloc
+#define real_calloc SDL_ArenaCalloc
+#define real_realloc SDL_ArenaRealloc
+#define real_free dlfree
+#else
+#define real_malloc dlmalloc
+#define real_calloc dlcalloc
+#define real_realloc dlrealloc
+#define real_free dlfree
+#endif
+
+/* Counting blocks and bytes costs shared atomics and a size lookup on every
+   allocation, so it's only done when SDL is built with SDL_MALLOC_STATS.
+   Then this is how to ask the default functions how big a block is.
+*/
+#if !defined(SDL_MALLOC_STATS)
+/* No block sizes needed */
+#elif !defined(HAVE_MALLOC)
+#define real_usable_size dlmalloc_usable_size
+#elif defined(__GLIBC__) && defined(HAVE_MALLOC_H)
+#include <malloc.h>
+#define real_usable_size malloc_usable_size
+#elif defined(__MACOSX__) || defined(__IPHONEOS__)
+#include <malloc/malloc.h>
+#define real_usable_size malloc_size
+#elif defined(_MSC_VER) || defined(__MINGW32__)
+#include <malloc.h>
+#define real_usable_size _msize
+#endif
+
+static struct
+{
+    SDL_malloc_func malloc_func;
+    SDL_calloc_func calloc_func;
+    SDL_realloc_func realloc_func;
+    SDL_free_func free_func;
+#ifdef SDL_MALLOC_STATS
+    SDL_bool count_bytes;
+    SDL_atomic_t num_allocations;
+    void *num_bytes;    /* a size_t, kept as a pointer to update it atomically */
+#endif
+} s_mem = {
+    real_malloc, real_calloc, real_realloc, real_free,
+#ifdef SDL_MALLOC_STATS
+#ifdef real_usable_size
+    SDL_TRUE,
+#else
+    SDL_FALSE,
+#endif
+    { 0 }, NULL
+#endif
+};
+
+#ifdef SDL_MALLOC_STATS
+/* Byte counts are only kept while the default functions are in use */
+#ifdef real_usable_size
+#define SDL_BlockSize(mem)  (s_mem.count_bytes ? (size_t) real_usable_size(mem) : 0)
+#else
+#define SDL_BlockSize(mem)  0
+#endif
+#define SDL_AddAllocation() SDL_AtomicIncRef(&s_mem.num_allocations)
+#define SDL_RemoveAllocation() (void) SDL_AtomicDecRef(&s_mem.num_allocations)
+
+static void
+SDL_CountBytes(size_t added, size_t removed)
+{
+    void *bytes;
+
+    if (added == removed) {
+        return;
+    }
+    do {
+        bytes = SDL_AtomicGetPtr(&s_mem.num_bytes);
+    } while (!SDL_AtomicCASPtr(&s_mem.num_bytes, bytes, (void *) ((size_t) bytes + added - removed)));
+}
+#else
+#define SDL_BlockSize(mem)  0
+#define SDL_AddAllocation()
+#define SDL_RemoveAllocation()
+#define SDL_CountBytes(added, removed)
+#endif /* SDL_MALLOC_STATS */
+
+void
+SDL_GetMemoryFunctions(SDL_malloc_func *malloc_func,
+                       SDL_calloc_func *calloc_func,
+                       SDL_realloc_func *realloc_func,
+                       SDL_free_func *free_func)
+{
+    if (malloc_func) {
+        *malloc_func = s_mem.malloc_func;
+    }
+    if (calloc_func) {
+        *calloc_func = s_mem.calloc_func;
+    }
+    if (realloc_func) {
+        *realloc_func = s_mem.realloc_func;
+    }
+    if (free_func) {
+        *free_func = s_mem.free_func;
+    }
+}
+
+int
+SDL_SetMemoryFunctions(SDL_malloc_func malloc_func,
+                       SDL_calloc_func calloc_func,
+                       SDL_realloc_func realloc_func,
+                       SDL_free_func free_func)
+{
+    if (!malloc_func) {
+        return SDL_InvalidParamError("malloc_func");
+    }
+    if (!calloc_func) {
+        return SDL_InvalidParamError("calloc_func");
+    }
+    if (!realloc_func) {
+        return SDL_InvalidParamError("realloc_func");
+    }
+    if (!free_func) {
+        return SDL_InvalidParamError("free_func");
+    }
+
+    s_mem.malloc_func = malloc_func;
+    s_mem.calloc_func = calloc_func;
+    s_mem.realloc_func = realloc_func;
+    s_mem.free_func = free_func;
+#if defined(SDL_MALLOC_STATS) && defined(real_usable_size)
+    s_mem.count_bytes = (malloc_func == real_malloc && calloc_func == real_calloc &&
+                         realloc_func == real_realloc && free_func == real_free) ? SDL_TRUE : SDL_FALSE;
+#endif
+    return 0;
+}
+
+int
+SDL_GetNumAllocations(void)
+{
+#ifdef SDL_MALLOC_STATS
+    return SDL_AtomicGet(&s_mem.num_allocations);
+#else
+    return -1;
+#endif
+}
+
+Sint64
+SDL_GetNumAllocatedBytes(void)
+{
+#ifdef SDL_MALLOC_STATS
+    if (s_mem.count_bytes) {
+        return (Sint64) (size_t) SDL_AtomicGetPtr(&s_mem.num_bytes);
+    }
+#endif
+    return -1;
+}
+
+void *
+SDL_malloc(size_t size)
+{
+    void *mem;
+
+    if (!size) {
+        size = 1;
+    }
+
+    mem = s_mem.malloc_func(size);
+    if (mem) {
+        SDL_AddAllocation();
+        SDL_CountBytes(SDL_BlockSize(mem), 0);
+    }
+    return mem;
+}
+
+void *
+SDL_calloc(size_t nmemb, size_t size)
+{
+    void *mem;
+
+    if (!nmemb || !size) {
+        nmemb = 1;
+        size = 1;
+    }
+
+    mem = s_mem.calloc_func(nmemb, size);
+    if (mem) {
+        SDL_AddAllocation();
+        SDL_CountBytes(SDL_BlockSize(mem), 0);
+    }
+    return mem;
+}
+
+void *
+SDL_realloc(void *ptr, size_t size)
+{
+#ifdef SDL_MALLOC_STATS
+    size_t old_size = 0;
+#endif
+    void *mem;
+
+    if (!size) {
+        size = 1;
+    }
+#ifdef SDL_MALLOC_STATS
+    if (ptr) {
+        old_size = SDL_BlockSize(ptr);
+    }
+#endif
+
+    mem = s_mem.realloc_func(ptr, size);
+#ifdef SDL_MALLOC_STATS
+    if (mem) {
+        if (!ptr) {
+            SDL_AddAllocation();
+        }
+        SDL_CountBytes(SDL_BlockSize(mem), old_size);
+    }
+#endif
+    return mem;
+}
+
+void
+SDL_free(void *ptr)
+{
+#ifdef SDL_MALLOC_STATS
+    size_t size;
+#endif
+
+    if (!ptr) {
+        return;
+    }
+
+#ifdef SDL_MALLOC_STATS
+    size = SDL_BlockSize(ptr);
+#endif
+    s_mem.free_func(ptr);
+    SDL_RemoveAllocation();
+    SDL_CountBytes(0, size);
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
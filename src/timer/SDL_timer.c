@@ -28,13 +28,19 @@
 
 /* #define DEBUG_TIMERS */
 
+/* How long to busy-wait at the end of a precise delay, in nanoseconds,
+   since the OS may oversleep by about this much.
+ */
+#define SDL_DELAY_SPIN_NS   200000
+
 typedef struct _SDL_Timer
 {
     int timerID;
     SDL_TimerCallback callback;
+    SDL_NSTimerCallback callback_ns;    /* set for high resolution timers */
     void *param;
-    Uint32 interval;
-    Uint32 scheduled;
+    Uint64 interval;    /* in milliseconds, or nanoseconds for callback_ns */
+    Uint64 scheduled;   /* in SDL_GetTicksNS() nanoseconds */
     SDL_atomic_t canceled;
     struct _SDL_Timer *next;
 } SDL_Timer;
@@ -46,12 +52,14 @@ typedef struct _SDL_TimerMap
     struct _SDL_TimerMap *next;
 } SDL_TimerMap;
 
-/* The timers are kept in a sorted list */
+/* The timers are kept in a heap ordered by scheduling time */
 typedef struct {
     /* Data used by the main thread */
     SDL_Thread *thread;
     SDL_atomic_t nextID;
-    SDL_TimerMap *timermap;
+    SDL_TimerMap **timermap;    /* hash buckets, indexed by timer ID */
+    int timermap_size;          /* number of buckets, a power of 2 */
+    int timermap_count;
     SDL_mutex *timermap_lock;
 
     /* Padding to separate cache lines between threads */
@@ -64,37 +72,111 @@ typedef struct {
     SDL_Timer *freelist;
     SDL_atomic_t active;
 
-    /* List of timers - this is only touched by the timer thread */
-    SDL_Timer *timers;
+    /* Heap of timers - this is only touched by the timer thread */
+    SDL_Timer **timers;
+    int num_timers;
+    int max_timers;
 } SDL_TimerData;
 
 static SDL_TimerData SDL_timer_data;
 
 /* The idea here is that any thread might add a timer, but a single
- * thread manages the active timer queue, sorted by scheduling time.
+ * thread manages the active timer queue, a binary min-heap ordered by
+ * scheduling time, so adding and rescheduling a timer is O(log n).
  *
  * Timers are removed by simply setting a canceled flag
  */
 
-static void
+#define SDL_TimerBefore(A, B)   ((A)->scheduled < (B)->scheduled)
+
+static SDL_bool
 SDL_AddTimerInternal(SDL_TimerData *data, SDL_Timer *timer)
 {
-    SDL_Timer *prev, *curr;
+    SDL_Timer **timers = data->timers;
+    int i, parent;
+
+    if (data->num_timers == data->max_timers) {
+        int max_timers = data->max_timers ? (data->max_timers * 2) : 64;
+        timers = (SDL_Timer **)SDL_realloc(data->timers, max_timers * sizeof(*timers));
+        if (!timers) {
+            return SDL_FALSE;
+        }
+        data->timers = timers;
+        data->max_timers = max_timers;
+    }
 
-    prev = NULL;
-    for (curr = data->timers; curr; prev = curr, curr = curr->next) {
-        if ((Sint32)(timer->scheduled-curr->scheduled) < 0) {
+    /* Sift the new timer up from the bottom of the heap */
+    i = data->num_timers++;
+    while (i > 0) {
+        parent = (i - 1) / 2;
+        if (!SDL_TimerBefore(timer, timers[parent])) {
             break;
         }
+        timers[i] = timers[parent];
+        i = parent;
     }
+    timers[i] = timer;
+    return SDL_TRUE;
+}
 
-    /* Insert the timer here! */
-    if (prev) {
-        prev->next = timer;
-    } else {
-        data->timers = timer;
+/* Replace the first timer in the heap with timer, or remove it if timer is NULL */
+static void
+SDL_ReplaceFirstTimer(SDL_TimerData *data, SDL_Timer *timer)
+{
+    SDL_Timer **timers = data->timers;
+    int i, child;
+
+    if (!timer) {
+        timer = timers[--data->num_timers];
+        if (data->num_timers == 0) {
+            return;
+        }
     }
-    timer->next = curr;
+
+    /* Sift the timer down from the top of the heap */
+    i = 0;
+    for ( ; ; ) {
+        child = 2 * i + 1;
+        if (child >= data->num_timers) {
+            break;
+        }
+        if (child + 1 < data->num_timers && SDL_TimerBefore(timers[child + 1], timers[child])) {
+            ++child;
+        }
+        if (!SDL_TimerBefore(timers[child], timer)) {
+            break;
+        }
+        timers[i] = timers[child];
+        i = child;
+    }
+    timers[i] = timer;
+}
+
+/* Double the number of timer map buckets -- called with the timermap locked */
+static SDL_bool
+SDL_GrowTimerMap(SDL_TimerData *data)
+{
+    int size = data->timermap_size ? (data->timermap_size * 2) : 64;
+    SDL_TimerMap **timermap;
+    SDL_TimerMap *entry, *next;
+    int i;
+
+    timermap = (SDL_TimerMap **)SDL_calloc(size, sizeof(*timermap));
+    if (!timermap) {
+        return SDL_FALSE;
+    }
+
+    for (i = 0; i < data->timermap_size; ++i) {
+        for (entry = data->timermap[i]; entry; entry = next) {
+            next = entry->next;
+            entry->next = timermap[entry->timerID & (size - 1)];
+            timermap[entry->timerID & (size - 1)] = entry;
+        }
+    }
+    SDL_free(data->timermap);
+    data->timermap = timermap;
+    data->timermap_size = size;
+    return SDL_TRUE;
 }
 
 static int
@@ -105,7 +187,8 @@ SDL_TimerThread(void *_data)
     SDL_Timer *current;
     SDL_Timer *freelist_head = NULL;
     SDL_Timer *freelist_tail = NULL;
-    Uint32 tick, now, interval, delay;
+    Uint64 tick, now, interval, delay_ns;
+    Uint32 delay;
 
     /* Threaded timer loop:
      *  1. Queue timers added by other threads
@@ -127,50 +210,65 @@ SDL_TimerThread(void *_data)
             }
         }
         SDL_AtomicUnlock(&data->lock);
+        freelist_head = NULL;
+        freelist_tail = NULL;
 
-        /* Sort the pending timers into our list */
+        /* Sort the pending timers into our heap */
         while (pending) {
             current = pending;
             pending = pending->next;
-            SDL_AddTimerInternal(data, current);
+            if (!SDL_AddTimerInternal(data, current)) {
+                /* Out of memory, drop the timer */
+                SDL_AtomicSet(&current->canceled, 1);
+                current->next = freelist_head;
+                if (!freelist_tail) {
+                    freelist_tail = current;
+                }
+                freelist_head = current;
+            }
         }
-        freelist_head = NULL;
-        freelist_tail = NULL;
 
         /* Check to see if we're still running, after maintenance */
         if (!SDL_AtomicGet(&data->active)) {
             break;
         }
 
-        /* Initial delay if there are no timers */
-        delay = SDL_MUTEX_MAXWAIT;
-
-        tick = SDL_GetTicks();
+        tick = SDL_GetTicksNS();
 
         /* Process all the pending timers for this tick */
-        while (data->timers) {
-            current = data->timers;
+        while (data->num_timers > 0) {
+            current = data->timers[0];
 
-            if ((Sint32)(tick-current->scheduled) < 0) {
+            if (current->scheduled > tick) {
                 /* Scheduled for the future, wait a bit */
-                delay = (current->scheduled - tick);
                 break;
             }
 
             /* We're going to do something with this timer */
-            data->timers = current->next;
-
             if (SDL_AtomicGet(&current->canceled)) {
                 interval = 0;
+            } else if (current->callback_ns) {
+                interval = current->callback_ns(current->interval, current->param);
             } else {
-                interval = current->callback(current->interval, current->param);
+                interval = current->callback((Uint32)current->interval, current->param);
             }
 
             if (interval > 0) {
                 /* Reschedule this timer */
-                current->scheduled = tick + interval;
-                SDL_AddTimerInternal(data, current);
+                if (current->callback_ns) {
+                    /* Keep periodic high resolution timers from drifting */
+                    current->scheduled += interval;
+                    if (current->scheduled <= tick) {
+                        current->scheduled = tick + interval;
+                    }
+                } else {
+                    current->scheduled = tick + interval * SDL_NS_PER_MS;
+                }
+                SDL_ReplaceFirstTimer(data, current);
             } else {
+                SDL_ReplaceFirstTimer(data, NULL);
+
+                current->next = NULL;
                 if (!freelist_head) {
                     freelist_head = current;
                 }
@@ -183,13 +281,25 @@ SDL_TimerThread(void *_data)
             }
         }
 
-        /* Adjust the delay based on processing time */
-        now = SDL_GetTicks();
-        interval = (now - tick);
-        if (interval > delay) {
-            delay = 0;
+        /* Work out how long to wait for the next timer */
+        if (data->num_timers == 0) {
+            delay = SDL_MUTEX_MAXWAIT;
         } else {
-            delay -= interval;
+            current = data->timers[0];
+            now = SDL_GetTicksNS();
+            delay_ns = (current->scheduled > now) ? (current->scheduled - now) : 0;
+
+            if (!current->callback_ns) {
+                /* Millisecond timers aren't due until their tick comes up */
+                delay = (Uint32)SDL_min((delay_ns + SDL_NS_PER_MS - 1) / SDL_NS_PER_MS, SDL_MUTEX_MAXWAIT - 1);
+            } else if (delay_ns > SDL_NS_PER_MS + SDL_DELAY_SPIN_NS) {
+                /* Wake up a little early so we can finish the wait precisely */
+                delay = (Uint32)SDL_min((delay_ns - SDL_DELAY_SPIN_NS) / SDL_NS_PER_MS, SDL_MUTEX_MAXWAIT - 1);
+            } else {
+                /* Too close to wait on the semaphore, new timers can wait this long */
+                SDL_DelayNS(delay_ns);
+                continue;
+            }
         }
 
         /* Note that each time a timer is added, this will return
@@ -222,6 +332,9 @@ SDL_TimerInit(void)
 
         SDL_AtomicSet(&data->active, 1);
 
+        /* Start the ticks before any timers are scheduled */
+        SDL_TicksInit();
+
         /* Timer threads use a callback into the app, so we can't set a limited stack size here. */
         data->thread = SDL_CreateThreadInternal(SDL_TimerThread, name, 0, data);
         if (!data->thread) {
@@ -240,6 +353,7 @@ SDL_TimerQuit(void)
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
     SDL_TimerMap *entry;
+    int i;
 
     if (SDL_AtomicCAS(&data->active, 1, 0)) {  /* active? Move to inactive. */
         /* Shutdown the timer thread */
@@ -253,29 +367,38 @@ SDL_TimerQuit(void)
         data->sem = NULL;
 
         /* Clean up the timer entries */
-        while (data->timers) {
-            timer = data->timers;
-            data->timers = timer->next;
-            SDL_free(timer);
+        for (i = 0; i < data->num_timers; ++i) {
+            SDL_free(data->timers[i]);
         }
+        SDL_free(data->timers);
+        data->timers = NULL;
+        data->num_timers = 0;
+        data->max_timers = 0;
+
         while (data->freelist) {
             timer = data->freelist;
             data->freelist = timer->next;
             SDL_free(timer);
         }
-        while (data->timermap) {
-            entry = data->timermap;
-            data->timermap = entry->next;
-            SDL_free(entry);
+        for (i = 0; i < data->timermap_size; ++i) {
+            while (data->timermap[i]) {
+                entry = data->timermap[i];
+                data->timermap[i] = entry->next;
+                SDL_free(entry);
+            }
         }
+        SDL_free(data->timermap);
+        data->timermap = NULL;
+        data->timermap_size = 0;
+        data->timermap_count = 0;
 
         SDL_DestroyMutex(data->timermap_lock);
         data->timermap_lock = NULL;
     }
 }
 
-SDL_TimerID
-SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
+static SDL_TimerID
+SDL_CreateTimer(Uint64 interval, SDL_TimerCallback callback, SDL_NSTimerCallback callback_ns, void *param)
 {
     SDL_TimerData *data = &SDL_timer_data;
     SDL_Timer *timer;
@@ -306,9 +429,10 @@ SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
     }
     timer->timerID = SDL_AtomicIncRef(&data->nextID);
     timer->callback = callback;
+    timer->callback_ns = callback_ns;
     timer->param = param;
     timer->interval = interval;
-    timer->scheduled = SDL_GetTicks() + interval;
+    timer->scheduled = SDL_GetTicksNS() + (callback_ns ? interval : interval * SDL_NS_PER_MS);
     SDL_AtomicSet(&timer->canceled, 0);
 
     entry = (SDL_TimerMap *)SDL_malloc(sizeof(*entry));
@@ -321,8 +445,17 @@ SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
     entry->timerID = timer->timerID;
 
     SDL_LockMutex(data->timermap_lock);
-    entry->next = data->timermap;
-    data->timermap = entry;
+    if (data->timermap_count >= data->timermap_size &&
+        !SDL_GrowTimerMap(data) && !data->timermap_size) {
+        SDL_UnlockMutex(data->timermap_lock);
+        SDL_free(entry);
+        SDL_free(timer);
+        SDL_OutOfMemory();
+        return 0;
+    }
+    entry->next = data->timermap[entry->timerID & (data->timermap_size - 1)];
+    data->timermap[entry->timerID & (data->timermap_size - 1)] = entry;
+    ++data->timermap_count;
     SDL_UnlockMutex(data->timermap_lock);
 
     /* Add the timer to the pending list for the timer thread */
@@ -337,24 +470,40 @@ SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
     return entry->timerID;
 }
 
+SDL_TimerID
+SDL_AddTimer(Uint32 interval, SDL_TimerCallback callback, void *param)
+{
+    return SDL_CreateTimer(interval, callback, NULL, param);
+}
+
+SDL_TimerID
+SDL_AddTimerNS(Uint64 interval, SDL_NSTimerCallback callback, void *param)
+{
+    return SDL_CreateTimer(interval, NULL, callback, param);
+}
+
 SDL_bool
 SDL_RemoveTimer(SDL_TimerID id)
 {
     SDL_TimerData *data = &SDL_timer_data;
-    SDL_TimerMap *prev, *entry;
+    SDL_TimerMap *prev, *entry = NULL;
     SDL_bool canceled = SDL_FALSE;
 
     /* Find the timer */
     SDL_LockMutex(data->timermap_lock);
-    prev = NULL;
-    for (entry = data->timermap; entry; prev = entry, entry = entry->next) {
-        if (entry->timerID == id) {
-            if (prev) {
-                prev->next = entry->next;
-            } else {
-                data->timermap = entry->next;
+    if (data->timermap_size) {
+        SDL_TimerMap **bucket = &data->timermap[id & (data->timermap_size - 1)];
+        prev = NULL;
+        for (entry = *bucket; entry; prev = entry, entry = entry->next) {
+            if (entry->timerID == id) {
+                if (prev) {
+                    prev->next = entry->next;
+                } else {
+                    *bucket = entry->next;
+                }
+                --data->timermap_count;
+                break;
             }
-            break;
         }
     }
     SDL_UnlockMutex(data->timermap_lock);
@@ -369,4 +518,30 @@ SDL_RemoveTimer(SDL_TimerID id)
     return canceled;
 }
 
+void
+SDL_DelayNS(Uint64 ns)
+{
+#if defined(SDL_TIMER_DUMMY) || defined(SDL_TIMERS_DISABLED)
+    /* There's no clock to wait on */
+    SDL_SYS_DelayNS(ns);
+#else
+    const Uint64 target = SDL_GetTicksNS() + ns;
+    Uint64 now, remaining;
+
+    /* Sleep until we're close, since the OS may oversleep a bit */
+    for (now = SDL_GetTicksNS(); now < target; now = SDL_GetTicksNS()) {
+        remaining = target - now;
+        if (remaining <= SDL_DELAY_SPIN_NS) {
+            break;
+        }
+        SDL_SYS_DelayNS(remaining - SDL_DELAY_SPIN_NS);
+    }
+
+    /* Spin the rest of the way */
+    while (SDL_GetTicksNS() < target) {
+        continue;
+    }
+#endif
+}
+
 /* vi: set ts=4 sw=4 expandtab: */
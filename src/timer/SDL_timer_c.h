@@ -26,8 +26,16 @@
 #define ROUND_RESOLUTION(X) \
     (((X+TIMER_RESOLUTION-1)/TIMER_RESOLUTION)*TIMER_RESOLUTION)
 
+#define SDL_NS_PER_SECOND   1000000000
+#define SDL_NS_PER_MS       1000000
+#define SDL_NS_PER_US       1000
+
 extern void SDL_TicksInit(void);
 extern void SDL_TicksQuit(void);
+
+/* Sleep for about 'ns' nanoseconds, as precisely as the platform allows,
+   called by SDL_DelayNS() which busy-waits the rest of the way */
+extern void SDL_SYS_DelayNS(Uint64 ns);
 extern int SDL_TimerInit(void);
 extern void SDL_TimerQuit(void);
 
@@ -23,6 +23,7 @@
 #if defined(SDL_TIMER_DUMMY) || defined(SDL_TIMERS_DISABLED)
 
 #include "SDL_timer.h"
+#include "../SDL_timer_c.h"
 
 static SDL_bool ticks_started = SDL_FALSE;
 
@@ -52,6 +53,12 @@ SDL_GetTicks(void)
     return 0;
 }
 
+Uint64
+SDL_GetTicksNS(void)
+{
+    return (Uint64)SDL_GetTicks() * SDL_NS_PER_MS;
+}
+
 Uint64
 SDL_GetPerformanceCounter(void)
 {
@@ -70,6 +77,12 @@ SDL_Delay(Uint32 ms)
     SDL_Unsupported();
 }
 
+void
+SDL_SYS_DelayNS(Uint64 ns)
+{
+    SDL_Unsupported();
+}
+
 #endif /* SDL_TIMER_DUMMY || SDL_TIMERS_DISABLED */
 
 /* vi: set ts=4 sw=4 expandtab: */
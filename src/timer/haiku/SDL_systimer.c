@@ -25,6 +25,7 @@
 #include <os/kernel/OS.h>
 
 #include "SDL_timer.h"
+#include "../SDL_timer_c.h"
 
 static bigtime_t start;
 static SDL_bool ticks_started = SDL_FALSE;
@@ -57,6 +58,16 @@ SDL_GetTicks(void)
     return ((system_time() - start) / 1000);
 }
 
+Uint64
+SDL_GetTicksNS(void)
+{
+    if (!ticks_started) {
+        SDL_TicksInit();
+    }
+
+    return (Uint64)(system_time() - start) * SDL_NS_PER_US;
+}
+
 Uint64
 SDL_GetPerformanceCounter(void)
 {
@@ -75,6 +86,12 @@ SDL_Delay(Uint32 ms)
     snooze(ms * 1000);
 }
 
+void
+SDL_SYS_DelayNS(Uint64 ns)
+{
+    snooze((bigtime_t)(ns / SDL_NS_PER_US));
+}
+
 #endif /* SDL_TIMER_HAIKU */
 
 /* vi: set ts=4 sw=4 expandtab: */
@@ -65,6 +65,22 @@ Uint32 SDL_GetTicks(void)
     return(ticks);
 }
 
+Uint64
+SDL_GetTicksNS(void)
+{
+    struct timeval now;
+    Uint64 ticks;
+
+    if (!ticks_started) {
+        SDL_TicksInit();
+    }
+
+    gettimeofday(&now, NULL);
+    ticks = (Uint64)(now.tv_sec - start.tv_sec) * SDL_NS_PER_SECOND;
+    ticks += (Sint64)(now.tv_usec - start.tv_usec) * SDL_NS_PER_US;
+    return ticks;
+}
+
 Uint64
 SDL_GetPerformanceCounter(void)
 {
@@ -85,6 +101,15 @@ void SDL_Delay(Uint32 ms)
     sceKernelDelayThreadCB(ms * 1000);
 }
 
+void SDL_SYS_DelayNS(Uint64 ns)
+{
+    const Uint64 max_delay = 0xffffffffUL;
+    Uint64 us = ns / SDL_NS_PER_US;
+    if(us > max_delay)
+        us = max_delay;
+    sceKernelDelayThreadCB((SceUInt)us);
+}
+
 #endif /* SDL_TIMERS_PSP */
 
 /* vim: ts=4 sw=4
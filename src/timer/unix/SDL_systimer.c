@@ -29,6 +29,7 @@
 
 #include "SDL_timer.h"
 #include "SDL_assert.h"
+#include "../SDL_timer_c.h"
 
 /* The clock_gettime provides monotonous time, so we should use it if
    it's available. The clock_gettime function is behind ifdef
@@ -129,6 +130,40 @@ SDL_GetTicks(void)
     return (ticks);
 }
 
+Uint64
+SDL_GetTicksNS(void)
+{
+    Uint64 ticks;
+    if (!ticks_started) {
+        SDL_TicksInit();
+    }
+
+    if (has_monotonic_time) {
+#if HAVE_CLOCK_GETTIME
+        struct timespec now;
+        clock_gettime(SDL_MONOTONIC_CLOCK, &now);
+        ticks = (Uint64)(now.tv_sec - start_ts.tv_sec) * SDL_NS_PER_SECOND;
+        ticks += now.tv_nsec;
+        ticks -= start_ts.tv_nsec;
+#elif defined(__APPLE__)
+        /* Split the conversion so the multiplication can't overflow */
+        const Uint64 elapsed = mach_absolute_time() - start_mach;
+        ticks = (elapsed / mach_base_info.denom) * mach_base_info.numer;
+        ticks += ((elapsed % mach_base_info.denom) * mach_base_info.numer) / mach_base_info.denom;
+#else
+        SDL_assert(SDL_FALSE);
+        ticks = 0;
+#endif
+    } else {
+        struct timeval now;
+
+        gettimeofday(&now, NULL);
+        ticks = (Uint64)(now.tv_sec - start_tv.tv_sec) * SDL_NS_PER_SECOND;
+        ticks += (Sint64)(now.tv_usec - start_tv.tv_usec) * SDL_NS_PER_US;
+    }
+    return (ticks);
+}
+
 Uint64
 SDL_GetPerformanceCounter(void)
 {
@@ -226,6 +261,33 @@ SDL_Delay(Uint32 ms)
     } while (was_error && (errno == EINTR));
 }
 
+void
+SDL_SYS_DelayNS(Uint64 ns)
+{
+#if HAVE_NANOSLEEP
+    struct timespec elapsed, tv;
+    int was_error;
+
+    elapsed.tv_sec = (time_t)(ns / SDL_NS_PER_SECOND);
+    elapsed.tv_nsec = (long)(ns % SDL_NS_PER_SECOND);
+    do {
+        errno = 0;
+
+        tv.tv_sec = elapsed.tv_sec;
+        tv.tv_nsec = elapsed.tv_nsec;
+        was_error = nanosleep(&tv, &elapsed);
+    } while (was_error && (errno == EINTR));
+#else
+    /* An interrupted select() just returns early, SDL_DelayNS() will call
+       us again for the rest */
+    struct timeval tv;
+
+    tv.tv_sec = (time_t)(ns / SDL_NS_PER_SECOND);
+    tv.tv_usec = (long)((ns % SDL_NS_PER_SECOND) / SDL_NS_PER_US);
+    select(0, NULL, NULL, NULL, &tv);
+#endif /* HAVE_NANOSLEEP */
+}
+
 #endif /* SDL_TIMER_UNIX */
 
 /* vi: set ts=4 sw=4 expandtab: */
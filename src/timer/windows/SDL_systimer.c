@@ -27,7 +27,12 @@
 
 #include "SDL_timer.h"
 #include "SDL_hints.h"
+#include "SDL_thread.h"
+#include "../SDL_timer_c.h"
 
+#ifndef CREATE_WAITABLE_TIMER_HIGH_RESOLUTION
+#define CREATE_WAITABLE_TIMER_HIGH_RESOLUTION 0x00000002
+#endif
 
 /* The first (low-resolution) ticks value of the application */
 static DWORD start = 0;
@@ -40,6 +45,17 @@ static LARGE_INTEGER hires_start_ticks;
 /* The number of ticks per second of the high-resolution performance counter */
 static LARGE_INTEGER hires_ticks_per_second;
 
+#ifndef __WINRT__
+/* Windows 10 1803 and later can make waitable timers with sub-millisecond
+   precision, which SDL_SYS_DelayNS() uses when it can */
+typedef HANDLE (WINAPI *CreateWaitableTimerExW_t)(LPSECURITY_ATTRIBUTES, LPCWSTR, DWORD, DWORD);
+static CreateWaitableTimerExW_t pCreateWaitableTimerExW;
+
+/* Each thread keeps the waitable timer it sleeps on in SDL_SYS_DelayNS(),
+   instead of creating and closing one on every call */
+static SDL_TLSID delay_timer;
+#endif
+
 static void
 SDL_SetSystemTimerResolution(const UINT uPeriod)
 {
@@ -102,6 +118,13 @@ SDL_TicksInit(void)
         start = timeGetTime();
 #endif /* __WINRT__ */
     }
+
+#ifndef __WINRT__
+    pCreateWaitableTimerExW = (CreateWaitableTimerExW_t)GetProcAddress(GetModuleHandle(TEXT("kernel32.dll")), "CreateWaitableTimerExW");
+    if (!delay_timer) {
+        delay_timer = SDL_TLSCreate();
+    }
+#endif
 }
 
 void
@@ -143,6 +166,34 @@ SDL_GetTicks(void)
     return (now - start);
 }
 
+Uint64
+SDL_GetTicksNS(void)
+{
+    DWORD now = 0;
+    LARGE_INTEGER hires_now;
+
+    if (!ticks_started) {
+        SDL_TicksInit();
+    }
+
+    if (hires_timer_available) {
+        const Uint64 freq = (Uint64) hires_ticks_per_second.QuadPart;
+        Uint64 ticks;
+
+        QueryPerformanceCounter(&hires_now);
+        ticks = (Uint64) (hires_now.QuadPart - hires_start_ticks.QuadPart);
+
+        /* Split the conversion so the multiplication can't overflow */
+        return (ticks / freq) * SDL_NS_PER_SECOND + ((ticks % freq) * SDL_NS_PER_SECOND) / freq;
+    } else {
+#ifndef __WINRT__
+        now = timeGetTime();
+#endif /* __WINRT__ */
+    }
+
+    return (Uint64) (now - start) * SDL_NS_PER_MS;
+}
+
 Uint64
 SDL_GetPerformanceCounter(void)
 {
@@ -195,6 +246,68 @@ SDL_Delay(Uint32 ms)
 #endif
 }
 
+#ifndef __WINRT__
+static void
+SDL_CloseDelayTimer(void *timer)
+{
+    CloseHandle((HANDLE) timer);
+}
+
+static HANDLE
+SDL_GetDelayTimer(void)
+{
+    HANDLE timer = (HANDLE) SDL_TLSGet(delay_timer);
+
+    if (timer) {
+        return timer;
+    }
+
+    /* Without the high resolution flag waitable timers still wait for the
+       next tick of the system timer, which SDL_TimerResolutionChanged()
+       usually sets to 1 ms */
+    if (pCreateWaitableTimerExW) {
+        timer = pCreateWaitableTimerExW(NULL, NULL, CREATE_WAITABLE_TIMER_HIGH_RESOLUTION, TIMER_ALL_ACCESS);
+    }
+    if (!timer) {
+        timer = CreateWaitableTimer(NULL, TRUE, NULL);
+    }
+    if (timer && SDL_TLSSet(delay_timer, timer, SDL_CloseDelayTimer) < 0) {
+        CloseHandle(timer);
+        timer = NULL;
+    }
+    return timer;
+}
+#endif /* __WINRT__ */
+
+void
+SDL_SYS_DelayNS(Uint64 ns)
+{
+#ifndef __WINRT__
+    HANDLE timer;
+
+    if (!ticks_started) {
+        SDL_TicksInit();
+    }
+
+    timer = SDL_GetDelayTimer();
+    if (timer) {
+        LARGE_INTEGER due;
+
+        /* Waitable timers are set in 100 nanosecond units */
+        due.QuadPart = -(LONGLONG) (ns / 100);  /* negative means relative */
+        if (SetWaitableTimer(timer, &due, 0, NULL, NULL, FALSE)) {
+            WaitForSingleObject(timer, INFINITE);
+        }
+        return;
+    }
+#endif /* __WINRT__ */
+
+    /* SDL_DelayNS() busy-waits whatever is less than a millisecond */
+    if (ns >= SDL_NS_PER_MS) {
+        SDL_Delay((Uint32) SDL_min(ns / SDL_NS_PER_MS, 0xFFFFFFFF));
+    }
+}
+
 #endif /* SDL_TIMER_WINDOWS */
 
 /* vi: set ts=4 sw=4 expandtab: */
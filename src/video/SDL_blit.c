@@ -153,6 +153,16 @@ SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
             if (SDL_HasSSE2()) {
                 features |= SDL_CPU_SSE2;
             }
+            /* SSSE3 isn't reported separately, but every SSE4.1 CPU has it */
+            if (SDL_HasSSE41()) {
+                features |= SDL_CPU_SSSE3;
+            }
+            if (SDL_HasAVX2()) {
+                features |= SDL_CPU_AVX2;
+            }
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+            features |= SDL_CPU_NEON;
+#endif
             if (SDL_HasAltiVec()) {
                 if (SDL_UseAltivecPrefetch()) {
                     features |= SDL_CPU_ALTIVEC_PREFETCH;
@@ -211,6 +221,21 @@ SDL_ChooseBlitFunc(Uint32 src_format, Uint32 dst_format, int flags,
     return NULL;
 }
 
+/* Choose a blit function for spans of pixels that don't live in a surface
+   yet, like the ones the software renderer samples on the fly */
+SDL_BlitFunc
+SDL_ChooseSpanBlit(Uint32 src_format, Uint32 dst_format, int flags)
+{
+    SDL_BlitFunc blit;
+
+    flags &= ~SDL_COPY_NEAREST;
+    blit = SDL_ChooseBlitFunc(src_format, dst_format, flags, SDL_SIMDBlitFuncTable);
+    if (blit == NULL) {
+        blit = SDL_ChooseBlitFunc(src_format, dst_format, flags, SDL_GeneratedBlitFuncTable);
+    }
+    return blit;
+}
+
 /* Figure out which of many blit routines to set up on a surface */
 int
 SDL_CalculateBlit(SDL_Surface * surface)
@@ -236,6 +261,13 @@ SDL_CalculateBlit(SDL_Surface * surface)
         }
     }
 
+    /* Reuse the blit function chosen for these formats and flags before */
+    if (SDL_LookupBlitFunc(surface->format->format, dst->format->format,
+                           map->info.flags, map->identity, &blit)) {
+        map->data = blit;
+        return 0;
+    }
+
     /* Choose a standard blit function */
     if (map->identity && !(map->info.flags & ~SDL_COPY_RLE_DESIRED)) {
         blit = SDL_BlitCopy;
@@ -245,10 +277,20 @@ SDL_CalculateBlit(SDL_Surface * surface)
     } else if (surface->format->BytesPerPixel == 1 &&
                SDL_ISPIXELFORMAT_INDEXED(surface->format->format)) {
         blit = SDL_CalculateBlit1(surface);
-    } else if (map->info.flags & SDL_COPY_BLEND) {
-        blit = SDL_CalculateBlitA(surface);
     } else {
-        blit = SDL_CalculateBlitN(surface);
+        /* Blending and modulation between 32-bit RGB formats is vectorized */
+        if (map->info.flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA |
+                               SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD)) {
+            blit = SDL_ChooseBlitFunc(surface->format->format, dst->format->format,
+                                      map->info.flags, SDL_SIMDBlitFuncTable);
+        }
+        if (blit == NULL) {
+            if (map->info.flags & SDL_COPY_BLEND) {
+                blit = SDL_CalculateBlitA(surface);
+            } else {
+                blit = SDL_CalculateBlitN(surface);
+            }
+        }
     }
     if (blit == NULL) {
         Uint32 src_format = surface->format->format;
@@ -280,6 +322,8 @@ SDL_CalculateBlit(SDL_Surface * surface)
         return SDL_SetError("Blit combination not supported");
     }
 
+    SDL_CacheBlitFunc(surface->format->format, dst->format->format,
+                      map->info.flags, map->identity, blit);
     return 0;
 }
 
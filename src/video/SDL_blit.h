@@ -51,6 +51,9 @@ extern Uint8* SDL_expand_byte[9];
 #define SDL_CPU_SSE2                0x00000008
 #define SDL_CPU_ALTIVEC_PREFETCH    0x00000010
 #define SDL_CPU_ALTIVEC_NOPREFETCH  0x00000020
+#define SDL_CPU_SSSE3               0x00000040
+#define SDL_CPU_AVX2                0x00000080
+#define SDL_CPU_NEON                0x00000100
 
 typedef struct
 {
@@ -81,6 +84,36 @@ typedef struct
     SDL_BlitFunc func;
 } SDL_BlitFuncEntry;
 
+/* Palette translation tables are shared between blit mappings, keyed by
+   the palettes and formats they translate between */
+typedef enum
+{
+    SDL_BLIT_TABLE_1TO1,        /* Palette to palette */
+    SDL_BLIT_TABLE_1TON,        /* Palette to RGB, with modulation */
+    SDL_BLIT_TABLE_NTO1         /* RGB to palette */
+} SDL_BlitTableType;
+
+typedef struct
+{
+    SDL_BlitTableType type;
+    Uint32 src, dst;            /* Palette version, or pixel format for RGB */
+    int src_colors, dst_colors;
+    Uint32 mods;                /* Color and alpha modulation, as RGBA */
+} SDL_BlitTableKey;
+
+typedef struct SDL_BlitTable
+{
+    SDL_BlitTableKey key;
+    Uint8 *table;
+    int identical;              /* The palettes match, so there's no table */
+    int refcount;
+    Uint32 last_used;
+    struct SDL_BlitTable *next;
+} SDL_BlitTable;
+
+/* Filter tables for stretching between two sizes, see SDL_stretch.c */
+typedef struct SDL_StretchFilters SDL_StretchFilters;
+
 /* Blit mapping definition */
 typedef struct SDL_BlitMap
 {
@@ -89,6 +122,14 @@ typedef struct SDL_BlitMap
     SDL_blit blit;
     void *data;
     SDL_BlitInfo info;
+    SDL_BlitTable *table;       /* The shared table in info.table, if any */
+
+    /* the filter used when the surface is stretched */
+    SDL_ScaleMode scale_mode;
+
+    /* the filter tables and intermediate surface of the last filtered stretch */
+    SDL_StretchFilters *filters;
+    SDL_Surface *filtered;
 
     /* the version count matches the destination; mismatch indicates
        an invalid mapping */
@@ -98,6 +139,35 @@ typedef struct SDL_BlitMap
 
 /* Functions found in SDL_blit.c */
 extern int SDL_CalculateBlit(SDL_Surface * surface);
+extern SDL_BlitFunc SDL_ChooseSpanBlit(Uint32 src_format, Uint32 dst_format, int flags);
+
+/* Functions found in SDL_blitcache.c */
+extern SDL_bool SDL_LookupBlitFunc(Uint32 src_format, Uint32 dst_format, int flags, int identity, SDL_BlitFunc * func);
+extern void SDL_CacheBlitFunc(Uint32 src_format, Uint32 dst_format, int flags, int identity, SDL_BlitFunc func);
+extern SDL_BlitTable *SDL_AcquireBlitTable(const SDL_BlitTableKey * key);
+extern SDL_BlitTable *SDL_AddBlitTable(const SDL_BlitTableKey * key, Uint8 * data, int identical);
+extern void SDL_ReleaseBlitTable(SDL_BlitTable * table);
+extern void SDL_QuitBlitCache(void);
+
+/* Functions found in SDL_surface.c */
+extern SDL_bool SDL_ClipBlit(const SDL_Surface * src, const SDL_Rect * srcrect,
+                             const SDL_Surface * dst, const SDL_Rect * dstrect,
+                             SDL_Rect * final_src, SDL_Rect * final_dst);
+extern SDL_bool SDL_ClipBlitScaled(const SDL_Surface * src, const SDL_Rect * srcrect,
+                                   const SDL_Surface * dst, const SDL_Rect * dstrect,
+                                   SDL_Rect * final_src, SDL_Rect * final_dst);
+
+/* Functions found in SDL_stretch.c */
+extern SDL_bool SDL_CanFilterStretch(const SDL_PixelFormat * format);
+extern int SDL_LowerSoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
+                                SDL_Surface * dst, const SDL_Rect * dstrect,
+                                SDL_ScaleMode scaleMode);
+extern SDL_StretchFilters *SDL_AcquireStretchFilters(SDL_Surface * src, const SDL_Rect * srcrect,
+                                                     const SDL_Rect * dstrect, SDL_ScaleMode scaleMode);
+extern void SDL_ReleaseStretchFilters(SDL_StretchFilters * filters);
+extern void SDL_SoftStretchRows(SDL_Surface * src, const SDL_Rect * srcrect,
+                                SDL_Surface * dst, const SDL_Rect * dstrect,
+                                const SDL_StretchFilters * filters, int y0, int y1);
 
 /* Functions found in SDL_blit_*.c */
 extern SDL_BlitFunc SDL_CalculateBlit0(SDL_Surface * surface);
@@ -105,6 +175,9 @@ extern SDL_BlitFunc SDL_CalculateBlit1(SDL_Surface * surface);
 extern SDL_BlitFunc SDL_CalculateBlitN(SDL_Surface * surface);
 extern SDL_BlitFunc SDL_CalculateBlitA(SDL_Surface * surface);
 
+/* Vectorized blend and modulate blitters for the 32-bit RGB formats */
+extern SDL_BlitFuncEntry SDL_SIMDBlitFuncTable[];
+
 /*
  * Useful macros for blitting routines
  */
@@ -1265,6 +1265,551 @@ BlitNtoNPixelAlpha(SDL_BlitInfo * info)
 }
 
 
+/* Vectorized blend, add, mod and color/alpha modulation blitters between
+   any of the 32-bit RGB formats. Each pixel is swizzled into ARGB8888
+   order, combined with exactly the arithmetic of the generated blitters in
+   SDL_blit_auto.c, and swizzled back into the destination order, so one
+   routine per instruction set covers every format pair.
+ */
+
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+#ifdef __SSE2__
+#define HAVE_SSE2_BLIT8888 1
+#endif
+/* The SSSE3 blitter shares the SSE2 blending code */
+#if defined(__SSE2__) && HAVE_SSSE3_INTRINSICS
+#define HAVE_SSSE3_BLIT8888 1
+#endif
+#if HAVE_AVX2_INTRINSICS
+#define HAVE_AVX2_BLIT8888 1
+#endif
+#if HAVE_SSSE3_BLIT8888 || HAVE_AVX2_BLIT8888
+#include <immintrin.h>
+#endif
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define HAVE_NEON_BLIT8888 1
+#include <arm_neon.h>
+#endif
+#endif /* SDL_BYTEORDER == SDL_LIL_ENDIAN */
+
+#if HAVE_SSE2_BLIT8888 || HAVE_SSSE3_BLIT8888 || HAVE_AVX2_BLIT8888 || HAVE_NEON_BLIT8888
+
+typedef struct
+{
+    int src_shift[4];       /* B, G, R, A bit positions, -1 if missing */
+    int dst_shift[4];
+    Uint32 modulate[4];     /* B, G, R, A factors, 255 if not modulated */
+    SDL_bool modulated;
+    int blend;              /* SDL_COPY_BLEND, SDL_COPY_ADD, SDL_COPY_MOD or 0 */
+} Blit8888Info;
+
+static void
+SetupBlit8888(const SDL_BlitInfo * info, Blit8888Info * blit)
+{
+    const SDL_PixelFormat *sf = info->src_fmt;
+    const SDL_PixelFormat *df = info->dst_fmt;
+    const int flags = info->flags;
+
+    blit->src_shift[0] = sf->Bshift;
+    blit->src_shift[1] = sf->Gshift;
+    blit->src_shift[2] = sf->Rshift;
+    blit->src_shift[3] = sf->Amask ? sf->Ashift : -1;
+    blit->dst_shift[0] = df->Bshift;
+    blit->dst_shift[1] = df->Gshift;
+    blit->dst_shift[2] = df->Rshift;
+    blit->dst_shift[3] = df->Amask ? df->Ashift : -1;
+
+    if (flags & SDL_COPY_MODULATE_COLOR) {
+        blit->modulate[0] = info->b;
+        blit->modulate[1] = info->g;
+        blit->modulate[2] = info->r;
+    } else {
+        blit->modulate[0] = blit->modulate[1] = blit->modulate[2] = 255;
+    }
+    blit->modulate[3] = (flags & SDL_COPY_MODULATE_ALPHA) ? info->a : 255;
+    blit->modulated = (flags & (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA)) ? SDL_TRUE : SDL_FALSE;
+    blit->blend = flags & (SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD);
+}
+
+/* Scalar version for the pixels left over at the end of each row */
+static Uint32
+Blit8888Pixel(Uint32 srcpixel, Uint32 dstpixel, const Blit8888Info * blit)
+{
+    Uint32 s[4], d[4];
+    Uint32 pixel = 0;
+    int i;
+
+    for (i = 0; i < 4; ++i) {
+        s[i] = (blit->src_shift[i] < 0) ? 0xFF : (Uint8) (srcpixel >> blit->src_shift[i]);
+        d[i] = (blit->dst_shift[i] < 0) ? 0xFF : (Uint8) (dstpixel >> blit->dst_shift[i]);
+        s[i] = (s[i] * blit->modulate[i]) / 255;
+    }
+    switch (blit->blend) {
+    case SDL_COPY_BLEND:
+        for (i = 0; i < 3; ++i) {
+            d[i] = (s[i] * s[3]) / 255 + ((255 - s[3]) * d[i]) / 255;
+        }
+        d[3] = s[3] + ((255 - s[3]) * d[3]) / 255;
+        break;
+    case SDL_COPY_ADD:
+        for (i = 0; i < 3; ++i) {
+            d[i] = SDL_min((s[i] * s[3]) / 255 + d[i], 255);
+        }
+        break;
+    case SDL_COPY_MOD:
+        for (i = 0; i < 3; ++i) {
+            d[i] = (s[i] * d[i]) / 255;
+        }
+        break;
+    case 0:
+        SDL_memcpy(d, s, sizeof (d));
+        break;
+    }
+    for (i = 0; i < 4; ++i) {
+        if (blit->dst_shift[i] >= 0) {
+            pixel |= d[i] << blit->dst_shift[i];
+        }
+    }
+    return pixel;
+}
+
+#if HAVE_SSE2_BLIT8888 || HAVE_SSSE3_BLIT8888 || HAVE_AVX2_BLIT8888
+/* Channel bit positions in ARGB8888, the order blending is done in */
+static const int blit8888_canonical[4] = { 0, 8, 16, 24 };
+#endif
+
+#if HAVE_SSSE3_BLIT8888 || HAVE_AVX2_BLIT8888
+/* Builds a byte shuffle moving each channel of four pixels from the bit
+   positions in 'from' to those in 'to', and the bits to set afterwards
+   for channels missing from the source */
+static void
+Blit8888ShuffleMask(Uint8 * mask, Uint32 * fill, const int *from, const int *to)
+{
+    int i, p;
+
+    SDL_memset(mask, 0x80, 16);
+    *fill = 0;
+    for (i = 0; i < 4; ++i) {
+        if (to[i] < 0) {
+            continue;
+        }
+        for (p = 0; p < 4; ++p) {
+            mask[p * 4 + to[i] / 8] = (from[i] < 0) ? 0x80 : (Uint8) (p * 4 + from[i] / 8);
+        }
+        if (from[i] < 0) {
+            *fill |= (Uint32) 0xFF << to[i];
+        }
+    }
+}
+#endif
+
+#if HAVE_SSE2_BLIT8888 || HAVE_SSSE3_BLIT8888
+/* Exact x / 255 for 0 <= x <= 255 * 255 */
+static SDL_INLINE __m128i
+Div255_SSE2(__m128i x)
+{
+    x = _mm_add_epi16(x, _mm_add_epi16(_mm_srli_epi16(x, 8), _mm_set1_epi16(1)));
+    return _mm_srli_epi16(x, 8);
+}
+
+/* Combines two ARGB pixels unpacked to 16 bits per channel */
+static SDL_INLINE __m128i
+Blend8888_SSE2(__m128i s, __m128i d, __m128i modulate, const Blit8888Info * blit)
+{
+    const __m128i alphamask = _mm_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0);
+    const __m128i full = _mm_set1_epi16(255);
+    __m128i alpha;
+
+    if (blit->modulated) {
+        s = Div255_SSE2(_mm_mullo_epi16(s, modulate));
+    }
+    switch (blit->blend) {
+    case SDL_COPY_BLEND:
+        alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s, 0xFF), 0xFF);
+        s = Div255_SSE2(_mm_mullo_epi16(s, _mm_or_si128(_mm_andnot_si128(alphamask, alpha),
+                                                        _mm_and_si128(alphamask, full))));
+        return _mm_add_epi16(s, Div255_SSE2(_mm_mullo_epi16(d, _mm_sub_epi16(full, alpha))));
+    case SDL_COPY_ADD:
+        alpha = _mm_shufflehi_epi16(_mm_shufflelo_epi16(s, 0xFF), 0xFF);
+        s = _mm_min_epi16(_mm_add_epi16(Div255_SSE2(_mm_mullo_epi16(s, alpha)), d), full);
+        return _mm_or_si128(_mm_andnot_si128(alphamask, s), _mm_and_si128(alphamask, d));
+    case SDL_COPY_MOD:
+        s = Div255_SSE2(_mm_mullo_epi16(s, d));
+        return _mm_or_si128(_mm_andnot_si128(alphamask, s), _mm_and_si128(alphamask, d));
+    case 0:
+        return s;
+    default:
+        return d;
+    }
+}
+
+static SDL_INLINE __m128i
+Blend8888x4_SSE2(__m128i s, __m128i d, __m128i modulate, const Blit8888Info * blit)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i lo = Blend8888_SSE2(_mm_unpacklo_epi8(s, zero), _mm_unpacklo_epi8(d, zero), modulate, blit);
+    const __m128i hi = Blend8888_SSE2(_mm_unpackhi_epi8(s, zero), _mm_unpackhi_epi8(d, zero), modulate, blit);
+    return _mm_packus_epi16(lo, hi);
+}
+#endif
+
+#if HAVE_SSE2_BLIT8888
+/* Without a byte shuffle, channels that change place are moved with
+   shifts, the rest are masked in place */
+typedef struct
+{
+    __m128i from[4];
+    __m128i to[4];
+    __m128i keep;
+    __m128i fill;
+    int moves;
+} Swizzle8888_SSE2;
+
+static void
+SetupSwizzle8888_SSE2(Swizzle8888_SSE2 * swz, const int *from, const int *to)
+{
+    Uint32 keep = 0, fill = 0;
+    int i;
+
+    swz->moves = 0;
+    for (i = 0; i < 4; ++i) {
+        if (to[i] < 0) {
+            continue;
+        }
+        if (from[i] < 0) {
+            fill |= (Uint32) 0xFF << to[i];
+        } else if (from[i] == to[i]) {
+            keep |= (Uint32) 0xFF << to[i];
+        } else {
+            swz->from[swz->moves] = _mm_cvtsi32_si128(from[i]);
+            swz->to[swz->moves] = _mm_cvtsi32_si128(to[i]);
+            ++swz->moves;
+        }
+    }
+    swz->keep = _mm_set1_epi32((int) keep);
+    swz->fill = _mm_set1_epi32((int) fill);
+}
+
+static SDL_INLINE __m128i
+Swizzle8888_SSE2_Apply(__m128i pixels, const Swizzle8888_SSE2 * swz)
+{
+    const __m128i mask = _mm_set1_epi32(0xFF);
+    __m128i result = _mm_or_si128(_mm_and_si128(pixels, swz->keep), swz->fill);
+    int i;
+
+    for (i = 0; i < swz->moves; ++i) {
+        result = _mm_or_si128(result, _mm_sll_epi32(_mm_and_si128(_mm_srl_epi32(pixels, swz->from[i]), mask), swz->to[i]));
+    }
+    return result;
+}
+
+static void
+Blit8888to8888SSE2(SDL_BlitInfo * info)
+{
+    Blit8888Info blit;
+    Swizzle8888_SSE2 src_swz, dst_swz, out_swz;
+    __m128i modulate;
+
+    SetupBlit8888(info, &blit);
+    SetupSwizzle8888_SSE2(&src_swz, blit.src_shift, blit8888_canonical);
+    SetupSwizzle8888_SSE2(&dst_swz, blit.dst_shift, blit8888_canonical);
+    SetupSwizzle8888_SSE2(&out_swz, blit8888_canonical, blit.dst_shift);
+    modulate = _mm_set_epi16(blit.modulate[3], blit.modulate[2], blit.modulate[1], blit.modulate[0],
+                             blit.modulate[3], blit.modulate[2], blit.modulate[1], blit.modulate[0]);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *) info->src;
+        Uint32 *dst = (Uint32 *) info->dst;
+        int n = info->dst_w;
+
+        while (n >= 4) {
+            const __m128i s = Swizzle8888_SSE2_Apply(_mm_loadu_si128((const __m128i *) src), &src_swz);
+            const __m128i d = blit.blend ? Swizzle8888_SSE2_Apply(_mm_loadu_si128((const __m128i *) dst), &dst_swz) : s;
+            _mm_storeu_si128((__m128i *) dst, Swizzle8888_SSE2_Apply(Blend8888x4_SSE2(s, d, modulate, &blit), &out_swz));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            *dst = Blit8888Pixel(*src, *dst, &blit);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* HAVE_SSE2_BLIT8888 */
+
+#if HAVE_SSSE3_BLIT8888
+static void SDL_TARGETING("ssse3")
+Blit8888to8888SSSE3(SDL_BlitInfo * info)
+{
+    Blit8888Info blit;
+    Uint8 mask[16];
+    Uint32 fill;
+    __m128i src_mask, src_fill, dst_mask, dst_fill, out_mask, out_fill;
+    __m128i modulate;
+
+    SetupBlit8888(info, &blit);
+    Blit8888ShuffleMask(mask, &fill, blit.src_shift, blit8888_canonical);
+    src_mask = _mm_loadu_si128((const __m128i *) mask);
+    src_fill = _mm_set1_epi32((int) fill);
+    Blit8888ShuffleMask(mask, &fill, blit.dst_shift, blit8888_canonical);
+    dst_mask = _mm_loadu_si128((const __m128i *) mask);
+    dst_fill = _mm_set1_epi32((int) fill);
+    Blit8888ShuffleMask(mask, &fill, blit8888_canonical, blit.dst_shift);
+    out_mask = _mm_loadu_si128((const __m128i *) mask);
+    out_fill = _mm_set1_epi32((int) fill);
+    modulate = _mm_set_epi16(blit.modulate[3], blit.modulate[2], blit.modulate[1], blit.modulate[0],
+                             blit.modulate[3], blit.modulate[2], blit.modulate[1], blit.modulate[0]);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *) info->src;
+        Uint32 *dst = (Uint32 *) info->dst;
+        int n = info->dst_w;
+
+        while (n >= 4) {
+            const __m128i s = _mm_or_si128(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) src), src_mask), src_fill);
+            const __m128i d = _mm_or_si128(_mm_shuffle_epi8(_mm_loadu_si128((const __m128i *) dst), dst_mask), dst_fill);
+            const __m128i out = Blend8888x4_SSE2(s, d, modulate, &blit);
+            _mm_storeu_si128((__m128i *) dst, _mm_or_si128(_mm_shuffle_epi8(out, out_mask), out_fill));
+            src += 4;
+            dst += 4;
+            n -= 4;
+        }
+        while (n--) {
+            *dst = Blit8888Pixel(*src, *dst, &blit);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* HAVE_SSSE3_BLIT8888 */
+
+#if HAVE_AVX2_BLIT8888
+static SDL_INLINE __m256i SDL_TARGETING("avx2")
+Div255_AVX2(__m256i x)
+{
+    x = _mm256_add_epi16(x, _mm256_add_epi16(_mm256_srli_epi16(x, 8), _mm256_set1_epi16(1)));
+    return _mm256_srli_epi16(x, 8);
+}
+
+static SDL_INLINE __m256i SDL_TARGETING("avx2")
+Blend8888_AVX2(__m256i s, __m256i d, __m256i modulate, const Blit8888Info * blit)
+{
+    const __m256i alphamask = _mm256_set_epi16(-1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0, -1, 0, 0, 0);
+    const __m256i full = _mm256_set1_epi16(255);
+    __m256i alpha;
+
+    if (blit->modulated) {
+        s = Div255_AVX2(_mm256_mullo_epi16(s, modulate));
+    }
+    switch (blit->blend) {
+    case SDL_COPY_BLEND:
+        alpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(s, 0xFF), 0xFF);
+        s = Div255_AVX2(_mm256_mullo_epi16(s, _mm256_blendv_epi8(alpha, full, alphamask)));
+        return _mm256_add_epi16(s, Div255_AVX2(_mm256_mullo_epi16(d, _mm256_sub_epi16(full, alpha))));
+    case SDL_COPY_ADD:
+        alpha = _mm256_shufflehi_epi16(_mm256_shufflelo_epi16(s, 0xFF), 0xFF);
+        s = _mm256_min_epi16(_mm256_add_epi16(Div255_AVX2(_mm256_mullo_epi16(s, alpha)), d), full);
+        return _mm256_blendv_epi8(s, d, alphamask);
+    case SDL_COPY_MOD:
+        s = Div255_AVX2(_mm256_mullo_epi16(s, d));
+        return _mm256_blendv_epi8(s, d, alphamask);
+    case 0:
+        return s;
+    default:
+        return d;
+    }
+}
+
+static void SDL_TARGETING("avx2")
+Blit8888to8888AVX2(SDL_BlitInfo * info)
+{
+    const __m256i zero = _mm256_setzero_si256();
+    Blit8888Info blit;
+    Uint8 mask[16];
+    Uint32 fill;
+    __m256i src_mask, src_fill, dst_mask, dst_fill, out_mask, out_fill;
+    __m256i modulate;
+
+    SetupBlit8888(info, &blit);
+    Blit8888ShuffleMask(mask, &fill, blit.src_shift, blit8888_canonical);
+    src_mask = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) mask));
+    src_fill = _mm256_set1_epi32((int) fill);
+    Blit8888ShuffleMask(mask, &fill, blit.dst_shift, blit8888_canonical);
+    dst_mask = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) mask));
+    dst_fill = _mm256_set1_epi32((int) fill);
+    Blit8888ShuffleMask(mask, &fill, blit8888_canonical, blit.dst_shift);
+    out_mask = _mm256_broadcastsi128_si256(_mm_loadu_si128((const __m128i *) mask));
+    out_fill = _mm256_set1_epi32((int) fill);
+    modulate = _mm256_set_epi16(blit.modulate[3], blit.modulate[2], blit.modulate[1], blit.modulate[0],
+                                blit.modulate[3], blit.modulate[2], blit.modulate[1], blit.modulate[0],
+                                blit.modulate[3], blit.modulate[2], blit.modulate[1], blit.modulate[0],
+                                blit.modulate[3], blit.modulate[2], blit.modulate[1], blit.modulate[0]);
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *) info->src;
+        Uint32 *dst = (Uint32 *) info->dst;
+        int n = info->dst_w;
+
+        while (n >= 8) {
+            const __m256i s = _mm256_or_si256(_mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *) src), src_mask), src_fill);
+            const __m256i d = _mm256_or_si256(_mm256_shuffle_epi8(_mm256_loadu_si256((const __m256i *) dst), dst_mask), dst_fill);
+            const __m256i lo = Blend8888_AVX2(_mm256_unpacklo_epi8(s, zero), _mm256_unpacklo_epi8(d, zero), modulate, &blit);
+            const __m256i hi = Blend8888_AVX2(_mm256_unpackhi_epi8(s, zero), _mm256_unpackhi_epi8(d, zero), modulate, &blit);
+            const __m256i out = _mm256_packus_epi16(lo, hi);
+            _mm256_storeu_si256((__m256i *) dst, _mm256_or_si256(_mm256_shuffle_epi8(out, out_mask), out_fill));
+            src += 8;
+            dst += 8;
+            n -= 8;
+        }
+        while (n--) {
+            *dst = Blit8888Pixel(*src, *dst, &blit);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* HAVE_AVX2_BLIT8888 */
+
+#if HAVE_NEON_BLIT8888
+/* Exact (a * b) / 255 */
+static SDL_INLINE uint8x16_t
+MulDiv255_NEON(uint8x16_t a, uint8x16_t b)
+{
+    const uint16x8_t one = vdupq_n_u16(1);
+    uint16x8_t lo = vmull_u8(vget_low_u8(a), vget_low_u8(b));
+    uint16x8_t hi = vmull_u8(vget_high_u8(a), vget_high_u8(b));
+
+    lo = vaddq_u16(vsraq_n_u16(lo, lo, 8), one);
+    hi = vaddq_u16(vsraq_n_u16(hi, hi, 8), one);
+    return vcombine_u8(vshrn_n_u16(lo, 8), vshrn_n_u16(hi, 8));
+}
+
+/* The de-interleaving loads and stores leave one vector per byte of the
+   pixels, so swizzling is just picking the right vector */
+static void
+Blit8888to8888NEON(SDL_BlitInfo * info)
+{
+    const uint8x16_t zero = vdupq_n_u8(0);
+    const uint8x16_t full = vdupq_n_u8(255);
+    Blit8888Info blit;
+    uint8x16_t modulate[4];
+    int i;
+
+    SetupBlit8888(info, &blit);
+    for (i = 0; i < 4; ++i) {
+        modulate[i] = vdupq_n_u8((Uint8) blit.modulate[i]);
+    }
+
+    while (info->dst_h--) {
+        Uint32 *src = (Uint32 *) info->src;
+        Uint32 *dst = (Uint32 *) info->dst;
+        int n = info->dst_w;
+
+        while (n >= 16) {
+            const uint8x16x4_t srcpixels = vld4q_u8((const Uint8 *) src);
+            uint8x16x4_t dstpixels = vld4q_u8((const Uint8 *) dst);
+            uint8x16_t s[4], d[4];
+
+            for (i = 0; i < 4; ++i) {
+                s[i] = (blit.src_shift[i] < 0) ? full : srcpixels.val[blit.src_shift[i] / 8];
+                d[i] = (blit.dst_shift[i] < 0) ? full : dstpixels.val[blit.dst_shift[i] / 8];
+                if (blit.modulated) {
+                    s[i] = MulDiv255_NEON(s[i], modulate[i]);
+                }
+            }
+            switch (blit.blend) {
+            case SDL_COPY_BLEND:
+                for (i = 0; i < 3; ++i) {
+                    d[i] = vaddq_u8(MulDiv255_NEON(s[i], s[3]), MulDiv255_NEON(d[i], vsubq_u8(full, s[3])));
+                }
+                d[3] = vaddq_u8(s[3], MulDiv255_NEON(d[3], vsubq_u8(full, s[3])));
+                break;
+            case SDL_COPY_ADD:
+                for (i = 0; i < 3; ++i) {
+                    d[i] = vqaddq_u8(MulDiv255_NEON(s[i], s[3]), d[i]);
+                }
+                break;
+            case SDL_COPY_MOD:
+                for (i = 0; i < 3; ++i) {
+                    d[i] = MulDiv255_NEON(s[i], d[i]);
+                }
+                break;
+            case 0:
+                for (i = 0; i < 4; ++i) {
+                    d[i] = s[i];
+                }
+                break;
+            }
+            for (i = 0; i < 4; ++i) {
+                dstpixels.val[i] = zero;
+            }
+            for (i = 0; i < 4; ++i) {
+                if (blit.dst_shift[i] >= 0) {
+                    dstpixels.val[blit.dst_shift[i] / 8] = d[i];
+                }
+            }
+            vst4q_u8((Uint8 *) dst, dstpixels);
+            src += 16;
+            dst += 16;
+            n -= 16;
+        }
+        while (n--) {
+            *dst = Blit8888Pixel(*src, *dst, &blit);
+            ++src;
+            ++dst;
+        }
+        info->src += info->src_pitch;
+        info->dst += info->dst_pitch;
+    }
+}
+#endif /* HAVE_NEON_BLIT8888 */
+
+#endif /* any vectorized 8888 blitter */
+
+#define BLIT8888_FLAGS \
+    (SDL_COPY_MODULATE_COLOR | SDL_COPY_MODULATE_ALPHA | SDL_COPY_BLEND | SDL_COPY_ADD | SDL_COPY_MOD)
+
+#define BLIT8888_ENTRIES_FROM(src, cpu, func) \
+    { src, SDL_PIXELFORMAT_RGB888, BLIT8888_FLAGS, cpu, func }, \
+    { src, SDL_PIXELFORMAT_BGR888, BLIT8888_FLAGS, cpu, func }, \
+    { src, SDL_PIXELFORMAT_ARGB8888, BLIT8888_FLAGS, cpu, func }, \
+    { src, SDL_PIXELFORMAT_RGBA8888, BLIT8888_FLAGS, cpu, func }, \
+    { src, SDL_PIXELFORMAT_ABGR8888, BLIT8888_FLAGS, cpu, func }, \
+    { src, SDL_PIXELFORMAT_BGRA8888, BLIT8888_FLAGS, cpu, func }
+
+#define BLIT8888_ENTRIES(cpu, func) \
+    BLIT8888_ENTRIES_FROM(SDL_PIXELFORMAT_RGB888, cpu, func), \
+    BLIT8888_ENTRIES_FROM(SDL_PIXELFORMAT_BGR888, cpu, func), \
+    BLIT8888_ENTRIES_FROM(SDL_PIXELFORMAT_ARGB8888, cpu, func), \
+    BLIT8888_ENTRIES_FROM(SDL_PIXELFORMAT_RGBA8888, cpu, func), \
+    BLIT8888_ENTRIES_FROM(SDL_PIXELFORMAT_ABGR8888, cpu, func), \
+    BLIT8888_ENTRIES_FROM(SDL_PIXELFORMAT_BGRA8888, cpu, func)
+
+/* Fastest first, SDL_ChooseBlitFunc() takes the first one the CPU supports */
+SDL_BlitFuncEntry SDL_SIMDBlitFuncTable[] = {
+#if HAVE_AVX2_BLIT8888
+    BLIT8888_ENTRIES(SDL_CPU_AVX2, Blit8888to8888AVX2),
+#endif
+#if HAVE_SSSE3_BLIT8888
+    BLIT8888_ENTRIES(SDL_CPU_SSSE3, Blit8888to8888SSSE3),
+#endif
+#if HAVE_SSE2_BLIT8888
+    BLIT8888_ENTRIES(SDL_CPU_SSE2, Blit8888to8888SSE2),
+#endif
+#if HAVE_NEON_BLIT8888
+    BLIT8888_ENTRIES(SDL_CPU_NEON, Blit8888to8888NEON),
+#endif
+    { 0, 0, 0, 0, NULL }
+};
+
 SDL_BlitFunc
 SDL_CalculateBlitA(SDL_Surface * surface)
 {
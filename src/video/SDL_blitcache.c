@@ -0,0 +1,298 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#include "SDL_atomic.h"
+#include "SDL_blit.h"
+
+/* Cache of what SDL_MapSurface() works out for a pair of formats, so that
+   blitting the same surface to different destinations doesn't redo it.
+
+   The blitter chosen for a pair of formats and flags never changes, so
+   those entries are kept until SDL_Quit(). Palette translation tables
+   are keyed by palette version, which is unique to the palette contents,
+   and are shared by every mapping that uses them. Tables that no mapping
+   uses any more are kept in case the same palettes come back, up to
+   MAX_UNUSED_BLIT_TABLES of them.
+*/
+#define BLIT_CACHE_BUCKETS      256
+#define MAX_UNUSED_BLIT_TABLES  32
+
+typedef struct SDL_BlitCacheFunc
+{
+    Uint32 src_format;
+    Uint32 dst_format;
+    int flags;
+    int identity;
+    SDL_BlitFunc func;
+    struct SDL_BlitCacheFunc *next;
+} SDL_BlitCacheFunc;
+
+static SDL_SpinLock blit_cache_lock;
+static SDL_BlitCacheFunc *blit_funcs[BLIT_CACHE_BUCKETS];
+static SDL_BlitTable *blit_tables[BLIT_CACHE_BUCKETS];
+static int num_unused_tables;
+static Uint32 blit_table_clock;
+static Uint64 blit_cache_hits;
+static Uint64 blit_cache_misses;
+
+static Uint32
+SDL_HashBlitFunc(Uint32 src_format, Uint32 dst_format, int flags, int identity)
+{
+    Uint32 hash = src_format;
+
+    hash = hash * 31 + dst_format;
+    hash = hash * 31 + (Uint32) flags;
+    hash = hash * 31 + (Uint32) identity;
+    return (hash ^ (hash >> 16)) % BLIT_CACHE_BUCKETS;
+}
+
+static Uint32
+SDL_HashBlitTable(const SDL_BlitTableKey * key)
+{
+    Uint32 hash = (Uint32) key->type;
+
+    hash = hash * 31 + key->src;
+    hash = hash * 31 + key->dst;
+    hash = hash * 31 + (Uint32) key->src_colors;
+    hash = hash * 31 + (Uint32) key->dst_colors;
+    hash = hash * 31 + key->mods;
+    return (hash ^ (hash >> 16)) % BLIT_CACHE_BUCKETS;
+}
+
+static SDL_bool
+SDL_BlitTableKeysEqual(const SDL_BlitTableKey * a, const SDL_BlitTableKey * b)
+{
+    return (a->type == b->type && a->src == b->src && a->dst == b->dst &&
+            a->src_colors == b->src_colors && a->dst_colors == b->dst_colors &&
+            a->mods == b->mods) ? SDL_TRUE : SDL_FALSE;
+}
+
+SDL_bool
+SDL_LookupBlitFunc(Uint32 src_format, Uint32 dst_format, int flags, int identity, SDL_BlitFunc * func)
+{
+    const Uint32 bucket = SDL_HashBlitFunc(src_format, dst_format, flags, identity);
+    SDL_BlitCacheFunc *entry;
+
+    SDL_AtomicLock(&blit_cache_lock);
+    for (entry = blit_funcs[bucket]; entry; entry = entry->next) {
+        if (entry->src_format == src_format && entry->dst_format == dst_format &&
+            entry->flags == flags && entry->identity == identity) {
+            *func = entry->func;
+            ++blit_cache_hits;
+            SDL_AtomicUnlock(&blit_cache_lock);
+            return SDL_TRUE;
+        }
+    }
+    ++blit_cache_misses;
+    SDL_AtomicUnlock(&blit_cache_lock);
+    return SDL_FALSE;
+}
+
+void
+SDL_CacheBlitFunc(Uint32 src_format, Uint32 dst_format, int flags, int identity, SDL_BlitFunc func)
+{
+    const Uint32 bucket = SDL_HashBlitFunc(src_format, dst_format, flags, identity);
+    SDL_BlitCacheFunc *entry, *added;
+
+    added = (SDL_BlitCacheFunc *) SDL_malloc(sizeof (*added));
+    if (!added) {
+        /* It'll just be worked out again next time */
+        return;
+    }
+    added->src_format = src_format;
+    added->dst_format = dst_format;
+    added->flags = flags;
+    added->identity = identity;
+    added->func = func;
+
+    SDL_AtomicLock(&blit_cache_lock);
+    for (entry = blit_funcs[bucket]; entry; entry = entry->next) {
+        if (entry->src_format == src_format && entry->dst_format == dst_format &&
+            entry->flags == flags && entry->identity == identity) {
+            break;
+        }
+    }
+    if (!entry) {
+        added->next = blit_funcs[bucket];
+        blit_funcs[bucket] = added;
+        added = NULL;
+    }
+    SDL_AtomicUnlock(&blit_cache_lock);
+
+    /* Another thread got there first */
+    SDL_free(added);
+}
+
+/* Must be called with the cache locked */
+static SDL_BlitTable *
+SDL_FindBlitTable(const SDL_BlitTableKey * key)
+{
+    SDL_BlitTable *table;
+
+    for (table = blit_tables[SDL_HashBlitTable(key)]; table; table = table->next) {
+        if (SDL_BlitTableKeysEqual(&table->key, key)) {
+            if (table->refcount++ == 0) {
+                --num_unused_tables;
+            }
+            return table;
+        }
+    }
+    return NULL;
+}
+
+SDL_BlitTable *
+SDL_AcquireBlitTable(const SDL_BlitTableKey * key)
+{
+    SDL_BlitTable *table;
+
+    SDL_AtomicLock(&blit_cache_lock);
+    table = SDL_FindBlitTable(key);
+    if (table) {
+        ++blit_cache_hits;
+    } else {
+        ++blit_cache_misses;
+    }
+    SDL_AtomicUnlock(&blit_cache_lock);
+    return table;
+}
+
+SDL_BlitTable *
+SDL_AddBlitTable(const SDL_BlitTableKey * key, Uint8 * data, int identical)
+{
+    SDL_BlitTable *table, *added;
+    Uint32 bucket;
+
+    added = (SDL_BlitTable *) SDL_malloc(sizeof (*added));
+    if (!added) {
+        return NULL;
+    }
+    added->key = *key;
+    added->table = data;
+    added->identical = identical;
+    added->refcount = 1;
+    added->last_used = 0;
+
+    SDL_AtomicLock(&blit_cache_lock);
+    table = SDL_FindBlitTable(key);
+    if (!table) {
+        bucket = SDL_HashBlitTable(key);
+        added->next = blit_tables[bucket];
+        blit_tables[bucket] = added;
+        table = added;
+        added = NULL;
+    }
+    SDL_AtomicUnlock(&blit_cache_lock);
+
+    /* Another thread got there first */
+    if (added) {
+        SDL_free(added->table);
+        SDL_free(added);
+    }
+    return table;
+}
+
+/* Must be called with the cache locked */
+static SDL_BlitTable *
+SDL_RemoveOldestUnusedTable(void)
+{
+    SDL_BlitTable **link, **oldest = NULL;
+    SDL_BlitTable *table;
+    int i;
+
+    for (i = 0; i < BLIT_CACHE_BUCKETS; ++i) {
+        for (link = &blit_tables[i]; *link; link = &(*link)->next) {
+            if ((*link)->refcount == 0 &&
+                (!oldest || (blit_table_clock - (*link)->last_used) > (blit_table_clock - (*oldest)->last_used))) {
+                oldest = link;
+            }
+        }
+    }
+    if (!oldest) {
+        return NULL;
+    }
+    table = *oldest;
+    *oldest = table->next;
+    --num_unused_tables;
+    return table;
+}
+
+void
+SDL_ReleaseBlitTable(SDL_BlitTable * table)
+{
+    SDL_BlitTable *removed = NULL;
+
+    if (!table) {
+        return;
+    }
+
+    SDL_AtomicLock(&blit_cache_lock);
+    if (--table->refcount == 0) {
+        table->last_used = ++blit_table_clock;
+        if (++num_unused_tables > MAX_UNUSED_BLIT_TABLES) {
+            removed = SDL_RemoveOldestUnusedTable();
+        }
+    }
+    SDL_AtomicUnlock(&blit_cache_lock);
+
+    if (removed) {
+        SDL_free(removed->table);
+        SDL_free(removed);
+    }
+}
+
+void
+SDL_QuitBlitCache(void)
+{
+    SDL_BlitCacheFunc *entry;
+    SDL_BlitTable *table;
+    int i;
+
+    /* Tables still in use by surfaces that are still around stay put */
+    SDL_AtomicLock(&blit_cache_lock);
+    for (i = 0; i < BLIT_CACHE_BUCKETS; ++i) {
+        while (blit_funcs[i]) {
+            entry = blit_funcs[i];
+            blit_funcs[i] = entry->next;
+            SDL_free(entry);
+        }
+    }
+    while ((table = SDL_RemoveOldestUnusedTable()) != NULL) {
+        SDL_free(table->table);
+        SDL_free(table);
+    }
+    SDL_AtomicUnlock(&blit_cache_lock);
+}
+
+void
+SDL_GetBlitCacheStats(Uint64 * hits, Uint64 * misses)
+{
+    SDL_AtomicLock(&blit_cache_lock);
+    if (hits) {
+        *hits = blit_cache_hits;
+    }
+    if (misses) {
+        *misses = blit_cache_misses;
+    }
+    SDL_AtomicUnlock(&blit_cache_lock);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
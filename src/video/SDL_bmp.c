@@ -98,6 +98,8 @@ SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
     SDL_Palette *palette;
     Uint8 *bits;
     Uint8 *top, *end;
+    const Uint8 *view, *view_start;
+    size_t view_size;
     SDL_bool topDown;
     int ExpandBMP;
     SDL_bool haveRGBMasks = SDL_FALSE;
@@ -369,6 +371,7 @@ SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
         pad = (((bmpPitch) % 4) ? (4 - ((bmpPitch) % 4)) : 0);
         break;
     default:
+        bmpPitch = surface->pitch;
         pad = ((surface->pitch % 4) ? (4 - (surface->pitch % 4)) : 0);
         break;
     }
@@ -377,6 +380,14 @@ SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
     } else {
         bits = end - surface->pitch;
     }
+
+    /* If the pixels are already in memory, decode them from there */
+    view = view_start = (const Uint8 *) SDL_RWGetView(src, &view_size);
+    if (view && (surface->h <= 0 ||
+                 view_size / surface->h < (size_t) (bmpPitch + pad))) {
+        view = NULL;
+    }
+
     while (bits >= top && bits < end) {
         switch (ExpandBMP) {
         case 1:
@@ -385,7 +396,9 @@ SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
                 int shift = (8 - ExpandBMP);
                 for (i = 0; i < surface->w; ++i) {
                     if (i % (8 / ExpandBMP) == 0) {
-                        if (!SDL_RWread(src, &pixel, 1, 1)) {
+                        if (view) {
+                            pixel = *view++;
+                        } else if (!SDL_RWread(src, &pixel, 1, 1)) {
                             SDL_SetError("Error reading from BMP");
                             was_error = SDL_TRUE;
                             goto done;
@@ -398,7 +411,10 @@ SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
             break;
 
         default:
-            if (SDL_RWread(src, bits, 1, surface->pitch)
+            if (view) {
+                SDL_memcpy(bits, view, surface->pitch);
+                view += surface->pitch;
+            } else if (SDL_RWread(src, bits, 1, surface->pitch)
                 != surface->pitch) {
                 SDL_Error(SDL_EFREAD);
                 was_error = SDL_TRUE;
@@ -427,7 +443,9 @@ SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
             break;
         }
         /* Skip padding bytes, ugh */
-        if (pad) {
+        if (view) {
+            view += pad;
+        } else if (pad) {
             Uint8 padbyte;
             for (i = 0; i < pad; ++i) {
                 SDL_RWread(src, &padbyte, 1, 1);
@@ -439,6 +457,9 @@ SDL_LoadBMP_RW(SDL_RWops * src, int freesrc)
             bits -= surface->pitch;
         }
     }
+    if (view) {
+        SDL_RWseek(src, view - view_start, RW_SEEK_CUR);
+    }
     if (correctAlpha) {
         CorrectAlphaChannel(surface);
     }
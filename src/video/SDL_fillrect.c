@@ -22,117 +22,114 @@
 
 #include "SDL_video.h"
 #include "SDL_blit.h"
+#include "SDL_rowjob_c.h"
 
 
-#ifdef __SSE__
-/* *INDENT-OFF* */
+/* Long enough to hold the first bytes of a row plus a full cycle of
+   vectors, starting at any byte of a pixel */
+#define FILL_PATTERN_SIZE   128
 
-#ifdef _MSC_VER
-#define SSE_BEGIN \
-    __m128 c128; \
-    c128.m128_u32[0] = color; \
-    c128.m128_u32[1] = color; \
-    c128.m128_u32[2] = color; \
-    c128.m128_u32[3] = color;
-#else
-#define SSE_BEGIN \
-    __m128 c128; \
-    DECLARE_ALIGNED(Uint32, cccc[4], 16); \
-    cccc[0] = color; \
-    cccc[1] = color; \
-    cccc[2] = color; \
-    cccc[3] = color; \
-    c128 = *(__m128 *)cccc;
-#endif
+typedef struct
+{
+    int bpp;
+    Uint32 color;       /* Replicated to 32 bits for 1 and 2 bytes per pixel */
+    Uint8 pattern[FILL_PATTERN_SIZE];   /* The pixel repeated in memory order */
+} SDL_FillColor;
 
-#define SSE_WORK \
-    for (i = n / 64; i--;) { \
-        _mm_stream_ps((float *)(p+0), c128); \
-        _mm_stream_ps((float *)(p+16), c128); \
-        _mm_stream_ps((float *)(p+32), c128); \
-        _mm_stream_ps((float *)(p+48), c128); \
-        p += 64; \
-    }
+/* Each fill kernel fills 'h' rows of 'w' pixels starting at 'pixels' */
+typedef void (*SDL_FillRectFunc) (Uint8 * pixels, int pitch, const SDL_FillColor * fill, int w, int h);
+
+/* Fills larger than this go around the cache with non-temporal stores,
+   since they would only push everything else out of it */
+#define FILL_STREAMING_THRESHOLD    (8 * 1024 * 1024)
+
+/* Fills larger than this are split across SDL_HINT_SURFACE_THREADS */
+#define FILL_THREADING_THRESHOLD    (256 * 1024)
+#define FILL_MIN_BAND_HEIGHT        16
 
-#define SSE_END
+/* How many rects SDL_FillRects() clips at a time */
+#define FILL_RECT_BATCH             64
 
-#define DEFINE_SSE_FILLRECT(bpp, type) \
-static void \
-SDL_FillRect##bpp##SSE(Uint8 *pixels, int pitch, Uint32 color, int w, int h) \
+#if HAVE_AVX_INTRINSICS
+#define HAVE_AVX_FILLRECT 1
+#include <immintrin.h>
+#endif
+
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define HAVE_NEON_FILLRECT 1
+#include <arm_neon.h>
+#endif
+
+/* The vector kernels handle every pixel size the same way. Rows start
+   with bytes from the pattern up to a vector boundary, then store a
+   cycle of three vectors. Three vectors of 16 or 32 bytes hold a whole
+   number of pixels of any size, so the cycle can be loaded once per row
+   from the pattern, at the offset of the first aligned pixel byte.
+   Whatever is left over at the end of a row is a prefix of that cycle.
+   'target' is the SDL_TARGETING() the kernel needs, if any. */
+/* *INDENT-OFF* */
+#define DEFINE_FILLRECT_VECTOR(name, target, vtype, size, load, store, done) \
+static void target \
+name(Uint8 * pixels, int pitch, const SDL_FillColor * fill, int w, int h) \
 { \
-    int i, n; \
-    Uint8 *p = NULL; \
- \
-    SSE_BEGIN; \
+    const int row = w * fill->bpp; \
  \
     while (h--) { \
-        n = w * bpp; \
-        p = pixels; \
+        Uint8 *p = pixels; \
+        int n = row; \
  \
-        if (n > 63) { \
-            int adjust = 16 - ((uintptr_t)p & 15); \
-            if (adjust < 16) { \
-                n -= adjust; \
-                adjust /= bpp; \
-                while (adjust--) { \
-                    *((type *)p) = (type)color; \
-                    p += bpp; \
-                } \
-            } \
-            SSE_WORK; \
-        } \
-        if (n & 63) { \
-            int remainder = (n & 63); \
-            remainder /= bpp; \
-            while (remainder--) { \
-                *((type *)p) = (type)color; \
-                p += bpp; \
+        if (n < 4 * size) { \
+            SDL_memcpy(p, fill->pattern, n); \
+        } else { \
+            const int head = (int) ((size - ((uintptr_t) p & (size - 1))) & (size - 1)); \
+            const Uint8 *cycle = fill->pattern + (head % fill->bpp); \
+            const vtype v0 = load(cycle); \
+            const vtype v1 = load(cycle + size); \
+            const vtype v2 = load(cycle + 2 * size); \
+ \
+            SDL_memcpy(p, fill->pattern, head); \
+            p += head; \
+            n -= head; \
+            for ( ; n >= 3 * size; n -= 3 * size) { \
+                store(p, v0); \
+                store(p + size, v1); \
+                store(p + 2 * size, v2); \
+                p += 3 * size; \
             } \
+            SDL_memcpy(p, cycle, n); \
         } \
         pixels += pitch; \
     } \
- \
-    SSE_END; \
+    done; \
 }
 
-static void
-SDL_FillRect1SSE(Uint8 *pixels, int pitch, Uint32 color, int w, int h)
-{
-    int i, n;
-
-    SSE_BEGIN;
-    while (h--) {
-        Uint8 *p = pixels;
-        n = w;
-
-        if (n > 63) {
-            int adjust = 16 - ((uintptr_t)p & 15);
-            if (adjust) {
-                n -= adjust;
-                SDL_memset(p, color, adjust);
-                p += adjust;
-            }
-            SSE_WORK;
-        }
-        if (n & 63) {
-            int remainder = (n & 63);
-            SDL_memset(p, color, remainder);
-        }
-        pixels += pitch;
-    }
-
-    SSE_END;
-}
-/* DEFINE_SSE_FILLRECT(1, Uint8) */
-DEFINE_SSE_FILLRECT(2, Uint16)
-DEFINE_SSE_FILLRECT(4, Uint32)
+#ifdef __SSE__
+#define SSE_LOAD(p)         _mm_loadu_ps((const float *) (p))
+#define SSE_STORE(p, v)     _mm_store_ps((float *) (p), v)
+#define SSE_STREAM(p, v)    _mm_stream_ps((float *) (p), v)
+DEFINE_FILLRECT_VECTOR(SDL_FillRectSSE, , __m128, 16, SSE_LOAD, SSE_STORE, (void) 0)
+DEFINE_FILLRECT_VECTOR(SDL_FillRectSSEStream, , __m128, 16, SSE_LOAD, SSE_STREAM, _mm_sfence())
+#endif /* __SSE__ */
 
+#if HAVE_AVX_FILLRECT
+#define AVX_LOAD(p)         _mm256_loadu_si256((const __m256i *) (p))
+#define AVX_STORE(p, v)     _mm256_store_si256((__m256i *) (p), v)
+#define AVX_STREAM(p, v)    _mm256_stream_si256((__m256i *) (p), v)
+DEFINE_FILLRECT_VECTOR(SDL_FillRectAVX, SDL_TARGETING("avx"), __m256i, 32, AVX_LOAD, AVX_STORE, (void) 0)
+DEFINE_FILLRECT_VECTOR(SDL_FillRectAVXStream, SDL_TARGETING("avx"), __m256i, 32, AVX_LOAD, AVX_STREAM, _mm_sfence())
+#endif /* HAVE_AVX_FILLRECT */
+
+#if HAVE_NEON_FILLRECT
+#define NEON_LOAD(p)        vld1q_u8(p)
+#define NEON_STORE(p, v)    vst1q_u8(p, v)
+DEFINE_FILLRECT_VECTOR(SDL_FillRectNEON, , uint8x16_t, 16, NEON_LOAD, NEON_STORE, (void) 0)
+#endif /* HAVE_NEON_FILLRECT */
 /* *INDENT-ON* */
-#endif /* __SSE__ */
 
 static void
-SDL_FillRect1(Uint8 * pixels, int pitch, Uint32 color, int w, int h)
+SDL_FillRect1(Uint8 * pixels, int pitch, const SDL_FillColor * fill, int w, int h)
 {
+    const Uint32 color = fill->color;
     int n;
     Uint8 *p = NULL;
     
@@ -170,8 +167,9 @@ SDL_FillRect1(Uint8 * pixels, int pitch, Uint32 color, int w, int h)
 }
 
 static void
-SDL_FillRect2(Uint8 * pixels, int pitch, Uint32 color, int w, int h)
+SDL_FillRect2(Uint8 * pixels, int pitch, const SDL_FillColor * fill, int w, int h)
 {
+    const Uint32 color = fill->color;
     int n;
     Uint16 *p = NULL;
     
@@ -194,50 +192,163 @@ SDL_FillRect2(Uint8 * pixels, int pitch, Uint32 color, int w, int h)
 }
 
 static void
-SDL_FillRect3(Uint8 * pixels, int pitch, Uint32 color, int w, int h)
+SDL_FillRect3(Uint8 * pixels, int pitch, const SDL_FillColor * fill, int w, int h)
 {
-#if SDL_BYTEORDER == SDL_LIL_ENDIAN
-    Uint8 b1 = (Uint8) (color & 0xFF);
-    Uint8 b2 = (Uint8) ((color >> 8) & 0xFF);
-    Uint8 b3 = (Uint8) ((color >> 16) & 0xFF);
-#elif SDL_BYTEORDER == SDL_BIG_ENDIAN
-    Uint8 b1 = (Uint8) ((color >> 16) & 0xFF);
-    Uint8 b2 = (Uint8) ((color >> 8) & 0xFF);
-    Uint8 b3 = (Uint8) (color & 0xFF);
-#endif
+    /* The largest whole number of pixels the pattern holds */
+    const int chunk = (FILL_PATTERN_SIZE / 3) * 3;
     int n;
     Uint8 *p = NULL;
 
     while (h--) {
-        n = w;
+        n = w * 3;
         p = pixels;
 
-        while (n--) {
-            *p++ = b1;
-            *p++ = b2;
-            *p++ = b3;
+        while (n > chunk) {
+            SDL_memcpy(p, fill->pattern, chunk);
+            p += chunk;
+            n -= chunk;
         }
+        SDL_memcpy(p, fill->pattern, n);
         pixels += pitch;
     }
 }
 
 static void
-SDL_FillRect4(Uint8 * pixels, int pitch, Uint32 color, int w, int h)
+SDL_FillRect4(Uint8 * pixels, int pitch, const SDL_FillColor * fill, int w, int h)
 {
     while (h--) {
-        SDL_memset4(pixels, color, w);
+        SDL_memset4(pixels, fill->color, w);
         pixels += pitch;
     }
 }
 
+static void
+SDL_SetupFillColor(SDL_FillColor * fill, int bpp, Uint32 color)
+{
+    Uint8 *p = fill->pattern;
+    int i;
+
+    fill->bpp = bpp;
+    switch (bpp) {
+    case 1:
+        color &= 0xFF;
+        color |= (color << 8);
+        color |= (color << 16);
+        SDL_memset(p, (Uint8) color, FILL_PATTERN_SIZE);
+        break;
+    case 2:
+        color &= 0xFFFF;
+        color |= (color << 16);
+        for (i = 0; i < FILL_PATTERN_SIZE; i += 2) {
+            *(Uint16 *) (p + i) = (Uint16) color;
+        }
+        break;
+    case 3:
+        for (i = 0; i + 3 <= FILL_PATTERN_SIZE; i += 3) {
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+            p[i] = (Uint8) (color & 0xFF);
+            p[i + 1] = (Uint8) ((color >> 8) & 0xFF);
+            p[i + 2] = (Uint8) ((color >> 16) & 0xFF);
+#else
+            p[i] = (Uint8) ((color >> 16) & 0xFF);
+            p[i + 1] = (Uint8) ((color >> 8) & 0xFF);
+            p[i + 2] = (Uint8) (color & 0xFF);
+#endif
+        }
+        break;
+    default:
+        for (i = 0; i < FILL_PATTERN_SIZE; i += 4) {
+            *(Uint32 *) (p + i) = color;
+        }
+        break;
+    }
+    fill->color = color;
+}
+
+static SDL_FillRectFunc
+SDL_ChooseFillRect(int bpp, SDL_bool stream)
+{
+#if HAVE_AVX_FILLRECT
+    if (SDL_HasAVX()) {
+        return stream ? SDL_FillRectAVXStream : SDL_FillRectAVX;
+    }
+#endif
+#ifdef __SSE__
+    if (SDL_HasSSE()) {
+        return stream ? SDL_FillRectSSEStream : SDL_FillRectSSE;
+    }
+#endif
+#if HAVE_NEON_FILLRECT
+    return SDL_FillRectNEON;
+#endif
+
+    switch (bpp) {
+    case 1:
+        return SDL_FillRect1;
+    case 2:
+        return SDL_FillRect2;
+    case 3:
+        return SDL_FillRect3;
+    default:
+        return SDL_FillRect4;
+    }
+}
+
+/* A batch of clipped rects, filled together one band of rows at a time */
+typedef struct
+{
+    SDL_Surface *dst;
+    const SDL_Rect *rects;
+    int count;
+    int top;
+    SDL_FillRectFunc func;
+    const SDL_FillColor *fill;
+} SDL_FillRectJob;
+
+static void
+SDL_FillRectRows(void *userdata, int y, int h)
+{
+    const SDL_FillRectJob *job = (const SDL_FillRectJob *) userdata;
+    const SDL_Surface *dst = job->dst;
+    const int top = job->top + y;
+    const int bottom = top + h;
+    int i, y0, y1;
+
+    for (i = 0; i < job->count; ++i) {
+        const SDL_Rect *rect = &job->rects[i];
+
+        y0 = SDL_max(rect->y, top);
+        y1 = SDL_min(rect->y + rect->h, bottom);
+        if (y0 < y1) {
+            job->func((Uint8 *) dst->pixels + y0 * dst->pitch + rect->x * job->fill->bpp,
+                      dst->pitch, job->fill, rect->w, y1 - y0);
+        }
+    }
+}
+
 /* 
  * This function performs a fast fill of the given rectangle with 'color'
  */
 int
 SDL_FillRect(SDL_Surface * dst, const SDL_Rect * rect, Uint32 color)
 {
-    SDL_Rect clipped;
-    Uint8 *pixels;
+    if (!dst) {
+        return SDL_SetError("Passed NULL destination surface");
+    }
+
+    /* If 'rect' == NULL, then fill the whole surface */
+    return SDL_FillRects(dst, rect ? rect : &dst->clip_rect, 1, color);
+}
+
+int
+SDL_FillRects(SDL_Surface * dst, const SDL_Rect * rects, int count,
+              Uint32 color)
+{
+    SDL_Rect clipped[FILL_RECT_BATCH];
+    SDL_FillColor fill;
+    SDL_FillRectJob job;
+    size_t size;
+    int i, bottom;
 
     if (!dst) {
         return SDL_SetError("Passed NULL destination surface");
@@ -248,74 +359,45 @@ SDL_FillRect(SDL_Surface * dst, const SDL_Rect * rect, Uint32 color)
         return SDL_SetError("SDL_FillRect(): Unsupported surface format");
     }
 
-    /* If 'rect' == NULL, then fill the whole surface */
-    if (rect) {
-        /* Perform clipping */
-        if (!SDL_IntersectRect(rect, &dst->clip_rect, &clipped)) {
-            return 0;
-        }
-        rect = &clipped;
-    } else {
-        rect = &dst->clip_rect;
-        /* Don't attempt to fill if the surface's clip_rect is empty */
-        if (SDL_RectEmpty(rect)) {
-            return 0;
-        }
-    }
-
-    /* Perform software fill */
-    if (!dst->pixels) {
-        return SDL_SetError("SDL_FillRect(): You must lock the surface");
+    if (!rects) {
+        return SDL_SetError("SDL_FillRects() passed NULL rects");
     }
 
-    pixels = (Uint8 *) dst->pixels + rect->y * dst->pitch +
-                                     rect->x * dst->format->BytesPerPixel;
-
-    switch (dst->format->BytesPerPixel) {
-    case 1:
-        {
-            color |= (color << 8);
-            color |= (color << 16);
-#ifdef __SSE__
-            if (SDL_HasSSE()) {
-                SDL_FillRect1SSE(pixels, dst->pitch, color, rect->w, rect->h);
-                break;
+    SDL_SetupFillColor(&fill, dst->format->BytesPerPixel, color);
+    job.dst = dst;
+    job.rects = clipped;
+    job.fill = &fill;
+
+    for (i = 0; i < count; ) {
+        /* Perform clipping, skipping rects that end up empty */
+        job.count = 0;
+        job.top = dst->h;
+        bottom = 0;
+        size = 0;
+        for ( ; i < count && job.count < FILL_RECT_BATCH; ++i) {
+            SDL_Rect *rect = &clipped[job.count];
+
+            if (SDL_IntersectRect(&rects[i], &dst->clip_rect, rect)) {
+                job.top = SDL_min(job.top, rect->y);
+                bottom = SDL_max(bottom, rect->y + rect->h);
+                size += (size_t) rect->w * rect->h * fill.bpp;
+                ++job.count;
             }
-#endif
-            SDL_FillRect1(pixels, dst->pitch, color, rect->w, rect->h);
-            break;
         }
-
-    case 2:
-        {
-            color |= (color << 16);
-#ifdef __SSE__
-            if (SDL_HasSSE()) {
-                SDL_FillRect2SSE(pixels, dst->pitch, color, rect->w, rect->h);
-                break;
-            }
-#endif
-            SDL_FillRect2(pixels, dst->pitch, color, rect->w, rect->h);
-            break;
+        if (!job.count) {
+            continue;
         }
 
-    case 3:
-        /* 24-bit RGB is a slow path, at least for now. */
-        {
-            SDL_FillRect3(pixels, dst->pitch, color, rect->w, rect->h);
-            break;
+        /* Perform software fill */
+        if (!dst->pixels) {
+            return SDL_SetError("SDL_FillRect(): You must lock the surface");
         }
 
-    case 4:
-        {
-#ifdef __SSE__
-            if (SDL_HasSSE()) {
-                SDL_FillRect4SSE(pixels, dst->pitch, color, rect->w, rect->h);
-                break;
-            }
-#endif
-            SDL_FillRect4(pixels, dst->pitch, color, rect->w, rect->h);
-            break;
+        job.func = SDL_ChooseFillRect(fill.bpp, (size > FILL_STREAMING_THRESHOLD));
+        if (size > FILL_THREADING_THRESHOLD) {
+            SDL_RunRowJob(SDL_FillRectRows, &job, bottom - job.top, FILL_MIN_BAND_HEIGHT);
+        } else {
+            SDL_FillRectRows(&job, 0, bottom - job.top);
         }
     }
 
@@ -323,21 +405,4 @@ SDL_FillRect(SDL_Surface * dst, const SDL_Rect * rect, Uint32 color)
     return 0;
 }
 
-int
-SDL_FillRects(SDL_Surface * dst, const SDL_Rect * rects, int count,
-              Uint32 color)
-{
-    int i;
-    int status = 0;
-
-    if (!rects) {
-        return SDL_SetError("SDL_FillRects() passed NULL rects");
-    }
-
-    for (i = 0; i < count; ++i) {
-        status += SDL_FillRect(dst, &rects[i], color);
-    }
-    return status;
-}
-
 /* vi: set ts=4 sw=4 expandtab: */
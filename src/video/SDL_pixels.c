@@ -22,6 +22,7 @@
 
 /* General (mostly internal) pixel/color manipulation routines for SDL */
 
+#include "SDL_atomic.h"
 #include "SDL_endian.h"
 #include "SDL_video.h"
 #include "SDL_sysvideo.h"
@@ -613,6 +614,21 @@ SDL_FreeFormat(SDL_PixelFormat *format)
     SDL_free(format);
 }
 
+/* Palette versions all come from one counter, so a version is only ever
+   used for one set of colors, and blit tables can be shared by version */
+static SDL_atomic_t SDL_palette_version;
+
+static Uint32
+SDL_NextPaletteVersion(void)
+{
+    Uint32 version;
+
+    do {
+        version = (Uint32) SDL_AtomicAdd(&SDL_palette_version, 1) + 1;
+    } while (!version);
+    return version;
+}
+
 SDL_Palette *
 SDL_AllocPalette(int ncolors)
 {
@@ -636,7 +652,7 @@ SDL_AllocPalette(int ncolors)
         return NULL;
     }
     palette->ncolors = ncolors;
-    palette->version = 1;
+    palette->version = SDL_NextPaletteVersion();
     palette->refcount = 1;
 
     SDL_memset(palette->colors, 0xFF, ncolors * sizeof(*palette->colors));
@@ -691,10 +707,7 @@ SDL_SetPaletteColors(SDL_Palette * palette, const SDL_Color * colors,
         SDL_memcpy(palette->colors + firstcolor, colors,
                    ncolors * sizeof(*colors));
     }
-    ++palette->version;
-    if (!palette->version) {
-        palette->version = 1;
-    }
+    palette->version = SDL_NextPaletteVersion();
 
     return status;
 }
@@ -985,8 +998,77 @@ SDL_InvalidateMap(SDL_BlitMap * map)
     map->dst = NULL;
     map->src_palette_version = 0;
     map->dst_palette_version = 0;
-    SDL_free(map->info.table);
+    SDL_ReleaseBlitTable(map->table);
+    map->table = NULL;
     map->info.table = NULL;
+    SDL_ReleaseStretchFilters(map->filters);
+    map->filters = NULL;
+    if (map->filtered) {
+        SDL_FreeSurface(map->filtered);
+        map->filtered = NULL;
+    }
+}
+
+/* Finds or builds the palette translation table for a mapping, sharing it
+   with every other mapping between the same palettes and formats */
+static int
+SDL_MapTable(SDL_BlitMap * map, SDL_BlitTableType type,
+             SDL_PixelFormat * srcfmt, SDL_PixelFormat * dstfmt)
+{
+    SDL_BlitTableKey key;
+    SDL_BlitTable *table;
+    Uint8 *data = NULL;
+    int identical = 0;
+
+    SDL_zero(key);
+    key.type = type;
+    if (srcfmt->palette) {
+        key.src = srcfmt->palette->version;
+        key.src_colors = srcfmt->palette->ncolors;
+    } else {
+        key.src = srcfmt->format;
+    }
+    if (dstfmt->palette) {
+        key.dst = dstfmt->palette->version;
+        key.dst_colors = dstfmt->palette->ncolors;
+    } else {
+        key.dst = dstfmt->format;
+    }
+    if (type == SDL_BLIT_TABLE_1TON) {
+        key.mods = ((Uint32) map->info.r << 24) | ((Uint32) map->info.g << 16) |
+                   ((Uint32) map->info.b << 8) | map->info.a;
+    } else if (type == SDL_BLIT_TABLE_NTO1) {
+        /* RGB to palette only depends on the destination palette */
+        key.src = 0;
+    }
+
+    table = SDL_AcquireBlitTable(&key);
+    if (!table) {
+        switch (type) {
+        case SDL_BLIT_TABLE_1TO1:
+            data = Map1to1(srcfmt->palette, dstfmt->palette, &identical);
+            break;
+        case SDL_BLIT_TABLE_1TON:
+            data = Map1toN(srcfmt, map->info.r, map->info.g, map->info.b, map->info.a, dstfmt);
+            break;
+        case SDL_BLIT_TABLE_NTO1:
+            data = MapNto1(srcfmt, dstfmt, &identical);
+            break;
+        }
+        if (data == NULL && !identical) {
+            return (-1);
+        }
+        table = SDL_AddBlitTable(&key, data, identical);
+        if (table == NULL) {
+            SDL_free(data);
+            return SDL_OutOfMemory();
+        }
+    }
+
+    map->table = table;
+    map->info.table = table->table;
+    map->identity = table->identical;
+    return (0);
 }
 
 int
@@ -1010,32 +1092,22 @@ SDL_MapSurface(SDL_Surface * src, SDL_Surface * dst)
     if (SDL_ISPIXELFORMAT_INDEXED(srcfmt->format)) {
         if (SDL_ISPIXELFORMAT_INDEXED(dstfmt->format)) {
             /* Palette --> Palette */
-            map->info.table =
-                Map1to1(srcfmt->palette, dstfmt->palette, &map->identity);
-            if (!map->identity) {
-                if (map->info.table == NULL) {
-                    return (-1);
-                }
+            if (SDL_MapTable(map, SDL_BLIT_TABLE_1TO1, srcfmt, dstfmt) < 0) {
+                return (-1);
             }
             if (srcfmt->BitsPerPixel != dstfmt->BitsPerPixel)
                 map->identity = 0;
         } else {
             /* Palette --> BitField */
-            map->info.table =
-                Map1toN(srcfmt, src->map->info.r, src->map->info.g,
-                        src->map->info.b, src->map->info.a, dstfmt);
-            if (map->info.table == NULL) {
+            if (SDL_MapTable(map, SDL_BLIT_TABLE_1TON, srcfmt, dstfmt) < 0) {
                 return (-1);
             }
         }
     } else {
         if (SDL_ISPIXELFORMAT_INDEXED(dstfmt->format)) {
             /* BitField --> Palette */
-            map->info.table = MapNto1(srcfmt, dstfmt, &map->identity);
-            if (!map->identity) {
-                if (map->info.table == NULL) {
-                    return (-1);
-                }
+            if (SDL_MapTable(map, SDL_BLIT_TABLE_NTO1, srcfmt, dstfmt) < 0) {
+                return (-1);
             }
             map->identity = 0;  /* Don't optimize to copy */
         } else {
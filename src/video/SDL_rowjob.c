@@ -0,0 +1,216 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#include "SDL_atomic.h"
+#include "SDL_hints.h"
+#include "SDL_mutex.h"
+#include "SDL_thread.h"
+#include "SDL_rowjob_c.h"
+#include "../thread/SDL_systhread.h"
+
+/* Bands are small enough that each thread gets a few of them, so a thread
+   that gets held up doesn't hold up the whole job */
+#define ROW_JOB_BANDS_PER_THREAD    4
+
+typedef struct
+{
+    SDL_RowJobFunc func;
+    void *userdata;
+    int num_rows;
+    int band_height, num_bands;
+    SDL_atomic_t next_band;
+} SDL_RowJob;
+
+static SDL_SpinLock row_job_lock;
+static SDL_mutex *row_job_mutex;    /* Held by the thread using the pool */
+static SDL_RowJob *row_job;         /* The job the pool is working on */
+static int row_job_wanted;          /* Most threads a job has asked for */
+static int row_job_num_threads;     /* Pool threads, not counting the caller */
+static SDL_Thread **row_job_threads;
+static SDL_sem *row_job_work_sem;
+static SDL_sem *row_job_done_sem;
+static SDL_bool row_job_quit;
+
+static void
+SDL_RunRowBands(SDL_RowJob * job)
+{
+    int n, y;
+
+    while ((n = SDL_AtomicAdd(&job->next_band, 1)) < job->num_bands) {
+        y = n * job->band_height;
+        job->func(job->userdata, y, SDL_min(job->band_height, job->num_rows - y));
+    }
+}
+
+static int SDLCALL
+SDL_RowJobThread(void *arg)
+{
+    for ( ; ; ) {
+        SDL_SemWait(row_job_work_sem);
+        if (row_job_quit) {
+            break;
+        }
+        SDL_RunRowBands(row_job);
+        SDL_SemPost(row_job_done_sem);
+    }
+    return 0;
+}
+
+static void
+SDL_StopRowJobThreads(void)
+{
+    int i;
+
+    row_job_quit = SDL_TRUE;
+    for (i = 0; i < row_job_num_threads; ++i) {
+        SDL_SemPost(row_job_work_sem);
+    }
+    for (i = 0; i < row_job_num_threads; ++i) {
+        SDL_WaitThread(row_job_threads[i], NULL);
+    }
+    row_job_num_threads = 0;
+    row_job_quit = SDL_FALSE;
+
+    SDL_free(row_job_threads);
+    row_job_threads = NULL;
+    if (row_job_work_sem) {
+        SDL_DestroySemaphore(row_job_work_sem);
+        row_job_work_sem = NULL;
+    }
+    if (row_job_done_sem) {
+        SDL_DestroySemaphore(row_job_done_sem);
+        row_job_done_sem = NULL;
+    }
+}
+
+static void
+SDL_StartRowJobThreads(int num_threads)
+{
+    int i;
+
+    row_job_work_sem = SDL_CreateSemaphore(0);
+    row_job_done_sem = SDL_CreateSemaphore(0);
+    row_job_threads = (SDL_Thread **) SDL_calloc(num_threads, sizeof (*row_job_threads));
+    if (!row_job_work_sem || !row_job_done_sem || !row_job_threads) {
+        return;
+    }
+
+    for (i = 0; i < num_threads; ++i) {
+        char name[64];
+        SDL_snprintf(name, sizeof (name), "SDLSurfaceThread%d", i);
+        row_job_threads[i] = SDL_CreateThreadInternal(SDL_RowJobThread, name, 0, NULL);
+        if (!row_job_threads[i]) {
+            break;
+        }
+        ++row_job_num_threads;
+    }
+}
+
+int
+SDL_GetRowJobThreads(void)
+{
+    const char *hint = SDL_GetHint(SDL_HINT_SURFACE_THREADS);
+    int num_threads = hint ? SDL_atoi(hint) : 0;
+
+    return SDL_max(num_threads, 1);
+}
+
+void
+SDL_RunRowJob(SDL_RowJobFunc func, void *userdata, int num_rows, int min_rows)
+{
+    SDL_RunRowJobThreads(func, userdata, num_rows, min_rows, SDL_GetRowJobThreads());
+}
+
+void
+SDL_RunRowJobThreads(SDL_RowJobFunc func, void *userdata, int num_rows, int min_rows, int num_threads)
+{
+    SDL_RowJob job;
+    int i, num_workers;
+
+    min_rows = SDL_max(min_rows, 1);
+    if (num_threads < 2 || num_rows < 2 * min_rows) {
+        func(userdata, 0, num_rows);
+        return;
+    }
+
+    SDL_AtomicLock(&row_job_lock);
+    if (!row_job_mutex) {
+        row_job_mutex = SDL_CreateMutex();
+    }
+    SDL_AtomicUnlock(&row_job_lock);
+
+    /* Another thread has the pool, this is a pool thread, or this thread
+       is already running a job */
+    if (!row_job_mutex || SDL_TryLockMutex(row_job_mutex) != 0) {
+        func(userdata, 0, num_rows);
+        return;
+    }
+    if (row_job) {
+        SDL_UnlockMutex(row_job_mutex);
+        func(userdata, 0, num_rows);
+        return;
+    }
+
+    /* The pool only grows, so jobs asking for different numbers of threads
+       don't keep restarting it; smaller jobs leave the extra threads idle */
+    if (num_threads > row_job_wanted) {
+        SDL_StopRowJobThreads();
+        SDL_StartRowJobThreads(num_threads - 1);
+        row_job_wanted = num_threads;
+    }
+
+    job.func = func;
+    job.userdata = userdata;
+    job.num_rows = num_rows;
+    job.band_height = SDL_max(num_rows / (num_threads * ROW_JOB_BANDS_PER_THREAD), min_rows);
+    job.num_bands = (num_rows + job.band_height - 1) / job.band_height;
+    SDL_AtomicSet(&job.next_band, 0);
+    row_job = &job;
+
+    /* The calling thread works on the job too */
+    num_workers = SDL_min(SDL_min(row_job_num_threads, num_threads - 1), job.num_bands - 1);
+    for (i = 0; i < num_workers; ++i) {
+        SDL_SemPost(row_job_work_sem);
+    }
+    SDL_RunRowBands(&job);
+    for (i = 0; i < num_workers; ++i) {
+        SDL_SemWait(row_job_done_sem);
+    }
+
+    row_job = NULL;
+    SDL_UnlockMutex(row_job_mutex);
+}
+
+void
+SDL_QuitRowJobs(void)
+{
+    if (row_job_mutex) {
+        SDL_LockMutex(row_job_mutex);
+        SDL_StopRowJobThreads();
+        row_job_wanted = 0;
+        SDL_UnlockMutex(row_job_mutex);
+        SDL_DestroyMutex(row_job_mutex);
+        row_job_mutex = NULL;
+    }
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,49 @@
+/*
+  Simple DirectMedia Layer
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely, subject to the following restrictions:
+
+  1. The origin of this software must not be misrepresented; you must not
+     claim that you wrote the original software. If you use this software
+     in a product, an acknowledgment in the product documentation would be
+     appreciated but is not required.
+  2. Altered source versions must be plainly marked as such, and must not be
+     misrepresented as being the original software.
+  3. This notice may not be removed or altered from any source distribution.
+*/
+#include "../SDL_internal.h"
+
+#ifndef _SDL_rowjob_c_h
+#define _SDL_rowjob_c_h
+
+/* Surface operations that can be split into bands of rows, run on a pool
+   of threads set up by SDL_HINT_SURFACE_THREADS */
+
+typedef void (*SDL_RowJobFunc) (void *userdata, int y, int h);
+
+/* Calls 'func' for bands of rows that together cover 0 to num_rows - 1,
+   and returns when all of them are done. Bands are at least min_rows high.
+   If threads are disabled or the pool is busy, 'func' is just called once
+   for all of the rows on the calling thread. */
+extern void SDL_RunRowJob(SDL_RowJobFunc func, void *userdata, int num_rows, int min_rows);
+
+/* Like SDL_RunRowJob(), but with 'num_threads' threads, counting the
+   calling thread, instead of what SDL_HINT_SURFACE_THREADS asks for */
+extern void SDL_RunRowJobThreads(SDL_RowJobFunc func, void *userdata, int num_rows, int min_rows, int num_threads);
+
+/* Returns the number of threads SDL_RunRowJob() would use */
+extern int SDL_GetRowJobThreads(void);
+
+/* Stops the pool threads, called from SDL_Quit() */
+extern void SDL_QuitRowJobs(void);
+
+#endif /* _SDL_rowjob_c_h */
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -29,196 +29,785 @@
 #include "SDL_video.h"
 #include "SDL_blit.h"
 
-/* This isn't ready for general consumption yet - it should be folded
-   into the general blitting mechanism.
+#ifdef __SSE2__
+#define HAVE_SSE2_STRETCH 1
+#endif
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+#define HAVE_NEON_STRETCH 1
+#include <arm_neon.h>
+#endif
+
+/* Nearest pixel stretching
+
+   Each row is stretched by a kernel specialized for the pixel size and for
+   how the widths relate: the same width, a whole number of destination pixels
+   for each source pixel, every so many source pixels, or a fractional 16.16
+   step. The kernel is picked once for the whole stretch, and whichever one it
+   is, it picks exactly the source pixels the fractional step would.
 */
 
-#if ((defined(_MFC_VER) && defined(_M_IX86)) || \
-     defined(__WATCOMC__) || \
-     (defined(__GNUC__) && defined(__i386__))) && SDL_ASSEMBLY_ROUTINES
-/* There's a bug with gcc 4.4.1 and -O2 where srcp doesn't get the correct
- * value after the first scanline.  FIXME? */
-/* #define USE_ASM_STRETCH */
-#endif
+typedef enum
+{
+    STRETCH_COPY,       /* Same width */
+    STRETCH_ENLARGE,    /* Each source pixel repeated 'step' times */
+    STRETCH_SHRINK,     /* Every 'step'th source pixel */
+    STRETCH_STEP,       /* Source pixel (i * inc) >> 16 */
+    STRETCH_NUM_KERNELS
+} SDL_StretchKernel;
 
-#ifdef USE_ASM_STRETCH
+typedef struct
+{
+    int src_w, dst_w;
+    int step;
+    Uint32 inc;
+} SDL_StretchRow;
 
-#ifdef HAVE_MPROTECT
-#include <sys/types.h>
-#include <sys/mman.h>
-#endif
+typedef void (*SDL_StretchRowFunc) (const Uint8 * src, Uint8 * dst,
+                                    const SDL_StretchRow * row);
+
+#define DEFINE_STRETCH_ROW(bpp, type)                                   \
+static void                                                             \
+StretchRowCopy##bpp(const Uint8 *src, Uint8 *dst, const SDL_StretchRow *row) \
+{                                                                       \
+    SDL_memcpy(dst, src, row->dst_w * sizeof (type));                   \
+}                                                                       \
+                                                                        \
+static void                                                             \
+StretchRowEnlarge##bpp(const Uint8 *src8, Uint8 *dst8, const SDL_StretchRow *row) \
+{                                                                       \
+    const type *src = (const type *) src8;                              \
+    type *dst = (type *) dst8;                                          \
+    int i, n;                                                           \
+                                                                        \
+    if (row->step == 2) {                                               \
+        for (i = 0; i < row->src_w; ++i) {                              \
+            dst[0] = dst[1] = src[i];                                   \
+            dst += 2;                                                   \
+        }                                                               \
+    } else {                                                            \
+        for (i = 0; i < row->src_w; ++i) {                              \
+            const type pixel = src[i];                                  \
+            for (n = row->step; n > 0; --n) {                           \
+                *dst++ = pixel;                                         \
+            }                                                           \
+        }                                                               \
+    }                                                                   \
+}                                                                       \
+                                                                        \
+static void                                                             \
+StretchRowShrink##bpp(const Uint8 *src8, Uint8 *dst8, const SDL_StretchRow *row) \
+{                                                                       \
+    const type *src = (const type *) src8;                              \
+    type *dst = (type *) dst8;                                          \
+    const int step = row->step;                                         \
+    int i;                                                              \
+                                                                        \
+    for (i = row->dst_w; i > 0; --i) {                                  \
+        *dst++ = *src;                                                  \
+        src += step;                                                    \
+    }                                                                   \
+}                                                                       \
+                                                                        \
+static void                                                             \
+StretchRowStep##bpp(const Uint8 *src8, Uint8 *dst8, const SDL_StretchRow *row) \
+{                                                                       \
+    const type *src = (const type *) src8;                              \
+    type *dst = (type *) dst8;                                          \
+    const Uint32 inc = row->inc;                                        \
+    Uint32 pos = 0;                                                     \
+    int i;                                                              \
+                                                                        \
+    for (i = row->dst_w; i >= 4; i -= 4) {                              \
+        dst[0] = src[pos >> 16];                                        \
+        pos += inc;                                                     \
+        dst[1] = src[pos >> 16];                                        \
+        pos += inc;                                                     \
+        dst[2] = src[pos >> 16];                                        \
+        pos += inc;                                                     \
+        dst[3] = src[pos >> 16];                                        \
+        pos += inc;                                                     \
+        dst += 4;                                                       \
+    }                                                                   \
+    for ( ; i > 0; --i) {                                               \
+        *dst++ = src[pos >> 16];                                        \
+        pos += inc;                                                     \
+    }                                                                   \
+}
+/* *INDENT-OFF* */
+DEFINE_STRETCH_ROW(1, Uint8)
+DEFINE_STRETCH_ROW(2, Uint16)
+DEFINE_STRETCH_ROW(4, Uint32)
+/* *INDENT-ON* */
+
+#define COPY_PIXEL3(dst, src) \
+    do { (dst)[0] = (src)[0]; (dst)[1] = (src)[1]; (dst)[2] = (src)[2]; } while (0)
+
+/* SDL_memcpy() is a function call inside SDL, too slow for a single pixel */
 #ifdef __GNUC__
-#define PAGE_ALIGNED __attribute__((__aligned__(4096)))
-#else
-#define PAGE_ALIGNED
+#define COPY_UNALIGNED4(dst, src)   __builtin_memcpy((dst), (src), 4)
 #endif
 
-#if defined(_M_IX86) || defined(i386)
-#define PREFIX16    0x66
-#define STORE_BYTE  0xAA
-#define STORE_WORD  0xAB
-#define LOAD_BYTE   0xAC
-#define LOAD_WORD   0xAD
-#define RETURN      0xC3
-#else
-#error Need assembly opcodes for this architecture
+static void
+StretchRowCopy3(const Uint8 * src, Uint8 * dst, const SDL_StretchRow * row)
+{
+    SDL_memcpy(dst, src, row->dst_w * 3);
+}
+
+static void
+StretchRowEnlarge3(const Uint8 * src, Uint8 * dst, const SDL_StretchRow * row)
+{
+    int i, n;
+
+    for (i = row->src_w; i > 0; --i) {
+        for (n = row->step; n > 0; --n) {
+            COPY_PIXEL3(dst, src);
+            dst += 3;
+        }
+        src += 3;
+    }
+}
+
+static void
+StretchRowShrink3(const Uint8 * src, Uint8 * dst, const SDL_StretchRow * row)
+{
+    const int step = row->step * 3;
+    int i;
+
+    for (i = row->dst_w; i > 0; --i) {
+        COPY_PIXEL3(dst, src);
+        dst += 3;
+        src += step;
+    }
+}
+
+static void
+StretchRowStep3(const Uint8 * src, Uint8 * dst, const SDL_StretchRow * row)
+{
+    const Uint32 inc = row->inc;
+    Uint32 pos = 0;
+    int i = row->dst_w;
+#ifdef COPY_UNALIGNED4
+    const Uint32 last = (Uint32) (row->src_w - 1) << 16;
+    Uint32 a, b, c, d;
+
+    /* Move each pixel as 4 bytes while the extra byte read is still in the
+       source row and the extra byte written is overwritten by the next one */
+    while (i > 4 && pos + 3 * inc < last) {
+        COPY_UNALIGNED4(&a, src + (pos >> 16) * 3);
+        pos += inc;
+        COPY_UNALIGNED4(&b, src + (pos >> 16) * 3);
+        pos += inc;
+        COPY_UNALIGNED4(&c, src + (pos >> 16) * 3);
+        pos += inc;
+        COPY_UNALIGNED4(&d, src + (pos >> 16) * 3);
+        pos += inc;
+        COPY_UNALIGNED4(dst, &a);
+        COPY_UNALIGNED4(dst + 3, &b);
+        COPY_UNALIGNED4(dst + 6, &c);
+        COPY_UNALIGNED4(dst + 9, &d);
+        dst += 12;
+        i -= 4;
+    }
 #endif
+    for ( ; i > 0; --i) {
+        COPY_PIXEL3(dst, src + (pos >> 16) * 3);
+        dst += 3;
+        pos += inc;
+    }
+}
 
-static unsigned char copy_row[4096] PAGE_ALIGNED;
+#if HAVE_SSE2_STRETCH
+static void
+StretchRowEnlarge2x4SSE2(const Uint8 * src8, Uint8 * dst8, const SDL_StretchRow * row)
+{
+    const Uint32 *src = (const Uint32 *) src8;
+    Uint32 *dst = (Uint32 *) dst8;
+    int i;
 
-static int
-generate_rowbytes(int src_w, int dst_w, int bpp)
+    for (i = 0; i + 4 <= row->src_w; i += 4) {
+        const __m128i pixels = _mm_loadu_si128((const __m128i *) (src + i));
+        _mm_storeu_si128((__m128i *) (dst + 2 * i), _mm_unpacklo_epi32(pixels, pixels));
+        _mm_storeu_si128((__m128i *) (dst + 2 * i + 4), _mm_unpackhi_epi32(pixels, pixels));
+    }
+    for ( ; i < row->src_w; ++i) {
+        dst[2 * i] = dst[2 * i + 1] = src[i];
+    }
+}
+
+static void
+StretchRowShrink2x4SSE2(const Uint8 * src8, Uint8 * dst8, const SDL_StretchRow * row)
+{
+    const Uint32 *src = (const Uint32 *) src8;
+    Uint32 *dst = (Uint32 *) dst8;
+    int i;
+
+    for (i = 0; i + 4 <= row->dst_w; i += 4) {
+        const __m128 a = _mm_castsi128_ps(_mm_loadu_si128((const __m128i *) (src + 2 * i)));
+        const __m128 b = _mm_castsi128_ps(_mm_loadu_si128((const __m128i *) (src + 2 * i + 4)));
+        _mm_storeu_si128((__m128i *) (dst + i), _mm_castps_si128(_mm_shuffle_ps(a, b, _MM_SHUFFLE(2, 0, 2, 0))));
+    }
+    for ( ; i < row->dst_w; ++i) {
+        dst[i] = src[2 * i];
+    }
+}
+#endif /* HAVE_SSE2_STRETCH */
+
+#if HAVE_NEON_STRETCH
+static void
+StretchRowEnlarge2x4NEON(const Uint8 * src8, Uint8 * dst8, const SDL_StretchRow * row)
+{
+    const Uint32 *src = (const Uint32 *) src8;
+    Uint32 *dst = (Uint32 *) dst8;
+    int i;
+
+    for (i = 0; i + 4 <= row->src_w; i += 4) {
+        uint32x4x2_t pixels;
+        pixels.val[0] = pixels.val[1] = vld1q_u32(src + i);
+        vst2q_u32(dst + 2 * i, pixels);
+    }
+    for ( ; i < row->src_w; ++i) {
+        dst[2 * i] = dst[2 * i + 1] = src[i];
+    }
+}
+
+static void
+StretchRowShrink2x4NEON(const Uint8 * src8, Uint8 * dst8, const SDL_StretchRow * row)
 {
-    static struct
-    {
-        int bpp;
-        int src_w;
-        int dst_w;
-        int status;
-    } last;
+    const Uint32 *src = (const Uint32 *) src8;
+    Uint32 *dst = (Uint32 *) dst8;
+    int i;
+
+    for (i = 0; i + 4 <= row->dst_w; i += 4) {
+        vst1q_u32(dst + i, vld2q_u32(src + 2 * i).val[0]);
+    }
+    for ( ; i < row->dst_w; ++i) {
+        dst[i] = src[2 * i];
+    }
+}
+#endif /* HAVE_NEON_STRETCH */
 
+static SDL_StretchRowFunc
+ChooseStretchRow(SDL_StretchRow * row, int src_w, int dst_w, int bpp)
+{
+    static const SDL_StretchRowFunc kernels[4][STRETCH_NUM_KERNELS] = {
+        { StretchRowCopy1, StretchRowEnlarge1, StretchRowShrink1, StretchRowStep1 },
+        { StretchRowCopy2, StretchRowEnlarge2, StretchRowShrink2, StretchRowStep2 },
+        { StretchRowCopy3, StretchRowEnlarge3, StretchRowShrink3, StretchRowStep3 },
+        { StretchRowCopy4, StretchRowEnlarge4, StretchRowShrink4, StretchRowStep4 }
+    };
+    SDL_StretchKernel kernel;
     int i;
-    int pos, inc;
-    unsigned char *eip, *fence;
-    unsigned char load, store;
-
-    /* See if we need to regenerate the copy buffer */
-    if ((src_w == last.src_w) && (dst_w == last.dst_w) && (bpp == last.bpp)) {
-        return (last.status);
-    }
-    last.bpp = bpp;
-    last.src_w = src_w;
-    last.dst_w = dst_w;
-    last.status = -1;
-
-    switch (bpp) {
-    case 1:
-        load = LOAD_BYTE;
-        store = STORE_BYTE;
-        break;
-    case 2:
-    case 4:
-        load = LOAD_WORD;
-        store = STORE_WORD;
-        break;
-    default:
-        return SDL_SetError("ASM stretch of %d bytes isn't supported\n", bpp);
-    }
-#ifdef HAVE_MPROTECT
-    /* Make the code writeable */
-    if (mprotect(copy_row, sizeof(copy_row), PROT_READ | PROT_WRITE) < 0) {
-        return SDL_SetError("Couldn't make copy buffer writeable");
+
+    row->src_w = src_w;
+    row->dst_w = dst_w;
+    row->step = 1;
+    row->inc = (Uint32) ((src_w << 16) / dst_w);
+
+    if (src_w == dst_w) {
+        kernel = STRETCH_COPY;
+    } else if ((dst_w % src_w) == 0) {
+        kernel = STRETCH_ENLARGE;
+        row->step = dst_w / src_w;
+    } else if ((src_w % dst_w) == 0) {
+        kernel = STRETCH_SHRINK;
+        row->step = src_w / dst_w;
+    } else {
+        kernel = STRETCH_STEP;
+    }
+
+    /* The truncated step can fall behind a whole number ratio, so make sure
+       the shortcut picks the same pixels */
+    if (kernel == STRETCH_ENLARGE || kernel == STRETCH_SHRINK) {
+        for (i = 0; i < dst_w; ++i) {
+            const int x = (kernel == STRETCH_ENLARGE) ? (i / row->step) : (i * row->step);
+            if ((int) (((Uint64) i * row->inc) >> 16) != x) {
+                kernel = STRETCH_STEP;
+                break;
+            }
+        }
     }
+
+    if (bpp == 4 && row->step == 2) {
+#if HAVE_SSE2_STRETCH
+        if (SDL_HasSSE2()) {
+            if (kernel == STRETCH_ENLARGE) {
+                return StretchRowEnlarge2x4SSE2;
+            } else if (kernel == STRETCH_SHRINK) {
+                return StretchRowShrink2x4SSE2;
+            }
+        }
+#endif
+#if HAVE_NEON_STRETCH
+        if (kernel == STRETCH_ENLARGE) {
+            return StretchRowEnlarge2x4NEON;
+        } else if (kernel == STRETCH_SHRINK) {
+            return StretchRowShrink2x4NEON;
+        }
 #endif
-    pos = 0x10000;
-    inc = (src_w << 16) / dst_w;
-    eip = copy_row;
-    fence = copy_row + sizeof(copy_row)-2;
-    for (i = 0; i < dst_w; ++i) {
-        while (pos >= 0x10000L) {
-            if (eip == fence) {
-                return -1;
+    }
+    return kernels[bpp - 1][kernel];
+}
+
+/* Filtered stretching
+
+   The linear and area averaging filters are separable, so each one is set up
+   as a table with the first source pixel and the weights of the source pixels
+   for every destination column or row. A destination row is made by summing
+   the source rows it covers into a row of 16-bit values, and then summing the
+   columns of that. Every byte of a pixel is filtered the same way, so this
+   works for any format with 8-bit channels, whatever order they're in.
+*/
+
+/* The weights for each destination pixel add up to this */
+#define FILTER_ONE          (1 << 14)
+/* Summed rows are kept with this many fractional bits */
+#define FILTER_ROW_BITS     7
+#define FILTER_ROW_SHIFT    (14 - FILTER_ROW_BITS)
+#define FILTER_COLUMN_SHIFT (14 + FILTER_ROW_BITS)
+
+typedef struct
+{
+    int taps;           /* Source pixels summed for each destination pixel, always even */
+    int *offsets;       /* First source pixel for each destination pixel */
+    Sint16 *weights;    /* 'taps' weights for each destination pixel */
+} SDL_StretchFilter;
+
+/* The tables only depend on the sizes and the scale mode, so the last ones
+   used are kept in the source's blit map, and shared with any recorded
+   drawing that still uses them */
+struct SDL_StretchFilters
+{
+    int src_w, src_h;
+    int dst_w, dst_h;
+    SDL_ScaleMode scale_mode;
+    int refcount;
+    SDL_StretchFilter x, y;
+};
+
+typedef void (*SDL_FilterRowsFunc) (Sint16 * dst, const Uint8 ** rows,
+                                    const Sint16 * weights, int taps, int len);
+
+static void
+FreeStretchFilter(SDL_StretchFilter * filter)
+{
+    SDL_free(filter->offsets);
+    SDL_free(filter->weights);
+}
+
+static int
+SetupStretchFilter(SDL_StretchFilter * filter, int src_size, int dst_size,
+                   SDL_ScaleMode scaleMode)
+{
+    const SDL_bool average = (scaleMode == SDL_ScaleModeBest && dst_size < src_size);
+    int i, j;
+
+    if (average) {
+        filter->taps = (src_size + dst_size - 1) / dst_size + 1;
+    } else {
+        filter->taps = 2;
+    }
+    filter->taps = (filter->taps + 1) & ~1;
+    filter->offsets = (int *) SDL_malloc(dst_size * sizeof (*filter->offsets));
+    filter->weights = (Sint16 *) SDL_calloc(dst_size * filter->taps, sizeof (*filter->weights));
+    if (!filter->offsets || !filter->weights) {
+        FreeStretchFilter(filter);
+        return SDL_OutOfMemory();
+    }
+
+    for (i = 0; i < dst_size; ++i) {
+        Sint16 *weights = &filter->weights[i * filter->taps];
+
+        if (average) {
+            /* Destination pixel i covers [i * src_size, (i + 1) * src_size) and
+               source pixel j covers [j * dst_size, (j + 1) * dst_size), so each
+               source pixel is weighted by how much of the destination it covers */
+            const Sint64 start = (Sint64) i * src_size;
+            const Sint64 end = start + src_size;
+            Sint64 covered;
+            int sum = 0, total;
+
+            filter->offsets[i] = (int) (start / dst_size);
+            for (j = 0; ; ++j) {
+                covered = SDL_min((Sint64) (filter->offsets[i] + j + 1) * dst_size, end);
+                total = (int) (((covered - start) * FILTER_ONE + src_size / 2) / src_size);
+                weights[j] = (Sint16) (total - sum);
+                sum = total;
+                if (covered == end) {
+                    break;
+                }
+            }
+        } else {
+            /* Interpolate between the two source pixels nearest to the center
+               of the destination pixel, in 16.16 fixed point */
+            Sint64 pos = (((Sint64) (2 * i + 1) * src_size) << 15) / dst_size - 0x8000;
+            int frac;
+
+            if (pos < 0) {
+                pos = 0;
             }
-            if (bpp == 2) {
-                *eip++ = PREFIX16;
+            filter->offsets[i] = (int) (pos >> 16);
+            frac = (int) (pos & 0xFFFF);
+            if (filter->offsets[i] >= src_size - 1) {
+                filter->offsets[i] = src_size - 1;
+                frac = 0;
             }
-            *eip++ = load;
-            pos -= 0x10000L;
+            weights[1] = (Sint16) ((frac + 2) >> 2);
+            weights[0] = (Sint16) (FILTER_ONE - weights[1]);
         }
-        if (eip == fence) {
-            return -1;
+    }
+    return 0;
+}
+
+static void
+FilterRows(Sint16 * dst, const Uint8 ** rows, const Sint16 * weights, int taps, int len)
+{
+    int i, k, sum;
+
+    for (i = 0; i < len; ++i) {
+        sum = 1 << (FILTER_ROW_SHIFT - 1);
+        for (k = 0; k < taps; ++k) {
+            sum += weights[k] * rows[k][i];
         }
-        if (bpp == 2) {
-            *eip++ = PREFIX16;
+        dst[i] = (Sint16) (sum >> FILTER_ROW_SHIFT);
+    }
+}
+
+static void
+FilterColumns(Uint8 * dst, const Sint16 * src, const SDL_StretchFilter * filter,
+              int width, int bpp)
+{
+    const Sint16 *pixel, *weights;
+    int i, c, k, sum;
+
+    for (i = 0; i < width; ++i) {
+        pixel = src + filter->offsets[i] * bpp;
+        weights = &filter->weights[i * filter->taps];
+        for (c = 0; c < bpp; ++c) {
+            sum = 1 << (FILTER_COLUMN_SHIFT - 1);
+            for (k = 0; k < filter->taps; ++k) {
+                sum += weights[k] * pixel[k * bpp + c];
+            }
+            *dst++ = (Uint8) (sum >> FILTER_COLUMN_SHIFT);
         }
-        *eip++ = store;
-        pos += inc;
     }
-    *eip++ = RETURN;
+}
+
+#if HAVE_SSE2_STRETCH
+static void
+FilterRowsSSE2(Sint16 * dst, const Uint8 ** rows, const Sint16 * weights, int taps, int len)
+{
+    const __m128i zero = _mm_setzero_si128();
+    const __m128i round = _mm_set1_epi32(1 << (FILTER_ROW_SHIFT - 1));
+    int i, k;
+
+    for (i = 0; i + 16 <= len; i += 16) {
+        __m128i sum0 = round, sum1 = round, sum2 = round, sum3 = round;
 
-#ifdef HAVE_MPROTECT
-    /* Make the code executable but not writeable */
-    if (mprotect(copy_row, sizeof(copy_row), PROT_READ | PROT_EXEC) < 0) {
-        return SDL_SetError("Couldn't make copy buffer executable");
+        /* Interleave the bytes of two rows, so multiply-add sums them in pairs */
+        for (k = 0; k < taps; k += 2) {
+            const __m128i a = _mm_loadu_si128((const __m128i *) (rows[k] + i));
+            const __m128i b = _mm_loadu_si128((const __m128i *) (rows[k + 1] + i));
+            const __m128i w = _mm_set1_epi32((Uint16) weights[k] | ((Uint32) (Uint16) weights[k + 1] << 16));
+            const __m128i lo = _mm_unpacklo_epi8(a, b);
+            const __m128i hi = _mm_unpackhi_epi8(a, b);
+            sum0 = _mm_add_epi32(sum0, _mm_madd_epi16(_mm_unpacklo_epi8(lo, zero), w));
+            sum1 = _mm_add_epi32(sum1, _mm_madd_epi16(_mm_unpackhi_epi8(lo, zero), w));
+            sum2 = _mm_add_epi32(sum2, _mm_madd_epi16(_mm_unpacklo_epi8(hi, zero), w));
+            sum3 = _mm_add_epi32(sum3, _mm_madd_epi16(_mm_unpackhi_epi8(hi, zero), w));
+        }
+        _mm_storeu_si128((__m128i *) (dst + i),
+                         _mm_packs_epi32(_mm_srai_epi32(sum0, FILTER_ROW_SHIFT),
+                                         _mm_srai_epi32(sum1, FILTER_ROW_SHIFT)));
+        _mm_storeu_si128((__m128i *) (dst + i + 8),
+                         _mm_packs_epi32(_mm_srai_epi32(sum2, FILTER_ROW_SHIFT),
+                                         _mm_srai_epi32(sum3, FILTER_ROW_SHIFT)));
+    }
+    for ( ; i < len; ++i) {
+        int sum = 1 << (FILTER_ROW_SHIFT - 1);
+        for (k = 0; k < taps; ++k) {
+            sum += weights[k] * rows[k][i];
+        }
+        dst[i] = (Sint16) (sum >> FILTER_ROW_SHIFT);
     }
-#endif
-    last.status = 0;
-    return (0);
 }
 
-#endif /* USE_ASM_STRETCH */
-
-#define DEFINE_COPY_ROW(name, type)         \
-static void name(type *src, int src_w, type *dst, int dst_w)    \
-{                                           \
-    int i;                                  \
-    int pos, inc;                           \
-    type pixel = 0;                         \
-                                            \
-    pos = 0x10000;                          \
-    inc = (src_w << 16) / dst_w;            \
-    for ( i=dst_w; i>0; --i ) {             \
-        while ( pos >= 0x10000L ) {         \
-            pixel = *src++;                 \
-            pos -= 0x10000L;                \
-        }                                   \
-        *dst++ = pixel;                     \
-        pos += inc;                         \
-    }                                       \
+static void
+FilterColumns4SSE2(Uint8 * dst, const Sint16 * src, const SDL_StretchFilter * filter, int width)
+{
+    const __m128i round = _mm_set1_epi32(1 << (FILTER_COLUMN_SHIFT - 1));
+    const Sint16 *pixel, *weights;
+    int i, k;
+
+    for (i = 0; i < width; ++i) {
+        __m128i sum = round;
+
+        pixel = src + filter->offsets[i] * 4;
+        weights = &filter->weights[i * filter->taps];
+
+        /* Interleave the channels of two pixels, so multiply-add sums them in pairs */
+        for (k = 0; k < filter->taps; k += 2) {
+            const __m128i p = _mm_loadu_si128((const __m128i *) (pixel + k * 4));
+            const __m128i w = _mm_set1_epi32((Uint16) weights[k] | ((Uint32) (Uint16) weights[k + 1] << 16));
+            sum = _mm_add_epi32(sum, _mm_madd_epi16(_mm_unpacklo_epi16(p, _mm_srli_si128(p, 8)), w));
+        }
+        sum = _mm_srai_epi32(sum, FILTER_COLUMN_SHIFT);
+        sum = _mm_packs_epi32(sum, sum);
+        *(Uint32 *) dst = (Uint32) _mm_cvtsi128_si32(_mm_packus_epi16(sum, sum));
+        dst += 4;
+    }
 }
-/* *INDENT-OFF* */
-DEFINE_COPY_ROW(copy_row1, Uint8)
-DEFINE_COPY_ROW(copy_row2, Uint16)
-DEFINE_COPY_ROW(copy_row4, Uint32)
-/* *INDENT-ON* */
+#endif /* HAVE_SSE2_STRETCH */
 
-/* The ASM code doesn't handle 24-bpp stretch blits */
+#if HAVE_NEON_STRETCH
 static void
-copy_row3(Uint8 * src, int src_w, Uint8 * dst, int dst_w)
+FilterRowsNEON(Sint16 * dst, const Uint8 ** rows, const Sint16 * weights, int taps, int len)
 {
-    int i;
-    int pos, inc;
-    Uint8 pixel[3] = { 0, 0, 0 };
-
-    pos = 0x10000;
-    inc = (src_w << 16) / dst_w;
-    for (i = dst_w; i > 0; --i) {
-        while (pos >= 0x10000L) {
-            pixel[0] = *src++;
-            pixel[1] = *src++;
-            pixel[2] = *src++;
-            pos -= 0x10000L;
+    int i, k;
+
+    for (i = 0; i + 8 <= len; i += 8) {
+        uint32x4_t lo = vdupq_n_u32(1 << (FILTER_ROW_SHIFT - 1));
+        uint32x4_t hi = lo;
+
+        for (k = 0; k < taps; ++k) {
+            const uint16x8_t p = vmovl_u8(vld1_u8(rows[k] + i));
+            lo = vmlal_n_u16(lo, vget_low_u16(p), (uint16_t) weights[k]);
+            hi = vmlal_n_u16(hi, vget_high_u16(p), (uint16_t) weights[k]);
         }
-        *dst++ = pixel[0];
-        *dst++ = pixel[1];
-        *dst++ = pixel[2];
-        pos += inc;
+        vst1q_s16(dst + i, vreinterpretq_s16_u16(vcombine_u16(vshrn_n_u32(lo, FILTER_ROW_SHIFT),
+                                                              vshrn_n_u32(hi, FILTER_ROW_SHIFT))));
+    }
+    for ( ; i < len; ++i) {
+        int sum = 1 << (FILTER_ROW_SHIFT - 1);
+        for (k = 0; k < taps; ++k) {
+            sum += weights[k] * rows[k][i];
+        }
+        dst[i] = (Sint16) (sum >> FILTER_ROW_SHIFT);
     }
 }
 
-/* Perform a stretch blit between two surfaces of the same format.
-   NOTE:  This function is not safe to call from multiple threads!
+static void
+FilterColumns4NEON(Uint8 * dst, const Sint16 * src, const SDL_StretchFilter * filter, int width)
+{
+    const Sint16 *pixel, *weights;
+    int i, k;
+
+    for (i = 0; i < width; ++i) {
+        int32x4_t sum = vdupq_n_s32(1 << (FILTER_COLUMN_SHIFT - 1));
+        uint16x4_t narrow;
+
+        pixel = src + filter->offsets[i] * 4;
+        weights = &filter->weights[i * filter->taps];
+        for (k = 0; k < filter->taps; ++k) {
+            sum = vmlal_n_s16(sum, vld1_s16(pixel + k * 4), weights[k]);
+        }
+        narrow = vqmovun_s32(vshrq_n_s32(sum, FILTER_COLUMN_SHIFT));
+        vst1_lane_u32((uint32_t *) dst, vreinterpret_u32_u8(vqmovn_u16(vcombine_u16(narrow, narrow))), 0);
+        dst += 4;
+    }
+}
+#endif /* HAVE_NEON_STRETCH */
+
+static SDL_bool
+IsByteMask(Uint32 mask)
+{
+    return (mask == 0x000000FF || mask == 0x0000FF00 ||
+            mask == 0x00FF0000 || mask == 0xFF000000) ? SDL_TRUE : SDL_FALSE;
+}
+
+/* Returns SDL_TRUE if surfaces of this format can be stretched with filtering */
+SDL_bool
+SDL_CanFilterStretch(const SDL_PixelFormat * format)
+{
+    if (SDL_ISPIXELFORMAT_INDEXED(format->format) ||
+        (format->BytesPerPixel != 3 && format->BytesPerPixel != 4)) {
+        return SDL_FALSE;
+    }
+    return (IsByteMask(format->Rmask) && IsByteMask(format->Gmask) && IsByteMask(format->Bmask) &&
+            (!format->Amask || IsByteMask(format->Amask))) ? SDL_TRUE : SDL_FALSE;
+}
+
+/* Returns SDL_StretchFilters for stretching srcrect to dstrect, with a
+   reference the caller has to release, or NULL to stretch without filtering */
+SDL_StretchFilters *
+SDL_AcquireStretchFilters(SDL_Surface * src, const SDL_Rect * srcrect,
+                          const SDL_Rect * dstrect, SDL_ScaleMode scaleMode)
+{
+    SDL_BlitMap *map = src->map;
+    SDL_StretchFilters *filters = map->filters;
+
+    if (scaleMode == SDL_ScaleModeNearest || !SDL_CanFilterStretch(src->format)) {
+        return NULL;
+    }
+
+    if (!filters || filters->scale_mode != scaleMode ||
+        filters->src_w != srcrect->w || filters->src_h != srcrect->h ||
+        filters->dst_w != dstrect->w || filters->dst_h != dstrect->h) {
+        filters = (SDL_StretchFilters *) SDL_malloc(sizeof (*filters));
+        if (!filters) {
+            return NULL;
+        }
+        if (SetupStretchFilter(&filters->x, srcrect->w, dstrect->w, scaleMode) < 0) {
+            SDL_free(filters);
+            return NULL;
+        }
+        if (SetupStretchFilter(&filters->y, srcrect->h, dstrect->h, scaleMode) < 0) {
+            FreeStretchFilter(&filters->x);
+            SDL_free(filters);
+            return NULL;
+        }
+        filters->src_w = srcrect->w;
+        filters->src_h = srcrect->h;
+        filters->dst_w = dstrect->w;
+        filters->dst_h = dstrect->h;
+        filters->scale_mode = scaleMode;
+        filters->refcount = 1;
+
+        SDL_ReleaseStretchFilters(map->filters);
+        map->filters = filters;
+    }
+    ++filters->refcount;
+    return filters;
+}
+
+void
+SDL_ReleaseStretchFilters(SDL_StretchFilters * filters)
+{
+    if (filters && --filters->refcount == 0) {
+        FreeStretchFilter(&filters->x);
+        FreeStretchFilter(&filters->y);
+        SDL_free(filters);
+    }
+}
+
+/* Returns SDL_FALSE if there wasn't enough memory to filter */
+static SDL_bool
+FilterStretchRows(SDL_Surface * src, const SDL_Rect * srcrect,
+                  SDL_Surface * dst, const SDL_Rect * dstrect,
+                  const SDL_StretchFilters * filters, int y0, int y1)
+{
+    const int bpp = dst->format->BytesPerPixel;
+    const SDL_StretchFilter *xfilter = &filters->x;
+    const SDL_StretchFilter *yfilter = &filters->y;
+    SDL_FilterRowsFunc filter_rows = FilterRows;
+    const Uint8 **rows;
+    const Sint16 *weights;
+    Sint16 *buffer;
+    Uint8 *dstp;
+    int i, k, y;
+
+    /* The columns past the edge are zero, so every tap can be read */
+    buffer = (Sint16 *) SDL_calloc((srcrect->w + xfilter->taps) * bpp, sizeof (*buffer));
+    rows = (const Uint8 **) SDL_malloc(yfilter->taps * sizeof (*rows));
+    if (!rows || !buffer) {
+        SDL_free(rows);
+        SDL_free(buffer);
+        return SDL_FALSE;
+    }
+
+#if HAVE_SSE2_STRETCH
+    if (SDL_HasSSE2()) {
+        filter_rows = FilterRowsSSE2;
+    }
+#endif
+#if HAVE_NEON_STRETCH
+    filter_rows = FilterRowsNEON;
+#endif
+
+    for (y = y0; y < y1; ++y) {
+        i = y - dstrect->y;
+        weights = &yfilter->weights[i * yfilter->taps];
+        for (k = 0; k < yfilter->taps; ++k) {
+            const int row = SDL_min(yfilter->offsets[i] + k, srcrect->h - 1);
+            rows[k] = (const Uint8 *) src->pixels + (srcrect->y + row) * src->pitch + srcrect->x * bpp;
+        }
+        filter_rows(buffer, rows, weights, yfilter->taps, srcrect->w * bpp);
+
+        dstp = (Uint8 *) dst->pixels + y * dst->pitch + dstrect->x * bpp;
+#if HAVE_SSE2_STRETCH
+        if (bpp == 4 && filter_rows == FilterRowsSSE2) {
+            FilterColumns4SSE2(dstp, buffer, xfilter, dstrect->w);
+            continue;
+        }
+#endif
+#if HAVE_NEON_STRETCH
+        if (bpp == 4) {
+            FilterColumns4NEON(dstp, buffer, xfilter, dstrect->w);
+            continue;
+        }
+#endif
+        FilterColumns(dstp, buffer, xfilter, dstrect->w, bpp);
+    }
+
+    SDL_free(rows);
+    SDL_free(buffer);
+    return SDL_TRUE;
+}
+
+/* Stretch the rows y0 to y1 of dstrect, which have to be inside dstrect,
+   filtering with 'filters' from SDL_AcquireStretchFilters() unless it's NULL.
+   The surfaces have to be the same format, and the rectangles valid.
 */
+void
+SDL_SoftStretchRows(SDL_Surface * src, const SDL_Rect * srcrect,
+                    SDL_Surface * dst, const SDL_Rect * dstrect,
+                    const SDL_StretchFilters * filters, int y0, int y1)
+{
+    SDL_StretchRow row;
+    SDL_StretchRowFunc stretch_row;
+    int inc;
+    int src_row, dst_row, last_row = -1;
+    Uint8 *srcp;
+    Uint8 *dstp, *lastp = NULL;
+    const int bpp = dst->format->BytesPerPixel;
+
+    if (y0 >= y1) {
+        return;
+    }
+
+    if (filters && FilterStretchRows(src, srcrect, dst, dstrect, filters, y0, y1)) {
+        return;
+    }
+
+    /* Set up the data... */
+    inc = (srcrect->h << 16) / dstrect->h;
+    stretch_row = ChooseStretchRow(&row, srcrect->w, dstrect->w, bpp);
+
+    /* Perform the stretch blit */
+    for (dst_row = y0; dst_row < y1; ++dst_row) {
+        dstp = (Uint8 *) dst->pixels + (dst_row * dst->pitch)
+            + (dstrect->x * bpp);
+        src_row = srcrect->y + (int) (((Sint64) (dst_row - dstrect->y) * inc) >> 16);
+        if (src_row == last_row) {
+            /* Enlarging, so this row is the same as the last one */
+            SDL_memcpy(dstp, lastp, dstrect->w * bpp);
+            continue;
+        }
+        srcp = (Uint8 *) src->pixels + (src_row * src->pitch)
+            + (srcrect->x * bpp);
+        stretch_row(srcp, dstp, &row);
+        last_row = src_row;
+        lastp = dstp;
+    }
+}
+
+/* Perform a stretch blit between two surfaces of the same format */
 int
 SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
                 SDL_Surface * dst, const SDL_Rect * dstrect)
+{
+    return SDL_LowerSoftStretch(src, srcrect, dst, dstrect, SDL_ScaleModeNearest);
+}
+
+int
+SDL_LowerSoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
+                     SDL_Surface * dst, const SDL_Rect * dstrect,
+                     SDL_ScaleMode scaleMode)
 {
     int src_locked;
     int dst_locked;
-    int pos, inc;
-    int dst_maxrow;
-    int src_row, dst_row;
-    Uint8 *srcp = NULL;
-    Uint8 *dstp;
     SDL_Rect full_src;
     SDL_Rect full_dst;
-#ifdef USE_ASM_STRETCH
-    SDL_bool use_asm = SDL_TRUE;
-#ifdef __GNUC__
-    int u1, u2;
-#endif
-#endif /* USE_ASM_STRETCH */
-    const int bpp = dst->format->BytesPerPixel;
+    SDL_StretchFilters *filters;
 
     if (src->format->format != dst->format->format) {
         return SDL_SetError("Only works with same format surfaces");
@@ -272,73 +861,10 @@ SDL_SoftStretch(SDL_Surface * src, const SDL_Rect * srcrect,
         src_locked = 1;
     }
 
-    /* Set up the data... */
-    pos = 0x10000;
-    inc = (srcrect->h << 16) / dstrect->h;
-    src_row = srcrect->y;
-    dst_row = dstrect->y;
-
-#ifdef USE_ASM_STRETCH
-    /* Write the opcodes for this stretch */
-    if ((bpp == 3) || (generate_rowbytes(srcrect->w, dstrect->w, bpp) < 0)) {
-        use_asm = SDL_FALSE;
-    }
-#endif
-
-    /* Perform the stretch blit */
-    for (dst_maxrow = dst_row + dstrect->h; dst_row < dst_maxrow; ++dst_row) {
-        dstp = (Uint8 *) dst->pixels + (dst_row * dst->pitch)
-            + (dstrect->x * bpp);
-        while (pos >= 0x10000L) {
-            srcp = (Uint8 *) src->pixels + (src_row * src->pitch)
-                + (srcrect->x * bpp);
-            ++src_row;
-            pos -= 0x10000L;
-        }
-#ifdef USE_ASM_STRETCH
-        if (use_asm) {
-#ifdef __GNUC__
-            __asm__ __volatile__("call *%4":"=&D"(u1), "=&S"(u2)
-                                 :"0"(dstp), "1"(srcp), "r"(copy_row)
-                                 :"memory");
-#elif defined(_MSC_VER) || defined(__WATCOMC__)
-            /* *INDENT-OFF* */
-            {
-                void *code = copy_row;
-                __asm {
-                    push edi
-                    push esi
-                    mov edi, dstp
-                    mov esi, srcp
-                    call dword ptr code
-                    pop esi
-                    pop edi
-                }
-            }
-            /* *INDENT-ON* */
-#else
-#error Need inline assembly for this compiler
-#endif
-        } else
-#endif
-            switch (bpp) {
-            case 1:
-                copy_row1(srcp, srcrect->w, dstp, dstrect->w);
-                break;
-            case 2:
-                copy_row2((Uint16 *) srcp, srcrect->w,
-                          (Uint16 *) dstp, dstrect->w);
-                break;
-            case 3:
-                copy_row3(srcp, srcrect->w, dstp, dstrect->w);
-                break;
-            case 4:
-                copy_row4((Uint32 *) srcp, srcrect->w,
-                          (Uint32 *) dstp, dstrect->w);
-                break;
-            }
-        pos += inc;
-    }
+    filters = SDL_AcquireStretchFilters(src, srcrect, dstrect, scaleMode);
+    SDL_SoftStretchRows(src, srcrect, dst, dstrect, filters,
+                        dstrect->y, dstrect->y + dstrect->h);
+    SDL_ReleaseStretchFilters(filters);
 
     /* We need to unlock the surfaces if they're locked */
     if (dst_locked) {
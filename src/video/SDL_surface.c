@@ -25,6 +25,7 @@
 #include "SDL_blit.h"
 #include "SDL_RLEaccel_c.h"
 #include "SDL_pixels_c.h"
+#include "SDL_rowjob_c.h"
 
 /* Public routines */
 
@@ -488,6 +489,37 @@ SDL_GetSurfaceBlendMode(SDL_Surface * surface, SDL_BlendMode *blendMode)
     return 0;
 }
 
+int
+SDL_SetSurfaceScaleMode(SDL_Surface * surface, SDL_ScaleMode scaleMode)
+{
+    if (!surface) {
+        return -1;
+    }
+
+    switch (scaleMode) {
+    case SDL_ScaleModeNearest:
+    case SDL_ScaleModeLinear:
+    case SDL_ScaleModeBest:
+        surface->map->scale_mode = scaleMode;
+        return 0;
+    default:
+        return SDL_Unsupported();
+    }
+}
+
+int
+SDL_GetSurfaceScaleMode(SDL_Surface * surface, SDL_ScaleMode *scaleMode)
+{
+    if (!surface) {
+        return -1;
+    }
+
+    if (scaleMode) {
+        *scaleMode = surface->map->scale_mode;
+    }
+    return 0;
+}
+
 SDL_bool
 SDL_SetClipRect(SDL_Surface * surface, const SDL_Rect * rect)
 {
@@ -531,9 +563,8 @@ SDL_GetClipRect(SDL_Surface * surface, SDL_Rect * rect)
  * you know exactly what you are doing, you can optimize your code
  * by calling the one(s) you need.
  */
-int
-SDL_LowerBlit(SDL_Surface * src, SDL_Rect * srcrect,
-              SDL_Surface * dst, SDL_Rect * dstrect)
+static int
+SDL_ValidateMap(SDL_Surface * src, SDL_Surface * dst)
 {
     /* Check to make sure the blit mapping is valid */
     if ((src->map->dst != dst) ||
@@ -550,33 +581,93 @@ SDL_LowerBlit(SDL_Surface * src, SDL_Rect * srcrect,
 /*              src, dst->flags, src->map->info.flags, dst, dst->flags, */
 /*              dst->map->info.flags, src->map->blit); */
     }
-    return (src->map->blit(src, srcrect, dst, dstrect));
+    return 0;
 }
 
-
 int
-SDL_UpperBlit(SDL_Surface * src, const SDL_Rect * srcrect,
+SDL_LowerBlit(SDL_Surface * src, SDL_Rect * srcrect,
               SDL_Surface * dst, SDL_Rect * dstrect)
 {
-    SDL_Rect fulldst;
-    int srcx, srcy, w, h;
-
-    /* Make sure the surfaces aren't locked */
-    if (!src || !dst) {
-        return SDL_SetError("SDL_UpperBlit: passed a NULL surface");
+    if (SDL_ValidateMap(src, dst) < 0) {
+        return (-1);
     }
-    if (src->locked || dst->locked) {
-        return SDL_SetError("Surfaces must not be locked during blit");
+    return (src->map->blit(src, srcrect, dst, dstrect));
+}
+
+/* Conversions of more pixels than this are split across SDL_HINT_SURFACE_THREADS */
+#define CONVERT_THREADING_THRESHOLD (512 * 512)
+#define CONVERT_MIN_BAND_HEIGHT     16
+
+typedef struct
+{
+    SDL_Surface *src;
+    SDL_Surface *dst;
+} SDL_ConvertJob;
+
+static void
+SDL_ConvertRows(void *userdata, int y, int h)
+{
+    const SDL_ConvertJob *job = (const SDL_ConvertJob *) userdata;
+    SDL_Surface src = *job->src;
+    SDL_BlitMap map = *job->src->map;
+    SDL_Rect rect;
+
+    /* The blitters write into the blit map, so each band uses its own copy */
+    src.map = &map;
+    rect.x = 0;
+    rect.y = y;
+    rect.w = src.w;
+    rect.h = h;
+    map.blit(&src, &rect, job->dst, &rect);
+}
+
+/*
+ * Blit all of 'src' to the top left of 'dst' with no clipping, the way
+ * the conversion functions do. Large images are blitted in bands of rows
+ * on SDL_HINT_SURFACE_THREADS, all sharing the one blit mapping.
+ */
+static int
+SDL_ConvertBlit(SDL_Surface * src, SDL_Surface * dst)
+{
+    SDL_ConvertJob job;
+    SDL_Rect bounds;
+
+    if (SDL_ValidateMap(src, dst) < 0) {
+        return (-1);
     }
 
-    /* If the destination rectangle is NULL, use the entire dest surface */
-    if (dstrect == NULL) {
-        fulldst.x = fulldst.y = 0;
-        fulldst.w = dst->w;
-        fulldst.h = dst->h;
-        dstrect = &fulldst;
+    /* Surfaces that need locking are locked by the blit itself, which
+       can't happen on several threads at once */
+    if ((size_t) src->w * src->h < CONVERT_THREADING_THRESHOLD ||
+        SDL_MUSTLOCK(src) || SDL_MUSTLOCK(dst) ||
+        SDL_GetRowJobThreads() < 2) {
+        bounds.x = 0;
+        bounds.y = 0;
+        bounds.w = src->w;
+        bounds.h = src->h;
+        return (src->map->blit(src, &bounds, dst, &bounds));
     }
 
+    job.src = src;
+    job.dst = dst;
+    SDL_RunRowJob(SDL_ConvertRows, &job, src->h, CONVERT_MIN_BAND_HEIGHT);
+    return 0;
+}
+
+
+/*
+ * Clip a blit to the source surface and to the clip rectangle of the
+ * destination, returning SDL_FALSE if there is nothing left to draw.
+ * This doesn't change either surface, so it's safe to call from any thread.
+ */
+SDL_bool
+SDL_ClipBlit(const SDL_Surface * src, const SDL_Rect * srcrect,
+             const SDL_Surface * dst, const SDL_Rect * dstrect,
+             SDL_Rect * final_src, SDL_Rect * final_dst)
+{
+    SDL_Rect dr = *dstrect;
+    int srcx, srcy, w, h;
+
     /* clip the source rectangle to the source surface */
     if (srcrect) {
         int maxw, maxh;
@@ -585,7 +676,7 @@ SDL_UpperBlit(SDL_Surface * src, const SDL_Rect * srcrect,
         w = srcrect->w;
         if (srcx < 0) {
             w += srcx;
-            dstrect->x -= srcx;
+            dr.x -= srcx;
             srcx = 0;
         }
         maxw = src->w - srcx;
@@ -596,7 +687,7 @@ SDL_UpperBlit(SDL_Surface * src, const SDL_Rect * srcrect,
         h = srcrect->h;
         if (srcy < 0) {
             h += srcy;
-            dstrect->y -= srcy;
+            dr.y -= srcy;
             srcy = 0;
         }
         maxh = src->h - srcy;
@@ -611,67 +702,94 @@ SDL_UpperBlit(SDL_Surface * src, const SDL_Rect * srcrect,
 
     /* clip the destination rectangle against the clip rectangle */
     {
-        SDL_Rect *clip = &dst->clip_rect;
+        const SDL_Rect *clip = &dst->clip_rect;
         int dx, dy;
 
-        dx = clip->x - dstrect->x;
+        dx = clip->x - dr.x;
         if (dx > 0) {
             w -= dx;
-            dstrect->x += dx;
+            dr.x += dx;
             srcx += dx;
         }
-        dx = dstrect->x + w - clip->x - clip->w;
+        dx = dr.x + w - clip->x - clip->w;
         if (dx > 0)
             w -= dx;
 
-        dy = clip->y - dstrect->y;
+        dy = clip->y - dr.y;
         if (dy > 0) {
             h -= dy;
-            dstrect->y += dy;
+            dr.y += dy;
             srcy += dy;
         }
-        dy = dstrect->y + h - clip->y - clip->h;
+        dy = dr.y + h - clip->y - clip->h;
         if (dy > 0)
             h -= dy;
     }
 
+    final_src->x = srcx;
+    final_src->y = srcy;
+    final_src->w = w;
+    final_src->h = h;
+    dr.w = w;
+    dr.h = h;
+    *final_dst = dr;
+    return (w > 0 && h > 0) ? SDL_TRUE : SDL_FALSE;
+}
+
+int
+SDL_UpperBlit(SDL_Surface * src, const SDL_Rect * srcrect,
+              SDL_Surface * dst, SDL_Rect * dstrect)
+{
+    SDL_Rect fulldst, sr;
+    SDL_bool clipped;
+
+    /* Make sure the surfaces aren't locked */
+    if (!src || !dst) {
+        return SDL_SetError("SDL_UpperBlit: passed a NULL surface");
+    }
+    if (src->locked || dst->locked) {
+        return SDL_SetError("Surfaces must not be locked during blit");
+    }
+
+    /* If the destination rectangle is NULL, use the entire dest surface */
+    if (dstrect == NULL) {
+        fulldst.x = fulldst.y = 0;
+        fulldst.w = dst->w;
+        fulldst.h = dst->h;
+        dstrect = &fulldst;
+    }
+
+    clipped = SDL_ClipBlit(src, srcrect, dst, dstrect, &sr, dstrect);
+
     /* Switch back to a fast blit if we were previously stretching */
     if (src->map->info.flags & SDL_COPY_NEAREST) {
         src->map->info.flags &= ~SDL_COPY_NEAREST;
         SDL_InvalidateMap(src->map);
     }
 
-    if (w > 0 && h > 0) {
-        SDL_Rect sr;
-        sr.x = srcx;
-        sr.y = srcy;
-        sr.w = dstrect->w = w;
-        sr.h = dstrect->h = h;
+    if (clipped) {
         return SDL_LowerBlit(src, &sr, dst, dstrect);
     }
     dstrect->w = dstrect->h = 0;
     return 0;
 }
 
-int
-SDL_UpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
-              SDL_Surface * dst, SDL_Rect * dstrect)
+/*
+ * Clip a scaled blit to the source surface and to the clip rectangle of the
+ * destination, returning SDL_FALSE if there is nothing left to draw.
+ * This doesn't change either surface, so it's safe to call from any thread.
+ */
+SDL_bool
+SDL_ClipBlitScaled(const SDL_Surface * src, const SDL_Rect * srcrect,
+                   const SDL_Surface * dst, const SDL_Rect * dstrect,
+                   SDL_Rect * final_src, SDL_Rect * final_dst)
 {
     double src_x0, src_y0, src_x1, src_y1;
     double dst_x0, dst_y0, dst_x1, dst_y1;
-    SDL_Rect final_src, final_dst;
     double scaling_w, scaling_h;
     int src_w, src_h;
     int dst_w, dst_h;
 
-    /* Make sure the surfaces aren't locked */
-    if (!src || !dst) {
-        return SDL_SetError("SDL_UpperBlitScaled: passed a NULL surface");
-    }
-    if (src->locked || dst->locked) {
-        return SDL_SetError("Surfaces must not be locked during blit");
-    }
-
     if (NULL == srcrect) {
         src_w = src->w;
         src_h = src->h;
@@ -688,11 +806,6 @@ SDL_UpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
         dst_h = dstrect->h;
     }
 
-    if (dst_w == src_w && dst_h == src_h) {
-        /* No scaling, defer to regular blit */
-        return SDL_BlitSurface(src, srcrect, dst, dstrect);
-    }
-
     scaling_w = (double)dst_w / src_w;
     scaling_h = (double)dst_h / src_h;
 
@@ -776,26 +889,69 @@ SDL_UpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
     dst_y0 += dst->clip_rect.y;
     dst_y1 += dst->clip_rect.y;
 
-    final_src.x = (int)SDL_floor(src_x0 + 0.5);
-    final_src.y = (int)SDL_floor(src_y0 + 0.5);
-    final_src.w = (int)SDL_floor(src_x1 - src_x0 + 1.5);
-    final_src.h = (int)SDL_floor(src_y1 - src_y0 + 1.5);
+    final_src->x = (int)SDL_floor(src_x0 + 0.5);
+    final_src->y = (int)SDL_floor(src_y0 + 0.5);
+    final_src->w = (int)SDL_floor(src_x1 - src_x0 + 1.5);
+    final_src->h = (int)SDL_floor(src_y1 - src_y0 + 1.5);
 
-    final_dst.x = (int)SDL_floor(dst_x0 + 0.5);
-    final_dst.y = (int)SDL_floor(dst_y0 + 0.5);
-    final_dst.w = (int)SDL_floor(dst_x1 - dst_x0 + 1.5);
-    final_dst.h = (int)SDL_floor(dst_y1 - dst_y0 + 1.5);
+    final_dst->x = (int)SDL_floor(dst_x0 + 0.5);
+    final_dst->y = (int)SDL_floor(dst_y0 + 0.5);
+    final_dst->w = (int)SDL_floor(dst_x1 - dst_x0 + 1.5);
+    final_dst->h = (int)SDL_floor(dst_y1 - dst_y0 + 1.5);
 
-    if (final_dst.w < 0)
-        final_dst.w = 0;
-    if (final_dst.h < 0)
-        final_dst.h = 0;
+    if (final_dst->w < 0)
+        final_dst->w = 0;
+    if (final_dst->h < 0)
+        final_dst->h = 0;
+
+    return (final_dst->w == 0 || final_dst->h == 0 ||
+            final_src->w <= 0 || final_src->h <= 0) ? SDL_FALSE : SDL_TRUE;
+}
+
+int
+SDL_UpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
+              SDL_Surface * dst, SDL_Rect * dstrect)
+{
+    SDL_Rect final_src, final_dst;
+    SDL_bool clipped;
+    int src_w, src_h;
+    int dst_w, dst_h;
+
+    /* Make sure the surfaces aren't locked */
+    if (!src || !dst) {
+        return SDL_SetError("SDL_UpperBlitScaled: passed a NULL surface");
+    }
+    if (src->locked || dst->locked) {
+        return SDL_SetError("Surfaces must not be locked during blit");
+    }
+
+    if (NULL == srcrect) {
+        src_w = src->w;
+        src_h = src->h;
+    } else {
+        src_w = srcrect->w;
+        src_h = srcrect->h;
+    }
+
+    if (NULL == dstrect) {
+        dst_w = dst->w;
+        dst_h = dst->h;
+    } else {
+        dst_w = dstrect->w;
+        dst_h = dstrect->h;
+    }
+
+    if (dst_w == src_w && dst_h == src_h) {
+        /* No scaling, defer to regular blit */
+        return SDL_BlitSurface(src, srcrect, dst, dstrect);
+    }
+
+    clipped = SDL_ClipBlitScaled(src, srcrect, dst, dstrect, &final_src, &final_dst);
 
     if (dstrect)
         *dstrect = final_dst;
 
-    if (final_dst.w == 0 || final_dst.h == 0 ||
-        final_src.w <= 0 || final_src.h <= 0) {
+    if (!clipped) {
         /* No-op. */
         return 0;
     }
@@ -803,6 +959,54 @@ SDL_UpperBlitScaled(SDL_Surface * src, const SDL_Rect * srcrect,
     return SDL_LowerBlitScaled(src, &final_src, dst, &final_dst);
 }
 
+/*
+ * The blitters can only stretch with nearest pixel sampling, so filter into
+ * a temporary surface of the source format and blit that with the source's
+ * color and alpha modulation and blend mode. The temporary surface is kept
+ * in the source's blit map for the next blit of the same size.
+ */
+static int
+SDL_LowerBlitFiltered(SDL_Surface * src, SDL_Rect * srcrect,
+                      SDL_Surface * dst, SDL_Rect * dstrect)
+{
+    SDL_BlitMap *map = src->map;
+    SDL_Surface *tmp = map->filtered;
+    SDL_Rect tmprect;
+    SDL_BlendMode blendMode;
+    Uint8 r, g, b, a;
+    int status;
+
+    if (!tmp || tmp->w != dstrect->w || tmp->h != dstrect->h) {
+        if (tmp) {
+            SDL_FreeSurface(tmp);
+            map->filtered = NULL;
+        }
+        tmp = SDL_CreateRGBSurfaceWithFormat(0, dstrect->w, dstrect->h,
+                                             src->format->BitsPerPixel,
+                                             src->format->format);
+        if (!tmp) {
+            return -1;
+        }
+        map->filtered = tmp;
+    }
+    tmprect.x = 0;
+    tmprect.y = 0;
+    tmprect.w = dstrect->w;
+    tmprect.h = dstrect->h;
+
+    status = SDL_LowerSoftStretch(src, srcrect, tmp, &tmprect, map->scale_mode);
+    if (status == 0) {
+        SDL_GetSurfaceColorMod(src, &r, &g, &b);
+        SDL_GetSurfaceAlphaMod(src, &a);
+        SDL_GetSurfaceBlendMode(src, &blendMode);
+        SDL_SetSurfaceColorMod(tmp, r, g, b);
+        SDL_SetSurfaceAlphaMod(tmp, a);
+        SDL_SetSurfaceBlendMode(tmp, blendMode);
+        status = SDL_LowerBlit(tmp, &tmprect, dst, dstrect);
+    }
+    return status;
+}
+
 /**
  *  This is a semi-private blit function and it performs low-level surface
  *  scaled blitting only.
@@ -825,7 +1029,11 @@ SDL_LowerBlitScaled(SDL_Surface * src, SDL_Rect * srcrect,
     if ( !(src->map->info.flags & complex_copy_flags) &&
          src->format->format == dst->format->format &&
          !SDL_ISPIXELFORMAT_INDEXED(src->format->format) ) {
-        return SDL_SoftStretch( src, srcrect, dst, dstrect );
+        return SDL_LowerSoftStretch( src, srcrect, dst, dstrect, src->map->scale_mode );
+    } else if ( src->map->scale_mode != SDL_ScaleModeNearest &&
+                !(src->map->info.flags & SDL_COPY_COLORKEY) &&
+                SDL_CanFilterStretch(src->format) ) {
+        return SDL_LowerBlitFiltered( src, srcrect, dst, dstrect );
     } else {
         return SDL_LowerBlit( src, srcrect, dst, dstrect );
     }
@@ -880,7 +1088,6 @@ SDL_ConvertSurface(SDL_Surface * surface, const SDL_PixelFormat * format,
     SDL_Surface *convert;
     Uint32 copy_flags;
     SDL_Color copy_color;
-    SDL_Rect bounds;
 
     /* Check for empty destination palette! (results in empty image) */
     if (format->palette != NULL) {
@@ -928,17 +1135,14 @@ SDL_ConvertSurface(SDL_Surface * surface, const SDL_PixelFormat * format,
     SDL_InvalidateMap(surface->map);
 
     /* Copy over the image data */
-    bounds.x = 0;
-    bounds.y = 0;
-    bounds.w = surface->w;
-    bounds.h = surface->h;
-    SDL_LowerBlit(surface, &bounds, convert, &bounds);
+    SDL_ConvertBlit(surface, convert);
 
     /* Clean up the original surface, and update converted surface */
     convert->map->info.r = copy_color.r;
     convert->map->info.g = copy_color.g;
     convert->map->info.b = copy_color.b;
     convert->map->info.a = copy_color.a;
+    convert->map->scale_mode = surface->map->scale_mode;
     convert->map->info.flags =
         (copy_flags &
          ~(SDL_COPY_COLORKEY | SDL_COPY_BLEND
@@ -1061,7 +1265,6 @@ int SDL_ConvertPixels(int width, int height,
     SDL_Surface src_surface, dst_surface;
     SDL_PixelFormat src_fmt, dst_fmt;
     SDL_BlitMap src_blitmap, dst_blitmap;
-    SDL_Rect rect;
     void *nonconst_src = (void *) src;
 
     /* Check to make sure we are blitting somewhere, so we don't crash */
@@ -1136,12 +1339,8 @@ int SDL_ConvertPixels(int width, int height,
         return -1;
     }
 
-    /* Set up the rect and go! */
-    rect.x = 0;
-    rect.y = 0;
-    rect.w = width;
-    rect.h = height;
-    return SDL_LowerBlit(&src_surface, &rect, &dst_surface, &rect);
+    /* Set up the blit and go! */
+    return SDL_ConvertBlit(&src_surface, &dst_surface);
 }
 
 /*
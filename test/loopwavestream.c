@@ -0,0 +1,159 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Program to loop playing a wave file using SDL sound queueing, decoding
+   only a little of it at a time with SDL_ReadWAVStream() */
+
+#include <stdio.h>
+#include <stdlib.h>
+
+#ifdef __EMSCRIPTEN__
+#include <emscripten/emscripten.h>
+#endif
+
+#include "SDL.h"
+
+#if HAVE_SIGNAL_H
+#include <signal.h>
+#endif
+
+#define PIECE_SIZE  16384
+
+struct
+{
+    SDL_AudioSpec spec;
+    SDL_WAVStream *stream;      /* The wave file being played */
+    Uint8 piece[PIECE_SIZE];    /* Decoded wave data on its way to the queue */
+} wave;
+
+
+/* Call this instead of exit(), so we can clean up SDL: atexit() is evil. */
+static void
+quit(int rc)
+{
+    SDL_Quit();
+    exit(rc);
+}
+
+static int done = 0;
+void
+poked(int sig)
+{
+    done = 1;
+}
+
+void
+loop()
+{
+#ifdef __EMSCRIPTEN__
+    if (done || (SDL_GetAudioStatus() != SDL_AUDIO_PLAYING)) {
+        emscripten_cancel_main_loop();
+    }
+    else
+#endif
+    {
+        /* The device from SDL_OpenAudio() is always device #1. */
+        while (SDL_GetQueuedAudioSize(1) <= 2 * PIECE_SIZE) {
+            int len = SDL_ReadWAVStream(wave.stream, wave.piece, PIECE_SIZE);
+            if (len == 0) {
+                /* Back to the start for another go around */
+                if (SDL_SeekWAVStream(wave.stream, 0) < 0) {
+                    len = -1;
+                } else {
+                    len = SDL_ReadWAVStream(wave.stream, wave.piece, PIECE_SIZE);
+                }
+            }
+            if (len <= 0) {
+                SDL_Log("Couldn't decode more audio: %s\n", SDL_GetError());
+                done = 1;
+                break;
+            }
+            if (SDL_QueueAudio(1, wave.piece, len) < 0) {
+                SDL_Log("Device FAILED to queue %d more bytes: %s\n", len, SDL_GetError());
+                done = 1;
+                break;
+            }
+        }
+    }
+}
+
+int
+main(int argc, char *argv[])
+{
+    char filename[4096];
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    /* Load the SDL library */
+    if (SDL_Init(SDL_INIT_AUDIO) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    if (argc > 1) {
+        SDL_strlcpy(filename, argv[1], sizeof(filename));
+    } else {
+        SDL_strlcpy(filename, "sample.wav", sizeof(filename));
+    }
+    /* Read the headers, leaving the samples in the file for now */
+    wave.stream = SDL_OpenWAVStream(filename, &wave.spec);
+    if (wave.stream == NULL) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't open %s: %s\n", filename, SDL_GetError());
+        quit(1);
+    }
+    SDL_Log("Streaming %u sample frames from %s\n", SDL_GetWAVStreamLength(wave.stream), filename);
+
+    wave.spec.callback = NULL;  /* we'll push audio. */
+
+#if HAVE_SIGNAL_H
+    /* Set the signals */
+#ifdef SIGHUP
+    signal(SIGHUP, poked);
+#endif
+    signal(SIGINT, poked);
+#ifdef SIGQUIT
+    signal(SIGQUIT, poked);
+#endif
+    signal(SIGTERM, poked);
+#endif /* HAVE_SIGNAL_H */
+
+    if (SDL_OpenAudio(&wave.spec, NULL) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't open audio: %s\n", SDL_GetError());
+        SDL_CloseWAVStream(wave.stream);
+        quit(2);
+    }
+
+    /* Let the audio run */
+    SDL_PauseAudio(0);
+
+    done = 0;
+
+#ifdef __EMSCRIPTEN__
+    emscripten_set_main_loop(loop, 0, 1);
+#else
+    while (!done && (SDL_GetAudioStatus() == SDL_AUDIO_PLAYING))
+    {
+        loop();
+
+        SDL_Delay(100);  /* let it play for awhile. */
+    }
+#endif
+
+    /* Clean up on signal */
+    SDL_CloseAudio();
+    SDL_CloseWAVStream(wave.stream);
+    SDL_Quit();
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
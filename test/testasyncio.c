@@ -0,0 +1,305 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of SDL_RWreadAsync(), reading thousands of files in a directory
+   one after another with SDL_RWread() and then many at once, checking that
+   every file reads back what was written to it.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define DEFAULT_NUM_FILES   2000
+#define DEFAULT_FILE_SIZE   (64 * 1024)
+#define DEFAULT_IN_FLIGHT   64
+
+typedef struct
+{
+    SDL_RWops *rw;
+    SDL_AsyncRead *request;
+    Uint8 *buffer;
+    int index;
+    Uint64 start;
+} Transfer;
+
+static const char *directory = ".";
+static int num_files = DEFAULT_NUM_FILES;
+static int file_size = DEFAULT_FILE_SIZE;
+static int in_flight = DEFAULT_IN_FLIGHT;
+
+static void
+GetFileName(int index, char *name, size_t maxlen)
+{
+    SDL_snprintf(name, maxlen, "%s/testasyncio_%d.dat", directory, index);
+}
+
+/* Returns 1 if the data isn't what was written to file 'index' */
+static int
+CheckData(int index, const Uint8 *data, size_t size)
+{
+    size_t i;
+
+    if (size != (size_t) file_size) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "File %d: read %u bytes, expected %d\n",
+                     index, (unsigned int) size, file_size);
+        return 1;
+    }
+    for (i = 0; i < size; ++i) {
+        if (data[i] != (Uint8) (index + i)) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "File %d: byte %u doesn't match\n",
+                         index, (unsigned int) i);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+static int
+CreateFiles(void)
+{
+    char name[4096];
+    Uint8 *data = (Uint8 *) SDL_malloc(file_size);
+    int i, j;
+
+    if (!data) {
+        return SDL_OutOfMemory();
+    }
+    for (i = 0; i < num_files; ++i) {
+        SDL_RWops *rw;
+
+        GetFileName(i, name, sizeof (name));
+        rw = SDL_RWFromFile(name, "wb");
+        if (!rw) {
+            SDL_free(data);
+            return -1;
+        }
+        for (j = 0; j < file_size; ++j) {
+            data[j] = (Uint8) (i + j);
+        }
+        if (SDL_RWwrite(rw, data, file_size, 1) != 1) {
+            SDL_RWclose(rw);
+            SDL_free(data);
+            return -1;
+        }
+        SDL_RWclose(rw);
+    }
+    SDL_free(data);
+    return 0;
+}
+
+static void
+RemoveFiles(void)
+{
+    char name[4096];
+    int i;
+
+    for (i = 0; i < num_files; ++i) {
+        GetFileName(i, name, sizeof (name));
+        remove(name);
+    }
+}
+
+/* Reads every file in turn, returning the number of failures */
+static int
+ReadSync(double *seconds)
+{
+    char name[4096];
+    Uint8 *buffer = (Uint8 *) SDL_malloc(file_size);
+    Uint64 start;
+    int i, failures = 0;
+
+    if (!buffer) {
+        SDL_OutOfMemory();
+        return 1;
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_files; ++i) {
+        SDL_RWops *rw;
+        size_t nread;
+
+        GetFileName(i, name, sizeof (name));
+        rw = SDL_RWFromFile(name, "rb");
+        if (!rw) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't open %s: %s\n", name, SDL_GetError());
+            ++failures;
+            continue;
+        }
+        nread = SDL_RWread(rw, buffer, 1, file_size);
+        SDL_RWclose(rw);
+        failures += CheckData(i, buffer, nread);
+    }
+    *seconds = (double) (SDL_GetPerformanceCounter() - start) / SDL_GetPerformanceFrequency();
+
+    SDL_free(buffer);
+    return failures;
+}
+
+/* Starts reading the next file into 'transfer', returning SDL_FALSE if
+   there are no files left */
+static SDL_bool
+StartTransfer(Transfer *transfer, int *next_index, int *failures)
+{
+    char name[4096];
+
+    while (*next_index < num_files) {
+        transfer->index = (*next_index)++;
+        GetFileName(transfer->index, name, sizeof (name));
+        transfer->rw = SDL_RWFromFile(name, "rb");
+        if (!transfer->rw) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't open %s: %s\n", name, SDL_GetError());
+            ++*failures;
+            continue;
+        }
+        transfer->start = SDL_GetPerformanceCounter();
+        transfer->request = SDL_RWreadAsync(transfer->rw, 0, transfer->buffer, file_size);
+        if (!transfer->request) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't start reading %s: %s\n", name, SDL_GetError());
+            SDL_RWclose(transfer->rw);
+            ++*failures;
+            continue;
+        }
+        return SDL_TRUE;
+    }
+    transfer->rw = NULL;
+    transfer->request = NULL;
+    return SDL_FALSE;
+}
+
+/* Keeps 'in_flight' files reading at once, returning the number of failures */
+static int
+ReadAsync(double *seconds, double *mean_latency, double *max_latency)
+{
+    Transfer *transfers = (Transfer *) SDL_calloc(in_flight, sizeof (Transfer));
+    const double frequency = (double) SDL_GetPerformanceFrequency();
+    double latency, total_latency = 0.0;
+    Uint64 start;
+    int i, active = 0, completed = 0, next_index = 0, failures = 0;
+
+    *seconds = *mean_latency = *max_latency = 0.0;
+    if (!transfers) {
+        SDL_OutOfMemory();
+        return 1;
+    }
+    for (i = 0; i < in_flight; ++i) {
+        transfers[i].buffer = (Uint8 *) SDL_malloc(file_size);
+        if (!transfers[i].buffer) {
+            SDL_OutOfMemory();
+            failures = 1;
+            in_flight = i;
+            goto done;
+        }
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < in_flight; ++i) {
+        if (StartTransfer(&transfers[i], &next_index, &failures)) {
+            ++active;
+        }
+    }
+    while (active > 0) {
+        SDL_bool progress = SDL_FALSE;
+
+        for (i = 0; i < in_flight; ++i) {
+            Transfer *transfer = &transfers[i];
+            SDL_AsyncStatus status;
+            size_t nread;
+
+            if (!transfer->request ||
+                SDL_GetAsyncReadStatus(transfer->request, NULL) == SDL_ASYNC_PENDING) {
+                continue;
+            }
+
+            latency = (double) (SDL_GetPerformanceCounter() - transfer->start) / frequency;
+            total_latency += latency;
+            *max_latency = SDL_max(*max_latency, latency);
+            ++completed;
+
+            status = SDL_WaitAsyncRead(transfer->request, &nread);
+            SDL_RWclose(transfer->rw);
+            if (status != SDL_ASYNC_COMPLETE) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "File %d: %s\n", transfer->index, SDL_GetError());
+                ++failures;
+            } else {
+                failures += CheckData(transfer->index, transfer->buffer, nread);
+            }
+
+            if (!StartTransfer(transfer, &next_index, &failures)) {
+                --active;
+            }
+            progress = SDL_TRUE;
+        }
+        if (!progress) {
+            SDL_Delay(0);
+        }
+    }
+    *seconds = (double) (SDL_GetPerformanceCounter() - start) / frequency;
+    *mean_latency = completed ? total_latency / completed : 0.0;
+
+  done:
+    for (i = 0; i < in_flight; ++i) {
+        SDL_free(transfers[i].buffer);
+    }
+    SDL_free(transfers);
+    return failures;
+}
+
+int
+main(int argc, char *argv[])
+{
+    double seconds, mean_latency, max_latency, megabytes;
+    int failures = 0;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        directory = argv[1];
+    }
+    if (argc > 2) {
+        num_files = SDL_atoi(argv[2]);
+    }
+    if (argc > 3) {
+        file_size = SDL_atoi(argv[3]);
+    }
+    if (argc > 4) {
+        in_flight = SDL_atoi(argv[4]);
+    }
+    if (num_files < 1 || file_size < 1 || in_flight < 1) {
+        SDL_Log("USAGE: %s [directory] [num_files] [file_size] [in_flight]\n", argv[0]);
+        return 1;
+    }
+
+    if (CreateFiles() < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create files in %s: %s\n", directory, SDL_GetError());
+        RemoveFiles();
+        return 1;
+    }
+    megabytes = (double) num_files * file_size / (1024.0 * 1024.0);
+    SDL_Log("Reading %d files of %d bytes in %s, %d at once\n", num_files, file_size, directory, in_flight);
+
+    failures += ReadSync(&seconds);
+    SDL_Log("  SDL_RWread:      %8.1f MB/sec, %8.3f ms per file\n",
+            megabytes / seconds, seconds * 1000.0 / num_files);
+
+    failures += ReadAsync(&seconds, &mean_latency, &max_latency);
+    SDL_Log("  SDL_RWreadAsync: %8.1f MB/sec, %8.3f ms mean latency, %8.3f ms max latency\n",
+            megabytes / seconds, mean_latency * 1000.0, max_latency * 1000.0);
+
+    RemoveFiles();
+    SDL_Quit();
+    return failures ? 1 : 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,196 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of the audio sample format converters, comparing the portable
+   C converters with each set of vectorized ones, picked in turn with
+   SDL_HINT_AUDIO_SIMD_CONVERTERS.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define DEFAULT_SAMPLES     (1024 * 1024)
+#define DEFAULT_ITERATIONS  100
+
+typedef struct
+{
+    SDL_AudioFormat src_format;
+    SDL_AudioFormat dst_format;
+    const char *name;
+} FormatPair;
+
+static const FormatPair pairs[] = {
+    { AUDIO_S16SYS, AUDIO_F32SYS, "S16 -> F32" },
+    { AUDIO_F32SYS, AUDIO_S16SYS, "F32 -> S16" },
+    { AUDIO_S32SYS, AUDIO_F32SYS, "S32 -> F32" },
+    { AUDIO_F32SYS, AUDIO_S32SYS, "F32 -> S32" },
+    { AUDIO_U8, AUDIO_F32SYS, "U8  -> F32" },
+    { AUDIO_F32SYS, AUDIO_U8, "F32 -> U8 " },
+};
+
+/* Hint values for the converters to try, the portable C ones first */
+static const char *paths[] = { "0", "sse2", "avx2", "neon" };
+static const char *path_names[] = { "C", "SSE2", "AVX2", "NEON" };
+
+static int num_samples = DEFAULT_SAMPLES;
+static int iterations = DEFAULT_ITERATIONS;
+
+static void
+fill_samples(Uint8 *buf, SDL_AudioFormat format, int num)
+{
+    int i;
+
+    for (i = 0; i < num; ++i) {
+        switch (format) {
+        case AUDIO_U8:
+            buf[i] = (Uint8) rand();
+            break;
+        case AUDIO_S16SYS:
+            ((Sint16 *) buf)[i] = (Sint16) rand();
+            break;
+        case AUDIO_S32SYS:
+            ((Sint32 *) buf)[i] = (Sint32) (((Uint32) rand() << 16) ^ (Uint32) rand());
+            break;
+        case AUDIO_F32SYS:
+            ((float *) buf)[i] = ((float) rand() / RAND_MAX) * 2.0f - 1.0f;
+            break;
+        }
+    }
+}
+
+static double
+sample_value(const Uint8 *buf, SDL_AudioFormat format, int i)
+{
+    switch (format) {
+    case AUDIO_U8:
+        return buf[i] / 127.0 - 1.0;
+    case AUDIO_S16SYS:
+        return ((const Sint16 *) buf)[i] / 32767.0;
+    case AUDIO_S32SYS:
+        return ((const Sint32 *) buf)[i] / 2147483647.0;
+    default:
+        return ((const float *) buf)[i];
+    }
+}
+
+/* Returns samples per second, and leaves the converted data in cvt.buf */
+static double
+benchmark(SDL_AudioCVT *cvt, const Uint8 *input, int len)
+{
+    Uint64 total = 0;
+    Uint64 start;
+    int i;
+
+    for (i = 0; i < iterations; ++i) {
+        SDL_memcpy(cvt->buf, input, len);
+        cvt->len = len;
+        start = SDL_GetPerformanceCounter();
+        SDL_ConvertAudio(cvt);
+        total += SDL_GetPerformanceCounter() - start;
+    }
+    return ((double) num_samples * iterations * SDL_GetPerformanceFrequency()) / (double) total;
+}
+
+int
+main(int argc, char *argv[])
+{
+    int i, j, p;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        num_samples = SDL_atoi(argv[1]);
+    }
+    if (argc > 2) {
+        iterations = SDL_atoi(argv[2]);
+    }
+    if (num_samples < 1 || iterations < 1) {
+        SDL_Log("USAGE: %s [num_samples] [iterations]\n", argv[0]);
+        return 1;
+    }
+
+    SDL_Log("CPU features: SSE2 %s, AVX2 %s, NEON built in %s\n",
+            SDL_HasSSE2() ? "yes" : "no", SDL_HasAVX2() ? "yes" : "no",
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+            "yes"
+#else
+            "no"
+#endif
+            );
+    SDL_Log("Converting %d samples %d times (Msamples/sec, - if not available)\n", num_samples, iterations);
+    SDL_Log("              %10s %10s %10s %10s   max difference\n",
+            path_names[0], path_names[1], path_names[2], path_names[3]);
+
+    srand(0);
+    for (i = 0; i < SDL_arraysize(pairs); ++i) {
+        const FormatPair *pair = &pairs[i];
+        const int len = num_samples * (SDL_AUDIO_BITSIZE(pair->src_format) / 8);
+        char rates[SDL_arraysize(paths)][16];
+        SDL_AudioCVT scalar_cvt, cvt;
+        double maxdiff = 0.0;
+        Uint8 *input;
+
+        SDL_SetHint(SDL_HINT_AUDIO_SIMD_CONVERTERS, paths[0]);
+        SDL_BuildAudioCVT(&scalar_cvt, pair->src_format, 1, 48000, pair->dst_format, 1, 48000);
+
+        input = (Uint8 *) SDL_malloc(len);
+        scalar_cvt.buf = (Uint8 *) SDL_malloc(len * scalar_cvt.len_mult);
+        if (!input || !scalar_cvt.buf) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+            return 1;
+        }
+        fill_samples(input, pair->src_format, num_samples);
+        SDL_snprintf(rates[0], sizeof (rates[0]), "%.1f", benchmark(&scalar_cvt, input, len) / 1000000.0);
+
+        for (p = 1; p < SDL_arraysize(paths); ++p) {
+            SDL_SetHint(SDL_HINT_AUDIO_SIMD_CONVERTERS, paths[p]);
+            SDL_BuildAudioCVT(&cvt, pair->src_format, 1, 48000, pair->dst_format, 1, 48000);
+
+            /* Falling back to the C converter means this one isn't there */
+            if (cvt.filters[0] == scalar_cvt.filters[0]) {
+                SDL_strlcpy(rates[p], "-", sizeof (rates[p]));
+                continue;
+            }
+
+            cvt.buf = (Uint8 *) SDL_malloc(len * cvt.len_mult);
+            if (!cvt.buf) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+                return 1;
+            }
+            SDL_snprintf(rates[p], sizeof (rates[p]), "%.1f", benchmark(&cvt, input, len) / 1000000.0);
+
+            for (j = 0; j < num_samples; ++j) {
+                const double diff = SDL_fabs(sample_value(scalar_cvt.buf, pair->dst_format, j) -
+                                             sample_value(cvt.buf, pair->dst_format, j));
+                if (diff > maxdiff) {
+                    maxdiff = diff;
+                }
+            }
+            SDL_free(cvt.buf);
+        }
+
+        SDL_Log("  %s  %10s %10s %10s %10s   %g\n", pair->name,
+                rates[0], rates[1], rates[2], rates[3], maxdiff);
+
+        SDL_free(scalar_cvt.buf);
+        SDL_free(input);
+    }
+    SDL_SetHint(SDL_HINT_AUDIO_SIMD_CONVERTERS, NULL);
+
+    SDL_Quit();
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,166 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of mixing many voices into one device buffer, comparing a
+   plain C loop, one SDL_MixAudioFormat() call per voice, and a single
+   SDL_MixAudioFormatMulti() call.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define DEFAULT_MAX_VOICES  32
+#define DEFAULT_ITERATIONS  2000
+#define BUFFER_SAMPLES      (4096 * 2)
+
+typedef enum
+{
+    MIX_C,
+    MIX_SEQUENTIAL,
+    MIX_MULTI
+} MixMethod;
+
+static int iterations = DEFAULT_ITERATIONS;
+
+static void
+mix_c(Uint8 *dst, const Uint8 **src, SDL_AudioFormat format, int voices, const int *volume)
+{
+    int i, j;
+
+    for (j = 0; j < voices; ++j) {
+        if (format == AUDIO_S16SYS) {
+            Sint16 *dst16 = (Sint16 *) dst;
+            const Sint16 *src16 = (const Sint16 *) src[j];
+            for (i = 0; i < BUFFER_SAMPLES; ++i) {
+                const int sample = dst16[i] + (src16[i] * volume[j]) / SDL_MIX_MAXVOLUME;
+                dst16[i] = (Sint16) SDL_max(SDL_min(sample, 32767), -32768);
+            }
+        } else {
+            float *dst32 = (float *) dst;
+            const float *src32 = (const float *) src[j];
+            for (i = 0; i < BUFFER_SAMPLES; ++i) {
+                dst32[i] += (src32[i] * volume[j]) / SDL_MIX_MAXVOLUME;
+            }
+        }
+    }
+}
+
+/* Returns voice samples mixed per second */
+static double
+benchmark(MixMethod method, SDL_AudioFormat format, Uint8 *dst, const Uint8 **src, int voices, const int *volume)
+{
+    const Uint32 len = BUFFER_SAMPLES * (SDL_AUDIO_BITSIZE(format) / 8);
+    Uint64 start, now;
+    int i, j;
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        SDL_memset(dst, '\0', len);
+        switch (method) {
+        case MIX_C:
+            mix_c(dst, src, format, voices, volume);
+            break;
+        case MIX_SEQUENTIAL:
+            for (j = 0; j < voices; ++j) {
+                SDL_MixAudioFormat(dst, src[j], format, len, volume[j]);
+            }
+            break;
+        case MIX_MULTI:
+            SDL_MixAudioFormatMulti(dst, src, format, len, volume, voices);
+            break;
+        }
+    }
+    now = SDL_GetPerformanceCounter();
+
+    return ((double) BUFFER_SAMPLES * voices * iterations * SDL_GetPerformanceFrequency()) / (double) (now - start);
+}
+
+int
+main(int argc, char *argv[])
+{
+    static const SDL_AudioFormat formats[] = { AUDIO_S16SYS, AUDIO_F32SYS };
+    int max_voices = DEFAULT_MAX_VOICES;
+    const Uint8 **src;
+    Uint8 *dst;
+    int *volume;
+    int i, j, voices;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        max_voices = SDL_atoi(argv[1]);
+    }
+    if (argc > 2) {
+        iterations = SDL_atoi(argv[2]);
+    }
+    if (max_voices < 1 || iterations < 1) {
+        SDL_Log("USAGE: %s [max_voices] [iterations]\n", argv[0]);
+        return 1;
+    }
+
+    dst = (Uint8 *) SDL_malloc(BUFFER_SAMPLES * sizeof (float));
+    src = (const Uint8 **) SDL_malloc(max_voices * sizeof (*src));
+    volume = (int *) SDL_malloc(max_voices * sizeof (*volume));
+    if (!dst || !src || !volume) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+        return 1;
+    }
+
+    srand(0);
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        const SDL_AudioFormat format = formats[i];
+
+        for (j = 0; j < max_voices; ++j) {
+            Uint8 *buf = (Uint8 *) SDL_malloc(BUFFER_SAMPLES * sizeof (float));
+            int k;
+            if (!buf) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+                return 1;
+            }
+            for (k = 0; k < BUFFER_SAMPLES; ++k) {
+                if (format == AUDIO_S16SYS) {
+                    ((Sint16 *) buf)[k] = (Sint16) (rand() % 8192 - 4096);
+                } else {
+                    ((float *) buf)[k] = ((float) rand() / RAND_MAX) * 0.25f - 0.125f;
+                }
+            }
+            src[j] = buf;
+            volume[j] = (j & 1) ? SDL_MIX_MAXVOLUME : SDL_MIX_MAXVOLUME / 2;
+        }
+
+        SDL_Log("%s, %d samples per buffer (Msamples/sec)\n",
+                format == AUDIO_S16SYS ? "AUDIO_S16SYS" : "AUDIO_F32SYS", BUFFER_SAMPLES);
+        SDL_Log("  voices          C   SDL_MixAudioFormat   SDL_MixAudioFormatMulti\n");
+        for (voices = 1; voices <= max_voices; voices *= 2) {
+            const double c = benchmark(MIX_C, format, dst, src, voices, volume);
+            const double sequential = benchmark(MIX_SEQUENTIAL, format, dst, src, voices, volume);
+            const double multi = benchmark(MIX_MULTI, format, dst, src, voices, volume);
+            SDL_Log("  %6d %10.1f %20.1f %25.1f\n", voices,
+                    c / 1000000.0, sequential / 1000000.0, multi / 1000000.0);
+        }
+
+        for (j = 0; j < max_voices; ++j) {
+            SDL_free((void *) src[j]);
+        }
+    }
+
+    SDL_free(volume);
+    SDL_free(src);
+    SDL_free(dst);
+    SDL_Quit();
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -968,6 +968,750 @@ int audio_openCloseAudioDeviceConnected()
 }
 
 
+/**
+ * \brief Converts audio through an SDL_AudioStream in odd sized pieces and
+ *        compares the result with SDL_ConvertAudio() on the whole buffer.
+ *
+ * \sa https://wiki.libsdl.org/SDL_NewAudioStream
+ * \sa https://wiki.libsdl.org/SDL_AudioStreamPut
+ * \sa https://wiki.libsdl.org/SDL_AudioStreamGet
+ * \sa https://wiki.libsdl.org/SDL_AudioStreamFlush
+ */
+int audio_convertAudioStream()
+{
+  const int frames = 8000;
+  const int len = frames * 2 * sizeof (Sint16);
+  SDL_AudioStream *stream;
+  SDL_AudioCVT cvt;
+  Sint16 *data;
+  float *expected;
+  float *actual;
+  float maxdiff = 0.0f;
+  int expected_frames;
+  int actual_len = 0;
+  int result;
+  int pos, i;
+
+  data = (Sint16 *)SDL_malloc(len);
+  SDLTest_AssertCheck(data != NULL, "Check data buffer is not NULL");
+  if (data == NULL) return TEST_ABORTED;
+  for (i = 0; i < frames * 2; i++) {
+    data[i] = (Sint16)SDLTest_RandomSint16();
+  }
+
+  /* Convert the whole buffer at once for reference */
+  result = SDL_BuildAudioCVT(&cvt, AUDIO_S16SYS, 2, 44100, AUDIO_F32SYS, 2, 48000);
+  SDLTest_AssertPass("Call to SDL_BuildAudioCVT(AUDIO_S16SYS,2,44100 ==> AUDIO_F32SYS,2,48000)");
+  SDLTest_AssertCheck(result == 1, "Verify result value; expected: 1, got: %i", result);
+  cvt.len = len;
+  cvt.buf = (Uint8 *)SDL_malloc(len * cvt.len_mult);
+  actual = (float *)SDL_malloc(len * cvt.len_mult);
+  SDLTest_AssertCheck(cvt.buf != NULL && actual != NULL, "Check conversion buffers are not NULL");
+  if (cvt.buf == NULL || actual == NULL) return TEST_ABORTED;
+  SDL_memcpy(cvt.buf, data, len);
+  result = SDL_ConvertAudio(&cvt);
+  SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0; got: %i", result);
+  expected = (float *)cvt.buf;
+  expected_frames = cvt.len_cvt / (2 * sizeof (float));
+
+  stream = SDL_NewAudioStream(AUDIO_S16SYS, 2, 44100, AUDIO_F32SYS, 2, 48000);
+  SDLTest_AssertPass("Call to SDL_NewAudioStream(AUDIO_S16SYS,2,44100 ==> AUDIO_F32SYS,2,48000)");
+  SDLTest_AssertCheck(stream != NULL, "Verify stream is not NULL");
+  if (stream == NULL) return TEST_ABORTED;
+
+  /* Put it in pieces that split sample frames, reading as we go */
+  for (pos = 0; pos < len; ) {
+    int chunk = SDLTest_RandomIntegerInRange(1, 1000);
+    if (chunk > len - pos) {
+      chunk = len - pos;
+    }
+    result = SDL_AudioStreamPut(stream, (Uint8 *)data + pos, chunk);
+    SDLTest_AssertCheck(result == 0, "Verify SDL_AudioStreamPut result; expected: 0; got: %i", result);
+    pos += chunk;
+
+    result = SDL_AudioStreamGet(stream, (Uint8 *)actual + actual_len, 2 * sizeof (float) * 64);
+    SDLTest_AssertCheck(result >= 0, "Verify SDL_AudioStreamGet result; expected: >=0; got: %i", result);
+    if (result > 0) {
+      actual_len += result;
+    }
+  }
+
+  result = SDL_AudioStreamFlush(stream);
+  SDLTest_AssertPass("Call to SDL_AudioStreamFlush()");
+  SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0; got: %i", result);
+  result = SDL_AudioStreamAvailable(stream);
+  SDLTest_AssertCheck(actual_len + result == cvt.len_cvt, "Verify output length; expected: %i; got: %i", cvt.len_cvt, actual_len + result);
+  result = SDL_AudioStreamGet(stream, (Uint8 *)actual + actual_len, result);
+  if (result > 0) {
+    actual_len += result;
+  }
+  SDLTest_AssertCheck(SDL_AudioStreamAvailable(stream) == 0, "Verify stream is empty");
+
+  for (i = 0; i < expected_frames * 2 && i < actual_len / (int)sizeof (float); i++) {
+    const float diff = SDL_fabs(expected[i] - actual[i]);
+    if (diff > maxdiff) {
+      maxdiff = diff;
+    }
+  }
+  SDLTest_AssertCheck(maxdiff < 0.0001f, "Verify stream matches SDL_ConvertAudio(); max difference: %f", maxdiff);
+
+  /* Negative cases */
+  result = SDL_AudioStreamPut(stream, NULL, 4);
+  SDLTest_AssertCheck(result == -1, "Verify SDL_AudioStreamPut(NULL) result; expected: -1; got: %i", result);
+  result = SDL_AudioStreamGet(stream, actual, 3);
+  SDLTest_AssertCheck(result == -1, "Verify SDL_AudioStreamGet() of a partial frame; expected: -1; got: %i", result);
+
+  /* Clearing discards everything */
+  SDL_AudioStreamPut(stream, data, len);
+  SDL_AudioStreamClear(stream);
+  SDLTest_AssertPass("Call to SDL_AudioStreamClear()");
+  result = SDL_AudioStreamAvailable(stream);
+  SDLTest_AssertCheck(result == 0, "Verify available bytes after clear; expected: 0; got: %i", result);
+
+  SDL_FreeAudioStream(stream);
+  SDLTest_AssertPass("Call to SDL_FreeAudioStream()");
+
+  /* Without resampling, everything is available right away */
+  stream = SDL_NewAudioStream(AUDIO_U8, 1, 22050, AUDIO_S16SYS, 2, 22050);
+  SDLTest_AssertCheck(stream != NULL, "Verify stream is not NULL");
+  if (stream != NULL) {
+    result = SDL_AudioStreamPut(stream, data, 1001);
+    SDLTest_AssertCheck(result == 0, "Verify SDL_AudioStreamPut result; expected: 0; got: %i", result);
+    result = SDL_AudioStreamAvailable(stream);
+    SDLTest_AssertCheck(result == 1001 * 4, "Verify available bytes; expected: %i; got: %i", 1001 * 4, result);
+    SDL_FreeAudioStream(stream);
+  }
+
+  SDL_free(actual);
+  SDL_free(cvt.buf);
+  SDL_free(data);
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Checks that the vectorized sample format converters give the same
+ *        results as the portable ones, including out of range float samples.
+ *
+ * \sa https://wiki.libsdl.org/SDL_BuildAudioCVT
+ * \sa https://wiki.libsdl.org/SDL_ConvertAudio
+ */
+int audio_convertAudioSIMD()
+{
+  const SDL_AudioFormat formats[] = { AUDIO_U8, AUDIO_S16SYS, AUDIO_S32SYS };
+  const int num = 1027; /* not a multiple of any vector size */
+  Uint8 *data, *scalar, *simd;
+  int i, j, result;
+
+  data = (Uint8 *)SDL_malloc(num * sizeof (float));
+  scalar = (Uint8 *)SDL_malloc(num * sizeof (float) * 4);
+  simd = (Uint8 *)SDL_malloc(num * sizeof (float) * 4);
+  SDLTest_AssertCheck(data != NULL && scalar != NULL && simd != NULL, "Check buffers are not NULL");
+  if (data == NULL || scalar == NULL || simd == NULL) return TEST_ABORTED;
+
+  for (i = 0; i < SDL_arraysize(formats); i++) {
+    const SDL_AudioFormat format = formats[i];
+    const char *name = (format == AUDIO_U8) ? "AUDIO_U8" : (format == AUDIO_S16SYS) ? "AUDIO_S16SYS" : "AUDIO_S32SYS";
+    const int bytes = SDL_AUDIO_BITSIZE(format) / 8;
+    Sint64 maxdiff;
+
+    for (j = 0; j < 2; j++) {
+      SDL_AudioFormat src_format = (j == 0) ? format : AUDIO_F32SYS;
+      SDL_AudioFormat dst_format = (j == 0) ? AUDIO_F32SYS : format;
+      SDL_AudioCVT scalar_cvt, simd_cvt;
+      const int len = num * SDL_AUDIO_BITSIZE(src_format) / 8;
+      int k;
+
+      if (src_format == AUDIO_F32SYS) {
+        float *samples = (float *)data;
+        for (k = 0; k < num; k++) {
+          samples[k] = (float)SDLTest_RandomUnitDouble() * 2.0f - 1.0f;
+        }
+        samples[0] = 1.0f;
+        samples[1] = -1.0f;
+        samples[2] = 0.0f;
+        samples[3] = 1.5f;
+        samples[4] = -100000.0f;
+        samples[num - 1] = 3.0f;
+      } else {
+        for (k = 0; k < len; k++) {
+          data[k] = SDLTest_RandomUint8();
+        }
+      }
+
+      SDL_SetHint(SDL_HINT_AUDIO_SIMD_CONVERTERS, "0");
+      result = SDL_BuildAudioCVT(&scalar_cvt, src_format, 2, 44100, dst_format, 2, 44100);
+      SDLTest_AssertCheck(result == 1, "Verify result value; expected: 1, got: %i", result);
+      SDL_SetHint(SDL_HINT_AUDIO_SIMD_CONVERTERS, "1");
+      result = SDL_BuildAudioCVT(&simd_cvt, src_format, 2, 44100, dst_format, 2, 44100);
+      SDLTest_AssertPass("Call to SDL_BuildAudioCVT(%s ==> %s)", (j == 0) ? name : "AUDIO_F32SYS", (j == 0) ? "AUDIO_F32SYS" : name);
+      SDLTest_AssertCheck(result == 1, "Verify result value; expected: 1, got: %i", result);
+
+      scalar_cvt.buf = scalar;
+      scalar_cvt.len = len;
+      SDL_memcpy(scalar, data, len);
+      simd_cvt.buf = simd;
+      simd_cvt.len = len;
+      SDL_memcpy(simd, data, len);
+      SDL_ConvertAudio(&scalar_cvt);
+      result = SDL_ConvertAudio(&simd_cvt);
+      SDLTest_AssertCheck(result == 0, "Verify result value; expected: 0, got: %i", result);
+      SDLTest_AssertCheck(scalar_cvt.len_cvt == simd_cvt.len_cvt, "Verify converted lengths match; expected: %i, got: %i", scalar_cvt.len_cvt, simd_cvt.len_cvt);
+
+      /* The portable converters don't clamp, skip the out of range samples */
+      maxdiff = 0;
+      for (k = (j == 0) ? 0 : 5; k < num - 1; k++) {
+        if (j == 0) {
+          const float a = ((float *)scalar)[k];
+          const float b = ((float *)simd)[k];
+          if (SDL_fabs(a - b) > 0.000001) {
+            maxdiff = 1;
+          }
+        } else if (bytes == 1) {
+          maxdiff = SDL_max(maxdiff, SDL_abs(scalar[k] - simd[k]));
+        } else if (bytes == 2) {
+          maxdiff = SDL_max(maxdiff, SDL_abs(((Sint16 *)scalar)[k] - ((Sint16 *)simd)[k]));
+        } else {
+          const Sint64 diff = (Sint64)((Sint32 *)scalar)[k] - ((Sint32 *)simd)[k];
+          maxdiff = SDL_max(maxdiff, (diff < 0) ? -diff : diff);
+        }
+      }
+      SDLTest_AssertCheck(maxdiff <= ((bytes == 4) ? 256 : 0), "Verify converters agree; max difference: %" SDL_PRIs64, maxdiff);
+
+      if (j == 1) {
+        Sint64 top, bottom;
+        if (bytes == 1) {
+          top = simd[num - 1];
+          bottom = simd[4];
+          SDLTest_AssertCheck(top == 254 && bottom == 0, "Verify out of range samples are clamped; got: %" SDL_PRIs64 ", %" SDL_PRIs64, top, bottom);
+        } else if (bytes == 2) {
+          top = ((Sint16 *)simd)[num - 1];
+          bottom = ((Sint16 *)simd)[4];
+          SDLTest_AssertCheck(top == 32767 && bottom <= -32767, "Verify out of range samples are clamped; got: %" SDL_PRIs64 ", %" SDL_PRIs64, top, bottom);
+        } else {
+          top = ((Sint32 *)simd)[num - 1];
+          bottom = ((Sint32 *)simd)[4];
+          SDLTest_AssertCheck(top == 2147483647 && bottom <= -2147483647, "Verify out of range samples are clamped; got: %" SDL_PRIs64 ", %" SDL_PRIs64, top, bottom);
+        }
+      }
+    }
+  }
+
+  SDL_SetHint(SDL_HINT_AUDIO_SIMD_CONVERTERS, NULL);
+  SDL_free(simd);
+  SDL_free(scalar);
+  SDL_free(data);
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Mixes S16 and F32 buffers and compares them with a reference mix.
+ *
+ * \sa https://wiki.libsdl.org/SDL_MixAudioFormat
+ * \sa https://wiki.libsdl.org/SDL_MixAudioFormatMulti
+ */
+int audio_mixAudioFormat()
+{
+  const int num = 1021; /* not a multiple of any vector size */
+  const int num_src = 5;
+  Sint16 *dst16, *expected16, *src16[5];
+  float *dst32, *expected32, *src32[5];
+  Sint8 dst8[64], expected8[64], src8[5][64];
+  int volume[5];
+  int i, j, errors;
+
+  dst16 = (Sint16 *)SDL_malloc(num * sizeof (Sint16) * (num_src + 2));
+  dst32 = (float *)SDL_malloc(num * sizeof (float) * (num_src + 2));
+  SDLTest_AssertCheck(dst16 != NULL && dst32 != NULL, "Check buffers are not NULL");
+  if (dst16 == NULL || dst32 == NULL) return TEST_ABORTED;
+  expected16 = dst16 + num;
+  expected32 = dst32 + num;
+  for (j = 0; j < num_src; j++) {
+    src16[j] = expected16 + (j + 1) * num;
+    src32[j] = expected32 + (j + 1) * num;
+    volume[j] = (j == 0) ? SDL_MIX_MAXVOLUME : SDLTest_RandomIntegerInRange(1, SDL_MIX_MAXVOLUME);
+    for (i = 0; i < num; i++) {
+      src16[j][i] = SDLTest_RandomSint16();
+      src32[j][i] = (float)SDLTest_RandomUnitDouble() * 2.0f - 1.0f;
+    }
+  }
+  for (i = 0; i < num; i++) {
+    dst16[i] = SDLTest_RandomSint16();
+    dst32[i] = (float)SDLTest_RandomUnitDouble() * 2.0f - 1.0f;
+  }
+
+  /* One source at a time, clipping after each one */
+  SDL_memcpy(expected16, dst16, num * sizeof (Sint16));
+  for (j = 0; j < num_src; j++) {
+    for (i = 0; i < num; i++) {
+      const int sample = expected16[i] + (src16[j][i] * volume[j]) / SDL_MIX_MAXVOLUME;
+      expected16[i] = (Sint16)SDL_max(SDL_min(sample, 32767), -32768);
+    }
+    SDL_MixAudioFormat((Uint8 *)dst16, (const Uint8 *)src16[j], AUDIO_S16SYS, num * sizeof (Sint16), volume[j]);
+  }
+  SDLTest_AssertPass("Call to SDL_MixAudioFormat(AUDIO_S16SYS)");
+  errors = 0;
+  for (i = 0; i < num; i++) {
+    if (dst16[i] != expected16[i]) errors++;
+  }
+  SDLTest_AssertCheck(errors == 0, "Verify mixed S16 samples; expected: 0 differences, got: %i", errors);
+
+  SDL_memcpy(expected32, dst32, num * sizeof (float));
+  for (j = 0; j < num_src; j++) {
+    for (i = 0; i < num; i++) {
+      expected32[i] += (src32[j][i] * (float)volume[j]) * (1.0f / SDL_MIX_MAXVOLUME);
+    }
+    SDL_MixAudioFormat((Uint8 *)dst32, (const Uint8 *)src32[j], AUDIO_F32SYS, num * sizeof (float), volume[j]);
+  }
+  SDLTest_AssertPass("Call to SDL_MixAudioFormat(AUDIO_F32SYS)");
+  errors = 0;
+  for (i = 0; i < num; i++) {
+    if (SDL_fabs(dst32[i] - expected32[i]) > 0.000001) errors++;
+  }
+  SDLTest_AssertCheck(errors == 0, "Verify mixed F32 samples; expected: 0 differences, got: %i", errors);
+
+  /* All sources at once, clipping only at the end */
+  for (i = 0; i < num; i++) {
+    int sample = dst16[i];
+    float fsample = dst32[i];
+    for (j = 0; j < num_src; j++) {
+      sample += (src16[j][i] * volume[j]) / SDL_MIX_MAXVOLUME;
+      fsample += (src32[j][i] * (float)volume[j]) * (1.0f / SDL_MIX_MAXVOLUME);
+    }
+    expected16[i] = (Sint16)SDL_max(SDL_min(sample, 32767), -32768);
+    expected32[i] = fsample;
+  }
+  SDL_MixAudioFormatMulti((Uint8 *)dst16, (const Uint8 **)src16, AUDIO_S16SYS, num * sizeof (Sint16), volume, num_src);
+  SDLTest_AssertPass("Call to SDL_MixAudioFormatMulti(AUDIO_S16SYS)");
+  errors = 0;
+  for (i = 0; i < num; i++) {
+    if (dst16[i] != expected16[i]) errors++;
+  }
+  SDLTest_AssertCheck(errors == 0, "Verify mixed S16 samples; expected: 0 differences, got: %i", errors);
+
+  SDL_MixAudioFormatMulti((Uint8 *)dst32, (const Uint8 **)src32, AUDIO_F32SYS, num * sizeof (float), volume, num_src);
+  SDLTest_AssertPass("Call to SDL_MixAudioFormatMulti(AUDIO_F32SYS)");
+  errors = 0;
+  for (i = 0; i < num; i++) {
+    if (SDL_fabs(dst32[i] - expected32[i]) > 0.000001) errors++;
+  }
+  SDLTest_AssertCheck(errors == 0, "Verify mixed F32 samples; expected: 0 differences, got: %i", errors);
+
+  /* Other formats mix one source at a time */
+  for (i = 0; i < SDL_arraysize(dst8); i++) {
+    dst8[i] = expected8[i] = (Sint8)SDLTest_RandomSint8();
+    for (j = 0; j < num_src; j++) {
+      src8[j][i] = (Sint8)SDLTest_RandomSint8();
+    }
+  }
+  for (j = 0; j < num_src; j++) {
+    SDL_MixAudioFormat((Uint8 *)expected8, (const Uint8 *)src8[j], AUDIO_S8, sizeof (dst8), volume[j]);
+  }
+  {
+    const Uint8 *srcs[5];
+    for (j = 0; j < num_src; j++) {
+      srcs[j] = (const Uint8 *)src8[j];
+    }
+    SDL_MixAudioFormatMulti((Uint8 *)dst8, srcs, AUDIO_S8, sizeof (dst8), volume, num_src);
+  }
+  SDLTest_AssertPass("Call to SDL_MixAudioFormatMulti(AUDIO_S8)");
+  SDLTest_AssertCheck(SDL_memcmp(dst8, expected8, sizeof (dst8)) == 0, "Verify mixed S8 samples match SDL_MixAudioFormat()");
+
+  SDL_free(dst32);
+  SDL_free(dst16);
+
+  return TEST_COMPLETED;
+}
+
+/**
+ * \brief Queues and dequeues audio on the dummy driver and checks the
+ *        queue statistics.
+ *
+ * \sa https://wiki.libsdl.org/SDL_QueueAudio
+ * \sa https://wiki.libsdl.org/SDL_DequeueAudio
+ * \sa https://wiki.libsdl.org/SDL_GetQueuedAudioSize
+ * \sa https://wiki.libsdl.org/SDL_GetQueuedAudioStats
+ * \sa https://wiki.libsdl.org/SDL_ClearQueuedAudio
+ */
+int audio_queueAudio()
+{
+  SDL_AudioSpec desired;
+  SDL_AudioQueueStats stats;
+  SDL_AudioDeviceID id;
+  Uint8 data[10000];
+  Uint32 size;
+  int result, i;
+
+  /* Switch the running audio subsystem over to the dummy driver */
+  result = SDL_AudioInit("dummy");
+  SDLTest_AssertPass("Call to SDL_AudioInit('dummy')");
+  SDLTest_AssertCheck(result == 0, "Validate result value; expected: 0 got: %d", result);
+  if (result != 0) {
+    SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    _audioSetUp(NULL);
+    return TEST_ABORTED;
+  }
+
+  SDL_zero(desired);
+  desired.freq = 22050;
+  desired.format = AUDIO_S16SYS;
+  desired.channels = 2;
+  desired.samples = 512;
+  desired.callback = NULL;
+  id = SDL_OpenAudioDevice(NULL, 0, &desired, NULL, 0);
+  SDLTest_AssertPass("Call to SDL_OpenAudioDevice()");
+  SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1, got: %i", id);
+  if (id == 0) {
+    SDLTest_LogError("%s", SDL_GetError());
+    SDL_QuitSubSystem(SDL_INIT_AUDIO);
+    _audioSetUp(NULL);
+    return TEST_ABORTED;
+  }
+
+  result = SDL_GetQueuedAudioStats(id, NULL);
+  SDLTest_AssertCheck(result == -1, "Validate SDL_GetQueuedAudioStats(NULL) result; expected: -1, got: %i", result);
+
+  /* The device starts out paused, so nothing drains yet */
+  for (i = 0; i < sizeof (data); i++) {
+    data[i] = (Uint8)i;
+  }
+  for (i = 0; i < 3; i++) {
+    result = SDL_QueueAudio(id, data, sizeof (data));
+    SDLTest_AssertCheck(result == 0, "Validate SDL_QueueAudio result; expected: 0, got: %i", result);
+  }
+  size = SDL_GetQueuedAudioSize(id);
+  SDLTest_AssertCheck(size == 3 * sizeof (data), "Validate queued size; expected: %i, got: %u", (int)(3 * sizeof (data)), size);
+
+  result = SDL_GetQueuedAudioStats(id, &stats);
+  SDLTest_AssertPass("Call to SDL_GetQueuedAudioStats()");
+  SDLTest_AssertCheck(result == 0, "Validate result value; expected: 0, got: %i", result);
+  SDLTest_AssertCheck(stats.queued_bytes == size, "Validate queued_bytes; expected: %u, got: %u", size, stats.queued_bytes);
+  SDLTest_AssertCheck(stats.max_queued_bytes == size, "Validate max_queued_bytes; expected: %u, got: %u", size, stats.max_queued_bytes);
+  SDLTest_AssertCheck(stats.capacity >= size, "Validate capacity; expected: >=%u, got: %u", size, stats.capacity);
+  SDLTest_AssertCheck(stats.underruns == 0, "Validate underruns; expected: 0, got: %u", stats.underruns);
+  SDLTest_AssertCheck(stats.dropped_bytes == 0, "Validate dropped_bytes; expected: 0, got: %u", stats.dropped_bytes);
+
+  SDL_ClearQueuedAudio(id);
+  SDLTest_AssertPass("Call to SDL_ClearQueuedAudio()");
+  size = SDL_GetQueuedAudioSize(id);
+  SDLTest_AssertCheck(size == 0, "Validate queued size; expected: 0, got: %u", size);
+
+  /* Let a short bit of audio drain, then run dry */
+  SDL_QueueAudio(id, data, 4096);
+  SDL_PauseAudioDevice(id, 0);
+  for (i = 0; (i < 100) && (SDL_GetQueuedAudioSize(id) > 0); i++) {
+    SDL_Delay(10);
+  }
+  SDL_Delay(100);
+  size = SDL_GetQueuedAudioSize(id);
+  SDLTest_AssertCheck(size == 0, "Validate queue drained; expected: 0, got: %u", size);
+  SDL_GetQueuedAudioStats(id, &stats);
+  SDLTest_AssertCheck(stats.underruns > 0, "Validate underruns; expected: >0, got: %u", stats.underruns);
+  SDL_CloseAudioDevice(id);
+
+  /* Capture fills the queue for us to dequeue */
+  id = SDL_OpenAudioDevice(NULL, 1, &desired, NULL, 0);
+  SDLTest_AssertPass("Call to SDL_OpenAudioDevice(iscapture=1)");
+  SDLTest_AssertCheck(id > 1, "Validate device ID; expected: >1, got: %i", id);
+  SDL_PauseAudioDevice(id, 0);
+  for (i = 0; (i < 100) && (SDL_GetQueuedAudioSize(id) < sizeof (data)); i++) {
+    SDL_Delay(10);
+  }
+  size = SDL_DequeueAudio(id, data, sizeof (data));
+  SDLTest_AssertPass("Call to SDL_DequeueAudio()");
+  SDLTest_AssertCheck(size == sizeof (data), "Validate dequeued size; expected: %i, got: %u", (int)sizeof (data), size);
+  SDL_GetQueuedAudioStats(id, &stats);
+  SDLTest_AssertCheck(stats.max_queued_bytes >= sizeof (data), "Validate max_queued_bytes; expected: >=%i, got: %u", (int)sizeof (data), stats.max_queued_bytes);
+  SDLTest_AssertCheck(stats.capacity >= 22050 * 4, "Validate capture capacity holds a second; expected: >=%i, got: %u", 22050 * 4, stats.capacity);
+  SDL_CloseAudioDevice(id);
+
+  SDL_QuitSubSystem(SDL_INIT_AUDIO);
+  _audioSetUp(NULL);
+
+  return TEST_COMPLETED;
+}
+
+/* Writes a WAVE with 'blocks' blocks of ADPCM data generated from 'seed' to 'wav', returning its size */
+static int _audio_buildADPCMWAV(Uint8 *wav, Uint16 encoding, Uint16 channels, int blocks, Uint32 seed)
+{
+  const Uint16 blockalign = 256 * channels;
+  Uint16 frames_per_block;
+  Uint8 *p = wav;
+  int i, j, c, fmt_length;
+
+  if (encoding == 0x0002) {
+    frames_per_block = 2 + (blockalign - 7 * channels) * 2 / channels;
+    fmt_length = 16 + 2 + 4 + 7 * 4;
+  } else {
+    frames_per_block = 1 + (blockalign - 4 * channels) / (4 * channels) * 8;
+    fmt_length = 16 + 4;
+  }
+
+  SDL_memcpy(p, "RIFF\0\0\0\0WAVEfmt ", 16);
+  p += 16;
+  *p++ = fmt_length; *p++ = 0; *p++ = 0; *p++ = 0;
+  *p++ = (Uint8)encoding; *p++ = 0;
+  *p++ = (Uint8)channels; *p++ = 0;
+  *p++ = 0x22; *p++ = 0x56; *p++ = 0; *p++ = 0;   /* 22050 Hz */
+  *p++ = 0; *p++ = 0x40; *p++ = 0; *p++ = 0;      /* byte rate, unused */
+  *p++ = blockalign & 0xFF; *p++ = blockalign >> 8;
+  *p++ = 4; *p++ = 0;
+  *p++ = fmt_length - 18; *p++ = 0;
+  *p++ = frames_per_block & 0xFF; *p++ = frames_per_block >> 8;
+  if (encoding == 0x0002) {
+    static const Sint16 coefficients[7][2] = {
+      { 256, 0 }, { 512, -256 }, { 0, 0 }, { 192, 64 }, { 240, 0 }, { 460, -208 }, { 392, -232 }
+    };
+    *p++ = 7; *p++ = 0;
+    for (i = 0; i < 7; i++) {
+      for (j = 0; j < 2; j++) {
+        *p++ = coefficients[i][j] & 0xFF;
+        *p++ = (coefficients[i][j] >> 8) & 0xFF;
+      }
+    }
+  }
+  SDL_memcpy(p, "data", 4);
+  p += 4;
+  *p++ = (blocks * blockalign) & 0xFF; *p++ = ((blocks * blockalign) >> 8) & 0xFF;
+  *p++ = ((blocks * blockalign) >> 16) & 0xFF; *p++ = 0;
+
+  for (i = 0; i < blocks; i++) {
+    Uint8 *block = p;
+    for (j = 0; j < blockalign; j++) {
+      seed = seed * 1103515245 + 12345;
+      p[j] = (Uint8)(seed >> 16);
+    }
+    /* Keep the block headers valid */
+    for (c = 0; c < channels; c++) {
+      if (encoding == 0x0002) {
+        block[c] %= 7;
+      } else {
+        block[c * 4 + 2] %= 89;
+        block[c * 4 + 3] = 0;
+      }
+    }
+    p += blockalign;
+  }
+
+  i = (int)(p - wav) - 8;
+  wav[4] = i & 0xFF; wav[5] = (i >> 8) & 0xFF; wav[6] = (i >> 16) & 0xFF; wav[7] = 0;
+  return (int)(p - wav);
+}
+
+/**
+ * \brief Read ADPCM WAVE files a piece at a time and compare them with SDL_LoadWAV_RW()
+ *
+ * \sa https://wiki.libsdl.org/SDL_LoadWAV_RW
+ */
+int audio_streamWAV()
+{
+  static Uint8 wav[16 * 512 + 128];
+  const Uint16 encodings[] = { 0x0002, 0x0011 };
+  Uint8 *expected, *actual;
+  Uint32 expected_len, frames, frame, offset;
+  SDL_AudioSpec expected_spec, spec;
+  SDL_WAVStream *stream;
+  SDL_RWops *rw;
+  int e, channels, buffered, wav_len, frame_size, piece, result;
+
+  actual = (Uint8 *)SDL_malloc(16 * 1024 * 4);
+  SDLTest_AssertCheck(actual != NULL, "Validate result value; expected: non-NULL got: NULL");
+  if (actual == NULL) {
+    return TEST_ABORTED;
+  }
+
+  for (e = 0; e < SDL_arraysize(encodings); e++) {
+    for (channels = 1; channels <= 2; channels++) {
+      wav_len = _audio_buildADPCMWAV(wav, encodings[e], channels, 16, SDLTest_RandomUint32());
+      if (SDL_LoadWAV_RW(SDL_RWFromConstMem(wav, wav_len), 1, &expected_spec, &expected, &expected_len) == NULL) {
+        SDLTest_AssertCheck(SDL_FALSE, "Call to SDL_LoadWAV_RW(), encoding 0x%.4x, %i channels failed: %s", encodings[e], channels, SDL_GetError());
+        continue;
+      }
+      frame_size = 2 * channels;
+
+      /* From memory, read in place, and through a buffer that isn't */
+      for (buffered = 0; buffered <= 1; buffered++) {
+        rw = SDL_RWFromConstMem(wav, wav_len);
+        if (buffered) {
+          rw = SDL_CreateBufferedRW(rw, 100, SDL_TRUE);
+        }
+        stream = SDL_OpenWAVStream_RW(rw, 1, &spec);
+        SDLTest_AssertPass("Call to SDL_OpenWAVStream_RW(), encoding 0x%.4x, %i channels, buffered %i", encodings[e], channels, buffered);
+        SDLTest_AssertCheck(stream != NULL, "Validate result value; expected: non-NULL got: NULL");
+        if (stream == NULL) {
+          continue;
+        }
+        SDLTest_AssertCheck(spec.freq == expected_spec.freq && spec.format == expected_spec.format &&
+                            spec.channels == expected_spec.channels, "Validate spec matches SDL_LoadWAV_RW()");
+        frames = SDL_GetWAVStreamLength(stream);
+        SDLTest_AssertCheck(frames * frame_size == expected_len, "Validate length; expected: %u got: %u", expected_len / frame_size, frames);
+
+        /* Pieces that don't line up with the blocks */
+        offset = 0;
+        piece = 333 * frame_size + 1;
+        while ((result = SDL_ReadWAVStream(stream, actual + offset, piece)) > 0) {
+          offset += result;
+        }
+        SDLTest_AssertCheck(result == 0, "Validate SDL_ReadWAVStream() at the end; expected: 0 got: %i", result);
+        SDLTest_AssertCheck(offset == expected_len && SDL_memcmp(actual, expected, expected_len) == 0,
+                            "Validate decoded data matches SDL_LoadWAV_RW()");
+        SDLTest_AssertCheck(SDL_TellWAVStream(stream) == frames, "Validate position; expected: %u got: %u", frames, SDL_TellWAVStream(stream));
+
+        /* Seeking into the middle of blocks, backwards and forwards */
+        for (frame = frames - 1; frame > 0; frame = frame * 2 / 3) {
+          result = SDL_SeekWAVStream(stream, frame);
+          SDLTest_AssertCheck(result == 0, "Validate SDL_SeekWAVStream(%u) result; expected: 0 got: %i", frame, result);
+          result = SDL_ReadWAVStream(stream, actual, 100 * frame_size);
+          piece = (int)SDL_min(frames - frame, 100) * frame_size;
+          SDLTest_AssertCheck(result == piece && SDL_memcmp(actual, expected + frame * frame_size, piece) == 0,
+                              "Validate %i bytes read at frame %u match SDL_LoadWAV_RW()", piece, frame);
+        }
+
+        result = SDL_ReadWAVStream(stream, actual, frame_size - 1);
+        SDLTest_AssertCheck(result == -1, "Validate SDL_ReadWAVStream() with a short buffer; expected: -1 got: %i", result);
+        result = SDL_SeekWAVStream(stream, frames + 1);
+        SDLTest_AssertCheck(result == -1, "Validate SDL_SeekWAVStream() past the end; expected: -1 got: %i", result);
+        SDL_CloseWAVStream(stream);
+      }
+      SDL_FreeWAV(expected);
+    }
+  }
+  SDL_free(actual);
+
+  return TEST_COMPLETED;
+}
+
+/* A stream that reads at most 7 bytes (or one object) at a time, like a pipe might */
+static size_t SDLCALL _audio_shortRead(SDL_RWops *context, void *ptr, size_t size, size_t maxnum)
+{
+  return SDL_RWread((SDL_RWops *)context->hidden.unknown.data1, ptr, size, SDL_min(maxnum, SDL_max(7 / size, 1)));
+}
+
+static Sint64 SDLCALL _audio_shortSeek(SDL_RWops *context, Sint64 offset, int whence)
+{
+  return SDL_RWseek((SDL_RWops *)context->hidden.unknown.data1, offset, whence);
+}
+
+static int SDLCALL _audio_shortClose(SDL_RWops *context)
+{
+  SDL_RWclose((SDL_RWops *)context->hidden.unknown.data1);
+  SDL_FreeRW(context);
+  return 0;
+}
+
+static SDL_RWops *_audio_shortReadRW(const void *mem, int size)
+{
+  SDL_RWops *context = SDL_AllocRW();
+  if (context != NULL) {
+    context->seek = _audio_shortSeek;
+    context->read = _audio_shortRead;
+    context->close = _audio_shortClose;
+    context->hidden.unknown.data1 = SDL_RWFromConstMem(mem, size);
+  }
+  return context;
+}
+
+/**
+ * \brief Decode fixed ADPCM and PCM WAVE files and compare them with known output
+ *
+ * \sa https://wiki.libsdl.org/SDL_LoadWAV_RW
+ */
+int audio_streamWAVGolden()
+{
+  /* Lengths and MD5 sums of the SDL 2.0.5 decoder's output for 4 blocks made from seed 0x12345678 */
+  static const struct {
+    Uint16 encoding;
+    int channels;
+    Uint32 length;
+    const char *md5;
+  } golden[] = {
+    { 0x0002, 1, 4000, "ddd82d9fc9045e4943c9e1ac6152e96f" },
+    { 0x0002, 2, 8000, "a6331c6b16e40dbc9c1753fed909d178" },
+    { 0x0011, 1, 4040, "9923fac504307346f8c6b9c39086bf61" },
+    { 0x0011, 2, 8080, "a2da7aba186aaf549194eb838183272a" }
+  };
+  /* 3 channel S16 PCM at 22050 Hz, with a data chunk of 10 frames */
+  static const char pcm_header[] = "RIFF\x60\0\0\0WAVEfmt \x10\0\0\0\x01\0\x03\0\x22\x56\0\0\xcc\x04\x02\0\x06\0\x10\0data\x3c\0\0\0";
+  static Uint8 wav[4 * 512 + 128];
+  Uint8 actual[8192];
+  char md5[33];
+  SDLTest_Md5Context md5Context;
+  SDL_AudioSpec spec;
+  SDL_WAVStream *stream;
+  Uint8 *p;
+  Uint32 offset;
+  int i, j, shortreads, wav_len, result;
+
+  for (i = 0; i < SDL_arraysize(golden) * 2; i++) {
+    shortreads = i % 2;
+    wav_len = _audio_buildADPCMWAV(wav, golden[i / 2].encoding, (Uint16)golden[i / 2].channels, 4, 0x12345678);
+    stream = SDL_OpenWAVStream_RW(shortreads ? _audio_shortReadRW(wav, wav_len) : SDL_RWFromConstMem(wav, wav_len), 1, &spec);
+    SDLTest_AssertPass("Call to SDL_OpenWAVStream_RW(), encoding 0x%.4x, %i channels, short reads %i", golden[i / 2].encoding, golden[i / 2].channels, shortreads);
+    SDLTest_AssertCheck(stream != NULL, "Validate result value; expected: non-NULL got: NULL");
+    if (stream == NULL) {
+      continue;
+    }
+    offset = 0;
+    while ((result = SDL_ReadWAVStream(stream, actual + offset, 1000)) > 0) {
+      offset += result;
+    }
+    SDL_CloseWAVStream(stream);
+    SDLTest_AssertCheck(offset == golden[i / 2].length, "Validate length; expected: %u got: %u", golden[i / 2].length, offset);
+
+    SDLTest_Md5Init(&md5Context);
+    SDLTest_Md5Update(&md5Context, actual, offset);
+    SDLTest_Md5Final(&md5Context);
+    for (j = 0; j < 16; j++) {
+      SDL_snprintf(&md5[j * 2], 3, "%02x", md5Context.digest[j]);
+    }
+    SDLTest_AssertCheck(SDL_strcmp(md5, golden[i / 2].md5) == 0, "Validate decoded data; expected: %s got: %s", golden[i / 2].md5, md5);
+  }
+
+  /* 3 channel PCM through short reads, in pieces that split them mid-frame */
+  p = wav;
+  SDL_memcpy(p, pcm_header, 44);
+  p += 44;
+  for (i = 0; i < 10 * 6; i++) {
+    *p++ = (Uint8)i;
+  }
+  stream = SDL_OpenWAVStream_RW(_audio_shortReadRW(wav, (int)(p - wav)), 1, &spec);
+  SDLTest_AssertPass("Call to SDL_OpenWAVStream_RW(), 3 channel PCM, short reads 1");
+  SDLTest_AssertCheck(stream != NULL, "Validate result value; expected: non-NULL got: NULL");
+  if (stream != NULL) {
+    offset = 0;
+    while ((result = SDL_ReadWAVStream(stream, actual + offset, 4 * 6)) > 0) {
+      offset += result;
+    }
+    SDL_CloseWAVStream(stream);
+    SDLTest_AssertCheck(offset == 10 * 6 && SDL_memcmp(actual, wav + 44, 10 * 6) == 0,
+                        "Validate all 10 frames read in order; expected: %i bytes got: %u", 10 * 6, offset);
+  }
+
+  /* 3 channel PCM whose data chunk claims 10 frames, cut off 2 bytes into the 8th */
+  p = wav;
+  SDL_memcpy(p, pcm_header, 44);
+  p += 44;
+  for (i = 0; i < 7 * 6 + 2; i++) {
+    *p++ = (Uint8)i;
+  }
+  stream = SDL_OpenWAVStream_RW(SDL_RWFromConstMem(wav, (int)(p - wav)), 1, &spec);
+  SDLTest_AssertPass("Call to SDL_OpenWAVStream_RW(), truncated 3 channel PCM");
+  SDLTest_AssertCheck(stream != NULL, "Validate result value; expected: non-NULL got: NULL");
+  if (stream != NULL) {
+    result = SDL_ReadWAVStream(stream, actual, 10 * 6);
+    SDLTest_AssertCheck(result == 7 * 6, "Validate SDL_ReadWAVStream() stops at the last whole frame; expected: %i got: %i", 7 * 6, result);
+    result = SDL_SeekWAVStream(stream, 3);
+    SDLTest_AssertCheck(result == 0, "Validate SDL_SeekWAVStream(3) result; expected: 0 got: %i", result);
+    result = SDL_ReadWAVStream(stream, actual, 4 * 6);
+    SDLTest_AssertCheck(result == 4 * 6 && actual[0] == 3 * 6 && actual[4 * 6 - 1] == 7 * 6 - 1,
+                        "Validate frames 3-6 after seeking back; expected: %i bytes from %i got: %i bytes from %i", 4 * 6, 3 * 6, result, actual[0]);
+    SDL_CloseWAVStream(stream);
+  }
+
+  return TEST_COMPLETED;
+}
+
 
 /* ================= Test Case References ================== */
 
@@ -1022,11 +1766,30 @@ static const SDLTest_TestCaseReference audioTest14 =
 static const SDLTest_TestCaseReference audioTest15 =
         { (SDLTest_TestCaseFp)audio_pauseUnpauseAudio, "audio_pauseUnpauseAudio", "Pause and Unpause audio for various audio specs while testing callback.", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference audioTest16 =
+        { (SDLTest_TestCaseFp)audio_convertAudioStream, "audio_convertAudioStream", "Convert audio in pieces with an SDL_AudioStream.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest17 =
+        { (SDLTest_TestCaseFp)audio_convertAudioSIMD, "audio_convertAudioSIMD", "Compare vectorized sample format converters with the portable ones.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest18 =
+        { (SDLTest_TestCaseFp)audio_mixAudioFormat, "audio_mixAudioFormat", "Mix S16 and F32 audio and compare with a reference mix.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest19 =
+        { (SDLTest_TestCaseFp)audio_queueAudio, "audio_queueAudio", "Queue and dequeue audio and check the queue statistics.", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest20 =
+        { (SDLTest_TestCaseFp)audio_streamWAV, "audio_streamWAV", "Read ADPCM WAVE files a piece at a time and compare them with SDL_LoadWAV_RW().", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference audioTest21 =
+        { (SDLTest_TestCaseFp)audio_streamWAVGolden, "audio_streamWAVGolden", "Decode fixed ADPCM and PCM WAVE files and compare them with known output.", TEST_ENABLED };
+
 /* Sequence of Audio test cases */
 static const SDLTest_TestCaseReference *audioTests[] =  {
     &audioTest1, &audioTest2, &audioTest3, &audioTest4, &audioTest5, &audioTest6,
     &audioTest7, &audioTest8, &audioTest9, &audioTest10, &audioTest11,
-    &audioTest12, &audioTest13, &audioTest14, &audioTest15, NULL
+    &audioTest12, &audioTest13, &audioTest14, &audioTest15, &audioTest16,
+    &audioTest17, &audioTest18, &audioTest19, &audioTest20, &audioTest21, NULL
 };
 
 /* Audio test suite (global) */
@@ -175,6 +175,96 @@ events_addDelEventWatchWithUserdata(void *arg)
 }
 
 
+/**
+ * @brief Test pushing several events and polling them in one call.
+ *
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_PollEvents
+ */
+int
+events_pushAndPollEvents(void *arg)
+{
+   SDL_Event event;
+   SDL_Event events[8];
+   int i;
+   int result;
+
+   /* Start from an empty queue */
+   SDL_PumpEvents();
+   SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+   /* Push some user events */
+   for (i = 0; i < 3; i++) {
+      SDL_zero(event);
+      event.type = SDL_USEREVENT;
+      event.user.code = i;
+      SDL_PushEvent(&event);
+   }
+   SDLTest_AssertPass("Call to SDL_PushEvent()");
+
+   /* Poll for them all at once */
+   result = SDL_PollEvents(events, SDL_arraysize(events));
+   SDLTest_AssertPass("Call to SDL_PollEvents()");
+   SDLTest_AssertCheck(result == 3, "Check result from SDL_PollEvents, expected: 3, got: %d", result);
+   for (i = 0; i < result; i++) {
+      SDLTest_AssertCheck(events[i].type == SDL_USEREVENT && events[i].user.code == i, "Check event %d, expected user code: %d, got: %d", i, i, events[i].user.code);
+   }
+
+   /* The queue should now be empty */
+   result = SDL_PollEvents(events, SDL_arraysize(events));
+   SDLTest_AssertCheck(result == 0, "Check result from SDL_PollEvents, expected: 0, got: %d", result);
+
+   /* Invalid parameters */
+   result = SDL_PollEvents(NULL, 1);
+   SDLTest_AssertCheck(result == -1, "Check result from SDL_PollEvents with NULL events, expected: -1, got: %d", result);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Test merging of consecutive mouse motion events.
+ *
+ * @sa http://wiki.libsdl.org/moin.cgi/SDL_HINT_EVENT_COALESCE_MOTION
+ */
+int
+events_coalesceMotion(void *arg)
+{
+   SDL_Event event;
+   SDL_Event events[8];
+   int i;
+   int result;
+
+   SDL_PumpEvents();
+   SDL_FlushEvents(SDL_FIRSTEVENT, SDL_LASTEVENT);
+
+   SDL_SetHint(SDL_HINT_EVENT_COALESCE_MOTION, "1");
+   SDLTest_AssertPass("Call to SDL_SetHint(SDL_HINT_EVENT_COALESCE_MOTION, \"1\")");
+
+   /* Two runs of motion separated by a user event */
+   for (i = 0; i < 5; i++) {
+      SDL_zero(event);
+      event.type = i == 3 ? SDL_USEREVENT : SDL_MOUSEMOTION;
+      event.motion.x = i;
+      event.motion.xrel = 1;
+      SDL_PushEvent(&event);
+   }
+
+   result = SDL_PollEvents(events, SDL_arraysize(events));
+   SDLTest_AssertCheck(result == 3, "Check result from SDL_PollEvents, expected: 3, got: %d", result);
+   if (result == 3) {
+      SDLTest_AssertCheck(events[0].type == SDL_MOUSEMOTION && events[0].motion.x == 2 && events[0].motion.xrel == 3,
+                          "Check merged motion, expected: x=2 xrel=3, got: x=%d xrel=%d", events[0].motion.x, events[0].motion.xrel);
+      SDLTest_AssertCheck(events[1].type == SDL_USEREVENT, "Check that the user event was not merged");
+      SDLTest_AssertCheck(events[2].type == SDL_MOUSEMOTION && events[2].motion.x == 4 && events[2].motion.xrel == 1,
+                          "Check trailing motion, expected: x=4 xrel=1, got: x=%d xrel=%d", events[2].motion.x, events[2].motion.xrel);
+   }
+
+   SDL_SetHint(SDL_HINT_EVENT_COALESCE_MOTION, "0");
+   SDLTest_AssertPass("Call to SDL_SetHint(SDL_HINT_EVENT_COALESCE_MOTION, \"0\")");
+
+   return TEST_COMPLETED;
+}
+
+
 /* ================= Test References ================== */
 
 /* Events test cases */
@@ -187,9 +277,15 @@ static const SDLTest_TestCaseReference eventsTest2 =
 static const SDLTest_TestCaseReference eventsTest3 =
         { (SDLTest_TestCaseFp)events_addDelEventWatchWithUserdata, "events_addDelEventWatchWithUserdata", "Adds and deletes an event watch function with userdata", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference eventsTest4 =
+        { (SDLTest_TestCaseFp)events_pushAndPollEvents, "events_pushAndPollEvents", "Pushes several events and polls them in one call", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference eventsTest5 =
+        { (SDLTest_TestCaseFp)events_coalesceMotion, "events_coalesceMotion", "Checks merging of consecutive mouse motion events", TEST_ENABLED };
+
 /* Sequence of Events test cases */
 static const SDLTest_TestCaseReference *eventsTests[] =  {
-    &eventsTest1, &eventsTest2, &eventsTest3, NULL
+    &eventsTest1, &eventsTest2, &eventsTest3, &eventsTest4, &eventsTest5, NULL
 };
 
 /* Events test suite (global) */
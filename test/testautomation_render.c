@@ -766,6 +766,174 @@ render_testBlitBlend (void *arg)
 }
 
 
+/**
+ * @brief Draws a scene that exercises batching: merged runs, state changes
+ *        between them and texture updates in the middle. Helper function.
+ */
+static void
+_drawBatchingScene(SDL_Renderer *r, SDL_Texture *tface, SDL_Surface *face)
+{
+   static const SDL_BlendMode modes[4] = { SDL_BLENDMODE_NONE, SDL_BLENDMODE_BLEND, SDL_BLENDMODE_ADD, SDL_BLENDMODE_MOD };
+   SDL_Rect rect, viewport;
+   SDL_Point points[16];
+   int i;
+
+   SDL_SetRenderDrawColor(r, 10, 20, 30, 255);
+   SDL_RenderClear(r);
+
+   for (i = 0; i < 16; i++) {
+      SDL_SetRenderDrawBlendMode(r, modes[i % 2]);
+      SDL_SetRenderDrawColor(r, (Uint8)(i * 16), (Uint8)(255 - i * 16), 128, (Uint8)(100 + i * 8));
+      rect.x = i * 4;
+      rect.y = i * 3;
+      rect.w = 20;
+      rect.h = 12;
+      SDL_RenderFillRect(r, &rect);
+      points[i].x = i * 5;
+      points[i].y = 59 - i * 2;
+   }
+   SDL_SetRenderDrawColor(r, 255, 255, 0, 255);
+   SDL_RenderDrawPoints(r, points, 16);
+   SDL_RenderDrawLines(r, points, 16);
+
+   for (i = 0; i < 8; i++) {
+      SDL_SetTextureColorMod(tface, 255, (Uint8)(i * 32), (Uint8)(255 - i * 32));
+      SDL_SetTextureAlphaMod(tface, (Uint8)(128 + i * 16));
+      SDL_SetTextureBlendMode(tface, modes[i % 4]);
+      rect.x = i * 6;
+      rect.y = i * 3;
+      rect.w = 24 + i * 4;
+      rect.h = 24;
+      SDL_RenderCopy(r, tface, NULL, &rect);
+   }
+
+   /* Copies with the same state are merged into one command */
+   SDL_SetTextureColorMod(tface, 255, 255, 255);
+   SDL_SetTextureAlphaMod(tface, 255);
+   SDL_SetTextureBlendMode(tface, SDL_BLENDMODE_BLEND);
+   for (i = 0; i < 6; i++) {
+      rect.x = 70 - i * 13;
+      rect.y = 40 - i * 2;
+      rect.w = 10 + i * 3;
+      rect.h = 30 - i * 2;
+      SDL_RenderCopy(r, tface, NULL, &rect);
+   }
+   for (i = 0; i < 3; i++) {
+      SDL_RenderCopyEx(r, tface, NULL, &rect, i * 45.0, NULL, (SDL_RendererFlip)i);
+   }
+
+   /* Changing the texture has to draw what was batched with it first */
+   rect.x = 40;
+   rect.y = 30;
+   rect.w = face->w;
+   rect.h = face->h;
+   SDL_RenderCopy(r, tface, NULL, &rect);
+   rect.x = 0;
+   rect.y = 0;
+   rect.h = face->h / 2;
+   SDL_UpdateTexture(tface, &rect, face->pixels, face->pitch);
+   rect.x = 8;
+   rect.y = 36;
+   rect.w = face->w;
+   rect.h = face->h;
+   SDL_RenderCopy(r, tface, NULL, &rect);
+
+   /* So does changing the clip rectangle and viewport */
+   rect.x = 10;
+   rect.y = 10;
+   rect.w = 30;
+   rect.h = 20;
+   SDL_RenderSetClipRect(r, &rect);
+   SDL_SetRenderDrawColor(r, 0, 255, 255, 255);
+   SDL_RenderFillRect(r, NULL);
+   SDL_RenderSetClipRect(r, NULL);
+   viewport.x = 50;
+   viewport.y = 5;
+   viewport.w = 30;
+   viewport.h = 30;
+   SDL_RenderSetViewport(r, &viewport);
+   SDL_RenderCopyEx(r, tface, NULL, NULL, 30.0, NULL, SDL_FLIP_HORIZONTAL);
+   SDL_RenderSetViewport(r, NULL);
+}
+
+/**
+ * @brief Compares what each render driver that can batch draws with and without batching.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_HINT_RENDER_BATCHING
+ * http://wiki.libsdl.org/moin.cgi/SDL_RenderReadPixels
+ */
+int
+render_testBatching (void *arg)
+{
+   const int size = 4 * TESTRENDER_SCREEN_W * TESTRENDER_SCREEN_H;
+   SDL_RendererInfo info;
+   SDL_Window *w;
+   SDL_Renderer *r;
+   SDL_Texture *tface;
+   SDL_Surface *face;
+   Uint8 *pixels[2];
+   char *hint;
+   int i, batching, ret, failures, compared = 0;
+
+   face = SDLTest_ImageFace();
+   pixels[0] = (Uint8 *)SDL_malloc(size);
+   pixels[1] = (Uint8 *)SDL_malloc(size);
+   SDLTest_AssertCheck(face != NULL && pixels[0] != NULL && pixels[1] != NULL, "Verify face and pixel buffers are not NULL");
+   if (face == NULL || pixels[0] == NULL || pixels[1] == NULL) {
+      SDL_FreeSurface(face);
+      SDL_free(pixels[0]);
+      SDL_free(pixels[1]);
+      return TEST_ABORTED;
+   }
+
+   hint = SDL_GetHint(SDL_HINT_RENDER_BATCHING) ? SDL_strdup(SDL_GetHint(SDL_HINT_RENDER_BATCHING)) : NULL;
+   for (i = 0; i < SDL_GetNumRenderDrivers(); i++) {
+      SDL_GetRenderDriverInfo(i, &info);
+      for (batching = 0; batching <= 1; batching++) {
+         SDL_SetHintWithPriority(SDL_HINT_RENDER_BATCHING, batching ? "1" : "0", SDL_HINT_OVERRIDE);
+         w = SDL_CreateWindow("render_testBatching", 0, 0, TESTRENDER_SCREEN_W, TESTRENDER_SCREEN_H, 0);
+         r = w ? SDL_CreateRenderer(w, i, 0) : NULL;
+         tface = r ? SDL_CreateTextureFromSurface(r, face) : NULL;
+         if (tface == NULL) {
+            SDLTest_Log("Skipping %s, it can't be used here: %s", info.name, SDL_GetError());
+            if (r) SDL_DestroyRenderer(r);
+            if (w) SDL_DestroyWindow(w);
+            break;
+         }
+         _drawBatchingScene(r, tface, face);
+         ret = SDL_RenderReadPixels(r, NULL, RENDER_COMPARE_FORMAT, pixels[batching], 4 * TESTRENDER_SCREEN_W);
+         SDLTest_AssertCheck(ret == 0, "Validate result from SDL_RenderReadPixels() with %s, batching %i, expected: 0, got: %i", info.name, batching, ret);
+         SDL_RenderPresent(r);
+         SDL_DestroyTexture(tface);
+         SDL_DestroyRenderer(r);
+         SDL_DestroyWindow(w);
+      }
+      if (batching <= 1) {
+         continue;
+      }
+
+      failures = 0;
+      for (ret = 0; ret < size; ret += 4) {
+         if (SDL_memcmp(&pixels[0][ret], &pixels[1][ret], 4) != 0) failures++;
+      }
+      SDLTest_AssertCheck(failures == 0, "Validate %s draws the same with and without batching, expected: 0 different pixels, got: %i", info.name, failures);
+      compared++;
+   }
+   SDL_SetHintWithPriority(SDL_HINT_RENDER_BATCHING, hint, SDL_HINT_OVERRIDE);
+   SDL_free(hint);
+
+   SDL_FreeSurface(face);
+   SDL_free(pixels[0]);
+   SDL_free(pixels[1]);
+
+   if (compared == 0) {
+      SDLTest_Log("No render driver could be used here, skipping");
+      return TEST_SKIPPED;
+   }
+   return TEST_COMPLETED;
+}
+
 /**
  * @brief Checks to see if functionality is supported. Helper function.
  */
@@ -1085,9 +1253,12 @@ static const SDLTest_TestCaseReference renderTest6 =
 static const SDLTest_TestCaseReference renderTest7 =
         {  (SDLTest_TestCaseFp)render_testBlitBlend, "render_testBlitBlend", "Tests blitting with blending", TEST_DISABLED };
 
+static const SDLTest_TestCaseReference renderTest8 =
+        {  (SDLTest_TestCaseFp)render_testBatching, "render_testBatching", "Compares drawing with and without batching on each render driver", TEST_ENABLED };
+
 /* Sequence of Render test cases */
 static const SDLTest_TestCaseReference *renderTests[] =  {
-    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, NULL
+    &renderTest1, &renderTest2, &renderTest3, &renderTest4, &renderTest5, &renderTest6, &renderTest7, &renderTest8, NULL
 };
 
 /* Render test suite (global) */
@@ -334,6 +334,247 @@ rwops_testFileRead(void)
    return TEST_COMPLETED;
 }
 
+/**
+ * @brief Tests reading from a memory-mapped file and looking at it in place.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RWFromFile
+ * http://wiki.libsdl.org/moin.cgi/SDL_RWGetView
+ */
+int
+rwops_testMappedFileRead(void)
+{
+   SDL_RWops *rw;
+   const char *view;
+   size_t size;
+   Sint64 i;
+   int result;
+
+   /* Files are only mapped with the hint set */
+   rw = SDL_RWFromFile(RWopsReadTestFilename, "rb");
+   SDLTest_AssertCheck(rw != NULL, "Verify opening file with SDL_RWFromFile in read mode does not return NULL");
+   if (rw == NULL) return TEST_ABORTED;
+   view = (const char *)SDL_RWGetView(rw, &size);
+   SDLTest_AssertPass("Call to SDL_RWGetView() succeeded");
+   SDLTest_AssertCheck(view == NULL && size == 0, "Verify file read without the hint has no view");
+   SDL_RWclose(rw);
+
+   SDL_SetHint(SDL_HINT_RWOPS_MMAP, "1");
+   SDLTest_AssertPass("Call to SDL_SetHint(SDL_HINT_RWOPS_MMAP, \"1\") succeeded");
+   rw = SDL_RWFromFile(RWopsReadTestFilename, "rb");
+   SDLTest_AssertCheck(rw != NULL, "Verify opening file with SDL_RWFromFile in read mode does not return NULL");
+   if (rw == NULL) {
+      SDL_SetHint(SDL_HINT_RWOPS_MMAP, NULL);
+      return TEST_ABORTED;
+   }
+
+   /* Same check as SDL_rwops.c, SDL_config.h tells us whether there's mmap() */
+#if defined(HAVE_STDIO_H) && defined(HAVE_MMAP) && !defined(__ANDROID__)
+   SDLTest_AssertCheck(
+      rw->type == SDL_RWOPS_MAPFILE,
+      "Verify RWops type is SDL_RWOPS_MAPFILE; expected: %d, got: %d", SDL_RWOPS_MAPFILE, rw->type);
+
+   /* The view follows the stream position */
+   i = SDL_RWseek(rw, 6, RW_SEEK_SET);
+   SDLTest_AssertCheck(i == (Sint64)6, "Verify seek to 6 with SDL_RWseek (RW_SEEK_SET), expected 6, got %"SDL_PRIs64, i);
+   view = (const char *)SDL_RWGetView(rw, &size);
+   SDLTest_AssertCheck(view != NULL, "Verify SDL_RWGetView() does not return NULL");
+   SDLTest_AssertCheck(size == 6, "Verify view size, expected 6, got %i", (int)size);
+   if (view != NULL) {
+      SDLTest_AssertCheck(SDL_memcmp(view, RWopsHelloWorldCompString + 6, 6) == 0, "Verify view contents");
+   }
+#endif
+
+   /* Reading works the same whether or not it's mapped */
+   _testGenericRWopsValidations( rw, 0 );
+
+   result = SDL_RWclose(rw);
+   SDLTest_AssertPass("Call to SDL_RWclose() succeeded");
+   SDLTest_AssertCheck(result == 0, "Verify result value is 0; got: %d", result);
+
+   /* Files opened for writing aren't mapped */
+   rw = SDL_RWFromFile(RWopsWriteTestFilename, "w+");
+   SDLTest_AssertCheck(rw != NULL, "Verify opening file with SDL_RWFromFile in write mode does not return NULL");
+   if (rw != NULL) {
+      SDLTest_AssertCheck(rw->type != SDL_RWOPS_MAPFILE, "Verify RWops type is not SDL_RWOPS_MAPFILE, got: %d", rw->type);
+      SDLTest_AssertCheck(SDL_RWGetView(rw, &size) == NULL, "Verify SDL_RWGetView() returns NULL");
+      SDL_RWclose(rw);
+   }
+
+   SDL_SetHint(SDL_HINT_RWOPS_MMAP, NULL);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests asynchronous reads from memory and from a file.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_RWreadAsync
+ * http://wiki.libsdl.org/moin.cgi/SDL_WaitAsyncRead
+ */
+int
+rwops_testAsyncRead(void)
+{
+   char buf[3][sizeof(RWopsAlphabetString)];
+   SDL_AsyncRead *requests[3];
+   SDL_AsyncStatus status;
+   SDL_RWops *rw;
+   size_t nread;
+   int i, result;
+
+   rw = SDL_RWFromConstMem(RWopsAlphabetString, sizeof(RWopsAlphabetString) - 1);
+   SDLTest_AssertCheck(rw != NULL, "Verify opening memory with SDL_RWFromConstMem does not return NULL");
+   if (rw == NULL) return TEST_ABORTED;
+
+   /* A whole read, one that runs off the end, and one past the end */
+   SDL_zero(buf);
+   requests[0] = SDL_RWreadAsync(rw, 0, buf[0], 26);
+   requests[1] = SDL_RWreadAsync(rw, 20, buf[1], 10);
+   requests[2] = SDL_RWreadAsync(rw, 30, buf[2], 10);
+   SDLTest_AssertPass("Call to SDL_RWreadAsync() succeeded");
+   for (i = 0; i < 3; i++) {
+      SDLTest_AssertCheck(requests[i] != NULL, "Verify SDL_RWreadAsync() does not return NULL");
+   }
+   if (requests[0] == NULL || requests[1] == NULL || requests[2] == NULL) {
+      SDL_RWclose(rw);
+      return TEST_ABORTED;
+   }
+   status = SDL_WaitAsyncRead(requests[0], &nread);
+   SDLTest_AssertCheck(status == SDL_ASYNC_COMPLETE && nread == 26, "Verify whole read, expected: 26 bytes, got: %i", (int)nread);
+   SDLTest_AssertCheck(SDL_strcmp(buf[0], RWopsAlphabetString) == 0, "Verify read data, expected: %s, got: %s", RWopsAlphabetString, buf[0]);
+   status = SDL_WaitAsyncRead(requests[1], &nread);
+   SDLTest_AssertCheck(status == SDL_ASYNC_COMPLETE && nread == 6, "Verify read at end, expected: 6 bytes, got: %i", (int)nread);
+   SDLTest_AssertCheck(SDL_strcmp(buf[1], "UVWXYZ") == 0, "Verify read data, expected: UVWXYZ, got: %s", buf[1]);
+   status = SDL_WaitAsyncRead(requests[2], &nread);
+   SDLTest_AssertCheck(status == SDL_ASYNC_COMPLETE && nread == 0, "Verify read past end, expected: 0 bytes, got: %i", (int)nread);
+   SDL_RWclose(rw);
+
+   /* Files too */
+   rw = SDL_RWFromFile(RWopsAlphabetFilename, "r");
+   SDLTest_AssertCheck(rw != NULL, "Verify opening file with SDL_RWFromFile in read mode does not return NULL");
+   if (rw == NULL) return TEST_ABORTED;
+   SDL_zero(buf);
+   for (i = 0; i < 3; i++) {
+      requests[i] = SDL_RWreadAsync(rw, 3 + i * 8, buf[i], 5);
+   }
+   SDLTest_AssertCheck(requests[0] && requests[1] && requests[2], "Verify SDL_RWreadAsync() does not return NULL");
+   for (i = 0; i < 3; i++) {
+      if (requests[i] == NULL) continue;
+      status = SDL_WaitAsyncRead(requests[i], &nread);
+      SDLTest_AssertCheck(status == SDL_ASYNC_COMPLETE && nread == 5, "Verify file read, expected: 5 bytes, got: %i", (int)nread);
+      SDLTest_AssertCheck(SDL_strncmp(buf[i], RWopsAlphabetString + 3 + i * 8, 5) == 0, "Verify read data, got: %s", buf[i]);
+   }
+
+   /* A read is either canceled or completes, and has to be waited for either way */
+   requests[0] = SDL_RWreadAsync(rw, 0, buf[0], 26);
+   SDLTest_AssertCheck(requests[0] != NULL, "Verify SDL_RWreadAsync() does not return NULL");
+   if (requests[0] != NULL) {
+      result = SDL_CancelAsyncRead(requests[0]);
+      SDLTest_AssertPass("Call to SDL_CancelAsyncRead() succeeded");
+      status = SDL_WaitAsyncRead(requests[0], &nread);
+      SDLTest_AssertCheck((result == 0 && status == SDL_ASYNC_CANCELED) || (result == -1 && status == SDL_ASYNC_COMPLETE),
+                          "Verify status of canceled read, got: result %i, status %i", result, (int)status);
+   }
+
+   result = SDL_RWclose(rw);
+   SDLTest_AssertCheck(result == 0, "Verify result value is 0; got: %d", result);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests buffered reading and writing on top of files and memory.
+ *
+ * \sa
+ * http://wiki.libsdl.org/moin.cgi/SDL_CreateBufferedRW
+ * http://wiki.libsdl.org/moin.cgi/SDL_FlushBufferedRW
+ */
+int
+rwops_testBufferedRW(void)
+{
+   Uint8 mem[32];
+   SDL_RWops *rw, *source;
+   Uint16 BE16value, LE16value;
+   Uint32 BE32value, LE32value;
+   Uint64 LE64value;
+   int result;
+
+   /* Buffers smaller than the reads and writes in the generic tests */
+   source = SDL_RWFromFile(RWopsReadTestFilename, "r");
+   SDLTest_AssertCheck(source != NULL, "Verify opening file with SDL_RWFromFile in read mode does not return NULL");
+   if (source == NULL) return TEST_ABORTED;
+   rw = SDL_CreateBufferedRW(source, 5, SDL_TRUE);
+   SDLTest_AssertPass("Call to SDL_CreateBufferedRW() succeeded");
+   SDLTest_AssertCheck(rw != NULL, "Verify SDL_CreateBufferedRW() does not return NULL");
+   if (rw == NULL) {
+      SDL_RWclose(source);
+      return TEST_ABORTED;
+   }
+   SDLTest_AssertCheck(
+      rw->type == SDL_RWOPS_BUFFERED,
+      "Verify RWops type is SDL_RWOPS_BUFFERED; expected: %d, got: %d", SDL_RWOPS_BUFFERED, rw->type);
+   _testGenericRWopsValidations( rw, 0 );
+   result = SDL_RWclose(rw);
+   SDLTest_AssertCheck(result == 0, "Verify result value is 0; got: %d", result);
+
+   source = SDL_RWFromFile(RWopsWriteTestFilename, "w+");
+   SDLTest_AssertCheck(source != NULL, "Verify opening file with SDL_RWFromFile in write mode does not return NULL");
+   if (source == NULL) return TEST_ABORTED;
+   rw = SDL_CreateBufferedRW(source, 5, SDL_TRUE);
+   SDLTest_AssertCheck(rw != NULL, "Verify SDL_CreateBufferedRW() does not return NULL");
+   if (rw == NULL) {
+      SDL_RWclose(source);
+      return TEST_ABORTED;
+   }
+   _testGenericRWopsValidations( rw, 1 );
+   result = SDL_RWclose(rw);
+   SDLTest_AssertCheck(result == 0, "Verify result value is 0; got: %d", result);
+
+   /* Values written a field at a time only reach the source when flushed */
+   SDL_memset(mem, 0xAA, sizeof(mem));
+   source = SDL_RWFromMem(mem, sizeof(mem));
+   SDLTest_AssertCheck(source != NULL, "Verify opening memory with SDL_RWFromMem does not return NULL");
+   if (source == NULL) return TEST_ABORTED;
+   rw = SDL_CreateBufferedRW(source, 8, SDL_FALSE);
+   SDLTest_AssertCheck(rw != NULL, "Verify SDL_CreateBufferedRW() does not return NULL");
+   if (rw == NULL) {
+      SDL_RWclose(source);
+      return TEST_ABORTED;
+   }
+   SDL_WriteBE16(rw, 0x1234);
+   SDL_WriteLE16(rw, 0x5678);
+   SDL_WriteBE32(rw, 0x9ABCDEF0);
+   SDLTest_AssertCheck(mem[0] == 0xAA, "Verify buffered writes aren't written yet, got: 0x%.2x", mem[0]);
+   SDL_WriteLE32(rw, 0x0F1E2D3C);
+   SDL_WriteLE64(rw, ((Uint64)0x01234567 << 32) | 0x89ABCDEF);
+   result = SDL_FlushBufferedRW(rw);
+   SDLTest_AssertCheck(result == 0, "Verify result from SDL_FlushBufferedRW(), expected 0, got %d", result);
+   SDLTest_AssertCheck(mem[0] == 0x12 && mem[1] == 0x34 && mem[2] == 0x78 && mem[3] == 0x56,
+                       "Verify flushed bytes, got: 0x%.2x 0x%.2x 0x%.2x 0x%.2x", mem[0], mem[1], mem[2], mem[3]);
+   SDLTest_AssertCheck(SDL_RWtell(source) == 20, "Verify source position after flush, expected 20, got %d", (int)SDL_RWtell(source));
+
+   result = (int)SDL_RWseek(rw, 0, RW_SEEK_SET);
+   SDLTest_AssertCheck(result == 0, "Verify seek to 0, expected 0, got %d", result);
+   BE16value = SDL_ReadBE16(rw);
+   LE16value = SDL_ReadLE16(rw);
+   BE32value = SDL_ReadBE32(rw);
+   LE32value = SDL_ReadLE32(rw);
+   LE64value = SDL_ReadLE64(rw);
+   SDLTest_AssertCheck(BE16value == 0x1234 && LE16value == 0x5678, "Verify 16-bit values read back");
+   SDLTest_AssertCheck(BE32value == 0x9ABCDEF0 && LE32value == 0x0F1E2D3C, "Verify 32-bit values read back");
+   SDLTest_AssertCheck(LE64value == (((Uint64)0x01234567 << 32) | 0x89ABCDEF), "Verify 64-bit value read back");
+   SDLTest_AssertCheck(SDL_RWtell(rw) == 20, "Verify position after reading, expected 20, got %d", (int)SDL_RWtell(rw));
+
+   /* Closing leaves the source where the buffered stream was */
+   result = SDL_RWclose(rw);
+   SDLTest_AssertCheck(result == 0, "Verify result value is 0; got: %d", result);
+   SDLTest_AssertCheck(SDL_RWtell(source) == 20, "Verify source position after close, expected 20, got %d", (int)SDL_RWtell(source));
+   SDL_RWclose(source);
+
+   return TEST_COMPLETED;
+}
+
 /**
  * @brief Tests writing from file.
  *
@@ -733,10 +974,20 @@ static const SDLTest_TestCaseReference rwopsTest9 =
 static const SDLTest_TestCaseReference rwopsTest10 =
         { (SDLTest_TestCaseFp)rwops_testCompareRWFromMemWithRWFromFile, "rwops_testCompareRWFromMemWithRWFromFile", "Compare RWFromMem and RWFromFile RWops for read and seek", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference rwopsTest11 =
+        { (SDLTest_TestCaseFp)rwops_testMappedFileRead, "rwops_testMappedFileRead", "Tests reading from a memory-mapped file", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference rwopsTest12 =
+        { (SDLTest_TestCaseFp)rwops_testAsyncRead, "rwops_testAsyncRead", "Tests asynchronous reads", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference rwopsTest13 =
+        { (SDLTest_TestCaseFp)rwops_testBufferedRW, "rwops_testBufferedRW", "Tests buffered reading and writing", TEST_ENABLED };
+
 /* Sequence of RWops test cases */
 static const SDLTest_TestCaseReference *rwopsTests[] =  {
     &rwopsTest1, &rwopsTest2, &rwopsTest3, &rwopsTest4, &rwopsTest5, &rwopsTest6,
-    &rwopsTest7, &rwopsTest8, &rwopsTest9, &rwopsTest10, NULL
+    &rwopsTest7, &rwopsTest8, &rwopsTest9, &rwopsTest10, &rwopsTest11,
+    &rwopsTest12, &rwopsTest13, NULL
 };
 
 /* RWops test suite (global) */
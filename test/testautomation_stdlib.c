@@ -290,6 +290,126 @@ stdlib_sscanf(void *arg)
   return TEST_COMPLETED;
 }
 
+static int stdlib_custom_allocs;
+static int stdlib_custom_frees;
+static SDL_malloc_func stdlib_real_malloc;
+static SDL_calloc_func stdlib_real_calloc;
+static SDL_realloc_func stdlib_real_realloc;
+static SDL_free_func stdlib_real_free;
+
+static void * SDLCALL stdlib_customMalloc(size_t size)
+{
+  ++stdlib_custom_allocs;
+  return stdlib_real_malloc(size);
+}
+
+static void * SDLCALL stdlib_customCalloc(size_t nmemb, size_t size)
+{
+  ++stdlib_custom_allocs;
+  return stdlib_real_calloc(nmemb, size);
+}
+
+static void * SDLCALL stdlib_customRealloc(void *mem, size_t size)
+{
+  if (!mem) {
+    ++stdlib_custom_allocs;
+  }
+  return stdlib_real_realloc(mem, size);
+}
+
+static void SDLCALL stdlib_customFree(void *mem)
+{
+  ++stdlib_custom_frees;
+  stdlib_real_free(mem);
+}
+
+/**
+ * @brief Call to SDL_SetMemoryFunctions, SDL_GetNumAllocations and SDL_GetNumAllocatedBytes
+ */
+int
+stdlib_memoryFunctions(void *arg)
+{
+  SDL_malloc_func malloc_func;
+  SDL_calloc_func calloc_func;
+  SDL_realloc_func realloc_func;
+  SDL_free_func free_func;
+  int allocations, allocated, freed;
+  Sint64 bytes, allocated_bytes, grown_bytes, freed_bytes, custom_bytes, restored_bytes;
+  void *a, *b, *c;
+  int result, custom_allocated, custom_freed;
+
+  /* Logging allocates too, so everything is measured before it's checked */
+  allocations = SDL_GetNumAllocations();
+  bytes = SDL_GetNumAllocatedBytes();
+  a = SDL_malloc(100);
+  b = SDL_calloc(10, 10);
+  c = SDL_realloc(NULL, 100);
+  allocated = SDL_GetNumAllocations();
+  allocated_bytes = SDL_GetNumAllocatedBytes();
+  c = SDL_realloc(c, 100000);
+  grown_bytes = SDL_GetNumAllocatedBytes();
+  SDL_free(a);
+  SDL_free(b);
+  SDL_free(c);
+  SDL_free(NULL);
+  freed = SDL_GetNumAllocations();
+  freed_bytes = SDL_GetNumAllocatedBytes();
+  SDLTest_AssertPass("Call to SDL_malloc, SDL_calloc, SDL_realloc and SDL_free");
+  SDLTest_AssertCheck(a && b && c, "Check that all blocks were allocated");
+  if (allocations >= 0) {
+    SDLTest_AssertCheck(allocated == allocations + 3, "Check allocations, expected: %d, got: %d", allocations + 3, allocated);
+    SDLTest_AssertCheck(freed == allocations, "Check allocations after free, expected: %d, got: %d", allocations, freed);
+  } else {
+    SDLTest_AssertCheck(allocated == -1 && freed == -1 && bytes == -1, "Check that nothing is counted without SDL_MALLOC_STATS");
+  }
+  if (bytes >= 0) {
+    SDLTest_AssertCheck(allocated_bytes >= bytes + 300, "Check allocated bytes, expected at least: %d, got: %d", (int) (bytes + 300), (int) allocated_bytes);
+    SDLTest_AssertCheck(grown_bytes >= bytes + 100200, "Check allocated bytes after realloc, expected at least: %d, got: %d", (int) (bytes + 100200), (int) grown_bytes);
+  }
+  SDLTest_AssertCheck(freed_bytes == bytes, "Check allocated bytes after free, expected: %d, got: %d", (int) bytes, (int) freed_bytes);
+
+  /* Invalid functions are refused */
+  SDL_GetMemoryFunctions(&stdlib_real_malloc, &stdlib_real_calloc, &stdlib_real_realloc, &stdlib_real_free);
+  SDLTest_AssertPass("Call to SDL_GetMemoryFunctions");
+  SDLTest_AssertCheck(stdlib_real_malloc && stdlib_real_calloc && stdlib_real_realloc && stdlib_real_free, "Check that all memory functions are set");
+  result = SDL_SetMemoryFunctions(stdlib_customMalloc, stdlib_customCalloc, NULL, stdlib_customFree);
+  SDLTest_AssertCheck(result == -1, "Check result of SDL_SetMemoryFunctions with NULL realloc, expected: -1, got: %d", result);
+
+  /* Custom functions get every call until the originals are put back */
+  stdlib_custom_allocs = stdlib_custom_frees = 0;
+  allocations = SDL_GetNumAllocations();
+  result = SDL_SetMemoryFunctions(stdlib_customMalloc, stdlib_customCalloc, stdlib_customRealloc, stdlib_customFree);
+  SDL_GetMemoryFunctions(&malloc_func, &calloc_func, &realloc_func, &free_func);
+  custom_bytes = SDL_GetNumAllocatedBytes();
+  a = SDL_malloc(16);
+  b = SDL_calloc(4, 4);
+  c = SDL_realloc(NULL, 16);
+  c = SDL_realloc(c, 32);
+  custom_allocated = stdlib_custom_allocs;
+  allocated = SDL_GetNumAllocations();
+  SDL_free(a);
+  SDL_free(b);
+  SDL_free(c);
+  custom_freed = stdlib_custom_frees;
+  freed = SDL_GetNumAllocations();
+  SDL_SetMemoryFunctions(stdlib_real_malloc, stdlib_real_calloc, stdlib_real_realloc, stdlib_real_free);
+  restored_bytes = SDL_GetNumAllocatedBytes();
+  SDLTest_AssertCheck(result == 0, "Check result of SDL_SetMemoryFunctions, expected: 0, got: %d", result);
+  SDLTest_AssertCheck(malloc_func == stdlib_customMalloc && calloc_func == stdlib_customCalloc &&
+                      realloc_func == stdlib_customRealloc && free_func == stdlib_customFree,
+                      "Check that SDL_GetMemoryFunctions returns the custom functions");
+  SDLTest_AssertCheck(custom_bytes == -1, "Check allocated bytes with custom functions, expected: -1, got: %d", (int) custom_bytes);
+  SDLTest_AssertCheck(custom_allocated == 3, "Check custom allocations, expected: 3, got: %d", custom_allocated);
+  SDLTest_AssertCheck(custom_freed == 3, "Check custom frees, expected: 3, got: %d", custom_freed);
+  if (allocations >= 0) {
+    SDLTest_AssertCheck(allocated == allocations + 3, "Check allocations, expected: %d, got: %d", allocations + 3, allocated);
+    SDLTest_AssertCheck(freed == allocations, "Check allocations after free, expected: %d, got: %d", allocations, freed);
+  }
+  SDLTest_AssertCheck(restored_bytes >= 0 || bytes < 0, "Check that allocated bytes are counted again with the original functions");
+
+  return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Standard C routine test cases */
@@ -305,9 +425,12 @@ static const SDLTest_TestCaseReference stdlibTest3 =
 static const SDLTest_TestCaseReference stdlibTest4 =
         { (SDLTest_TestCaseFp)stdlib_sscanf, "stdlib_sscanf", "Call to SDL_sscanf", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference stdlibTest5 =
+        { (SDLTest_TestCaseFp)stdlib_memoryFunctions, "stdlib_memoryFunctions", "Call to SDL_SetMemoryFunctions, SDL_GetNumAllocations and SDL_GetNumAllocatedBytes", TEST_ENABLED };
+
 /* Sequence of Standard C routine test cases */
 static const SDLTest_TestCaseReference *stdlibTests[] =  {
-    &stdlibTest1, &stdlibTest2, &stdlibTest3, &stdlibTest4, NULL
+    &stdlibTest1, &stdlibTest2, &stdlibTest3, &stdlibTest4, &stdlibTest5, NULL
 };
 
 /* Standard C routine test suite (global) */
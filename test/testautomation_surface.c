@@ -588,6 +588,297 @@ surface_testBlitBlendLoop(void *arg) {
 
 }
 
+/**
+ * @brief Tests blending and modulation between all the 32-bit RGB formats
+ */
+int
+surface_testBlitBlend8888(void *arg)
+{
+   static const Uint32 formats[] = {
+      SDL_PIXELFORMAT_RGB888, SDL_PIXELFORMAT_BGR888,
+      SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGBA8888,
+      SDL_PIXELFORMAT_ABGR8888, SDL_PIXELFORMAT_BGRA8888
+   };
+   static const SDL_BlendMode modes[] = {
+      SDL_BLENDMODE_NONE, SDL_BLENDMODE_BLEND, SDL_BLENDMODE_ADD, SDL_BLENDMODE_MOD
+   };
+   const int w = 37, h = 3;
+   const Uint8 modR = 200, modG = 100, modB = 50, modA = 150;
+   SDL_Surface *src, *dst;
+   Uint32 *original;
+   int i, j, m, k, modulate, ret, failures, allowable_error;
+
+   original = (Uint32 *)SDL_malloc(w * h * sizeof(Uint32));
+   SDLTest_AssertCheck(original != NULL, "Verify buffer is not NULL");
+   if (original == NULL) return TEST_ABORTED;
+
+   for (i = 0; i < SDL_arraysize(formats); i++) {
+      for (j = 0; j < SDL_arraysize(formats); j++) {
+         src = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, formats[i]);
+         dst = SDL_CreateRGBSurfaceWithFormat(0, w, h, 32, formats[j]);
+         SDLTest_AssertCheck(src != NULL && dst != NULL, "Verify surfaces are not NULL");
+         if (src == NULL || dst == NULL) {
+            SDL_FreeSurface(src);
+            SDL_FreeSurface(dst);
+            continue;
+         }
+         for (k = 0; k < w * h; k++) {
+            ((Uint32 *)src->pixels)[k] = SDLTest_RandomUint32();
+         }
+
+         failures = 0;
+         for (m = 0; m < SDL_arraysize(modes); m++) {
+            for (modulate = 0; modulate < 2; modulate++) {
+               if (modes[m] == SDL_BLENDMODE_NONE && !modulate) {
+                  /* Plain format conversion, not what this test is about */
+                  continue;
+               }
+               for (k = 0; k < w * h; k++) {
+                  original[k] = ((Uint32 *)dst->pixels)[k] = SDLTest_RandomUint32();
+               }
+               SDL_SetSurfaceBlendMode(src, modes[m]);
+               SDL_SetSurfaceColorMod(src, modulate ? modR : 255, modulate ? modG : 255, modulate ? modB : 255);
+               SDL_SetSurfaceAlphaMod(src, modulate ? modA : 255);
+               ret = SDL_BlitSurface(src, NULL, dst, NULL);
+               if (ret != 0) failures++;
+
+               /* The dedicated alpha blitters may divide by 256 instead of 255 */
+               allowable_error = (modes[m] == SDL_BLENDMODE_BLEND) ? 3 : 0;
+
+               /* Compare with the arithmetic of the generic blitters */
+               for (k = 0; k < w * h; k++) {
+                  Uint8 sR, sG, sB, sA, dR, dG, dB, dA;
+                  Uint32 expected;
+                  SDL_GetRGBA(((Uint32 *)src->pixels)[k], src->format, &sR, &sG, &sB, &sA);
+                  SDL_GetRGBA(original[k], dst->format, &dR, &dG, &dB, &dA);
+                  if (modulate) {
+                     sR = (sR * modR) / 255;
+                     sG = (sG * modG) / 255;
+                     sB = (sB * modB) / 255;
+                     sA = (sA * modA) / 255;
+                  }
+                  if (modes[m] == SDL_BLENDMODE_BLEND || modes[m] == SDL_BLENDMODE_ADD) {
+                     sR = (sR * sA) / 255;
+                     sG = (sG * sA) / 255;
+                     sB = (sB * sA) / 255;
+                  }
+                  switch (modes[m]) {
+                  case SDL_BLENDMODE_BLEND:
+                     dR = sR + ((255 - sA) * dR) / 255;
+                     dG = sG + ((255 - sA) * dG) / 255;
+                     dB = sB + ((255 - sA) * dB) / 255;
+                     dA = sA + ((255 - sA) * dA) / 255;
+                     break;
+                  case SDL_BLENDMODE_ADD:
+                     dR = SDL_min(sR + dR, 255);
+                     dG = SDL_min(sG + dG, 255);
+                     dB = SDL_min(sB + dB, 255);
+                     break;
+                  case SDL_BLENDMODE_MOD:
+                     dR = (sR * dR) / 255;
+                     dG = (sG * dG) / 255;
+                     dB = (sB * dB) / 255;
+                     break;
+                  default:
+                     dR = sR;
+                     dG = sG;
+                     dB = sB;
+                     dA = sA;
+                     break;
+                  }
+                  expected = SDL_MapRGBA(dst->format, dR, dG, dB, dA);
+                  SDL_GetRGBA(((Uint32 *)dst->pixels)[k], dst->format, &sR, &sG, &sB, &sA);
+                  SDL_GetRGBA(expected, dst->format, &dR, &dG, &dB, &dA);
+                  if (SDL_abs(sR - dR) > allowable_error || SDL_abs(sG - dG) > allowable_error ||
+                      SDL_abs(sB - dB) > allowable_error || SDL_abs(sA - dA) > allowable_error) failures++;
+               }
+            }
+         }
+         SDLTest_AssertCheck(failures == 0, "Validate blits from %s to %s, expected: 0 failures, got: %i",
+                             SDL_GetPixelFormatName(formats[i]), SDL_GetPixelFormatName(formats[j]), failures);
+
+         SDL_FreeSurface(src);
+         SDL_FreeSurface(dst);
+      }
+   }
+
+   SDL_free(original);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests stretching with each scale mode, directly and through a blend
+ */
+int
+surface_testBlitScaledFilter(void *arg)
+{
+   static const Uint32 dst_formats[] = { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB888 };
+   SDL_Surface *src, *dst;
+   SDL_ScaleMode scaleMode;
+   Uint8 r, g, b;
+   int i, k, x, y, ret, failures;
+
+   /* A checkerboard of single black and white pixels */
+   src = SDL_CreateRGBSurfaceWithFormat(0, 40, 40, 32, SDL_PIXELFORMAT_ARGB8888);
+   SDLTest_AssertCheck(src != NULL, "Verify source surface is not NULL");
+   if (src == NULL) return TEST_ABORTED;
+   for (y = 0; y < src->h; y++) {
+      for (x = 0; x < src->w; x++) {
+         ((Uint32 *)src->pixels)[y * src->w + x] = ((x ^ y) & 1) ? 0xFFFFFFFF : 0xFF000000;
+      }
+   }
+
+   ret = SDL_GetSurfaceScaleMode(src, &scaleMode);
+   SDLTest_AssertCheck(ret == 0 && scaleMode == SDL_ScaleModeNearest, "Verify the default scale mode is nearest");
+   ret = SDL_SetSurfaceScaleMode(src, SDL_ScaleModeBest);
+   SDLTest_AssertPass("Call to SDL_SetSurfaceScaleMode(SDL_ScaleModeBest)");
+   ret |= SDL_GetSurfaceScaleMode(src, &scaleMode);
+   SDLTest_AssertCheck(ret == 0 && scaleMode == SDL_ScaleModeBest, "Verify the scale mode was set");
+
+   /* Shrinking it by averaging gives an even gray, whether or not it's blended */
+   for (i = 0; i < SDL_arraysize(dst_formats); i++) {
+      dst = SDL_CreateRGBSurfaceWithFormat(0, 10, 10, 32, dst_formats[i]);
+      SDLTest_AssertCheck(dst != NULL, "Verify destination surface is not NULL");
+      if (dst == NULL) continue;
+      SDL_SetSurfaceBlendMode(src, (i == 0) ? SDL_BLENDMODE_NONE : SDL_BLENDMODE_BLEND);
+      ret = SDL_BlitScaled(src, NULL, dst, NULL);
+      SDLTest_AssertCheck(ret == 0, "Verify result from blitting to %s, expected: 0, got: %i",
+                          SDL_GetPixelFormatName(dst_formats[i]), ret);
+      failures = 0;
+      for (k = 0; k < dst->w * dst->h; k++) {
+         SDL_GetRGB(((Uint32 *)dst->pixels)[k], dst->format, &r, &g, &b);
+         if (SDL_abs(r - 128) > 1 || SDL_abs(g - 128) > 1 || SDL_abs(b - 128) > 1) failures++;
+      }
+      SDLTest_AssertCheck(failures == 0, "Validate averaged pixels in %s, expected: 0 failures, got: %i",
+                          SDL_GetPixelFormatName(dst_formats[i]), failures);
+      SDL_FreeSurface(dst);
+   }
+
+   /* Blending at another size sets the filtering up again */
+   dst = SDL_CreateRGBSurfaceWithFormat(0, 20, 20, 32, SDL_PIXELFORMAT_RGB888);
+   SDLTest_AssertCheck(dst != NULL, "Verify destination surface is not NULL");
+   if (dst != NULL) {
+      ret = SDL_BlitScaled(src, NULL, dst, NULL);
+      SDLTest_AssertCheck(ret == 0, "Verify result from blit, expected: 0, got: %i", ret);
+      failures = 0;
+      for (k = 0; k < dst->w * dst->h; k++) {
+         SDL_GetRGB(((Uint32 *)dst->pixels)[k], dst->format, &r, &g, &b);
+         if (SDL_abs(r - 128) > 1 || SDL_abs(g - 128) > 1 || SDL_abs(b - 128) > 1) failures++;
+      }
+      SDLTest_AssertCheck(failures == 0, "Validate averaged pixels at 20x20, expected: 0 failures, got: %i", failures);
+      SDL_FreeSurface(dst);
+   }
+   SDL_SetSurfaceBlendMode(src, SDL_BLENDMODE_NONE);
+
+   /* Enlarging a black and a white pixel interpolates between them */
+   dst = SDL_CreateRGBSurfaceWithFormat(0, 4, 1, 32, SDL_PIXELFORMAT_ARGB8888);
+   SDLTest_AssertCheck(dst != NULL, "Verify destination surface is not NULL");
+   if (dst != NULL) {
+      static const Uint8 expected[4] = { 0, 64, 191, 255 };
+      SDL_Rect srcrect;
+      srcrect.x = 0;
+      srcrect.y = 0;
+      srcrect.w = 2;
+      srcrect.h = 1;
+      SDL_SetSurfaceScaleMode(src, SDL_ScaleModeLinear);
+      ret = SDL_BlitScaled(src, &srcrect, dst, NULL);
+      SDLTest_AssertCheck(ret == 0, "Verify result from blit, expected: 0, got: %i", ret);
+      failures = 0;
+      for (k = 0; k < 4; k++) {
+         SDL_GetRGB(((Uint32 *)dst->pixels)[k], dst->format, &r, &g, &b);
+         if (SDL_abs(r - expected[k]) > 1 || r != g || r != b) failures++;
+      }
+      SDLTest_AssertCheck(failures == 0, "Validate interpolated pixels, expected: 0 failures, got: %i", failures);
+
+      /* Nearest pixel sampling only ever picks source pixels */
+      SDL_SetSurfaceScaleMode(src, SDL_ScaleModeNearest);
+      ret = SDL_BlitScaled(src, &srcrect, dst, NULL);
+      SDLTest_AssertCheck(ret == 0, "Verify result from blit, expected: 0, got: %i", ret);
+      failures = 0;
+      for (k = 0; k < 4; k++) {
+         SDL_GetRGB(((Uint32 *)dst->pixels)[k], dst->format, &r, &g, &b);
+         if (r != 0 && r != 255) failures++;
+      }
+      SDLTest_AssertCheck(failures == 0, "Validate sampled pixels, expected: 0 failures, got: %i", failures);
+      SDL_FreeSurface(dst);
+   }
+
+   SDL_FreeSurface(src);
+
+   return TEST_COMPLETED;
+}
+
+/**
+ * @brief Tests that blitting the same surfaces to different targets reuses the blit setup
+ */
+int
+surface_testBlitMapCache(void *arg)
+{
+   SDL_Surface *indexed, *rgba, *dst[2];
+   SDL_Color colors[2];
+   Uint64 hits, misses, hits2;
+   Uint32 expected;
+   int i, k, ret, failures;
+
+   indexed = SDL_CreateRGBSurfaceWithFormat(0, 8, 8, 8, SDL_PIXELFORMAT_INDEX8);
+   rgba = SDL_CreateRGBSurfaceWithFormat(0, 8, 8, 32, SDL_PIXELFORMAT_ABGR8888);
+   dst[0] = SDL_CreateRGBSurfaceWithFormat(0, 8, 8, 32, SDL_PIXELFORMAT_ARGB8888);
+   dst[1] = SDL_CreateRGBSurfaceWithFormat(0, 8, 8, 32, SDL_PIXELFORMAT_ARGB8888);
+   SDLTest_AssertCheck(indexed && rgba && dst[0] && dst[1], "Verify surfaces are not NULL");
+   if (!indexed || !rgba || !dst[0] || !dst[1]) {
+      SDL_FreeSurface(indexed);
+      SDL_FreeSurface(rgba);
+      SDL_FreeSurface(dst[0]);
+      SDL_FreeSurface(dst[1]);
+      return TEST_ABORTED;
+   }
+
+   colors[0].r = 0x10; colors[0].g = 0x20; colors[0].b = 0x30; colors[0].a = 0xFF;
+   colors[1].r = 0xC0; colors[1].g = 0xB0; colors[1].b = 0xA0; colors[1].a = 0xFF;
+   SDL_SetPaletteColors(indexed->format->palette, colors, 0, 2);
+   SDL_memset(indexed->pixels, 1, indexed->h * indexed->pitch);
+   SDL_FillRect(rgba, NULL, SDL_MapRGB(rgba->format, 0x40, 0x50, 0x60));
+
+   /* Every switch of target has to set up the blit again */
+   SDL_GetBlitCacheStats(&hits, &misses);
+   for (i = 0; i < 8; i++) {
+      SDL_Surface *src = (i & 2) ? rgba : indexed;
+      SDL_Surface *target = dst[i & 1];
+      ret = SDL_BlitSurface(src, NULL, target, NULL);
+      SDLTest_AssertCheck(ret == 0, "Verify result from blit %i, expected: 0, got: %i", i, ret);
+      expected = (src == indexed) ? 0xFFC0B0A0 : 0xFF405060;
+      failures = 0;
+      for (k = 0; k < target->w * target->h; k++) {
+         if (((Uint32 *)target->pixels)[k] != expected) failures++;
+      }
+      SDLTest_AssertCheck(failures == 0, "Validate pixels of blit %i, expected: 0 failures, got: %i", i, failures);
+   }
+   SDL_GetBlitCacheStats(&hits2, NULL);
+   SDLTest_AssertCheck(hits2 > hits, "Verify blit setup was found in the cache, hits before: %i, after: %i",
+                       (int)hits, (int)hits2);
+
+   /* Changing the palette mustn't pick up the old translation table */
+   colors[1].r = 0x01; colors[1].g = 0x02; colors[1].b = 0x03;
+   SDL_SetPaletteColors(indexed->format->palette, colors, 0, 2);
+   for (i = 0; i < 2; i++) {
+      ret = SDL_BlitSurface(indexed, NULL, dst[i], NULL);
+      SDLTest_AssertCheck(ret == 0, "Verify result from blit, expected: 0, got: %i", ret);
+      failures = 0;
+      for (k = 0; k < dst[i]->w * dst[i]->h; k++) {
+         if (((Uint32 *)dst[i]->pixels)[k] != 0xFF010203) failures++;
+      }
+      SDLTest_AssertCheck(failures == 0, "Validate pixels after palette change, expected: 0 failures, got: %i", failures);
+   }
+
+   SDL_FreeSurface(indexed);
+   SDL_FreeSurface(rgba);
+   SDL_FreeSurface(dst[0]);
+   SDL_FreeSurface(dst[1]);
+
+   return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Surface test cases */
@@ -630,11 +921,21 @@ static const SDLTest_TestCaseReference surfaceTest11 =
 static const SDLTest_TestCaseReference surfaceTest12 =
         { (SDLTest_TestCaseFp)surface_testBlitBlendMod, "surface_testBlitBlendMod", "Tests blitting routines with mod blending mode.", TEST_ENABLED};
 
+static const SDLTest_TestCaseReference surfaceTest13 =
+        { (SDLTest_TestCaseFp)surface_testBlitBlend8888, "surface_testBlitBlend8888", "Tests blending and modulation between all 32-bit RGB formats.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest14 =
+        { (SDLTest_TestCaseFp)surface_testBlitScaledFilter, "surface_testBlitScaledFilter", "Tests stretching with each scale mode.", TEST_ENABLED};
+
+static const SDLTest_TestCaseReference surfaceTest15 =
+        { (SDLTest_TestCaseFp)surface_testBlitMapCache, "surface_testBlitMapCache", "Tests reusing the blit setup between targets.", TEST_ENABLED};
+
 /* Sequence of Surface test cases */
 static const SDLTest_TestCaseReference *surfaceTests[] =  {
     &surfaceTest1, &surfaceTest2, &surfaceTest3, &surfaceTest4, &surfaceTest5,
     &surfaceTest6, &surfaceTest7, &surfaceTest8, &surfaceTest9, &surfaceTest10,
-    &surfaceTest11, &surfaceTest12, NULL
+    &surfaceTest11, &surfaceTest12, &surfaceTest13, &surfaceTest14,
+    &surfaceTest15, NULL
 };
 
 /* Surface test suite (global) */
@@ -172,6 +172,88 @@ timer_addRemoveTimer(void *arg)
   return TEST_COMPLETED;
 }
 
+/**
+ * @brief Call to SDL_DelayNS and SDL_GetTicksNS
+ */
+int
+timer_delayNSAndGetTicksNS(void *arg)
+{
+  const Uint64 testDelay = 1500000;
+  const Uint64 marginOfError = 1000000;
+  Uint64 result;
+  Uint64 result2;
+  Uint64 difference;
+
+  /* Zero delay */
+  SDL_DelayNS(0);
+  SDLTest_AssertPass("Call to SDL_DelayNS(0)");
+
+  result = SDL_GetTicksNS();
+  SDLTest_AssertPass("Call to SDL_GetTicksNS()");
+
+  /* Sub-millisecond delays shouldn't be rounded up to a whole tick */
+  SDL_DelayNS(testDelay);
+  SDLTest_AssertPass("Call to SDL_DelayNS(%"SDL_PRIu64")", testDelay);
+  result2 = SDL_GetTicksNS();
+  SDLTest_AssertPass("Call to SDL_GetTicksNS()");
+  difference = result2 - result;
+  SDLTest_AssertCheck(difference >= testDelay, "Check difference, expected: >=%"SDL_PRIu64", got: %"SDL_PRIu64, testDelay, difference);
+  SDLTest_AssertCheck(difference < (testDelay + marginOfError), "Check difference, expected: <%"SDL_PRIu64", got: %"SDL_PRIu64, testDelay + marginOfError, difference);
+
+  return TEST_COMPLETED;
+}
+
+/* High resolution test callback */
+Uint64 _timerTestCallbackNS(Uint64 interval, void *param)
+{
+   ++_timerCallbackCalled;
+
+   /* Fire three times, then stop */
+   return (_timerCallbackCalled < 3) ? interval : 0;
+}
+
+/**
+ * @brief Call to SDL_AddTimerNS and SDL_RemoveTimer
+ */
+int
+timer_addRemoveTimerNS(void *arg)
+{
+  SDL_TimerID id;
+  SDL_bool result;
+
+  /* Reset state */
+  _paramCheck = 0;
+  _timerCallbackCalled = 0;
+
+  /* Set timer with a long delay */
+  id = SDL_AddTimerNS((Uint64)10000 * 1000000, _timerTestCallbackNS, NULL);
+  SDLTest_AssertPass("Call to SDL_AddTimerNS(10000000000,...)");
+  SDLTest_AssertCheck(id > 0, "Check result value, expected: >0, got: %d", id);
+
+  /* Remove timer again and check that callback was not called */
+  result = SDL_RemoveTimer(id);
+  SDLTest_AssertPass("Call to SDL_RemoveTimer()");
+  SDLTest_AssertCheck(result == SDL_TRUE, "Check result value, expected: %i, got: %i", SDL_TRUE, result);
+  SDLTest_AssertCheck(_timerCallbackCalled == 0, "Check callback WAS NOT called, expected: 0, got: %i", _timerCallbackCalled);
+
+  /* Set a periodic timer with a sub-millisecond interval */
+  id = SDL_AddTimerNS(500000, _timerTestCallbackNS, NULL);
+  SDLTest_AssertPass("Call to SDL_AddTimerNS(500000,...)");
+  SDLTest_AssertCheck(id > 0, "Check result value, expected: >0, got: %d", id);
+
+  /* Wait to let timer trigger callback */
+  SDL_Delay(100);
+  SDLTest_AssertPass("Call to SDL_Delay(100)");
+
+  /* Remove timer again and check that callback was called */
+  result = SDL_RemoveTimer(id);
+  SDLTest_AssertPass("Call to SDL_RemoveTimer()");
+  SDLTest_AssertCheck(result == SDL_FALSE, "Check result value, expected: %i, got: %i", SDL_FALSE, result);
+  SDLTest_AssertCheck(_timerCallbackCalled == 3, "Check callback was called, expected: 3, got: %i", _timerCallbackCalled);
+
+  return TEST_COMPLETED;
+}
+
 /* ================= Test References ================== */
 
 /* Timer test cases */
@@ -187,9 +269,15 @@ static const SDLTest_TestCaseReference timerTest3 =
 static const SDLTest_TestCaseReference timerTest4 =
         { (SDLTest_TestCaseFp)timer_addRemoveTimer, "timer_addRemoveTimer", "Call to SDL_AddTimer and SDL_RemoveTimer", TEST_ENABLED };
 
+static const SDLTest_TestCaseReference timerTest5 =
+        { (SDLTest_TestCaseFp)timer_delayNSAndGetTicksNS, "timer_delayNSAndGetTicksNS", "Call to SDL_DelayNS and SDL_GetTicksNS", TEST_ENABLED };
+
+static const SDLTest_TestCaseReference timerTest6 =
+        { (SDLTest_TestCaseFp)timer_addRemoveTimerNS, "timer_addRemoveTimerNS", "Call to SDL_AddTimerNS and SDL_RemoveTimer", TEST_ENABLED };
+
 /* Sequence of Timer test cases */
 static const SDLTest_TestCaseReference *timerTests[] =  {
-    &timerTest1, &timerTest2, &timerTest3, &timerTest4, NULL
+    &timerTest1, &timerTest2, &timerTest3, &timerTest4, &timerTest5, &timerTest6, NULL
 };
 
 /* Timer test suite (global) */
@@ -0,0 +1,156 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of blending and modulated blits between the 32-bit RGB formats.
+   Run it again with SDL_BLIT_CPU_FEATURES=0 in the environment to compare
+   against the blitters that don't use any SIMD instructions.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define DEFAULT_SIZE        512
+#define DEFAULT_ITERATIONS  50
+
+typedef struct
+{
+    const char *name;
+    SDL_BlendMode blend;
+    SDL_bool modulate;
+} BlitMode;
+
+static const BlitMode modes[] = {
+    { "blend", SDL_BLENDMODE_BLEND, SDL_FALSE },
+    { "blend+mod", SDL_BLENDMODE_BLEND, SDL_TRUE },
+    { "add", SDL_BLENDMODE_ADD, SDL_FALSE },
+    { "mod", SDL_BLENDMODE_MOD, SDL_FALSE },
+    { "colormod", SDL_BLENDMODE_NONE, SDL_TRUE },
+};
+
+static const Uint32 formats[] = {
+    SDL_PIXELFORMAT_RGB888,
+    SDL_PIXELFORMAT_BGR888,
+    SDL_PIXELFORMAT_ARGB8888,
+    SDL_PIXELFORMAT_RGBA8888,
+    SDL_PIXELFORMAT_ABGR8888,
+    SDL_PIXELFORMAT_BGRA8888
+};
+
+static int size = DEFAULT_SIZE;
+static int iterations = DEFAULT_ITERATIONS;
+
+static SDL_Surface *
+CreateRandomSurface(Uint32 format)
+{
+    SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormat(0, size, size, 32, format);
+    int i;
+
+    if (surface) {
+        for (i = 0; i < size * size; ++i) {
+            ((Uint32 *) surface->pixels)[i] = ((Uint32) rand() << 16) ^ (Uint32) rand();
+        }
+    }
+    return surface;
+}
+
+/* Returns pixels blitted per second */
+static double
+Benchmark(SDL_Surface *src, SDL_Surface *dst, const BlitMode *mode)
+{
+    Uint64 start, now;
+    int i;
+
+    SDL_SetSurfaceBlendMode(src, mode->blend);
+    SDL_SetSurfaceColorMod(src, mode->modulate ? 200 : 255, mode->modulate ? 150 : 255, mode->modulate ? 100 : 255);
+    SDL_SetSurfaceAlphaMod(src, mode->modulate ? 128 : 255);
+
+    /* Once to set up the blit mapping */
+    SDL_BlitSurface(src, NULL, dst, NULL);
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        SDL_BlitSurface(src, NULL, dst, NULL);
+    }
+    now = SDL_GetPerformanceCounter();
+
+    return ((double) size * size * iterations * SDL_GetPerformanceFrequency()) / (double) (now - start);
+}
+
+int
+main(int argc, char *argv[])
+{
+    char header[128];
+    int i, j, m;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        size = SDL_atoi(argv[1]);
+    }
+    if (argc > 2) {
+        iterations = SDL_atoi(argv[2]);
+    }
+    if (size < 1 || iterations < 1) {
+        SDL_Log("USAGE: %s [size] [iterations]\n", argv[0]);
+        return 1;
+    }
+
+    SDL_Log("CPU features: SSE2 %s, SSE4.1 %s, AVX2 %s, NEON built in %s\n",
+            SDL_HasSSE2() ? "yes" : "no", SDL_HasSSE41() ? "yes" : "no", SDL_HasAVX2() ? "yes" : "no",
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+            "yes"
+#else
+            "no"
+#endif
+            );
+    SDL_Log("Blitting %dx%d surfaces %d times (Mpixels/sec)\n", size, size, iterations);
+
+    SDL_snprintf(header, sizeof (header), "  %-36s", "");
+    for (m = 0; m < SDL_arraysize(modes); ++m) {
+        SDL_snprintf(header + SDL_strlen(header), sizeof (header) - SDL_strlen(header), " %10s", modes[m].name);
+    }
+    SDL_Log("%s\n", header);
+
+    srand(0);
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        for (j = 0; j < SDL_arraysize(formats); ++j) {
+            SDL_Surface *src = CreateRandomSurface(formats[i]);
+            SDL_Surface *dst = CreateRandomSurface(formats[j]);
+            char line[256];
+
+            if (!src || !dst) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create surfaces: %s\n", SDL_GetError());
+                return 1;
+            }
+
+            SDL_snprintf(line, sizeof (line), "  %-16s -> %-16s",
+                         SDL_GetPixelFormatName(formats[i]) + 16,
+                         SDL_GetPixelFormatName(formats[j]) + 16);
+            for (m = 0; m < SDL_arraysize(modes); ++m) {
+                SDL_snprintf(line + SDL_strlen(line), sizeof (line) - SDL_strlen(line), " %10.1f",
+                             Benchmark(src, dst, &modes[m]) / 1000000.0);
+            }
+            SDL_Log("%s\n", line);
+
+            SDL_FreeSurface(dst);
+            SDL_FreeSurface(src);
+        }
+    }
+
+    SDL_Quit();
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,137 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of writing and parsing a file one field at a time with
+   SDL_WriteLE32() and SDL_ReadLE32(), directly on a file and through
+   SDL_CreateBufferedRW(), checking that every field reads back right.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define DEFAULT_FILE_NAME   "testbufferedrw.dat"
+#define DEFAULT_MEGABYTES   64
+
+static const char *file_name = DEFAULT_FILE_NAME;
+static int num_fields = DEFAULT_MEGABYTES * 1024 * 1024 / 4;
+static size_t buffer_size = 0;
+
+static SDL_RWops *
+OpenFile(const char *mode, SDL_bool buffered)
+{
+    SDL_RWops *rw = SDL_RWFromFile(file_name, mode);
+
+    if (rw && buffered) {
+        SDL_RWops *buffer = SDL_CreateBufferedRW(rw, buffer_size, SDL_TRUE);
+        if (!buffer) {
+            SDL_RWclose(rw);
+        }
+        rw = buffer;
+    }
+    return rw;
+}
+
+/* Returns fields per second, or a negative value on error */
+static double
+WriteFields(SDL_bool buffered)
+{
+    SDL_RWops *rw = OpenFile("wb", buffered);
+    Uint64 start;
+    int i;
+
+    if (!rw) {
+        return -1.0;
+    }
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_fields; ++i) {
+        if (!SDL_WriteLE32(rw, (Uint32) i * 2654435761u)) {
+            SDL_RWclose(rw);
+            return -1.0;
+        }
+    }
+    if (SDL_RWclose(rw) < 0) {
+        return -1.0;
+    }
+    return (double) num_fields * SDL_GetPerformanceFrequency() / (double) (SDL_GetPerformanceCounter() - start);
+}
+
+/* Returns fields per second, or a negative value on error */
+static double
+ReadFields(SDL_bool buffered)
+{
+    SDL_RWops *rw = OpenFile("rb", buffered);
+    Uint64 start;
+    int i;
+
+    if (!rw) {
+        return -1.0;
+    }
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_fields; ++i) {
+        if (SDL_ReadLE32(rw) != (Uint32) i * 2654435761u) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Field %d doesn't match\n", i);
+            SDL_RWclose(rw);
+            return -1.0;
+        }
+    }
+    SDL_RWclose(rw);
+    return (double) num_fields * SDL_GetPerformanceFrequency() / (double) (SDL_GetPerformanceCounter() - start);
+}
+
+int
+main(int argc, char *argv[])
+{
+    double rate[4];
+    int i;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        file_name = argv[1];
+    }
+    if (argc > 2) {
+        num_fields = SDL_atoi(argv[2]) * 1024 * 1024 / 4;
+    }
+    if (argc > 3) {
+        buffer_size = (size_t) SDL_atoi(argv[3]);
+    }
+    if (num_fields < 1) {
+        SDL_Log("USAGE: %s [file] [megabytes] [buffer_size]\n", argv[0]);
+        return 1;
+    }
+
+    SDL_Log("Writing and reading %d fields in %s (Mfields/sec)\n", num_fields, file_name);
+    rate[0] = WriteFields(SDL_FALSE);
+    rate[1] = ReadFields(SDL_FALSE);
+    rate[2] = WriteFields(SDL_TRUE);
+    rate[3] = ReadFields(SDL_TRUE);
+    remove(file_name);
+
+    for (i = 0; i < SDL_arraysize(rate); ++i) {
+        if (rate[i] < 0.0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Test failed: %s\n", SDL_GetError());
+            SDL_Quit();
+            return 1;
+        }
+    }
+    SDL_Log("  %-10s %10s %10s\n", "", "write", "read");
+    SDL_Log("  %-10s %10.1f %10.1f\n", "direct", rate[0] / 1e6, rate[1] / 1e6);
+    SDL_Log("  %-10s %10.1f %10.1f\n", "buffered", rate[2] / 1e6, rate[3] / 1e6);
+
+    SDL_Quit();
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
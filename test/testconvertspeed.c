@@ -0,0 +1,175 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of SDL_ConvertSurface() and SDL_ConvertPixels() on a large
+   image, with 1 up to N threads set in SDL_HINT_SURFACE_THREADS, checking
+   that every thread count gives the same result as one thread.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define DEFAULT_WIDTH       4096
+#define DEFAULT_HEIGHT      4096
+#define DEFAULT_ITERATIONS  5
+
+typedef struct
+{
+    Uint32 src_format;
+    Uint32 dst_format;
+} Conversion;
+
+static const Conversion conversions[] = {
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_ABGR8888 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB24 },
+    { SDL_PIXELFORMAT_RGB24, SDL_PIXELFORMAT_ARGB8888 },
+    { SDL_PIXELFORMAT_RGB565, SDL_PIXELFORMAT_ARGB8888 },
+    { SDL_PIXELFORMAT_ARGB8888, SDL_PIXELFORMAT_RGB565 },
+    { SDL_PIXELFORMAT_INDEX8, SDL_PIXELFORMAT_ARGB8888 }
+};
+
+static int width = DEFAULT_WIDTH;
+static int height = DEFAULT_HEIGHT;
+static int iterations = DEFAULT_ITERATIONS;
+
+/* Converts 'src' the way an application loading it would, returning the
+   last result and the number of megapixels per second */
+static SDL_Surface *
+Convert(SDL_Surface *src, Uint32 dst_format, double *rate)
+{
+    SDL_Surface *dst = NULL;
+    Uint64 start, now;
+    int i;
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        SDL_FreeSurface(dst);
+        if (SDL_ISPIXELFORMAT_INDEXED(src->format->format)) {
+            dst = SDL_ConvertSurfaceFormat(src, dst_format, 0);
+        } else {
+            dst = SDL_CreateRGBSurfaceWithFormat(0, src->w, src->h, 0, dst_format);
+            if (dst) {
+                SDL_ConvertPixels(src->w, src->h, src->format->format, src->pixels, src->pitch,
+                                  dst_format, dst->pixels, dst->pitch);
+            }
+        }
+        if (!dst) {
+            return NULL;
+        }
+    }
+    now = SDL_GetPerformanceCounter();
+
+    *rate = ((double) src->w * src->h * iterations * SDL_GetPerformanceFrequency()) / (double) (now - start) / 1000000.0;
+    return dst;
+}
+
+int
+main(int argc, char *argv[])
+{
+    char line[256], label[64], value[16];
+    int i, j, y, max_threads, failures = 0;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    max_threads = SDL_max(SDL_GetCPUCount(), 2);
+    if (argc > 2) {
+        width = SDL_atoi(argv[1]);
+        height = SDL_atoi(argv[2]);
+    }
+    if (argc > 3) {
+        iterations = SDL_atoi(argv[3]);
+    }
+    if (argc > 4) {
+        max_threads = SDL_atoi(argv[4]);
+    }
+    if (width < 1 || height < 1 || iterations < 1 || max_threads < 1) {
+        SDL_Log("USAGE: %s [width height] [iterations] [max_threads]\n", argv[0]);
+        return 1;
+    }
+
+    SDL_Log("Converting %dx%d images %d times on 1 to %d threads (Mpixels/sec)\n",
+            width, height, iterations, max_threads);
+    SDL_snprintf(line, sizeof (line), "  %-22s", "");
+    for (j = 1; j <= max_threads; ++j) {
+        SDL_snprintf(value, sizeof (value), "%d", j);
+        SDL_snprintf(line + SDL_strlen(line), sizeof (line) - SDL_strlen(line), " %8s", value);
+    }
+    SDL_Log("%s\n", line);
+
+    srand(0);
+    for (i = 0; i < SDL_arraysize(conversions); ++i) {
+        SDL_Surface *src = SDL_CreateRGBSurfaceWithFormat(0, width, height, 0, conversions[i].src_format);
+        SDL_Surface *expected = NULL;
+        const int row_size = width * SDL_BYTESPERPIXEL(conversions[i].dst_format);
+
+        if (!src) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create surface: %s\n", SDL_GetError());
+            return 1;
+        }
+        for (y = 0; y < src->h * src->pitch; ++y) {
+            ((Uint8 *) src->pixels)[y] = (Uint8) rand();
+        }
+        if (src->format->palette) {
+            for (y = 0; y < src->format->palette->ncolors; ++y) {
+                src->format->palette->colors[y].r = (Uint8) rand();
+                src->format->palette->colors[y].g = (Uint8) rand();
+                src->format->palette->colors[y].b = (Uint8) rand();
+            }
+        }
+
+        SDL_snprintf(label, sizeof (label), "%s -> %s",
+                     SDL_GetPixelFormatName(conversions[i].src_format) + 16,
+                     SDL_GetPixelFormatName(conversions[i].dst_format) + 16);
+        SDL_snprintf(line, sizeof (line), "  %-22s", label);
+
+        for (j = 1; j <= max_threads; ++j) {
+            SDL_Surface *dst;
+            double rate = 0.0;
+
+            SDL_snprintf(value, sizeof (value), "%d", j);
+            SDL_SetHint(SDL_HINT_SURFACE_THREADS, value);
+            dst = Convert(src, conversions[i].dst_format, &rate);
+            if (!dst) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't convert surface: %s\n", SDL_GetError());
+                return 1;
+            }
+
+            if (!expected) {
+                expected = dst;
+            } else {
+                for (y = 0; y < height; ++y) {
+                    if (SDL_memcmp((Uint8 *) expected->pixels + y * expected->pitch,
+                                   (Uint8 *) dst->pixels + y * dst->pitch, row_size) != 0) {
+                        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s with %d threads: row %d doesn't match\n",
+                                     SDL_GetPixelFormatName(conversions[i].src_format) + 16, j, y);
+                        ++failures;
+                        break;
+                    }
+                }
+                SDL_FreeSurface(dst);
+            }
+            SDL_snprintf(line + SDL_strlen(line), sizeof (line) - SDL_strlen(line), " %8.1f", rate);
+        }
+        SDL_Log("%s\n", line);
+
+        SDL_FreeSurface(expected);
+        SDL_FreeSurface(src);
+    }
+
+    SDL_Quit();
+    return failures ? 1 : 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,127 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of SDL_PushEvent() throughput with several producer threads,
+   comparing the locked event queue with the lock-free ring enabled by
+   SDL_HINT_EVENT_QUEUE_LOCKFREE.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define DEFAULT_MAX_THREADS         4
+#define DEFAULT_EVENTS_PER_THREAD   250000
+#define MAX_THREADS                 64
+
+static int events_per_thread = DEFAULT_EVENTS_PER_THREAD;
+static SDL_atomic_t go;
+
+static int SDLCALL
+Producer(void *data)
+{
+    SDL_Event event;
+    int i;
+
+    SDL_zero(event);
+    event.type = SDL_USEREVENT;
+    event.user.code = (int)(uintptr_t)data;
+
+    while (!SDL_AtomicGet(&go)) {
+        SDL_Delay(0);
+    }
+
+    for (i = 0; i < events_per_thread; ++i) {
+        event.user.data1 = (void *)(uintptr_t)i;
+        while (SDL_PushEvent(&event) < 0) {
+            /* The queue is full, give the consumer a chance to catch up */
+            SDL_Delay(0);
+        }
+    }
+    return 0;
+}
+
+static double
+RunBenchmark(int num_threads)
+{
+    SDL_Thread *threads[MAX_THREADS];
+    SDL_Event events[128];
+    int expected = num_threads * events_per_thread;
+    int received = 0;
+    Uint64 start, now;
+    int i, n;
+
+    SDL_AtomicSet(&go, 0);
+    for (i = 0; i < num_threads; ++i) {
+        threads[i] = SDL_CreateThread(Producer, "Producer", (void *)(uintptr_t)i);
+    }
+
+    start = SDL_GetPerformanceCounter();
+    SDL_AtomicSet(&go, 1);
+
+    while (received < expected) {
+        n = SDL_PeepEvents(events, SDL_arraysize(events), SDL_GETEVENT, SDL_USEREVENT, SDL_USEREVENT);
+        if (n < 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_PeepEvents() failed: %s\n", SDL_GetError());
+            break;
+        }
+        received += n;
+    }
+    now = SDL_GetPerformanceCounter();
+
+    for (i = 0; i < num_threads; ++i) {
+        SDL_WaitThread(threads[i], NULL);
+    }
+
+    return (double)received * SDL_GetPerformanceFrequency() / (double)(now - start);
+}
+
+int
+main(int argc, char *argv[])
+{
+    static const char *modes[] = { "0", "1" };
+    int max_threads = DEFAULT_MAX_THREADS;
+    int mode, num_threads;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        max_threads = SDL_atoi(argv[1]);
+    }
+    if (argc > 2) {
+        events_per_thread = SDL_atoi(argv[2]);
+    }
+    if (max_threads < 1 || max_threads > MAX_THREADS || events_per_thread < 1) {
+        SDL_Log("USAGE: %s [max_threads (1-%d)] [events_per_thread]\n", argv[0], MAX_THREADS);
+        return 1;
+    }
+
+    for (mode = 0; mode < SDL_arraysize(modes); ++mode) {
+        SDL_SetHint(SDL_HINT_EVENT_QUEUE_LOCKFREE, modes[mode]);
+        if (SDL_Init(SDL_INIT_EVENTS) < 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+            return 1;
+        }
+
+        SDL_Log("Event queue: %s\n", SDL_GetHintBoolean(SDL_HINT_EVENT_QUEUE_LOCKFREE, SDL_FALSE) ? "lock-free ring" : "locked list");
+        for (num_threads = 1; num_threads <= max_threads; ++num_threads) {
+            SDL_Log("  %2d producer(s): %12.0f pushes/sec\n", num_threads, RunBenchmark(num_threads));
+        }
+
+        SDL_Quit();
+    }
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
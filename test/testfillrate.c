@@ -0,0 +1,207 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of SDL_FillRect() and SDL_FillRects() for each pixel size,
+   clearing whole surfaces and filling lots of small rects, with and
+   without SDL_HINT_SURFACE_THREADS, and checking that exactly the right
+   pixels get filled.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define DEFAULT_WIDTH       3840
+#define DEFAULT_HEIGHT      2160
+#define DEFAULT_ITERATIONS  20
+
+#define NUM_SMALL_RECTS     1000
+
+static const Uint32 formats[] = {
+    SDL_PIXELFORMAT_INDEX8,
+    SDL_PIXELFORMAT_RGB565,
+    SDL_PIXELFORMAT_RGB24,
+    SDL_PIXELFORMAT_ARGB8888
+};
+
+static int width = DEFAULT_WIDTH;
+static int height = DEFAULT_HEIGHT;
+static int iterations = DEFAULT_ITERATIONS;
+
+static void
+PutPixel(Uint8 *p, int bpp, Uint32 color)
+{
+    switch (bpp) {
+    case 1:
+        *p = (Uint8) color;
+        break;
+    case 2:
+        *(Uint16 *) p = (Uint16) color;
+        break;
+    case 3:
+#if SDL_BYTEORDER == SDL_LIL_ENDIAN
+        p[0] = (Uint8) color;
+        p[1] = (Uint8) (color >> 8);
+        p[2] = (Uint8) (color >> 16);
+#else
+        p[0] = (Uint8) (color >> 16);
+        p[1] = (Uint8) (color >> 8);
+        p[2] = (Uint8) color;
+#endif
+        break;
+    default:
+        *(Uint32 *) p = color;
+        break;
+    }
+}
+
+/* Returns 1 if SDL_FillRects() didn't do the same as filling one pixel at a time */
+static int
+CheckFill(SDL_Surface *surface, SDL_Surface *expected, const SDL_Rect *rects, int count, Uint32 color)
+{
+    const int bpp = surface->format->BytesPerPixel;
+    SDL_Rect rect;
+    int i, x, y;
+
+    SDL_memset(surface->pixels, 0x5A, surface->h * surface->pitch);
+    SDL_memset(expected->pixels, 0x5A, expected->h * expected->pitch);
+
+    SDL_FillRects(surface, rects, count, color);
+    for (i = 0; i < count; ++i) {
+        if (!SDL_IntersectRect(&rects[i], &expected->clip_rect, &rect)) {
+            continue;
+        }
+        for (y = rect.y; y < rect.y + rect.h; ++y) {
+            Uint8 *p = (Uint8 *) expected->pixels + y * expected->pitch + rect.x * bpp;
+            for (x = 0; x < rect.w; ++x, p += bpp) {
+                PutPixel(p, bpp, color);
+            }
+        }
+    }
+
+    for (y = 0; y < surface->h; ++y) {
+        if (SDL_memcmp((Uint8 *) surface->pixels + y * surface->pitch,
+                       (Uint8 *) expected->pixels + y * expected->pitch, surface->w * bpp) != 0) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s: filling %d rects, row %d doesn't match\n",
+                         SDL_GetPixelFormatName(surface->format->format) + 16, count, y);
+            return 1;
+        }
+    }
+    return 0;
+}
+
+/* Returns bytes filled per second */
+static double
+Benchmark(SDL_Surface *surface, const SDL_Rect *rects, int count)
+{
+    const int bpp = surface->format->BytesPerPixel;
+    double bytes = 0.0;
+    Uint64 start, now;
+    int i;
+
+    for (i = 0; i < count; ++i) {
+        SDL_Rect rect;
+        if (SDL_IntersectRect(&rects[i], &surface->clip_rect, &rect)) {
+            bytes += (double) rect.w * rect.h * bpp;
+        }
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        SDL_FillRects(surface, rects, count, (Uint32) i);
+    }
+    now = SDL_GetPerformanceCounter();
+
+    return (bytes * iterations * SDL_GetPerformanceFrequency()) / (double) (now - start);
+}
+
+int
+main(int argc, char *argv[])
+{
+    SDL_Rect full, small[NUM_SMALL_RECTS], odd[3];
+    char threads[16];
+    int i, num_threads, failures = 0;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 2) {
+        width = SDL_atoi(argv[1]);
+        height = SDL_atoi(argv[2]);
+    }
+    if (argc > 3) {
+        iterations = SDL_atoi(argv[3]);
+    }
+    if (width < 64 || height < 64 || iterations < 1) {
+        SDL_Log("USAGE: %s [width height] [iterations]\n", argv[0]);
+        return 1;
+    }
+
+    full.x = full.y = 0;
+    full.w = width;
+    full.h = height;
+
+    srand(0);
+    for (i = 0; i < NUM_SMALL_RECTS; ++i) {
+        small[i].x = rand() % width - 16;
+        small[i].y = rand() % height - 16;
+        small[i].w = 1 + rand() % 64;
+        small[i].h = 1 + rand() % 64;
+    }
+
+    /* Edges that don't line up with anything */
+    odd[0].x = 1; odd[0].y = 3; odd[0].w = width - 3; odd[0].h = height / 2;
+    odd[1].x = 7; odd[1].y = height / 3; odd[1].w = 61; odd[1].h = height / 2;
+    odd[2].x = width / 2 + 5; odd[2].y = 1; odd[2].w = width / 3 - 1; odd[2].h = height - 2;
+
+    num_threads = SDL_max(SDL_GetCPUCount(), 2);
+    SDL_snprintf(threads, sizeof (threads), "%d", num_threads);
+
+    SDL_Log("Filling %dx%d surfaces %d times (GB/sec written)\n", width, height, iterations);
+    SDL_Log("  %-8s %10s %10s %10s %10s\n", "format", "clear", "small", "clear", "small");
+    SDL_Log("  %-8s %21s %21s\n", "", "1 thread", (num_threads > 1) ? "threads" : "");
+
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        SDL_Surface *surface = SDL_CreateRGBSurfaceWithFormat(0, width, height, 0, formats[i]);
+        SDL_Surface *expected = SDL_CreateRGBSurfaceWithFormat(0, width, height, 0, formats[i]);
+        double rate[4];
+
+        if (!surface || !expected) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create surface: %s\n", SDL_GetError());
+            return 1;
+        }
+
+        SDL_SetHint(SDL_HINT_SURFACE_THREADS, "1");
+        failures += CheckFill(surface, expected, small, SDL_arraysize(small), 0x12345678);
+        failures += CheckFill(surface, expected, odd, SDL_arraysize(odd), 0x9ABCDEF0);
+        rate[0] = Benchmark(surface, &full, 1);
+        rate[1] = Benchmark(surface, small, SDL_arraysize(small));
+
+        SDL_SetHint(SDL_HINT_SURFACE_THREADS, threads);
+        failures += CheckFill(surface, expected, &full, 1, 0x0FEDCBA9);
+        failures += CheckFill(surface, expected, odd, SDL_arraysize(odd), 0x87654321);
+        rate[2] = Benchmark(surface, &full, 1);
+        rate[3] = Benchmark(surface, small, SDL_arraysize(small));
+
+        SDL_Log("  %-8s %10.2f %10.2f %10.2f %10.2f\n", SDL_GetPixelFormatName(formats[i]) + 16,
+                rate[0] / 1e9, rate[1] / 1e9, rate[2] / 1e9, rate[3] / 1e9);
+
+        SDL_FreeSurface(expected);
+        SDL_FreeSurface(surface);
+    }
+
+    SDL_Quit();
+    return failures ? 1 : 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
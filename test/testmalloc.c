@@ -0,0 +1,148 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of SDL_malloc() and SDL_free() from 1 up to N threads at once,
+   each keeping a set of small blocks and replacing them at random, checking
+   that SDL_GetNumAllocations() comes back to where it started when SDL is
+   built with SDL_MALLOC_STATS.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define DEFAULT_OPERATIONS  2000000
+#define NUM_SLOTS           1024
+#define MAX_BLOCK_SIZE      512
+
+typedef struct
+{
+    SDL_Thread *thread;
+    Uint32 seed;
+    int failures;
+} Worker;
+
+static int operations = DEFAULT_OPERATIONS;
+
+static Uint32
+NextRandom(Uint32 *seed)
+{
+    *seed = *seed * 1103515245 + 12345;
+    return *seed >> 8;
+}
+
+static int SDLCALL
+Churn(void *data)
+{
+    Worker *worker = (Worker *) data;
+    Uint8 *slots[NUM_SLOTS];
+    int i;
+
+    SDL_zero(slots);
+    for (i = 0; i < operations; ++i) {
+        const Uint32 slot = NextRandom(&worker->seed) % NUM_SLOTS;
+
+        if (slots[slot]) {
+            if (slots[slot][0] != (Uint8) slot) {
+                ++worker->failures;
+            }
+            SDL_free(slots[slot]);
+            slots[slot] = NULL;
+        } else {
+            const size_t size = 1 + NextRandom(&worker->seed) % MAX_BLOCK_SIZE;
+
+            slots[slot] = (Uint8 *) SDL_malloc(size);
+            if (!slots[slot]) {
+                ++worker->failures;
+                continue;
+            }
+            slots[slot][0] = (Uint8) slot;
+        }
+    }
+    for (i = 0; i < NUM_SLOTS; ++i) {
+        SDL_free(slots[i]);
+    }
+    return 0;
+}
+
+int
+main(int argc, char *argv[])
+{
+    Worker *workers;
+    Uint64 start;
+    double rate;
+    int i, j, allocations, max_threads, failures = 0;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    max_threads = SDL_max(SDL_GetCPUCount(), 4);
+    if (argc > 1) {
+        operations = SDL_atoi(argv[1]);
+    }
+    if (argc > 2) {
+        max_threads = SDL_atoi(argv[2]);
+    }
+    if (operations < 1 || max_threads < 1) {
+        SDL_Log("USAGE: %s [operations] [max_threads]\n", argv[0]);
+        return 1;
+    }
+
+    workers = (Worker *) SDL_calloc(max_threads, sizeof (Worker));
+    if (!workers) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+        return 1;
+    }
+
+    SDL_Log("%d allocations or frees per thread on 1 to %d threads (Mops/sec in total)\n",
+            operations, max_threads);
+    for (i = 1; i <= max_threads; ++i) {
+        allocations = SDL_GetNumAllocations();
+        start = SDL_GetPerformanceCounter();
+        for (j = 0; j < i; ++j) {
+            workers[j].seed = (Uint32) j + 1;
+            workers[j].failures = 0;
+            workers[j].thread = SDL_CreateThread(Churn, "Churn", &workers[j]);
+            if (!workers[j].thread) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create thread: %s\n", SDL_GetError());
+                return 1;
+            }
+        }
+        for (j = 0; j < i; ++j) {
+            SDL_WaitThread(workers[j].thread, NULL);
+            failures += workers[j].failures;
+        }
+        rate = (double) operations * i * SDL_GetPerformanceFrequency() / (double) (SDL_GetPerformanceCounter() - start);
+
+        if (SDL_GetNumAllocations() != allocations) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%d threads: %d blocks allocated, expected %d\n",
+                         i, SDL_GetNumAllocations(), allocations);
+            ++failures;
+        }
+        SDL_Log("  %2d threads: %8.1f\n", i, rate / 1e6);
+    }
+    SDL_free(workers);
+
+    if (SDL_GetNumAllocatedBytes() >= 0) {
+        SDL_Log("%d blocks, %d bytes still allocated\n",
+                SDL_GetNumAllocations(), (int) SDL_GetNumAllocatedBytes());
+    }
+    if (failures) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%d failures\n", failures);
+    }
+
+    SDL_Quit();
+    return failures ? 1 : 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,137 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of scheduling and canceling a large number of timers, reporting
+   how late the remaining timers fire.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define DEFAULT_NUM_TIMERS  100000
+#define MAX_INTERVAL        1000
+
+typedef struct
+{
+    SDL_TimerID id;
+    Uint64 expected;
+} TimerInfo;
+
+static SDL_atomic_t fired;
+
+/* These are only touched by the timer thread until all timers have fired */
+static double total_lateness;
+static double max_lateness;
+
+static Uint32 SDLCALL
+callback(Uint32 interval, void *param)
+{
+    TimerInfo *info = (TimerInfo *) param;
+    Uint64 now = SDL_GetPerformanceCounter();
+    double lateness = 0.0;
+
+    if (now > info->expected) {
+        lateness = (double)((now - info->expected) * 1000) / SDL_GetPerformanceFrequency();
+    }
+    total_lateness += lateness;
+    if (lateness > max_lateness) {
+        max_lateness = lateness;
+    }
+    SDL_AtomicIncRef(&fired);
+    return 0;
+}
+
+static double
+elapsed_ms(Uint64 start)
+{
+    return (double)((SDL_GetPerformanceCounter() - start) * 1000) / SDL_GetPerformanceFrequency();
+}
+
+int
+main(int argc, char *argv[])
+{
+    TimerInfo *timers;
+    int num_timers = DEFAULT_NUM_TIMERS;
+    int i, canceled = 0, remaining;
+    Uint64 freq, start;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argv[1]) {
+        num_timers = atoi(argv[1]);
+    }
+    if (num_timers <= 0) {
+        SDL_Log("USAGE: %s [num_timers]\n", argv[0]);
+        return (1);
+    }
+
+    if (SDL_Init(SDL_INIT_TIMER) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't initialize SDL: %s\n", SDL_GetError());
+        return (1);
+    }
+
+    timers = (TimerInfo *) SDL_calloc(num_timers, sizeof(*timers));
+    if (!timers) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory\n");
+        SDL_Quit();
+        return (1);
+    }
+
+    freq = SDL_GetPerformanceFrequency();
+    srand(0);
+
+    /* Schedule all the timers with random intervals */
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_timers; ++i) {
+        Uint32 interval = 1 + (rand() % MAX_INTERVAL);
+        timers[i].expected = SDL_GetPerformanceCounter() + (interval * freq) / 1000;
+        timers[i].id = SDL_AddTimer(interval, callback, &timers[i]);
+        if (!timers[i].id) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Could not create timer %d: %s\n", i, SDL_GetError());
+            SDL_Quit();
+            return (1);
+        }
+    }
+    SDL_Log("Scheduled %d timers in %f ms\n", num_timers, elapsed_ms(start));
+
+    /* Cancel every other timer, most of which won't have fired yet */
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_timers; i += 2) {
+        if (SDL_RemoveTimer(timers[i].id)) {
+            ++canceled;
+        }
+    }
+    SDL_Log("Canceled %d timers in %f ms\n", canceled, elapsed_ms(start));
+
+    /* Wait for the rest of them */
+    remaining = num_timers - canceled;
+    start = SDL_GetPerformanceCounter();
+    while (SDL_AtomicGet(&fired) < remaining && elapsed_ms(start) < 10 * MAX_INTERVAL) {
+        SDL_Delay(10);
+    }
+
+    if (SDL_AtomicGet(&fired) < remaining) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Only %d of %d timers fired\n", SDL_AtomicGet(&fired), remaining);
+    } else {
+        SDL_Log("%d timers fired, jitter: average %f ms, maximum %f ms\n",
+                remaining, total_lateness / remaining, max_lateness);
+    }
+
+    SDL_Quit();
+    SDL_free(timers);
+    return (0);
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -0,0 +1,266 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of the software renderer drawing with SDL_HINT_RENDER_SOFTWARE_THREADS,
+   checking that every frame matches what it draws on a single thread.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+#include "SDL_test.h"
+
+#define DEFAULT_FRAMES      50
+#define DEFAULT_THREADS     4
+#define SCREEN_WIDTH        640
+#define SCREEN_HEIGHT       480
+#define SPRITE_SIZE         64
+#define NUM_SPRITES         500
+
+typedef struct
+{
+    SDL_Surface *screen;
+    SDL_Renderer *renderer;
+    SDL_Texture *sprite;        /* Blended, with color and alpha mod */
+    SDL_Texture *keyed;         /* Static and colorkeyed, so it gets RLE encoded */
+    SDL_Texture *target;
+} Scene;
+
+static int num_frames = DEFAULT_FRAMES;
+
+static SDL_Texture *
+CreateSprite(SDL_Renderer *renderer, SDL_bool keyed)
+{
+    SDL_Surface *surface;
+    SDL_Texture *texture;
+    int x, y;
+
+    surface = SDL_CreateRGBSurfaceWithFormat(0, SPRITE_SIZE, SPRITE_SIZE, 32, SDL_PIXELFORMAT_ARGB8888);
+    if (!surface) {
+        return NULL;
+    }
+    for (y = 0; y < SPRITE_SIZE; ++y) {
+        Uint32 *row = (Uint32 *) ((Uint8 *) surface->pixels + y * surface->pitch);
+        for (x = 0; x < SPRITE_SIZE; ++x) {
+            const int dx = x - SPRITE_SIZE / 2, dy = y - SPRITE_SIZE / 2;
+            const int d2 = dx * dx + dy * dy;
+            const int r2 = (SPRITE_SIZE / 2) * (SPRITE_SIZE / 2);
+            const Uint32 alpha = (d2 >= r2) ? 0 : 255 - (255 * d2) / r2;
+            if (keyed) {
+                row[x] = (d2 >= r2) ? 0xFF000000 : 0xFF000000 | ((Uint32) (x * 4) << 8) | (Uint32) (y * 4);
+            } else {
+                row[x] = (alpha << 24) | ((Uint32) (x * 4) << 16) | ((Uint32) (y * 4) << 8) | 0x80;
+            }
+        }
+    }
+    if (keyed) {
+        SDL_SetColorKey(surface, SDL_TRUE, 0xFF000000);
+    }
+    texture = SDL_CreateTextureFromSurface(renderer, surface);
+    SDL_FreeSurface(surface);
+    return texture;
+}
+
+static SDL_bool
+CreateScene(Scene *scene, const char *threads)
+{
+    SDL_zerop(scene);
+    SDL_SetHint(SDL_HINT_RENDER_SOFTWARE_THREADS, threads);
+    scene->screen = SDL_CreateRGBSurfaceWithFormat(0, SCREEN_WIDTH, SCREEN_HEIGHT, 32, SDL_PIXELFORMAT_RGB888);
+    if (!scene->screen) {
+        return SDL_FALSE;
+    }
+    scene->renderer = SDL_CreateSoftwareRenderer(scene->screen);
+    if (!scene->renderer) {
+        return SDL_FALSE;
+    }
+    scene->sprite = CreateSprite(scene->renderer, SDL_FALSE);
+    scene->keyed = CreateSprite(scene->renderer, SDL_TRUE);
+    scene->target = SDL_CreateTexture(scene->renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_TARGET,
+                                      SPRITE_SIZE * 2, SPRITE_SIZE * 2);
+    return (scene->sprite && scene->keyed && scene->target) ? SDL_TRUE : SDL_FALSE;
+}
+
+static void
+DestroyScene(Scene *scene)
+{
+    if (scene->renderer) {
+        SDL_DestroyRenderer(scene->renderer);
+    }
+    if (scene->screen) {
+        SDL_FreeSurface(scene->screen);
+    }
+}
+
+static void
+DrawFrame(Scene *scene, int frame)
+{
+    SDL_Renderer *renderer = scene->renderer;
+    SDL_Rect rect, viewport;
+    SDL_Point points[64];
+    int i;
+
+    srand(frame);
+
+    /* Something to draw into a texture first */
+    SDL_SetRenderTarget(renderer, scene->target);
+    SDL_SetRenderDrawColor(renderer, 0x20, 0x40, 0x60, 0xFF);
+    SDL_RenderClear(renderer);
+    SDL_RenderCopy(renderer, scene->keyed, NULL, NULL);
+    SDL_SetRenderTarget(renderer, NULL);
+
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_NONE);
+    SDL_SetRenderDrawColor(renderer, 0x30, 0x30, 0x30, 0xFF);
+    SDL_RenderClear(renderer);
+
+    /* Translucent rectangles, some of them in a viewport */
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_BLEND);
+    for (i = 0; i < 50; ++i) {
+        if (i == 25) {
+            viewport.x = 50;
+            viewport.y = 40;
+            viewport.w = SCREEN_WIDTH - 100;
+            viewport.h = SCREEN_HEIGHT - 80;
+            SDL_RenderSetViewport(renderer, &viewport);
+        }
+        rect.x = rand() % SCREEN_WIDTH - 50;
+        rect.y = rand() % SCREEN_HEIGHT - 50;
+        rect.w = 20 + rand() % 100;
+        rect.h = 20 + rand() % 100;
+        SDL_SetRenderDrawColor(renderer, rand() % 256, rand() % 256, rand() % 256, rand() % 256);
+        SDL_RenderFillRect(renderer, &rect);
+    }
+    SDL_RenderSetViewport(renderer, NULL);
+
+    /* Sprites, with the color mod changing as they're drawn */
+    for (i = 0; i < NUM_SPRITES; ++i) {
+        rect.w = SPRITE_SIZE / 2 + rand() % SPRITE_SIZE;
+        rect.h = (i & 1) ? rect.w : SPRITE_SIZE;
+        rect.x = rand() % (SCREEN_WIDTH + SPRITE_SIZE) - SPRITE_SIZE;
+        rect.y = rand() % (SCREEN_HEIGHT + SPRITE_SIZE) - SPRITE_SIZE;
+        switch (i % 5) {
+        case 0:
+            SDL_SetTextureColorMod(scene->sprite, rand() % 256, rand() % 256, rand() % 256);
+            SDL_SetTextureAlphaMod(scene->sprite, rand() % 256);
+            SDL_RenderCopy(renderer, scene->sprite, NULL, &rect);
+            break;
+        case 1:
+            SDL_RenderCopy(renderer, scene->keyed, NULL, &rect);
+            break;
+        case 2:
+            SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, (i & 2) ? "linear" : "nearest");
+            SDL_RenderCopyEx(renderer, scene->sprite, NULL, &rect, (double) (rand() % 360), NULL,
+                             (SDL_RendererFlip) (i & 3));
+            break;
+        case 3:
+            SDL_RenderCopyEx(renderer, scene->target, NULL, &rect, (double) (rand() % 360), NULL,
+                             SDL_FLIP_NONE);
+            break;
+        default:
+            rect.w = rect.h = SPRITE_SIZE;
+            SDL_RenderCopy(renderer, scene->keyed, NULL, &rect);
+            break;
+        }
+    }
+
+    /* Points and lines, clipped */
+    rect.x = 100;
+    rect.y = 100;
+    rect.w = SCREEN_WIDTH - 200;
+    rect.h = SCREEN_HEIGHT - 200;
+    SDL_RenderSetClipRect(renderer, &rect);
+    for (i = 0; i < SDL_arraysize(points); ++i) {
+        points[i].x = rand() % SCREEN_WIDTH;
+        points[i].y = rand() % SCREEN_HEIGHT;
+    }
+    SDL_SetRenderDrawColor(renderer, 0xFF, 0xFF, 0x00, 0x80);
+    SDL_RenderDrawPoints(renderer, points, SDL_arraysize(points));
+    SDL_SetRenderDrawBlendMode(renderer, SDL_BLENDMODE_ADD);
+    SDL_RenderDrawLines(renderer, points, 8);
+    SDL_RenderCopy(renderer, scene->sprite, NULL, NULL);
+    SDL_RenderSetClipRect(renderer, NULL);
+
+    SDL_RenderPresent(renderer);
+}
+
+/* Returns frames drawn per second */
+static double
+Benchmark(Scene *scene)
+{
+    Uint64 start, now;
+    int i;
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_frames; ++i) {
+        DrawFrame(scene, i);
+    }
+    now = SDL_GetPerformanceCounter();
+
+    return ((double) num_frames * SDL_GetPerformanceFrequency()) / (double) (now - start);
+}
+
+int
+main(int argc, char *argv[])
+{
+    Scene single, threaded;
+    const char *threads = SDL_getenv(SDL_HINT_RENDER_SOFTWARE_THREADS);
+    double single_rate, threaded_rate;
+    int i, failures = 0;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        num_frames = SDL_atoi(argv[1]);
+    }
+    if (num_frames < 1) {
+        SDL_Log("USAGE: %s [num_frames]\n", argv[0]);
+        return 1;
+    }
+    if (!threads) {
+        static char buf[16];
+        SDL_snprintf(buf, sizeof (buf), "%d", SDL_max(SDL_GetCPUCount(), DEFAULT_THREADS));
+        threads = buf;
+    }
+
+    if (!CreateScene(&single, "1") || !CreateScene(&threaded, threads)) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't set up the renderers: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    /* Every frame has to come out the same either way */
+    for (i = 0; i < 10; ++i) {
+        DrawFrame(&single, i);
+        DrawFrame(&threaded, i);
+        if (SDLTest_CompareSurfaces(threaded.screen, single.screen, 0) != 0) {
+            ++failures;
+        }
+    }
+    if (failures) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%d of 10 frames drawn with threads didn't match\n", failures);
+    }
+
+    SDL_Log("Drawing %d frames of %d sprites into a %dx%d surface\n",
+            num_frames, NUM_SPRITES, SCREEN_WIDTH, SCREEN_HEIGHT);
+    single_rate = Benchmark(&single);
+    threaded_rate = Benchmark(&threaded);
+    SDL_Log("  1 thread:   %8.1f frames/sec\n", single_rate);
+    SDL_Log("  %s threads: %8.1f frames/sec\n", threads, threaded_rate);
+
+    DestroyScene(&threaded);
+    DestroyScene(&single);
+    SDL_Quit();
+    return failures ? 1 : 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
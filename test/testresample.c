@@ -12,6 +12,158 @@
 
 #include "SDL.h"
 
+#define BENCHMARK_SECONDS   4
+#define BENCHMARK_AMPLITUDE 0.5
+
+static const struct
+{
+    int src_rate;
+    int dst_rate;
+} benchmark_rates[] = {
+    { 44100, 48000 },
+    { 48000, 44100 },
+    { 22050, 48000 },
+    { 48000, 96000 },
+    { 96000, 44100 },
+    { 48000, 8000 },
+};
+
+static double
+decibels(double ratio)
+{
+    return 10.0 * SDL_log(ratio > 1e-30 ? ratio : 1e-30) / SDL_log(10.0);
+}
+
+/* Fill (channels) interleaved channels with a sine wave at (freq) Hz */
+static void
+make_tone(float *buf, int frames, int channels, int rate, double freq)
+{
+    int i, c;
+    for (i = 0; i < frames; i++) {
+        const float v = (float) (BENCHMARK_AMPLITUDE * SDL_sin(2.0 * M_PI * freq * i / rate));
+        for (c = 0; c < channels; c++) {
+            buf[i * channels + c] = v;
+        }
+    }
+}
+
+/* Resample a tone, returning the converted buffer and its length in frames */
+static float *
+resample_tone(int channels, int src_rate, int dst_rate, double freq,
+              int *outframes, double *seconds)
+{
+    const int frames = src_rate * BENCHMARK_SECONDS;
+    const int len = frames * channels * sizeof (float);
+    SDL_AudioCVT cvt;
+    float *tone;
+    Uint64 start, elapsed = 0;
+    int runs = 0;
+
+    if (SDL_BuildAudioCVT(&cvt, AUDIO_F32SYS, channels, src_rate,
+                          AUDIO_F32SYS, channels, dst_rate) < 0) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "failed to build CVT: %s\n", SDL_GetError());
+        return NULL;
+    }
+
+    tone = (float *) SDL_malloc(len);
+    cvt.len = len;
+    cvt.buf = (Uint8 *) SDL_malloc(len * cvt.len_mult);
+    if (tone == NULL || cvt.buf == NULL) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory.\n");
+        SDL_free(tone);
+        SDL_free(cvt.buf);
+        return NULL;
+    }
+    make_tone(tone, frames, channels, src_rate, freq);
+
+    /* Keep converting for at least half a second to get a stable number */
+    do {
+        SDL_memcpy(cvt.buf, tone, len);
+        start = SDL_GetPerformanceCounter();
+        SDL_ConvertAudio(&cvt);
+        elapsed += SDL_GetPerformanceCounter() - start;
+        runs++;
+    } while (elapsed < SDL_GetPerformanceFrequency() / 2);
+
+    SDL_free(tone);
+    *outframes = cvt.len_cvt / (channels * sizeof (float));
+    *seconds = (double) elapsed / SDL_GetPerformanceFrequency() / runs;
+    return (float *) cvt.buf;
+}
+
+/* Power of the first channel, skipping the filter's ramp at either end */
+static double
+tone_power(const float *buf, int frames, int channels, int rate, double freq, double *noise)
+{
+    const int skip = frames / 10;
+    double signal = 0.0;
+    int i;
+
+    *noise = 0.0;
+    for (i = skip; i < frames - skip; i++) {
+        const double actual = buf[i * channels];
+        const double ideal = BENCHMARK_AMPLITUDE * SDL_sin(2.0 * M_PI * freq * i / rate);
+        signal += ideal * ideal;
+        *noise += (actual - ideal) * (actual - ideal);
+    }
+    return signal;
+}
+
+static int
+benchmark(void)
+{
+    int i, channels;
+
+    SDL_Log("%-14s %4s %14s %9s %10s\n", "conversion", "chan", "frames/sec", "1kHz SNR", "rejection");
+
+    for (i = 0; i < SDL_arraysize(benchmark_rates); i++) {
+        const int src_rate = benchmark_rates[i].src_rate;
+        const int dst_rate = benchmark_rates[i].dst_rate;
+
+        for (channels = 1; channels <= 2; channels++) {
+            double seconds, signal, noise, snr;
+            char rejection[32] = "n/a";
+            int frames;
+            float *out;
+
+            /* Quality: a 1 kHz tone should come out as the same tone */
+            out = resample_tone(channels, src_rate, dst_rate, 1000.0, &frames, &seconds);
+            if (out == NULL) {
+                return 4;
+            }
+            signal = tone_power(out, frames, channels, dst_rate, 1000.0, &noise);
+            snr = decibels(signal / (noise > 0.0 ? noise : 1e-30));
+            SDL_free(out);
+
+            /* Aliasing: a tone above the new Nyquist should disappear */
+            if (dst_rate < src_rate) {
+                const double freq = (src_rate + dst_rate) / 4.0;
+                double power = 0.0;
+                int j;
+
+                out = resample_tone(channels, src_rate, dst_rate, freq, &frames, &seconds);
+                if (out == NULL) {
+                    return 4;
+                }
+                for (j = frames / 10; j < frames - frames / 10; j++) {
+                    power += (double) out[j * channels] * out[j * channels];
+                }
+                power /= frames - 2 * (frames / 10);
+                SDL_free(out);
+
+                /* the input tone's power is A^2/2 */
+                SDL_snprintf(rejection, sizeof (rejection), "%.1f dB",
+                             decibels((BENCHMARK_AMPLITUDE * BENCHMARK_AMPLITUDE / 2.0) / (power > 0.0 ? power : 1e-30)));
+            }
+
+            SDL_Log("%6d->%-6d %4d %14.0f %6.1f dB %10s\n", src_rate, dst_rate, channels,
+                    (src_rate * BENCHMARK_SECONDS) / seconds, snr, rejection);
+        }
+    }
+
+    return 0;
+}
+
 int
 main(int argc, char **argv)
 {
@@ -28,8 +180,20 @@ main(int argc, char **argv)
     /* Enable standard application logging */
     SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
 
+    if ((argc == 2) && (SDL_strcmp(argv[1], "--benchmark") == 0)) {
+        int retval;
+        if (SDL_Init(0) == -1) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "SDL_Init() failed: %s\n", SDL_GetError());
+            return 2;
+        }
+        retval = benchmark();
+        SDL_Quit();
+        return retval;
+    }
+
     if (argc != 4) {
         SDL_Log("USAGE: %s in.wav out.wav newfreq\n", argv[0]);
+        SDL_Log("       %s --benchmark\n", argv[0]);
         return 1;
     }
 
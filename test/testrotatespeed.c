@@ -0,0 +1,142 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of SDL_RenderCopyEx() on the software renderer, drawing scaled
+   and rotated sprites into an offscreen surface and comparing them with
+   plain SDL_RenderCopy() calls.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define DEFAULT_SPRITES     20000
+#define SCREEN_WIDTH        640
+#define SCREEN_HEIGHT       480
+#define SPRITE_SIZE         64
+
+typedef struct
+{
+    const char *name;
+    SDL_BlendMode blend;
+    const char *quality;
+    SDL_bool rotate;
+} CopyMode;
+
+static const CopyMode modes[] = {
+    { "RenderCopy,   none,  nearest", SDL_BLENDMODE_NONE, "nearest", SDL_FALSE },
+    { "RenderCopy,   blend, nearest", SDL_BLENDMODE_BLEND, "nearest", SDL_FALSE },
+    { "RenderCopyEx, none,  nearest", SDL_BLENDMODE_NONE, "nearest", SDL_TRUE },
+    { "RenderCopyEx, blend, nearest", SDL_BLENDMODE_BLEND, "nearest", SDL_TRUE },
+    { "RenderCopyEx, none,  linear ", SDL_BLENDMODE_NONE, "linear", SDL_TRUE },
+    { "RenderCopyEx, blend, linear ", SDL_BLENDMODE_BLEND, "linear", SDL_TRUE },
+};
+
+static int num_sprites = DEFAULT_SPRITES;
+
+static SDL_Texture *
+CreateSprite(SDL_Renderer *renderer)
+{
+    SDL_Texture *texture;
+    Uint32 pixels[SPRITE_SIZE * SPRITE_SIZE];
+    int x, y;
+
+    /* A disc with a soft edge, so blending has something to do */
+    for (y = 0; y < SPRITE_SIZE; ++y) {
+        for (x = 0; x < SPRITE_SIZE; ++x) {
+            const int dx = x - SPRITE_SIZE / 2, dy = y - SPRITE_SIZE / 2;
+            const int d2 = dx * dx + dy * dy;
+            const int r2 = (SPRITE_SIZE / 2) * (SPRITE_SIZE / 2);
+            const Uint32 alpha = (d2 >= r2) ? 0 : 255 - (255 * d2) / r2;
+            pixels[y * SPRITE_SIZE + x] = (alpha << 24) | ((Uint32) (x * 4) << 16) | ((Uint32) (y * 4) << 8) | 0x80;
+        }
+    }
+
+    texture = SDL_CreateTexture(renderer, SDL_PIXELFORMAT_ARGB8888, SDL_TEXTUREACCESS_STATIC, SPRITE_SIZE, SPRITE_SIZE);
+    if (texture) {
+        SDL_UpdateTexture(texture, NULL, pixels, SPRITE_SIZE * sizeof (Uint32));
+    }
+    return texture;
+}
+
+/* Returns sprites drawn per second */
+static double
+Benchmark(SDL_Renderer *renderer, SDL_Texture *sprite, const CopyMode *mode)
+{
+    Uint64 start, now;
+    int i;
+
+    SDL_SetHint(SDL_HINT_RENDER_SCALE_QUALITY, mode->quality);
+    SDL_SetTextureBlendMode(sprite, mode->blend);
+
+    srand(0);
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_sprites; ++i) {
+        SDL_Rect dst;
+        dst.w = SPRITE_SIZE / 2 + rand() % SPRITE_SIZE;
+        dst.h = SPRITE_SIZE / 2 + rand() % SPRITE_SIZE;
+        dst.x = rand() % (SCREEN_WIDTH - dst.w);
+        dst.y = rand() % (SCREEN_HEIGHT - dst.h);
+        if (mode->rotate) {
+            SDL_RenderCopyEx(renderer, sprite, NULL, &dst, (double) (rand() % 360), NULL,
+                             (SDL_RendererFlip) (i & 3));
+        } else {
+            SDL_RenderCopy(renderer, sprite, NULL, &dst);
+        }
+    }
+    now = SDL_GetPerformanceCounter();
+
+    return ((double) num_sprites * SDL_GetPerformanceFrequency()) / (double) (now - start);
+}
+
+int
+main(int argc, char *argv[])
+{
+    SDL_Surface *screen;
+    SDL_Renderer *renderer;
+    SDL_Texture *sprite;
+    int i;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        num_sprites = SDL_atoi(argv[1]);
+    }
+    if (num_sprites < 1) {
+        SDL_Log("USAGE: %s [num_sprites]\n", argv[0]);
+        return 1;
+    }
+
+    screen = SDL_CreateRGBSurfaceWithFormat(0, SCREEN_WIDTH, SCREEN_HEIGHT, 32, SDL_PIXELFORMAT_RGB888);
+    renderer = screen ? SDL_CreateSoftwareRenderer(screen) : NULL;
+    sprite = renderer ? CreateSprite(renderer) : NULL;
+    if (!sprite) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't set up the renderer: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    SDL_Log("Drawing %d sprites of about %dx%d pixels into a %dx%d surface\n",
+            num_sprites, SPRITE_SIZE, SPRITE_SIZE, SCREEN_WIDTH, SCREEN_HEIGHT);
+    for (i = 0; i < SDL_arraysize(modes); ++i) {
+        SDL_Log("  %s: %10.0f sprites/sec\n", modes[i].name, Benchmark(renderer, sprite, &modes[i]));
+    }
+
+    SDL_DestroyTexture(sprite);
+    SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(screen);
+    SDL_Quit();
+    return 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
@@ -35,6 +35,7 @@ static int current_alpha = 0;
 static int current_color = 0;
 static SDL_Rect *positions;
 static SDL_Rect *velocities;
+static SDL_Sprite *batch;
 static int sprite_w, sprite_h;
 static SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND;
 
@@ -42,6 +43,10 @@ static SDL_BlendMode blendMode = SDL_BLENDMODE_BLEND;
 /* -1: infinite random moves (default); >=0: enables N deterministic moves */
 static int iterations = -1;
 
+/* Number of frames to draw before quitting - used for benchmarks. */
+/* 0: run until the window is closed (default) */
+static int max_frames = 0;
+
 int done;
 
 /* Call this instead of exit(), so we can clean up SDL: atexit() is evil. */
@@ -51,6 +56,7 @@ quit(int rc)
     SDL_free(sprites);
     SDL_free(positions);
     SDL_free(velocities);
+    SDL_free(batch);
     SDLTest_CommonQuit(state);
     exit(rc);
 }
@@ -225,11 +231,23 @@ MoveSprites(SDL_Renderer * renderer, SDL_Texture * sprite)
     }
 
     /* Draw sprites */
-    for (i = 0; i < num_sprites; ++i) {
-        position = &positions[i];
+    if (batch) {
+        /* All of them in a single call */
+        for (i = 0; i < num_sprites; ++i) {
+            position = &positions[i];
+            batch[i].dstrect.x = (float) position->x;
+            batch[i].dstrect.y = (float) position->y;
+            batch[i].dstrect.w = (float) position->w;
+            batch[i].dstrect.h = (float) position->h;
+        }
+        SDL_RenderCopySprites(renderer, sprite, batch, num_sprites);
+    } else {
+        for (i = 0; i < num_sprites; ++i) {
+            position = &positions[i];
 
-        /* Blit the sprite onto the screen */
-        SDL_RenderCopy(renderer, sprite, NULL, position);
+            /* Blit the sprite onto the screen */
+            SDL_RenderCopy(renderer, sprite, NULL, position);
+        }
     }
 
     /* Update the screen! */
@@ -265,6 +283,7 @@ main(int argc, char *argv[])
     Uint32 then, now, frames;
     Uint64 seed;
     const char *icon = "icon.bmp";
+    SDL_bool use_batch = SDL_FALSE;
 
     /* Initialize parameters */
     num_sprites = NUM_SPRITES;
@@ -303,6 +322,15 @@ main(int argc, char *argv[])
                     if (iterations < -1) iterations = -1;
                     consumed = 2;
                 }
+            } else if (SDL_strcasecmp(argv[i], "--frames") == 0) {
+                if (argv[i + 1]) {
+                    max_frames = SDL_atoi(argv[i + 1]);
+                    if (max_frames < 0) max_frames = 0;
+                    consumed = 2;
+                }
+            } else if (SDL_strcasecmp(argv[i], "--batch") == 0) {
+                use_batch = SDL_TRUE;
+                consumed = 1;
             } else if (SDL_strcasecmp(argv[i], "--cyclecolor") == 0) {
                 cycle_color = SDL_TRUE;
                 consumed = 1;
@@ -318,7 +346,7 @@ main(int argc, char *argv[])
             }
         }
         if (consumed < 0) {
-            SDL_Log("Usage: %s %s [--blend none|blend|add|mod] [--cyclecolor] [--cyclealpha] [--iterations N] [num_sprites] [icon.bmp]\n",
+            SDL_Log("Usage: %s %s [--blend none|blend|add|mod] [--cyclecolor] [--cyclealpha] [--iterations N] [--frames N] [--batch] [num_sprites] [icon.bmp]\n",
                     argv[0], SDLTest_CommonUsage(state));
             quit(1);
         }
@@ -351,6 +379,20 @@ main(int argc, char *argv[])
         SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory!\n");
         quit(2);
     }
+    if (use_batch) {
+        batch = (SDL_Sprite *) SDL_malloc(num_sprites * sizeof(SDL_Sprite));
+        if (!batch) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Out of memory!\n");
+            quit(2);
+        }
+        for (i = 0; i < num_sprites; ++i) {
+            batch[i].srcrect.x = 0;
+            batch[i].srcrect.y = 0;
+            batch[i].srcrect.w = sprite_w;
+            batch[i].srcrect.h = sprite_h;
+            batch[i].color.r = batch[i].color.g = batch[i].color.b = batch[i].color.a = 0xFF;
+        }
+    }
 
     /* Position sprites and set their velocities using the fuzzer */ 
     if (iterations >= 0) {
@@ -385,6 +427,9 @@ main(int argc, char *argv[])
     while (!done) {
         ++frames;
         loop();
+        if (frames == max_frames) {
+            done = 1;
+        }
     }
 #endif
 
@@ -393,6 +438,7 @@ main(int argc, char *argv[])
     if (now > then) {
         double fps = ((double) frames * 1000) / (now - then);
         SDL_Log("%2.2f frames per second\n", fps);
+        SDL_Log("%2.0f sprites per second\n", fps * num_sprites * state->num_windows);
     }
     quit(0);
     return 0;
@@ -0,0 +1,224 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of SDL_SoftStretch() for each pixel size and a few kinds of
+   scale factor, against the stepping loop it used to run when it couldn't
+   generate code, and checking that both pick the same pixels.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define DEFAULT_SIZE        512
+#define DEFAULT_ITERATIONS  50
+
+typedef struct
+{
+    const char *name;
+    int num, den;       /* Destination size is size * num / den */
+} Ratio;
+
+static const Ratio ratios[] = {
+    { "1:1", 1, 1 },
+    { "2x", 2, 1 },
+    { "3x", 3, 1 },
+    { "1/2", 1, 2 },
+    { "3/4", 3, 4 },
+    { "4/3", 4, 3 }
+};
+
+static const Uint32 formats[] = {
+    SDL_PIXELFORMAT_INDEX8,
+    SDL_PIXELFORMAT_RGB565,
+    SDL_PIXELFORMAT_RGB24,
+    SDL_PIXELFORMAT_ARGB8888
+};
+
+static int size = DEFAULT_SIZE;
+static int iterations = DEFAULT_ITERATIONS;
+
+/* The row loops SDL_SoftStretch() used before */
+#define DEFINE_OLD_ROW(name, type)                                  \
+static void name(const type *src, int src_w, type *dst, int dst_w)  \
+{                                                                   \
+    int i, pos, inc;                                                \
+    type pixel = 0;                                                 \
+                                                                    \
+    pos = 0x10000;                                                  \
+    inc = (src_w << 16) / dst_w;                                    \
+    for (i = dst_w; i > 0; --i) {                                   \
+        while (pos >= 0x10000L) {                                   \
+            pixel = *src++;                                         \
+            pos -= 0x10000L;                                        \
+        }                                                           \
+        *dst++ = pixel;                                             \
+        pos += inc;                                                 \
+    }                                                               \
+}
+DEFINE_OLD_ROW(OldRow1, Uint8)
+DEFINE_OLD_ROW(OldRow2, Uint16)
+DEFINE_OLD_ROW(OldRow4, Uint32)
+
+static void
+OldRow3(const Uint8 *src, int src_w, Uint8 *dst, int dst_w)
+{
+    int i, pos, inc;
+    Uint8 pixel[3] = { 0, 0, 0 };
+
+    pos = 0x10000;
+    inc = (src_w << 16) / dst_w;
+    for (i = dst_w; i > 0; --i) {
+        while (pos >= 0x10000L) {
+            pixel[0] = *src++;
+            pixel[1] = *src++;
+            pixel[2] = *src++;
+            pos -= 0x10000L;
+        }
+        *dst++ = pixel[0];
+        *dst++ = pixel[1];
+        *dst++ = pixel[2];
+        pos += inc;
+    }
+}
+
+static void
+OldStretch(SDL_Surface *src, SDL_Surface *dst)
+{
+    const int bpp = src->format->BytesPerPixel;
+    const Uint8 *srcp = NULL;
+    Uint8 *dstp;
+    int pos, inc, src_row, dst_row;
+
+    pos = 0x10000;
+    inc = (src->h << 16) / dst->h;
+    src_row = 0;
+    for (dst_row = 0; dst_row < dst->h; ++dst_row) {
+        while (pos >= 0x10000L) {
+            srcp = (const Uint8 *) src->pixels + src_row * src->pitch;
+            ++src_row;
+            pos -= 0x10000L;
+        }
+        dstp = (Uint8 *) dst->pixels + dst_row * dst->pitch;
+        switch (bpp) {
+        case 1:
+            OldRow1(srcp, src->w, dstp, dst->w);
+            break;
+        case 2:
+            OldRow2((const Uint16 *) srcp, src->w, (Uint16 *) dstp, dst->w);
+            break;
+        case 3:
+            OldRow3(srcp, src->w, dstp, dst->w);
+            break;
+        default:
+            OldRow4((const Uint32 *) srcp, src->w, (Uint32 *) dstp, dst->w);
+            break;
+        }
+        pos += inc;
+    }
+}
+
+/* Returns destination pixels per second */
+static double
+Benchmark(SDL_Surface *src, SDL_Surface *dst, SDL_bool old)
+{
+    Uint64 start, now;
+    int i;
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < iterations; ++i) {
+        if (old) {
+            OldStretch(src, dst);
+        } else {
+            SDL_SoftStretch(src, NULL, dst, NULL);
+        }
+    }
+    now = SDL_GetPerformanceCounter();
+
+    return ((double) dst->w * dst->h * iterations * SDL_GetPerformanceFrequency()) / (double) (now - start);
+}
+
+int
+main(int argc, char *argv[])
+{
+    int i, r, y, failures = 0;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 1) {
+        size = SDL_atoi(argv[1]);
+    }
+    if (argc > 2) {
+        iterations = SDL_atoi(argv[2]);
+    }
+    if (size < 4 || iterations < 1) {
+        SDL_Log("USAGE: %s [size] [iterations]\n", argv[0]);
+        return 1;
+    }
+
+    SDL_Log("Stretching %dx%d surfaces %d times (Mpixels/sec written)\n", size, size, iterations);
+    SDL_Log("  %-8s %-6s %10s %10s\n", "format", "scale", "old loop", "kernels");
+
+    srand(0);
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        SDL_Surface *src = SDL_CreateRGBSurfaceWithFormat(0, size, size, 0, formats[i]);
+
+        if (!src) {
+            SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create surface: %s\n", SDL_GetError());
+            return 1;
+        }
+        for (y = 0; y < src->h * src->pitch; ++y) {
+            ((Uint8 *) src->pixels)[y] = (Uint8) rand();
+        }
+
+        for (r = 0; r < SDL_arraysize(ratios); ++r) {
+            const int dst_size = size * ratios[r].num / ratios[r].den;
+            SDL_Surface *expected = SDL_CreateRGBSurfaceWithFormat(0, dst_size, dst_size, 0, formats[i]);
+            SDL_Surface *dst = SDL_CreateRGBSurfaceWithFormat(0, dst_size, dst_size, 0, formats[i]);
+            const int row_size = dst_size * src->format->BytesPerPixel;
+            double old_rate, new_rate;
+
+            if (!expected || !dst) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create surface: %s\n", SDL_GetError());
+                return 1;
+            }
+
+            OldStretch(src, expected);
+            SDL_SoftStretch(src, NULL, dst, NULL);
+            for (y = 0; y < dst_size; ++y) {
+                if (SDL_memcmp((Uint8 *) expected->pixels + y * expected->pitch,
+                               (Uint8 *) dst->pixels + y * dst->pitch, row_size) != 0) {
+                    SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "%s %s: row %d doesn't match\n",
+                                 SDL_GetPixelFormatName(formats[i]) + 16, ratios[r].name, y);
+                    ++failures;
+                    break;
+                }
+            }
+
+            old_rate = Benchmark(src, dst, SDL_TRUE);
+            new_rate = Benchmark(src, dst, SDL_FALSE);
+            SDL_Log("  %-8s %-6s %10.1f %10.1f\n", SDL_GetPixelFormatName(formats[i]) + 16,
+                    ratios[r].name, old_rate / 1000000.0, new_rate / 1000000.0);
+
+            SDL_FreeSurface(dst);
+            SDL_FreeSurface(expected);
+        }
+        SDL_FreeSurface(src);
+    }
+
+    SDL_Quit();
+    return failures ? 1 : 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */
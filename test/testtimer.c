@@ -115,6 +115,20 @@ main(int argc, char *argv[])
     now32 = SDL_GetTicks();
     SDL_Log("Delay 1 second = %d ms in ticks, %f ms according to performance counter\n", (now32-start32), (double)((now - start)*1000) / SDL_GetPerformanceFrequency());
 
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < 100; ++i) {
+        SDL_Delay(1);
+    }
+    now = SDL_GetPerformanceCounter();
+    SDL_Log("100 x SDL_Delay(1) averaged %f ms according to performance counter\n", (double)((now - start)*1000) / (100 * SDL_GetPerformanceFrequency()));
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < 100; ++i) {
+        SDL_DelayNS(1000000);
+    }
+    now = SDL_GetPerformanceCounter();
+    SDL_Log("100 x SDL_DelayNS(1000000) averaged %f ms according to performance counter\n", (double)((now - start)*1000) / (100 * SDL_GetPerformanceFrequency()));
+
     SDL_Quit();
     return (0);
 }
@@ -0,0 +1,280 @@
+/*
+  Copyright (C) 1997-2016 Sam Lantinga <slouken@libsdl.org>
+
+  This software is provided 'as-is', without any express or implied
+  warranty.  In no event will the authors be held liable for any damages
+  arising from the use of this software.
+
+  Permission is granted to anyone to use this software for any purpose,
+  including commercial applications, and to alter it and redistribute it
+  freely.
+*/
+
+/* Benchmark of YUV texture conversion in the software renderer, for each
+   YUV format and each value of SDL_HINT_YUV_CONVERSION_MODE.
+*/
+
+#include <stdlib.h>
+#include <stdio.h>
+
+#include "SDL.h"
+
+#define DEFAULT_WIDTH       1920
+#define DEFAULT_HEIGHT      1080
+#define DEFAULT_FRAMES      50
+
+static const Uint32 formats[] = {
+    SDL_PIXELFORMAT_YV12,
+    SDL_PIXELFORMAT_IYUV,
+    SDL_PIXELFORMAT_NV12,
+    SDL_PIXELFORMAT_NV21,
+    SDL_PIXELFORMAT_YUY2,
+    SDL_PIXELFORMAT_UYVY,
+    SDL_PIXELFORMAT_YVYU
+};
+
+static const char *modes[] = { "JPEG", "BT601", "BT709" };
+
+static int width = DEFAULT_WIDTH;
+static int height = DEFAULT_HEIGHT;
+static int num_frames = DEFAULT_FRAMES;
+
+static int
+GetYUVPitch(Uint32 format)
+{
+    switch (format) {
+    case SDL_PIXELFORMAT_YUY2:
+    case SDL_PIXELFORMAT_UYVY:
+    case SDL_PIXELFORMAT_YVYU:
+        return width * 2;
+    default:
+        return width;
+    }
+}
+
+static size_t
+GetYUVSize(Uint32 format)
+{
+    switch (format) {
+    case SDL_PIXELFORMAT_YV12:
+    case SDL_PIXELFORMAT_IYUV:
+        return (size_t) width * height + 2 * ((width / 2) * (height / 2));
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        return (size_t) width * height + (size_t) width * (height / 2);
+    default:
+        return (size_t) width * 2 * height;
+    }
+}
+
+/* Fill a frame with a single color */
+static void
+FillYUV(Uint32 format, Uint8 *pixels, Uint8 y, Uint8 u, Uint8 v)
+{
+    const size_t luma = (size_t) width * height;
+    const size_t size = GetYUVSize(format);
+    size_t i;
+
+    switch (format) {
+    case SDL_PIXELFORMAT_YV12:
+    case SDL_PIXELFORMAT_IYUV:
+        SDL_memset(pixels, y, luma);
+        SDL_memset(pixels + luma, (format == SDL_PIXELFORMAT_YV12) ? v : u, (size - luma) / 2);
+        SDL_memset(pixels + luma + (size - luma) / 2, (format == SDL_PIXELFORMAT_YV12) ? u : v, (size - luma) / 2);
+        break;
+    case SDL_PIXELFORMAT_NV12:
+    case SDL_PIXELFORMAT_NV21:
+        SDL_memset(pixels, y, luma);
+        for (i = luma; i < size; i += 2) {
+            pixels[i] = (format == SDL_PIXELFORMAT_NV12) ? u : v;
+            pixels[i + 1] = (format == SDL_PIXELFORMAT_NV12) ? v : u;
+        }
+        break;
+    default:
+        for (i = 0; i < size; i += 4) {
+            switch (format) {
+            case SDL_PIXELFORMAT_YUY2:
+                pixels[i] = y; pixels[i + 1] = u; pixels[i + 2] = y; pixels[i + 3] = v;
+                break;
+            case SDL_PIXELFORMAT_UYVY:
+                pixels[i] = u; pixels[i + 1] = y; pixels[i + 2] = v; pixels[i + 3] = y;
+                break;
+            default:
+                pixels[i] = y; pixels[i + 1] = v; pixels[i + 2] = y; pixels[i + 3] = u;
+                break;
+            }
+        }
+        break;
+    }
+}
+
+/* What the color should come out as, straight from the matrix coefficients */
+static void
+ReferenceRGB(int mode, Uint8 y, Uint8 u, Uint8 v, int rgb[3])
+{
+    const double kr = (mode == 2) ? 0.2126 : 0.299;
+    const double kb = (mode == 2) ? 0.0722 : 0.114;
+    const double kg = 1.0 - kr - kb;
+    double Y = y, Cb = u - 128.0, Cr = v - 128.0;
+    double c[3];
+    int i;
+
+    if (mode != 0) {
+        Y = (Y - 16.0) * 255.0 / 219.0;
+        Cb *= 255.0 / 224.0;
+        Cr *= 255.0 / 224.0;
+    }
+    c[0] = Y + 2.0 * (1.0 - kr) * Cr;
+    c[1] = Y - 2.0 * (1.0 - kb) * kb / kg * Cb - 2.0 * (1.0 - kr) * kr / kg * Cr;
+    c[2] = Y + 2.0 * (1.0 - kb) * Cb;
+    for (i = 0; i < 3; ++i) {
+        rgb[i] = (int) (SDL_max(0.0, SDL_min(255.0, c[i])) + 0.5);
+    }
+}
+
+/* Returns the number of colors that came out wrong */
+static int
+CheckColors(SDL_Renderer *renderer, SDL_Surface *screen, SDL_Texture *texture,
+            Uint32 format, int mode, Uint8 *pixels)
+{
+    static const Uint8 colors[][3] = {
+        { 128, 128, 128 }, { 16, 128, 128 }, { 235, 128, 128 },
+        { 81, 90, 240 }, { 145, 54, 34 }, { 41, 240, 110 }, { 200, 20, 200 }
+    };
+    int i, c, failures = 0;
+
+    for (i = 0; i < SDL_arraysize(colors); ++i) {
+        int expected[3];
+        Uint8 r, g, b;
+
+        FillYUV(format, pixels, colors[i][0], colors[i][1], colors[i][2]);
+        SDL_UpdateTexture(texture, NULL, pixels, GetYUVPitch(format));
+        SDL_RenderCopy(renderer, texture, NULL, NULL);
+        SDL_RenderPresent(renderer);
+
+        SDL_GetRGB(((Uint32 *) screen->pixels)[(height / 2) * (screen->pitch / 4) + width / 2],
+                   screen->format, &r, &g, &b);
+        ReferenceRGB(mode, colors[i][0], colors[i][1], colors[i][2], expected);
+        for (c = 0; c < 3; ++c) {
+            const int got = (c == 0) ? r : (c == 1) ? g : b;
+            if (SDL_abs(got - expected[c]) > 2) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION,
+                             "%s %s: YUV %d,%d,%d came out as %d,%d,%d, expected %d,%d,%d\n",
+                             SDL_GetPixelFormatName(format) + 16, modes[mode],
+                             colors[i][0], colors[i][1], colors[i][2], r, g, b,
+                             expected[0], expected[1], expected[2]);
+                ++failures;
+                break;
+            }
+        }
+    }
+    return failures;
+}
+
+/* Returns frames converted per second */
+static double
+Benchmark(SDL_Renderer *renderer, SDL_Texture *texture, Uint32 format, Uint8 *pixels)
+{
+    const size_t size = GetYUVSize(format);
+    Uint64 start, now;
+    size_t j;
+    int i;
+
+    for (j = 0; j < size; ++j) {
+        pixels[j] = (Uint8) rand();
+    }
+
+    start = SDL_GetPerformanceCounter();
+    for (i = 0; i < num_frames; ++i) {
+        SDL_UpdateTexture(texture, NULL, pixels, GetYUVPitch(format));
+        SDL_RenderCopy(renderer, texture, NULL, NULL);
+        SDL_RenderPresent(renderer);
+    }
+    now = SDL_GetPerformanceCounter();
+
+    return ((double) num_frames * SDL_GetPerformanceFrequency()) / (double) (now - start);
+}
+
+int
+main(int argc, char *argv[])
+{
+    SDL_Surface *screen;
+    SDL_Renderer *renderer;
+    Uint8 *pixels;
+    char header[128];
+    int i, m, failures = 0;
+
+    /* Enable standard application logging */
+    SDL_LogSetPriority(SDL_LOG_CATEGORY_APPLICATION, SDL_LOG_PRIORITY_INFO);
+
+    if (argc > 2) {
+        width = SDL_atoi(argv[1]);
+        height = SDL_atoi(argv[2]);
+    }
+    if (argc > 3) {
+        num_frames = SDL_atoi(argv[3]);
+    }
+    if (width < 2 || height < 2 || num_frames < 1) {
+        SDL_Log("USAGE: %s [width height] [num_frames]\n", argv[0]);
+        return 1;
+    }
+    /* The chroma planes are subsampled, keep the frame an even size */
+    width &= ~1;
+    height &= ~1;
+
+    screen = SDL_CreateRGBSurfaceWithFormat(0, width, height, 32, SDL_PIXELFORMAT_RGB888);
+    renderer = screen ? SDL_CreateSoftwareRenderer(screen) : NULL;
+    pixels = (Uint8 *) SDL_malloc((size_t) width * height * 2);
+    if (!renderer || !pixels) {
+        SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't set up the renderer: %s\n", SDL_GetError());
+        return 1;
+    }
+
+    SDL_Log("CPU features: SSE2 %s, AVX2 %s, NEON built in %s\n",
+            SDL_HasSSE2() ? "yes" : "no", SDL_HasAVX2() ? "yes" : "no",
+#if defined(__ARM_NEON__) || defined(__ARM_NEON)
+            "yes"
+#else
+            "no"
+#endif
+            );
+    SDL_Log("Converting %d frames of %dx%d YUV to RGB888 (frames/sec)\n", num_frames, width, height);
+
+    SDL_snprintf(header, sizeof (header), "  %-8s", "");
+    for (m = 0; m < SDL_arraysize(modes); ++m) {
+        SDL_snprintf(header + SDL_strlen(header), sizeof (header) - SDL_strlen(header), " %10s", modes[m]);
+    }
+    SDL_Log("%s\n", header);
+
+    srand(0);
+    for (i = 0; i < SDL_arraysize(formats); ++i) {
+        char line[128];
+
+        SDL_snprintf(line, sizeof (line), "  %-8s", SDL_GetPixelFormatName(formats[i]) + 16);
+        for (m = 0; m < SDL_arraysize(modes); ++m) {
+            SDL_Texture *texture;
+
+            /* The conversion mode is picked up when the texture is created */
+            SDL_SetHint(SDL_HINT_YUV_CONVERSION_MODE, modes[m]);
+            texture = SDL_CreateTexture(renderer, formats[i], SDL_TEXTUREACCESS_STREAMING, width, height);
+            if (!texture) {
+                SDL_LogError(SDL_LOG_CATEGORY_APPLICATION, "Couldn't create %s texture: %s\n",
+                             SDL_GetPixelFormatName(formats[i]), SDL_GetError());
+                return 1;
+            }
+            failures += CheckColors(renderer, screen, texture, formats[i], m, pixels);
+            SDL_snprintf(line + SDL_strlen(line), sizeof (line) - SDL_strlen(line), " %10.1f",
+                         Benchmark(renderer, texture, formats[i], pixels));
+            SDL_DestroyTexture(texture);
+        }
+        SDL_Log("%s\n", line);
+    }
+
+    SDL_free(pixels);
+    SDL_DestroyRenderer(renderer);
+    SDL_FreeSurface(screen);
+    SDL_Quit();
+    return failures ? 1 : 0;
+}
+
+/* vi: set ts=4 sw=4 expandtab: */